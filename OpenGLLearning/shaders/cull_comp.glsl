@@ -0,0 +1,187 @@
+#version 410 core
+// GL 4.3 on our 4.1 context, through the extensions GpuCulling::IsSupported() checks.
+#extension GL_ARB_compute_shader : require
+#extension GL_ARB_shader_storage_buffer_object : require
+#extension GL_ARB_shading_language_420pack : require
+layout(local_size_x = 64) in;
+
+// One per draw the CPU registered, see GpuCulling::Add().
+struct CullingInstance {
+	vec4 boundingSphere;	// model space center, radius
+	uint count;
+	uint firstIndex;
+	int baseVertex;
+	uint baseInstance;		// also the object's index in PerObjects
+	uint batch;				// which vertex array and program, i.e. which counter
+	uint batchOffset;		// where the batch's commands start
+	uint firstLod;			// into Lods, none means draw count/firstIndex as is
+	uint lodCount;
+};
+
+// One level of detail, see MeshLod.
+struct CullingLod {
+	uint count;
+	uint firstIndex;
+	float error;			// model space
+	uint pad0;
+};
+
+struct DrawElementsIndirectCommand {
+	uint count;
+	uint instanceCount;
+	uint firstIndex;
+	int baseVertex;
+	uint baseInstance;
+};
+
+layout(std430, binding = 0) readonly buffer Instances {
+	CullingInstance instances[];
+};
+
+// The per-object blocks of this frame, projection * view * model first.
+layout(std430, binding = 1) readonly buffer PerObjects {
+	vec4 perObject[];
+};
+
+layout(std430, binding = 2) writeonly buffer Commands {
+	DrawElementsIndirectCommand commands[];
+};
+
+// Surviving draws per batch, zeroed before every dispatch.
+layout(std430, binding = 3) buffer Counters {
+	uint visibleCount[];
+};
+
+layout(std430, binding = 4) readonly buffer Lods {
+	CullingLod lods[];
+};
+
+uniform uint u_InstanceCount;
+// Distance between per-object blocks, in vec4s.
+uniform uint u_PerObjectStride;
+
+// Max-depth pyramid of the previous frame, level 0 at full resolution.
+uniform bool u_UseOcclusion;
+uniform sampler2D u_DepthPyramid;
+uniform int u_DepthPyramidLevels;
+
+// Pixels of error a level may show; 0 always draws the full mesh.
+uniform float u_LodHalfViewportHeight;
+uniform float u_LodThreshold;
+
+bool IsInsideFrustum(mat4 mvp, vec4 sphere)
+{
+	// The clip planes, in model space (Gribb & Hartmann).
+	vec4 rowX = vec4(mvp[0].x, mvp[1].x, mvp[2].x, mvp[3].x);
+	vec4 rowY = vec4(mvp[0].y, mvp[1].y, mvp[2].y, mvp[3].y);
+	vec4 rowZ = vec4(mvp[0].z, mvp[1].z, mvp[2].z, mvp[3].z);
+	vec4 rowW = vec4(mvp[0].w, mvp[1].w, mvp[2].w, mvp[3].w);
+	vec4 planes[6] = vec4[6](rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowW + rowZ, rowW - rowZ);
+
+	for (int i = 0; i < 6; ++i)
+	{
+		if (dot(planes[i].xyz, sphere.xyz) + planes[i].w < -sphere.w * length(planes[i].xyz))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool IsOccluded(mat4 mvp, vec4 sphere)
+{
+	// Screen rectangle and nearest depth of the sphere's bounding box.
+	vec3 minimum = vec3(1.0);
+	vec3 maximum = vec3(-1.0);
+	for (int i = 0; i < 8; ++i)
+	{
+		vec3 corner = sphere.xyz + sphere.w * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = mvp * vec4(corner, 1.0);
+		if (clip.w <= 0.0)
+		{
+			// Crosses the camera plane, so it can't be behind anything.
+			return false;
+		}
+		vec3 ndc = clip.xyz / clip.w;
+		minimum = min(minimum, ndc);
+		maximum = max(maximum, ndc);
+	}
+
+	vec2 uvMin = clamp(minimum.xy * 0.5 + 0.5, 0.0, 1.0);
+	vec2 uvMax = clamp(maximum.xy * 0.5 + 0.5, 0.0, 1.0);
+	float nearestDepth = minimum.z * 0.5 + 0.5;
+
+	// The level where the rectangle covers at most 2x2 texels.
+	vec2 size = (uvMax - uvMin) * vec2(textureSize(u_DepthPyramid, 0));
+	float level = ceil(log2(max(max(size.x, size.y), 1.0)));
+	level = min(level, float(u_DepthPyramidLevels - 1));
+
+	float farthest = max(
+		max(textureLod(u_DepthPyramid, uvMin, level).r, textureLod(u_DepthPyramid, vec2(uvMax.x, uvMin.y), level).r),
+		max(textureLod(u_DepthPyramid, vec2(uvMin.x, uvMax.y), level).r, textureLod(u_DepthPyramid, uvMax, level).r)
+	);
+	return nearestDepth > farthest;
+}
+
+// The coarsest level whose error covers at most u_LodThreshold pixels at
+// the near side of the sphere, like MeshLod::Select().
+uint SelectLod(mat4 mvp, vec4 sphere, uint firstLod, uint lodCount)
+{
+	vec3 rowY = vec3(mvp[0].y, mvp[1].y, mvp[2].y);
+	vec4 rowW = vec4(mvp[0].w, mvp[1].w, mvp[2].w, mvp[3].w);
+	float distance = dot(rowW.xyz, sphere.xyz) + rowW.w - sphere.w * length(rowW.xyz);
+	if (distance <= 0.0)
+	{
+		return firstLod;
+	}
+	float pixelsPerUnit = length(rowY) / distance * u_LodHalfViewportHeight;
+
+	for (uint i = lodCount - 1u; i > 0u; --i)
+	{
+		if (lods[firstLod + i].error * pixelsPerUnit <= u_LodThreshold)
+		{
+			return firstLod + i;
+		}
+	}
+	return firstLod;
+}
+
+void main()
+{
+	uint index = gl_GlobalInvocationID.x;
+	if (index >= u_InstanceCount)
+	{
+		return;
+	}
+
+	CullingInstance instance = instances[index];
+	uint base = instance.baseInstance * u_PerObjectStride;
+	mat4 mvp = mat4(perObject[base], perObject[base + 1], perObject[base + 2], perObject[base + 3]);
+
+	if (!IsInsideFrustum(mvp, instance.boundingSphere))
+	{
+		return;
+	}
+	if (u_UseOcclusion && IsOccluded(mvp, instance.boundingSphere))
+	{
+		return;
+	}
+
+	uint count = instance.count;
+	uint firstIndex = instance.firstIndex;
+	if (instance.lodCount > 1u)
+	{
+		CullingLod lod = lods[SelectLod(mvp, instance.boundingSphere, instance.firstLod, instance.lodCount)];
+		count = lod.count;
+		firstIndex = lod.firstIndex;
+	}
+
+	uint slot = atomicAdd(visibleCount[instance.batch], 1u);
+	commands[instance.batchOffset + slot] = DrawElementsIndirectCommand(
+		count,
+		1u,
+		firstIndex,
+		instance.baseVertex,
+		instance.baseInstance
+	);
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#version 410 core
+// DeferredShading's lighting pass: lights every pixel of the G-buffer
+// once, with the lights of its cluster. The defines after #version: LIT
+// when there are lights, and SHADOWS with the sun, see MaterialSystem::GetDefines().
+// lighting.glsl comes after them, with frag.glsl's ShadeClustered().
+
+in vec2 v_screen;
+
+// The G-buffer, see DeferredShading.
+uniform sampler2D u_GBufferAlbedoRoughness;
+uniform sampler2D u_GBufferNormal;
+uniform sampler2D u_GBufferDepth;
+
+#ifdef LIT
+// Undoes frag.glsl's EncodeNormal().
+vec3 DecodeNormal(vec2 encoded)
+{
+	encoded = encoded * 2.0f - 1.0f;
+	vec3 normal = vec3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+	float fold = max(-normal.z, 0.0f);
+	normal.xy += vec2(normal.x >= 0.0f ? -fold : fold, normal.y >= 0.0f ? -fold : fold);
+	return normalize(normal);
+}
+#endif
+
+out vec4 color;
+
+void main()
+{
+	ivec2 pixel = ivec2(gl_FragCoord.xy);
+	float depth = texelFetch(u_GBufferDepth, pixel, 0).r;
+	// Nothing was drawn here, keep the clear color.
+	if (depth == 1.0f)
+	{
+		discard;
+	}
+	vec4 albedoRoughness = texelFetch(u_GBufferAlbedoRoughness, pixel, 0);
+	color = vec4(albedoRoughness.rgb, 1.0f);
+#ifdef LIT
+	// No position target: the depth and the inverse projection give it back.
+	vec4 view = u_InverseProjection * vec4(v_screen * 2.0f - 1.0f, depth * 2.0f - 1.0f, 1.0f);
+	vec3 position = view.xyz / view.w;
+	color.rgb = ShadeClustered(position, DecodeNormal(texelFetch(u_GBufferNormal, pixel, 0).rg), albedoRoughness.rgb, albedoRoughness.a);
+#endif
+}
@@ -0,0 +1,39 @@
+#version 410 core
+// GL 4.3 on our 4.1 context, through the extensions GpuCulling::IsSupported() checks.
+#extension GL_ARB_compute_shader : require
+#extension GL_ARB_shader_image_load_store : require
+#extension GL_ARB_shader_image_size : require
+#extension GL_ARB_shading_language_420pack : require
+layout(local_size_x = 8, local_size_y = 8) in;
+
+// One level of the max-depth pyramid, from the level above it (or from
+// the depth buffer itself, for level 0).
+layout(r32f, binding = 0) uniform writeonly image2D u_Destination;
+uniform sampler2D u_Source;
+uniform int u_SourceLevel;
+
+void main()
+{
+	ivec2 destination = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 destinationSize = imageSize(u_Destination);
+	if (any(greaterThanEqual(destination, destinationSize)))
+	{
+		return;
+	}
+
+	// Every source texel this one covers. Odd sizes make that 3 wide at the
+	// edge, and the same size (level 0) makes it 1.
+	ivec2 sourceSize = textureSize(u_Source, u_SourceLevel);
+	ivec2 begin = destination * sourceSize / destinationSize;
+	ivec2 end = max(begin + 1, ((destination + 1) * sourceSize + destinationSize - 1) / destinationSize);
+
+	float depth = 0.0;
+	for (int y = begin.y; y < end.y; ++y)
+	{
+		for (int x = begin.x; x < end.x; ++x)
+		{
+			depth = max(depth, texelFetch(u_Source, ivec2(x, y), u_SourceLevel).r);
+		}
+	}
+	imageStore(u_Destination, destination, vec4(depth));
+}
\ No newline at end of file
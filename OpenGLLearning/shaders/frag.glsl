@@ -1,10 +1,92 @@
 #version 410 core
+// The defines after #version pick the permutation, see MaterialSystem::GetDefines().
+// lighting.glsl comes after them, with the Lighting block and ShadeClustered().
+// DEPTH_ONLY (the shadow maps) leaves everything to the depth test.
 
 in vec3 v_vertexColors;
+in vec2 v_texCoords;
+flat in float v_atlasLayer;
+flat in int v_material;
 
+struct Material {
+	vec4 baseColor;
+	vec4 uvScaleOffset;
+	// x: roughness
+	vec4 surface;
+};
+layout(std140) uniform Materials {
+	Material u_Materials[MAX_MATERIALS];
+};
+
+#if defined(TEXTURE_ARRAY)
+// Texture unit 0: every mesh's texture, packed into the layers of one array.
+uniform sampler2DArray u_Texture;
+#elif defined(TEXTURE)
+// Texture unit 0; a white texel when the scene has no texture.
+uniform sampler2D u_Texture;
+#endif
+
+#ifdef LIT
+// Where this fragment is in view space, from its depth.
+vec3 ViewPosition()
+{
+	vec2 screen = gl_FragCoord.xy / u_ClusterDepth.zw;
+	vec4 view = u_InverseProjection * vec4(screen * 2.0f - 1.0f, gl_FragCoord.z * 2.0f - 1.0f, 1.0f);
+	return view.xyz / view.w;
+}
+
+// Our meshes have no normals, the screen space derivatives of the
+// position stand in for them.
+vec3 DerivativeNormal(vec3 position)
+{
+	vec3 normal = normalize(cross(dFdx(position), dFdy(position)));
+	return (dot(normal, position) > 0.0f) ? -normal : normal;
+}
+
+#ifdef GBUFFER
+// Octahedral: the normal folded onto the xy plane, 0 to 1 for RG16.
+// deferred_frag.glsl's DecodeNormal() undoes it.
+vec2 EncodeNormal(vec3 normal)
+{
+	normal /= abs(normal.x) + abs(normal.y) + abs(normal.z);
+	vec2 folded = normal.xy;
+	if (normal.z < 0.0f)
+	{
+		folded = (1.0f - abs(normal.yx)) * vec2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+	}
+	return folded * 0.5f + 0.5f;
+}
+#endif
+#endif
+
+#ifdef GBUFFER
+// DeferredShading's targets: albedo and roughness, then the view space normal.
+layout(location = 0) out vec4 color;
+layout(location = 1) out vec2 encodedNormal;
+#else
 out vec4 color;
+#endif
 
 void main()
 {
-	color = vec4(v_vertexColors.r, v_vertexColors.g, v_vertexColors.b, 1.0f);
+#ifndef DEPTH_ONLY
+	color = vec4(v_vertexColors.r, v_vertexColors.g, v_vertexColors.b, 1.0f) * u_Materials[v_material].baseColor;
+#if defined(TEXTURE_ARRAY)
+	color *= texture(u_Texture, vec3(v_texCoords, v_atlasLayer));
+#elif defined(TEXTURE)
+	color *= texture(u_Texture, v_texCoords);
+#endif
+#if defined(GBUFFER)
+	color.a = u_Materials[v_material].surface.x;
+#ifdef LIT
+	encodedNormal = EncodeNormal(DerivativeNormal(ViewPosition()));
+#else
+	// Unlit, the lighting pass won't read it.
+	encodedNormal = vec2(0.5f);
+#endif
+#elif defined(LIT)
+	vec3 position = ViewPosition();
+	color.rgb = ShadeClustered(position, DerivativeNormal(position), color.rgb, u_Materials[v_material].surface.x);
+#endif
+#endif
 }
\ No newline at end of file
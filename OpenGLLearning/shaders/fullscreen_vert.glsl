@@ -0,0 +1,11 @@
+#version 410 core
+// One triangle that covers the screen, from gl_VertexID alone: draw 3
+// vertices with any vertex array bound.
+
+out vec2 v_screen;
+
+void main()
+{
+	v_screen = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(v_screen * 2.0f - 1.0f, 0.0f, 1.0f);
+}
@@ -0,0 +1,95 @@
+// Clustered lighting, shared by frag.glsl and deferred_frag.glsl: the
+// program builders put it after their defines, so only with LIT (and
+// SHADOWS) is any of it there, see MaterialSystem::GetDefines().
+
+#ifdef LIT
+// See ClusteredLighting.
+layout(std140) uniform Lighting {
+	mat4 u_InverseProjection;
+	// Clusters along x, y and z, and how many lights there are.
+	vec4 u_ClusterGrid;
+	// A view depth's slice is log(depth) * x + y; the viewport's size in pixels (zw).
+	vec4 u_ClusterDepth;
+	vec4 u_Ambient;
+};
+// Two texels a light: view space position and radius, then color.
+uniform samplerBuffer u_LightData;
+// Per cluster, its first index into u_LightIndices and how many it has.
+uniform usamplerBuffer u_ClusterLights;
+uniform usamplerBuffer u_LightIndices;
+
+#ifdef SHADOWS
+// The sun, shadowed by cascaded shadow maps, see CascadedShadowMaps.
+layout(std140) uniform Shadows {
+	// View space to each cascade's shadow map: uv, then depth.
+	mat4 u_ShadowMatrices[4];
+	// The view depth each cascade reaches.
+	vec4 u_CascadeEnds;
+	// The world size of a texel in each cascade.
+	vec4 u_CascadeTexelSizes;
+	// View space, towards the sun; w is how many cascades there are.
+	vec4 u_SunDirection;
+	vec4 u_SunColor;
+};
+uniform sampler2DArrayShadow u_ShadowMap;
+
+// How much sun reaches 'position', 0 to 1; full sun past the last cascade.
+float SunShadow(vec3 position, vec3 normal)
+{
+	int count = int(u_SunDirection.w);
+	int cascade = 0;
+	while (cascade < count - 1 && -position.z > u_CascadeEnds[cascade])
+	{
+		++cascade;
+	}
+	if (-position.z > u_CascadeEnds[count - 1])
+	{
+		return 1.0f;
+	}
+	// Looked up a little off the surface, against acne; a texel grows with
+	// the cascade, so does the offset.
+	vec4 shadow = u_ShadowMatrices[cascade] * vec4(position + normal * (u_CascadeTexelSizes[cascade] * 1.5f), 1.0f);
+	return texture(u_ShadowMap, vec4(shadow.xy, float(cascade), min(shadow.z, 1.0f)));
+}
+#endif
+
+// Lights a surface with its cluster's lights and the sun. 'position' and
+// 'normal' are in view space.
+vec3 ShadeClustered(vec3 position, vec3 normal, vec3 albedo, float roughness)
+{
+	ivec3 grid = ivec3(u_ClusterGrid.xyz);
+	vec2 screen = gl_FragCoord.xy / u_ClusterDepth.zw;
+	ivec3 cluster = clamp(ivec3(ivec2(screen * u_ClusterGrid.xy), int(log(-position.z) * u_ClusterDepth.x + u_ClusterDepth.y)), ivec3(0), grid - 1);
+	uvec2 range = texelFetch(u_ClusterLights, (cluster.z * grid.y + cluster.y) * grid.x + cluster.x).xy;
+
+	// Blinn-Phong, with the exponent that about matches a GGX lobe of this
+	// roughness, and a dielectric's 4% reflectance.
+	vec3 toEye = normalize(-position);
+	float alpha = max(roughness * roughness, 0.01f);
+	float exponent = 2.0f / (alpha * alpha) - 2.0f;
+	float specularScale = 0.04f * (exponent + 8.0f) / 8.0f;
+
+	vec3 diffuse = u_Ambient.rgb;
+	vec3 specular = vec3(0.0f);
+	for (uint i = 0u; i < range.y; ++i)
+	{
+		int index = int(texelFetch(u_LightIndices, int(range.x + i)).x);
+		vec4 positionRadius = texelFetch(u_LightData, index * 2);
+		vec3 toLight = positionRadius.xyz - position;
+		float distanceSquared = dot(toLight, toLight);
+		vec3 direction = toLight * inversesqrt(max(distanceSquared, 1e-8f));
+		// Smoothly down to nothing at the radius.
+		float falloff = clamp(1.0f - distanceSquared / (positionRadius.w * positionRadius.w), 0.0f, 1.0f);
+		float lambert = max(dot(normal, direction), 0.0f);
+		vec3 radiance = texelFetch(u_LightData, index * 2 + 1).rgb * (falloff * falloff * lambert);
+		diffuse += radiance;
+		specular += radiance * (specularScale * pow(max(dot(normal, normalize(direction + toEye)), 0.0f), exponent));
+	}
+#ifdef SHADOWS
+	vec3 sunRadiance = u_SunColor.rgb * (max(dot(normal, u_SunDirection.xyz), 0.0f) * SunShadow(position, normal));
+	diffuse += sunRadiance;
+	specular += sunRadiance * (specularScale * pow(max(dot(normal, normalize(u_SunDirection.xyz + toEye)), 0.0f), exponent));
+#endif
+	return albedo * diffuse + specular;
+}
+#endif
@@ -0,0 +1,15 @@
+#version 410 core
+// ParticleSystem's billboards, blended additively (GL_ONE, GL_ONE), so
+// the color goes out premultiplied by its alpha.
+in vec2 v_corner;
+in vec4 v_color;
+
+out vec4 color;
+
+void main()
+{
+	// A soft round spot rather than a square.
+	float falloff = max(1.0f - dot(v_corner, v_corner), 0.0f);
+	float alpha = v_color.a * falloff * falloff;
+	color = vec4(v_color.rgb * alpha, alpha);
+}
@@ -0,0 +1,82 @@
+#version 410 core
+// ParticleSystem's step: one particle a vertex, drawn as points with the
+// rasterizer off, and captured into the other buffer by transform
+// feedback. Has to match ParticleSimulation::Simulate(), which is the
+// reference, operation for operation.
+layout(location=0) in vec4 positionAge;
+layout(location=1) in vec4 velocityLifetime;
+
+#define MAX_EMITTERS 8
+
+// One emitter, see ParticleSystem.cpp's EmitterBlock.
+struct Emitter {
+	vec4 positionSize;
+	vec4 velocitySpread;
+	vec4 color;
+	// x: average lifetime, y: how far off it a particle may live
+	vec4 lifetime;
+	// first slot, slot count, this step's emission cursor and count
+	uvec4 slots;
+};
+layout(std140) uniform Particles {
+	mat4 u_View;
+	mat4 u_Projection;
+	// gravity * seconds (xyz), seconds (w)
+	vec4 u_GravitySeconds;
+	// x: how much velocity drag leaves this step
+	vec4 u_Drag;
+	// x: the step's hash, y: the emitter count
+	uvec4 u_Step;
+	Emitter u_Emitters[MAX_EMITTERS];
+};
+
+// Captured, see ParticleSystem::FeedbackVaryings.
+out vec4 tf_positionAge;
+out vec4 tf_velocityLifetime;
+
+// ParticleSimulation::Hash().
+uint Hash(uint x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352du;
+	x ^= x >> 15;
+	x *= 0x846ca68bu;
+	x ^= x >> 16;
+	return x;
+}
+
+void main()
+{
+	uint slot = uint(gl_VertexID);
+	uint emitter = 0u;
+	while (emitter + 1u < u_Step.y && slot >= u_Emitters[emitter].slots.x + u_Emitters[emitter].slots.y)
+	{
+		++emitter;
+	}
+	uvec4 slots = u_Emitters[emitter].slots;
+	uint ring = (slot - slots.x + slots.y - slots.z) % slots.y;
+
+	tf_positionAge = positionAge;
+	tf_velocityLifetime = velocityLifetime;
+	if (ring < slots.w)
+	{
+		uint state = Hash(slot ^ u_Step.x);
+		float random[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			state = Hash(state);
+			random[i] = float(state >> 8) * (1.0f / 16777216.0f);
+		}
+		vec3 jitter = vec3(random[0], random[1], random[2]) * 2.0f - 1.0f;
+		Emitter source = u_Emitters[emitter];
+		tf_positionAge = vec4(source.positionSize.xyz, 0.0f);
+		tf_velocityLifetime = vec4(source.velocitySpread.xyz + jitter * source.velocitySpread.w,
+			source.lifetime.x * (1.0f - source.lifetime.y + 2.0f * source.lifetime.y * random[3]));
+	}
+	else if (positionAge.w < velocityLifetime.w)
+	{
+		vec3 velocity = (velocityLifetime.xyz + u_GravitySeconds.xyz) * u_Drag.x;
+		tf_positionAge = vec4(positionAge.xyz + velocity * u_GravitySeconds.w, positionAge.w + u_GravitySeconds.w);
+		tf_velocityLifetime = vec4(velocity, velocityLifetime.w);
+	}
+}
@@ -0,0 +1,54 @@
+#version 410 core
+// ParticleSystem's billboards: one instance a particle, straight from the
+// buffer the last step wrote, four vertices a quad (a triangle strip).
+layout(location=0) in vec4 positionAge;
+layout(location=1) in vec4 velocityLifetime;
+
+#define MAX_EMITTERS 8
+
+// As in particle_update_vert.glsl.
+struct Emitter {
+	vec4 positionSize;
+	vec4 velocitySpread;
+	vec4 color;
+	vec4 lifetime;
+	uvec4 slots;
+};
+layout(std140) uniform Particles {
+	mat4 u_View;
+	mat4 u_Projection;
+	vec4 u_GravitySeconds;
+	vec4 u_Drag;
+	uvec4 u_Step;
+	Emitter u_Emitters[MAX_EMITTERS];
+};
+
+out vec2 v_corner;
+out vec4 v_color;
+
+void main()
+{
+	if (positionAge.w >= velocityLifetime.w)
+	{
+		// Dead, or never born: outside the clip volume, so nothing's drawn.
+		gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+		v_corner = vec2(0.0f);
+		v_color = vec4(0.0f);
+		return;
+	}
+	uint slot = uint(gl_InstanceID);
+	uint emitter = 0u;
+	while (emitter + 1u < u_Step.y && slot >= u_Emitters[emitter].slots.x + u_Emitters[emitter].slots.y)
+	{
+		++emitter;
+	}
+	v_corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0f - 1.0f;
+	vec4 color = u_Emitters[emitter].color;
+	color.a *= 1.0f - positionAge.w / velocityLifetime.w;
+	v_color = color;
+
+	// Offset in view space, so the quad always faces the camera.
+	vec4 viewPosition = u_View * vec4(positionAge.xyz, 1.0f);
+	viewPosition.xy += v_corner * u_Emitters[emitter].positionSize.w;
+	gl_Position = u_Projection * viewPosition;
+}
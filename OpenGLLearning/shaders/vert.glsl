@@ -1,18 +1,93 @@
 #version 410 core
+// The defines after #version pick the permutation, see MaterialSystem::GetDefines().
 layout(location=0) in vec3 position;
 layout(location=1) in vec3 vertexColors;
 
-uniform mat4 u_ModelMatrix;
-uniform mat4 u_ViewMatrix;
-uniform mat4 u_Projection;
+#ifdef INSTANCED
+// projection * view * model, one per draw. The draw's baseInstance picks
+// which one, since we don't have gl_DrawID (takes locations 2 to 5).
+layout(location=2) in mat4 modelViewProjection;
+// The rest of the per-object block, as below.
+layout(location=6) in vec4 atlasRect;
+layout(location=7) in vec4 objectIndices;
+#else
+// Per-object data, streamed from the CPU every frame.
+layout(std140) uniform PerObject {
+	// projection * view * model, combined on the CPU
+	mat4 u_ModelViewProjection;
+	// Where our texture is in the atlas, with --atlas: UV offset (xy) and
+	// scale (zw). The whole texture otherwise.
+	vec4 u_AtlasRect;
+	// The atlas layer (x), our index into u_Materials (y) and with SKINNED,
+	// where our joints start in u_SkinPalette (z).
+	vec4 u_ObjectIndices;
+};
+#define modelViewProjection u_ModelViewProjection
+#define atlasRect u_AtlasRect
+#define objectIndices u_ObjectIndices
+#endif
+
+#ifdef SKINNED
+// Up to four joints that move the vertex, and how much each (adding up to 1).
+layout(location=8) in vec4 joints;
+layout(location=9) in vec4 weights;
+// Every skinned object's joint matrices, the top three rows of each, one
+// texel a row (see AnimationSystem).
+uniform samplerBuffer u_SkinPalette;
+
+// Where our joints' matrices, weighted, put 'position' in model space.
+vec3 Skin(vec3 position)
+{
+	vec4 bound = vec4(position, 1.0f);
+	int firstJoint = int(objectIndices.z);
+	vec3 skinned = vec3(0.0f);
+	for (int i = 0; i < 4; ++i)
+	{
+		int texel = (firstJoint + int(joints[i])) * 3;
+		skinned += weights[i] * vec3(
+			dot(texelFetch(u_SkinPalette, texel), bound),
+			dot(texelFetch(u_SkinPalette, texel + 1), bound),
+			dot(texelFetch(u_SkinPalette, texel + 2), bound));
+	}
+	return skinned;
+}
+#endif
+
+// Every material's parameters, see MaterialSystem::Parameters.
+struct Material {
+	vec4 baseColor;
+	vec4 uvScaleOffset;
+	// x: roughness
+	vec4 surface;
+};
+layout(std140) uniform Materials {
+	Material u_Materials[MAX_MATERIALS];
+};
 
 out vec3 v_vertexColors;
+// Our meshes are unit quads around the origin, so the position doubles as UV.
+out vec2 v_texCoords;
+flat out float v_atlasLayer;
+flat out int v_material;
 
 void main()
 {
+	v_material = int(objectIndices.y);
+	v_atlasLayer = objectIndices.x;
+#ifdef VERTEX_COLORS
 	v_vertexColors = vertexColors;
+#else
+	v_vertexColors = vec3(1.0f);
+#endif
+	vec4 uvScaleOffset = u_Materials[v_material].uvScaleOffset;
+	v_texCoords = atlasRect.xy + ((position.xy + 0.5f) * uvScaleOffset.xy + uvScaleOffset.zw) * atlasRect.zw;
 
-	vec4 newPosition = u_Projection * u_ViewMatrix * u_ModelMatrix * vec4(position, 1.0f);
+#ifdef SKINNED
+	vec3 modelPosition = Skin(position);
+#else
+	vec3 modelPosition = position;
+#endif
+	vec4 newPosition = modelViewProjection * vec4(modelPosition, 1.0f);
 																	//Don't forget w here.
 	gl_Position = vec4(newPosition.x, newPosition.y, newPosition.z, newPosition.w);
 }  
\ No newline at end of file
@@ -0,0 +1,295 @@
+#include "AnimationClip.hpp"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Rotation components other than the largest are within this of 0.
+constexpr float SmallestThreeRange = 0.70710678f;
+constexpr float SmallestThreeSteps = 32767.0f;
+
+float RotationError(const glm::quat& a, const glm::quat& b)
+{
+	// The angle between them; atan2 keeps it accurate when it's tiny.
+	const glm::quat difference = glm::conjugate(a) * b;
+	return 2.0f * std::atan2(glm::length(glm::vec3(difference.x, difference.y, difference.z)), std::fabs(difference.w));
+}
+
+/// <summary>
+/// Greedy keyframe reduction: starting from the first frame, stretches each
+/// segment as far as interpolating its two keys, as they'll be decoded,
+/// reproduces every frame in it within 'tolerance'. A track that stays
+/// within 'tolerance' of its first frame keeps just that one.
+/// </summary>
+template <typename Value, typename Packed, typename Encode, typename Decode, typename Lerp, typename Error>
+void ReduceTrack(const std::vector<Value>& samples, float tolerance, const Encode& encode, const Decode& decode, const Lerp& lerp, const Error& error,
+	std::vector<std::uint16_t>* frames, std::vector<Packed>* keys)
+{
+	const std::uint32_t count = static_cast<std::uint32_t>(samples.size());
+	std::vector<Packed> packed(count);
+	std::vector<Value> decoded(count);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		packed[i] = encode(samples[i]);
+		decoded[i] = decode(packed[i]);
+	}
+	const auto fits = [&](std::uint32_t from, std::uint32_t to) {
+		for (std::uint32_t frame = from; frame <= to; ++frame)
+		{
+			const float t = static_cast<float>(frame - from) / static_cast<float>(to - from);
+			if (error(lerp(decoded[from], decoded[to], t), samples[frame]) > tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	frames->push_back(0);
+	keys->push_back(packed[0]);
+	bool constant = true;
+	for (std::uint32_t frame = 1; frame < count && constant; ++frame)
+	{
+		constant = error(decoded[0], samples[frame]) <= tolerance;
+	}
+	if (constant)
+	{
+		return;
+	}
+	std::uint32_t from = 0;
+	while (from + 1 < count)
+	{
+		std::uint32_t to = from + 1;
+		while (to + 1 < count && fits(from, to + 1))
+		{
+			++to;
+		}
+		frames->push_back(static_cast<std::uint16_t>(to));
+		keys->push_back(packed[to]);
+		from = to;
+	}
+}
+
+}
+
+void Skeleton::GetSkinningMatrices(const JointPose* poses, glm::mat4* skinning) const
+{
+	// Model space first: parents come before their children, so theirs is ready.
+	for (std::uint32_t joint = 0; joint < GetJointCount(); ++joint)
+	{
+		const JointPose& pose = poses[joint];
+		const glm::mat4 local = glm::translate(glm::mat4(1.0f), pose.mTranslation) * glm::mat4_cast(pose.mRotation) * glm::scale(glm::mat4(1.0f), pose.mScale);
+		skinning[joint] = (mParents[joint] == NoParent ? mRoot : skinning[mParents[joint]]) * local;
+	}
+	for (std::uint32_t joint = 0; joint < GetJointCount(); ++joint)
+	{
+		skinning[joint] = skinning[joint] * mInverseBindMatrices[joint];
+	}
+}
+
+AnimationClip AnimationClip::Compress(const RawClip& clip, const Tolerances& tolerances)
+{
+	AnimationClip result;
+	result.mName = clip.mName;
+	result.mFramesPerSecond = clip.mFramesPerSecond;
+	result.mFrameCount = std::min<std::uint32_t>(clip.mFrameCount, 65536);
+	result.mDuration = result.mFrameCount > 1 ? (result.mFrameCount - 1) / clip.mFramesPerSecond : 0.0f;
+	result.mJointCount = clip.mJointCount;
+	result.mRotationTracks.resize(clip.mJointCount);
+	result.mTranslationTracks.resize(clip.mJointCount);
+	result.mScaleTracks.resize(clip.mJointCount);
+	if (result.mFrameCount == 0)
+	{
+		return result;
+	}
+
+	const auto lerp = [](const glm::vec3& a, const glm::vec3& b, float t) { return a + (b - a) * t; };
+	const auto distance = [](const glm::vec3& a, const glm::vec3& b) { return glm::length(a - b); };
+	const auto largestDifference = [](const glm::vec3& a, const glm::vec3& b) {
+		const glm::vec3 difference = glm::abs(a - b);
+		return std::max(difference.x, std::max(difference.y, difference.z));
+	};
+
+	std::vector<glm::quat> rotations(result.mFrameCount);
+	std::vector<glm::vec3> translations(result.mFrameCount);
+	std::vector<glm::vec3> scales(result.mFrameCount);
+	for (std::uint32_t joint = 0; joint < clip.mJointCount; ++joint)
+	{
+		glm::vec3 translationMin(INFINITY), translationMax(-INFINITY);
+		glm::vec3 scaleMin(INFINITY), scaleMax(-INFINITY);
+		for (std::uint32_t frame = 0; frame < result.mFrameCount; ++frame)
+		{
+			const JointPose& pose = clip.mPoses[frame * clip.mJointCount + joint];
+			rotations[frame] = glm::normalize(pose.mRotation);
+			translations[frame] = pose.mTranslation;
+			scales[frame] = pose.mScale;
+			translationMin = glm::min(translationMin, pose.mTranslation);
+			translationMax = glm::max(translationMax, pose.mTranslation);
+			scaleMin = glm::min(scaleMin, pose.mScale);
+			scaleMax = glm::max(scaleMax, pose.mScale);
+		}
+
+		Track& rotationTrack = result.mRotationTracks[joint];
+		rotationTrack.mFirstKey = static_cast<std::uint32_t>(result.mRotationKeys.size());
+		ReduceTrack(rotations, tolerances.mRotation, &EncodeRotation, &DecodeRotation, &Interpolate, &RotationError,
+			&result.mRotationFrames, &result.mRotationKeys);
+		rotationTrack.mKeyCount = static_cast<std::uint32_t>(result.mRotationKeys.size()) - rotationTrack.mFirstKey;
+
+		const auto reduceVector = [&](const std::vector<glm::vec3>& samples, const glm::vec3& min, const glm::vec3& max, float tolerance,
+			const auto& error, Track* track, std::vector<std::uint16_t>* frames, std::vector<PackedVector>* keys) {
+			track->mFirstKey = static_cast<std::uint32_t>(keys->size());
+			track->mMin = min;
+			track->mStep = (max - min) / 65535.0f;
+			const Track& range = *track;
+			const auto encode = [&range](const glm::vec3& value) {
+				PackedVector packed;
+				for (int i = 0; i < 3; ++i)
+				{
+					const float steps = range.mStep[i] > 0.0f ? std::round((value[i] - range.mMin[i]) / range.mStep[i]) : 0.0f;
+					packed.mBits[i] = static_cast<std::uint16_t>(std::min(std::max(steps, 0.0f), 65535.0f));
+				}
+				return packed;
+			};
+			const auto decode = [&range](const PackedVector& packed) { return DecodeVector(range, packed); };
+			ReduceTrack(samples, tolerance, encode, decode, lerp, error, frames, keys);
+			track->mKeyCount = static_cast<std::uint32_t>(keys->size()) - track->mFirstKey;
+		};
+		reduceVector(translations, translationMin, translationMax, tolerances.mTranslation, distance,
+			&result.mTranslationTracks[joint], &result.mTranslationFrames, &result.mTranslationKeys);
+		reduceVector(scales, scaleMin, scaleMax, tolerances.mScale, largestDifference,
+			&result.mScaleTracks[joint], &result.mScaleFrames, &result.mScaleKeys);
+	}
+	return result;
+}
+
+void AnimationClip::Sample(float seconds, JointPose* poses) const
+{
+	const float frame = GetFrame(seconds);
+	for (std::uint32_t joint = 0; joint < mJointCount; ++joint)
+	{
+		std::uint32_t from, to;
+		float alpha;
+		Locate(mRotationTracks[joint], mRotationFrames.data(), frame, &from, &to, &alpha);
+		poses[joint].mRotation = Interpolate(DecodeRotation(mRotationKeys[from]), DecodeRotation(mRotationKeys[to]), alpha);
+
+		const Track& translation = mTranslationTracks[joint];
+		Locate(translation, mTranslationFrames.data(), frame, &from, &to, &alpha);
+		const glm::vec3 translationFrom = DecodeVector(translation, mTranslationKeys[from]);
+		poses[joint].mTranslation = translationFrom + (DecodeVector(translation, mTranslationKeys[to]) - translationFrom) * alpha;
+
+		const Track& scale = mScaleTracks[joint];
+		Locate(scale, mScaleFrames.data(), frame, &from, &to, &alpha);
+		const glm::vec3 scaleFrom = DecodeVector(scale, mScaleKeys[from]);
+		poses[joint].mScale = scaleFrom + (DecodeVector(scale, mScaleKeys[to]) - scaleFrom) * alpha;
+	}
+}
+
+void AnimationClip::Locate(const Track& track, const std::uint16_t* frames, float frame, std::uint32_t* from, std::uint32_t* to, float* alpha)
+{
+	const std::uint16_t* first = frames + track.mFirstKey;
+	const std::uint16_t* last = first + track.mKeyCount - 1;
+	if (track.mKeyCount < 2 || frame <= *first)
+	{
+		*from = *to = track.mFirstKey;
+		*alpha = 0.0f;
+		return;
+	}
+	if (frame >= *last)
+	{
+		*from = *to = track.mFirstKey + track.mKeyCount - 1;
+		*alpha = 0.0f;
+		return;
+	}
+	// The first key past 'frame'; there is one, and one before it.
+	const std::uint16_t* next = std::upper_bound(first, last, static_cast<std::uint16_t>(frame));
+	*to = static_cast<std::uint32_t>(next - frames);
+	*from = *to - 1;
+	*alpha = (frame - next[-1]) / static_cast<float>(next[0] - next[-1]);
+}
+
+float AnimationClip::GetFrame(float seconds) const
+{
+	if (mFrameCount < 2)
+	{
+		return 0.0f;
+	}
+	const float span = static_cast<float>(mFrameCount - 1);
+	const float frame = seconds * mFramesPerSecond;
+	return std::min(std::max(frame - std::floor(frame / span) * span, 0.0f), span);
+}
+
+AnimationClip::PackedRotation AnimationClip::EncodeRotation(const glm::quat& rotation)
+{
+	const glm::quat normalized = glm::normalize(rotation);
+	float components[4] = { normalized.x, normalized.y, normalized.z, normalized.w };
+	int largest = 0;
+	for (int i = 1; i < 4; ++i)
+	{
+		if (std::fabs(components[i]) > std::fabs(components[largest]))
+		{
+			largest = i;
+		}
+	}
+	// q and -q are the same rotation; keep the one whose largest is positive,
+	// which is then the square root of what the rest leave.
+	const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+	PackedRotation packed;
+	for (int i = 0, j = 0; i < 4; ++i)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+		const float value = std::min(std::max(components[i] * sign, -SmallestThreeRange), SmallestThreeRange);
+		packed.mBits[j++] = static_cast<std::uint16_t>(std::lround((value + SmallestThreeRange) * (SmallestThreeSteps / (2.0f * SmallestThreeRange))));
+	}
+	packed.mBits[0] |= static_cast<std::uint16_t>((largest & 1) << 15);
+	packed.mBits[1] |= static_cast<std::uint16_t>((largest >> 1) << 15);
+	return packed;
+}
+
+glm::quat AnimationClip::DecodeRotation(const PackedRotation& packed)
+{
+	const int largest = (packed.mBits[0] >> 15) | ((packed.mBits[1] >> 15) << 1);
+	float components[4];
+	float sum = 0.0f;
+	for (int i = 0, j = 0; i < 4; ++i)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+		components[i] = (packed.mBits[j++] & 0x7fff) * (2.0f * SmallestThreeRange / SmallestThreeSteps) - SmallestThreeRange;
+		sum += components[i] * components[i];
+	}
+	components[largest] = std::sqrt(std::max(1.0f - sum, 0.0f));
+	return glm::quat(components[3], components[0], components[1], components[2]);
+}
+
+glm::quat AnimationClip::Interpolate(const glm::quat& from, const glm::quat& to, float t)
+{
+	const float cosine = glm::dot(from, to);
+	const float d = std::fabs(cosine);
+	const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+	const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+	const float k = a * (t - 0.5f) * (t - 0.5f) + b;
+	const float corrected = t + t * (t - 0.5f) * (t - 1.0f) * k;
+	const float toWeight = cosine < 0.0f ? -corrected : corrected;
+	const glm::quat mixed(
+		from.w * (1.0f - corrected) + to.w * toWeight,
+		from.x * (1.0f - corrected) + to.x * toWeight,
+		from.y * (1.0f - corrected) + to.y * toWeight,
+		from.z * (1.0f - corrected) + to.z * toWeight);
+	return glm::normalize(mixed);
+}
+
+std::size_t AnimationClip::GetByteSize() const
+{
+	return sizeof(Track) * (mRotationTracks.size() + mTranslationTracks.size() + mScaleTracks.size())
+		+ sizeof(std::uint16_t) * (mRotationFrames.size() + mTranslationFrames.size() + mScaleFrames.size())
+		+ sizeof(PackedRotation) * mRotationKeys.size()
+		+ sizeof(PackedVector) * (mTranslationKeys.size() + mScaleKeys.size());
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// One joint's transform relative to its parent.
+/// </summary>
+struct JointPose {
+	glm::vec3			mTranslation	= glm::vec3(0.0f);
+	glm::quat			mRotation		= glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+	glm::vec3			mScale			= glm::vec3(1.0f);
+};
+
+/// <summary>
+/// The joints a skinned mesh is bound to, every parent before its children,
+/// so a pose can be taken to model space in one pass.
+/// </summary>
+struct Skeleton {
+	static constexpr std::int32_t NoParent = -1;
+
+	std::vector<std::int32_t>	mParents;
+	// The rest pose; clips keep it for the joints they don't animate.
+	std::vector<JointPose>		mBindPoses;
+	// Model space to each joint's space, in the pose the mesh was bound in.
+	std::vector<glm::mat4>		mInverseBindMatrices;
+	std::vector<std::string>	mNames;
+	// Whatever holds the root joints, in the mesh's model space.
+	glm::mat4					mRoot			= glm::mat4(1.0f);
+
+	std::uint32_t GetJointCount() const { return static_cast<std::uint32_t>(mParents.size()); }
+
+	/// <summary>
+	/// What moves a bound vertex to where 'poses' put it, per joint: the
+	/// joint's model space matrix times its inverse bind matrix. The plain
+	/// reference; AnimationSystem batches the same.
+	/// </summary>
+	void GetSkinningMatrices(const JointPose* poses, glm::mat4* skinning) const;
+};
+
+/// <summary>
+/// An animation as imported: every joint's pose at every frame, at a fixed
+/// rate. What AnimationClip compresses.
+/// </summary>
+struct RawClip {
+	std::string				mName;
+	float					mFramesPerSecond	= 30.0f;
+	std::uint32_t			mFrameCount			= 0;
+	std::uint32_t			mJointCount			= 0;
+	// Frame major: mPoses[frame * mJointCount + joint].
+	std::vector<JointPose>	mPoses;
+
+	float GetDuration() const { return mFrameCount > 1 ? (mFrameCount - 1) / mFramesPerSecond : 0.0f; }
+	std::size_t GetByteSize() const { return mPoses.size() * sizeof(JointPose); }
+};
+
+/// <summary>
+/// A compressed, looping clip. Every joint has a track per channel
+/// (rotation, translation, scale), and each track only keeps the frames
+/// that interpolating between their neighbours can't reproduce within the
+/// tolerances; a joint that doesn't move keeps one key.
+///
+/// Keys are quantized: rotations to their smallest three components, 15
+/// bits each, plus which one was dropped (6 bytes); translations and scales
+/// to 16 bits per component within their track's range (6 bytes). Every
+/// key has a 16 bit frame number, so a clip can't be longer than 65535
+/// frames.
+///
+/// Rotations are interpolated with Interpolate(), a corrected nlerp that
+/// stays within a thousandth of a radian of slerp and vectorizes; the
+/// tolerances are checked against it, so they hold on playback.
+/// </summary>
+class AnimationClip {
+public:
+	struct Tolerances {
+		// Model units.
+		float				mTranslation		= 1e-4f;
+		// Radians.
+		float				mRotation			= 1e-3f;
+		float				mScale				= 1e-4f;
+	};
+
+	/// <summary>
+	/// The three smallest components, 15 bits each, in the low bits; the
+	/// index of the largest in the top bits of the first two.
+	/// </summary>
+	struct PackedRotation {
+		std::uint16_t		mBits[3];
+	};
+	/// <summary>
+	/// 16 bits per component, from the track's mMin to mMin + 65535 * mStep.
+	/// </summary>
+	struct PackedVector {
+		std::uint16_t		mBits[3];
+	};
+
+	struct Track {
+		std::uint32_t		mFirstKey			= 0;
+		std::uint32_t		mKeyCount			= 0;
+		// Vector tracks only.
+		glm::vec3			mMin				= glm::vec3(0.0f);
+		glm::vec3			mStep				= glm::vec3(0.0f);
+	};
+
+	static AnimationClip Compress(const RawClip& clip, const Tolerances& tolerances);
+
+	/// <summary>
+	/// Every joint's pose 'seconds' in, wrapped to the clip's duration.
+	/// The reference for AnimationSystem's kernels.
+	/// </summary>
+	void Sample(float seconds, JointPose* poses) const;
+
+	/// <summary>
+	/// The keys of 'track' either side of 'frame', as indices into the
+	/// channel's keys, and how far 'frame' is from the first to the second
+	/// (0 to 1). Both are the same key if the track only has one.
+	/// </summary>
+	static void Locate(const Track& track, const std::uint16_t* frames, float frame, std::uint32_t* from, std::uint32_t* to, float* alpha);
+	/// <summary>
+	/// The frame 'seconds' falls on, wrapped to the clip, with a fraction.
+	/// </summary>
+	float GetFrame(float seconds) const;
+
+	static PackedRotation EncodeRotation(const glm::quat& rotation);
+	static glm::quat DecodeRotation(const PackedRotation& packed);
+	/// <summary>
+	/// slerp, approximated: nlerp with t corrected by a polynomial in t and
+	/// the keys' dot product (Kapoulkine, "Approximating slerp", 2015).
+	/// Takes the short way around.
+	/// </summary>
+	static glm::quat Interpolate(const glm::quat& from, const glm::quat& to, float t);
+	static glm::vec3 DecodeVector(const Track& track, const PackedVector& packed)
+	{
+		return track.mMin + glm::vec3(packed.mBits[0], packed.mBits[1], packed.mBits[2]) * track.mStep;
+	}
+
+	const std::string& GetName() const { return mName; }
+	float GetDuration() const { return mDuration; }
+	float GetFramesPerSecond() const { return mFramesPerSecond; }
+	std::uint32_t GetJointCount() const { return mJointCount; }
+
+	const Track& GetRotationTrack(std::uint32_t joint) const { return mRotationTracks[joint]; }
+	const Track& GetTranslationTrack(std::uint32_t joint) const { return mTranslationTracks[joint]; }
+	const Track& GetScaleTrack(std::uint32_t joint) const { return mScaleTracks[joint]; }
+	const std::uint16_t* GetRotationFrames() const { return mRotationFrames.data(); }
+	const std::uint16_t* GetTranslationFrames() const { return mTranslationFrames.data(); }
+	const std::uint16_t* GetScaleFrames() const { return mScaleFrames.data(); }
+	const PackedRotation* GetRotationKeys() const { return mRotationKeys.data(); }
+	const PackedVector* GetTranslationKeys() const { return mTranslationKeys.data(); }
+	const PackedVector* GetScaleKeys() const { return mScaleKeys.data(); }
+
+	/// <summary>
+	/// Keys in every track, and the bytes they and the tracks take.
+	/// </summary>
+	std::size_t GetKeyCount() const { return mRotationKeys.size() + mTranslationKeys.size() + mScaleKeys.size(); }
+	std::size_t GetByteSize() const;
+
+private:
+	std::string					mName;
+	float						mDuration			= 0.0f;
+	float						mFramesPerSecond	= 30.0f;
+	std::uint32_t				mFrameCount			= 0;
+	std::uint32_t				mJointCount			= 0;
+	std::vector<Track>			mRotationTracks;
+	std::vector<Track>			mTranslationTracks;
+	std::vector<Track>			mScaleTracks;
+	std::vector<std::uint16_t>	mRotationFrames;
+	std::vector<std::uint16_t>	mTranslationFrames;
+	std::vector<std::uint16_t>	mScaleFrames;
+	std::vector<PackedRotation>	mRotationKeys;
+	std::vector<PackedVector>	mTranslationKeys;
+	std::vector<PackedVector>	mScaleKeys;
+};
@@ -0,0 +1,371 @@
+#include "AnimationSystem.hpp"
+
+#include "CpuDispatch.hpp"
+#include "MatrixKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ANIMATION_SYSTEM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	// A block of instances for one thread at a time.
+	constexpr std::uint32_t InstancesPerBlock = 32;
+
+	/// <summary>
+	/// Decoding and interpolating rotation keys, so it can be SIMD.
+	/// </summary>
+	struct RotationKernelTable {
+		const char* mName;
+		/// <summary>
+		/// out[i] = AnimationClip::Interpolate(Decode(from[i]), Decode(to[i]), t[i]).
+		/// </summary>
+		void (*mInterpolateRotations)(const AnimationClip::PackedRotation* from, const AnimationClip::PackedRotation* to,
+			const float* t, std::uint32_t count, glm::quat* out);
+	};
+
+	//------------------------------- Scalar -----------------------------------
+
+	void InterpolateRotationsScalar(const AnimationClip::PackedRotation* from, const AnimationClip::PackedRotation* to,
+		const float* t, std::uint32_t count, glm::quat* out)
+	{
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			out[i] = AnimationClip::Interpolate(AnimationClip::DecodeRotation(from[i]), AnimationClip::DecodeRotation(to[i]), t[i]);
+		}
+	}
+
+	const RotationKernelTable* GetRotationKernelsScalar()
+	{
+		static const RotationKernelTable sTable = { "Scalar", InterpolateRotationsScalar };
+		return &sTable;
+	}
+
+	//------------------------------- SSE2 -----------------------------------
+
+#ifdef ANIMATION_SYSTEM_SSE2
+	/// <summary>
+	/// Four keys' x, y, z and w, one register each.
+	/// </summary>
+	struct QuatLanes {
+		__m128	mX, mY, mZ, mW;
+	};
+
+	QuatLanes DecodeRotations(const AnimationClip::PackedRotation* keys)
+	{
+		const __m128i word0 = _mm_setr_epi32(keys[0].mBits[0], keys[1].mBits[0], keys[2].mBits[0], keys[3].mBits[0]);
+		const __m128i word1 = _mm_setr_epi32(keys[0].mBits[1], keys[1].mBits[1], keys[2].mBits[1], keys[3].mBits[1]);
+		const __m128i word2 = _mm_setr_epi32(keys[0].mBits[2], keys[1].mBits[2], keys[2].mBits[2], keys[3].mBits[2]);
+		const __m128i largest = _mm_or_si128(_mm_srli_epi32(word0, 15), _mm_slli_epi32(_mm_srli_epi32(word1, 15), 1));
+
+		// The same operations in the same order as AnimationClip::DecodeRotation().
+		const __m128i low = _mm_set1_epi32(0x7fff);
+		const __m128 scale = _mm_set1_ps(2.0f * 0.70710678f / 32767.0f);
+		const __m128 range = _mm_set1_ps(0.70710678f);
+		const __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(word0, low)), scale), range);
+		const __m128 b = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(word1, low)), scale), range);
+		const __m128 c = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(word2, low)), scale), range);
+		const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+		const __m128 big = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), sum), _mm_setzero_ps()));
+
+		// The dropped component goes back in its place, the others shift up past it.
+		const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(0)));
+		const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+		const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+		const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3)));
+		const auto select = [](__m128 mask, __m128 yes, __m128 no) { return _mm_or_ps(_mm_and_ps(mask, yes), _mm_andnot_ps(mask, no)); };
+		QuatLanes q;
+		q.mX = select(is0, big, a);
+		q.mY = select(is0, a, select(is1, big, b));
+		q.mZ = select(_mm_or_ps(is0, is1), b, select(is2, big, c));
+		q.mW = select(is3, big, c);
+		return q;
+	}
+
+	void InterpolateRotationsSSE2(const AnimationClip::PackedRotation* from, const AnimationClip::PackedRotation* to,
+		const float* t, std::uint32_t count, glm::quat* out)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+		std::uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const QuatLanes p = DecodeRotations(from + i);
+			const QuatLanes q = DecodeRotations(to + i);
+			const __m128 s = _mm_loadu_ps(t + i);
+
+			// As AnimationClip::Interpolate(): correct t for how far apart the keys are.
+			const __m128 cosine = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p.mX, q.mX), _mm_mul_ps(p.mY, q.mY)),
+				_mm_add_ps(_mm_mul_ps(p.mZ, q.mZ), _mm_mul_ps(p.mW, q.mW)));
+			const __m128 d = _mm_andnot_ps(signBit, cosine);
+			const __m128 ka = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(-3.2452f),
+				_mm_mul_ps(d, _mm_sub_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(1.43519f)))))));
+			const __m128 kb = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(-1.06021f),
+				_mm_mul_ps(d, _mm_set1_ps(0.215638f)))));
+			const __m128 centered = _mm_sub_ps(s, half);
+			const __m128 k = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ka, centered), centered), kb);
+			const __m128 corrected = _mm_add_ps(s, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(s, centered), _mm_sub_ps(s, one)), k));
+			const __m128 fromWeight = _mm_sub_ps(one, corrected);
+			// The short way around: flip the second key's weight when they're apart.
+			const __m128 toWeight = _mm_xor_ps(corrected, _mm_and_ps(cosine, signBit));
+
+			__m128 x = _mm_add_ps(_mm_mul_ps(p.mX, fromWeight), _mm_mul_ps(q.mX, toWeight));
+			__m128 y = _mm_add_ps(_mm_mul_ps(p.mY, fromWeight), _mm_mul_ps(q.mY, toWeight));
+			__m128 z = _mm_add_ps(_mm_mul_ps(p.mZ, fromWeight), _mm_mul_ps(q.mZ, toWeight));
+			__m128 w = _mm_add_ps(_mm_mul_ps(p.mW, fromWeight), _mm_mul_ps(q.mW, toWeight));
+			const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w))));
+			const __m128 inverse = _mm_div_ps(one, length);
+			x = _mm_mul_ps(x, inverse);
+			y = _mm_mul_ps(y, inverse);
+			z = _mm_mul_ps(z, inverse);
+			w = _mm_mul_ps(w, inverse);
+
+			// Back to one quaternion per register, x y z w as glm::quat stores them.
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(&out[i].x, x);
+			_mm_storeu_ps(&out[i + 1].x, y);
+			_mm_storeu_ps(&out[i + 2].x, z);
+			_mm_storeu_ps(&out[i + 3].x, w);
+		}
+		InterpolateRotationsScalar(from + i, to + i, t + i, count - i, out + i);
+	}
+
+	const RotationKernelTable* GetRotationKernelsSSE2()
+	{
+		static const RotationKernelTable sTable = { "SSE2", InterpolateRotationsSSE2 };
+		return &sTable;
+	}
+#else
+	const RotationKernelTable* GetRotationKernelsSSE2()
+	{
+		return nullptr;
+	}
+#endif
+
+	const RotationKernelTable* SelectKernels()
+	{
+		const RotationKernelTable* const candidates[] = {
+			GetRotationKernelsScalar(),
+			GetRotationKernelsSSE2(),
+			nullptr,
+			nullptr,
+		};
+		SimdLevel level = SimdLevel::Scalar;
+		const RotationKernelTable* table = CpuDispatch::Select(candidates, &level);
+		CpuDispatch::ReportActivePath("AnimationSystem", level);
+		return table;
+	}
+
+	const RotationKernelTable*& GetKernels()
+	{
+		static const RotationKernelTable* sKernels = SelectKernels();
+		return sKernels;
+	}
+
+}
+
+static_assert(sizeof(glm::quat) == 4 * sizeof(float), "the SSE2 path stores tightly packed quats");
+
+AnimationSystem::~AnimationSystem()
+{
+	Destroy();
+}
+
+void AnimationSystem::SetSettings(const Settings& settings)
+{
+	mSettings = settings;
+}
+
+bool AnimationSystem::Create(const Settings& settings)
+{
+	SetSettings(settings);
+	glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &mMaxTexels);
+	glGenBuffers(1, &mBuffer);
+	glGenTextures(1, &mTexture);
+	// Never empty, so there's always something to sample.
+	glBindBuffer(GL_TEXTURE_BUFFER, mBuffer);
+	glBufferData(GL_TEXTURE_BUFFER, sizeof(glm::vec4) * TexelsPerJoint, nullptr, GL_STREAM_DRAW);
+	glBindTexture(GL_TEXTURE_BUFFER, mTexture);
+	glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, mBuffer);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	return glGetError() == GL_NO_ERROR;
+}
+
+void AnimationSystem::Destroy()
+{
+	if (mTexture != 0)
+	{
+		glDeleteTextures(1, &mTexture);
+		glDeleteBuffers(1, &mBuffer);
+	}
+	mTexture = mBuffer = 0;
+}
+
+AnimationSystem::Handle AnimationSystem::AddInstance(const Skeleton* skeleton, const AnimationClip* clip, float startSeconds, float speed)
+{
+	if (clip->GetJointCount() != skeleton->GetJointCount())
+	{
+		return InvalidHandle;
+	}
+	Instance instance;
+	instance.mSkeleton = skeleton;
+	instance.mClip = clip;
+	instance.mSeconds = std::fmod(std::max(startSeconds, 0.0f), std::max(clip->GetDuration(), 1e-6f));
+	instance.mSpeed = speed;
+	instance.mFirstJoint = mJointCount;
+	const Handle handle = static_cast<Handle>(mInstances.size());
+	mInstances.push_back(instance);
+	mJointCount += skeleton->GetJointCount();
+	mPalette.resize(static_cast<std::size_t>(mJointCount) * TexelsPerJoint);
+	return handle;
+}
+
+void AnimationSystem::Advance(float seconds)
+{
+	for (Instance& instance : mInstances)
+	{
+		// Kept within the clip, so the time doesn't lose precision as it grows.
+		const float duration = instance.mClip->GetDuration();
+		instance.mSeconds += seconds * instance.mSpeed;
+		if (duration > 0.0f && (instance.mSeconds >= duration || instance.mSeconds < 0.0f))
+		{
+			instance.mSeconds -= std::floor(instance.mSeconds / duration) * duration;
+		}
+	}
+}
+
+void AnimationSystem::Update(float offsetSeconds)
+{
+	const std::uint32_t count = static_cast<std::uint32_t>(mInstances.size());
+	const std::uint32_t blocks = (count + InstancesPerBlock - 1) / InstancesPerBlock;
+	unsigned threads = mSettings.mThreads;
+	if (threads == 0)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::max(1u, std::min(threads, blocks));
+	if (mScratch.size() < threads)
+	{
+		mScratch.resize(threads);
+	}
+
+	// A block at a time, whichever thread is free; this one too.
+	std::atomic<std::uint32_t> nextBlock(0);
+	const auto work = [&](Scratch* scratch) {
+		for (std::uint32_t block = nextBlock++; block < blocks; block = nextBlock++)
+		{
+			for (std::uint32_t i = block * InstancesPerBlock; i < std::min(count, (block + 1) * InstancesPerBlock); ++i)
+			{
+				UpdateInstance(mInstances[i], offsetSeconds, scratch);
+			}
+		}
+	};
+	std::vector<std::thread> helpers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		helpers.emplace_back(work, &mScratch[i]);
+	}
+	work(&mScratch[0]);
+	for (std::thread& helper : helpers)
+	{
+		helper.join();
+	}
+}
+
+void AnimationSystem::UpdateInstance(const Instance& instance, float offsetSeconds, Scratch* scratch)
+{
+	const Skeleton& skeleton = *instance.mSkeleton;
+	const AnimationClip& clip = *instance.mClip;
+	const std::uint32_t joints = skeleton.GetJointCount();
+	if (scratch->mAlpha.size() < joints)
+	{
+		scratch->mFrom.resize(joints);
+		scratch->mTo.resize(joints);
+		scratch->mAlpha.resize(joints);
+		scratch->mRotations.resize(joints);
+		scratch->mTranslations.resize(joints);
+		scratch->mScales.resize(joints);
+		scratch->mMatrices.resize(joints);
+	}
+
+	// Each track's two keys: the rotations' go to the kernel, the rest are lerped here.
+	const float frame = clip.GetFrame(instance.mSeconds + offsetSeconds * instance.mSpeed);
+	for (std::uint32_t joint = 0; joint < joints; ++joint)
+	{
+		std::uint32_t from, to;
+		AnimationClip::Locate(clip.GetRotationTrack(joint), clip.GetRotationFrames(), frame, &from, &to, &scratch->mAlpha[joint]);
+		scratch->mFrom[joint] = clip.GetRotationKeys()[from];
+		scratch->mTo[joint] = clip.GetRotationKeys()[to];
+
+		float alpha;
+		const AnimationClip::Track& translation = clip.GetTranslationTrack(joint);
+		AnimationClip::Locate(translation, clip.GetTranslationFrames(), frame, &from, &to, &alpha);
+		const glm::vec3 translationFrom = AnimationClip::DecodeVector(translation, clip.GetTranslationKeys()[from]);
+		scratch->mTranslations[joint] = translationFrom + (AnimationClip::DecodeVector(translation, clip.GetTranslationKeys()[to]) - translationFrom) * alpha;
+
+		const AnimationClip::Track& scale = clip.GetScaleTrack(joint);
+		AnimationClip::Locate(scale, clip.GetScaleFrames(), frame, &from, &to, &alpha);
+		const glm::vec3 scaleFrom = AnimationClip::DecodeVector(scale, clip.GetScaleKeys()[from]);
+		scratch->mScales[joint] = scaleFrom + (AnimationClip::DecodeVector(scale, clip.GetScaleKeys()[to]) - scaleFrom) * alpha;
+	}
+	GetKernels()->mInterpolateRotations(scratch->mFrom.data(), scratch->mTo.data(), scratch->mAlpha.data(), joints, scratch->mRotations.data());
+	MatrixKernels::ComposeTRSBatch(scratch->mTranslations.data(), scratch->mRotations.data(), scratch->mScales.data(), scratch->mMatrices.data(), joints);
+
+	// Model space, parents first, then into the palette with the inverse bind matrices.
+	glm::vec4* palette = &mPalette[static_cast<std::size_t>(instance.mFirstJoint) * TexelsPerJoint];
+	for (std::uint32_t joint = 0; joint < joints; ++joint)
+	{
+		const std::int32_t parent = skeleton.mParents[joint];
+		glm::mat4& model = scratch->mMatrices[joint];
+		model = (parent == Skeleton::NoParent ? skeleton.mRoot : scratch->mMatrices[parent]) * model;
+		const glm::mat4 skinning = model * skeleton.mInverseBindMatrices[joint];
+		for (std::uint32_t row = 0; row < TexelsPerJoint; ++row)
+		{
+			palette[joint * TexelsPerJoint + row] = glm::vec4(skinning[0][row], skinning[1][row], skinning[2][row], skinning[3][row]);
+		}
+	}
+}
+
+bool AnimationSystem::Upload()
+{
+	if (mPalette.size() > static_cast<std::size_t>(std::max(mMaxTexels, 0)))
+	{
+		return false;
+	}
+	// New storage every frame, so we never wait for the GPU to finish with the last.
+	const GLsizeiptr size = static_cast<GLsizeiptr>(mPalette.size() * sizeof(glm::vec4));
+	glBindBuffer(GL_TEXTURE_BUFFER, mBuffer);
+	glBufferData(GL_TEXTURE_BUFFER, std::max<GLsizeiptr>(size, sizeof(glm::vec4) * TexelsPerJoint), nullptr, GL_STREAM_DRAW);
+	if (size > 0)
+	{
+		glBufferSubData(GL_TEXTURE_BUFFER, 0, size, mPalette.data());
+	}
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	mUploadedBytes += static_cast<std::uint64_t>(size);
+	return true;
+}
+
+void AnimationSystem::Bind(GLuint unit) const
+{
+	glActiveTexture(GL_TEXTURE0 + unit);
+	glBindTexture(GL_TEXTURE_BUFFER, mTexture);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+const char* AnimationSystem::GetActivePathName()
+{
+	return GetKernels()->mName;
+}
+
+void AnimationSystem::Reselect()
+{
+	GetKernels() = SelectKernels();
+}
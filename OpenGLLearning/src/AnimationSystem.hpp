@@ -0,0 +1,126 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "AnimationClip.hpp"
+
+/// <summary>
+/// Plays compressed clips on many skinned instances and hands their
+/// skinning matrices to the vertex shader, which does the skinning.
+///
+/// Update() samples every instance's clip, on as many threads as there are
+/// cores, a block of instances at a time: it finds each track's two keys,
+/// decodes and interpolates the rotations four at a time with SSE2 (the
+/// scalar path runs AnimationClip::Sample()'s math), lerps the rest,
+/// composes the local matrices with MatrixKernels::ComposeTRSBatch(),
+/// walks the hierarchy to model space, and applies the inverse bind
+/// matrices.
+///
+/// The result is one palette for all instances, 3 texels a joint (the top
+/// three rows of its matrix; the last is always 0 0 0 1), that Upload()
+/// streams to a texture buffer and vert.glsl's SKINNED reads. An instance's
+/// joints start at GetFirstJoint(), which goes in its per-object data.
+/// </summary>
+class AnimationSystem {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = ~0u;
+	// Texels a joint takes in the palette.
+	static constexpr std::uint32_t TexelsPerJoint = 3;
+
+	struct Settings {
+		// Threads for Update(), this one included; 0 is one per core.
+		unsigned			mThreads		= 0;
+	};
+
+	~AnimationSystem();
+
+	/// <summary>
+	/// The CPU side only needs the settings; Create() also makes the texture buffer.
+	/// </summary>
+	void SetSettings(const Settings& settings);
+	bool Create(const Settings& settings);
+	void Destroy();
+	bool IsCreated() const { return mTexture != 0; }
+
+	/// <summary>
+	/// An instance playing 'clip' on 'skeleton', both of which have to
+	/// outlive it, 'startSeconds' in and at 'speed' times its rate. The clip
+	/// has to animate the skeleton's joints.
+	/// </summary>
+	Handle AddInstance(const Skeleton* skeleton, const AnimationClip* clip, float startSeconds, float speed);
+	std::uint32_t GetInstanceCount() const { return static_cast<std::uint32_t>(mInstances.size()); }
+	/// <summary>
+	/// Where the instance's skinning matrices start in the palette, in joints.
+	/// </summary>
+	std::uint32_t GetFirstJoint(Handle instance) const { return mInstances[instance].mFirstJoint; }
+	/// <summary>
+	/// Joints of all the instances.
+	/// </summary>
+	std::uint32_t GetJointCount() const { return mJointCount; }
+
+	/// <summary>
+	/// Moves every instance 'seconds' on. Per simulation tick.
+	/// </summary>
+	void Advance(float seconds);
+	/// <summary>
+	/// Samples every instance at its time plus 'offsetSeconds' (negative to
+	/// render between the last two ticks) into the palette.
+	/// </summary>
+	void Update(float offsetSeconds);
+	const std::vector<glm::vec4>& GetPalette() const { return mPalette; }
+
+	/// <summary>
+	/// Streams the palette to the GPU. False if the texture buffer can't
+	/// hold that many joints.
+	/// </summary>
+	bool Upload();
+	void Bind(GLuint unit) const;
+	std::uint64_t GetUploadedBytes() const { return mUploadedBytes; }
+
+	/// <summary>
+	/// The name of the rotation path in use, and picks it again (after
+	/// CpuDispatch::SetMaxLevel()).
+	/// </summary>
+	static const char* GetActivePathName();
+	static void Reselect();
+
+	/// <summary>
+	/// What one thread samples into; kept between updates.
+	/// </summary>
+	struct Scratch {
+		std::vector<AnimationClip::PackedRotation>	mFrom;
+		std::vector<AnimationClip::PackedRotation>	mTo;
+		std::vector<float>			mAlpha;
+		std::vector<glm::quat>		mRotations;
+		std::vector<glm::vec3>		mTranslations;
+		std::vector<glm::vec3>		mScales;
+		std::vector<glm::mat4>		mMatrices;
+	};
+
+private:
+	struct Instance {
+		const Skeleton*			mSkeleton		= nullptr;
+		const AnimationClip*	mClip			= nullptr;
+		float					mSeconds		= 0.0f;
+		float					mSpeed			= 1.0f;
+		std::uint32_t			mFirstJoint		= 0;
+	};
+
+	// One instance, into its part of the palette.
+	void UpdateInstance(const Instance& instance, float offsetSeconds, Scratch* scratch);
+
+	Settings				mSettings;
+	std::vector<Instance>	mInstances;
+	std::uint32_t			mJointCount		= 0;
+	std::vector<glm::vec4>	mPalette;
+	std::vector<Scratch>	mScratch;
+
+	GLuint					mBuffer			= 0;
+	GLuint					mTexture		= 0;
+	GLint					mMaxTexels		= 0;
+	std::uint64_t			mUploadedBytes	= 0;
+};
@@ -0,0 +1,115 @@
+#include "AtlasPacker.hpp"
+
+#include <algorithm>
+
+void AtlasPacker::Create(std::uint32_t width, std::uint32_t height)
+{
+	mWidth = width;
+	mHeight = height;
+	Clear();
+}
+
+void AtlasPacker::Clear()
+{
+	mSkyline.assign(1, Segment{ 0, 0, mWidth });
+	mUsedArea = 0;
+}
+
+bool AtlasPacker::Insert(std::uint32_t width, std::uint32_t height, Rect* rect)
+{
+	if (width == 0 || height == 0 || width > mWidth || height > mHeight)
+	{
+		return false;
+	}
+
+	// Lowest top first, then the least wasted area under the rectangle.
+	std::size_t bestIndex = mSkyline.size();
+	std::uint32_t bestY = 0;
+	std::uint32_t bestTop = ~0u;
+	std::uint64_t bestWaste = ~0ull;
+	for (std::size_t i = 0; i < mSkyline.size(); ++i)
+	{
+		std::uint32_t y = 0;
+		if (!Fit(i, width, &y) || y + height > mHeight)
+		{
+			continue;
+		}
+		std::uint64_t waste = 0;
+		const std::uint32_t right = mSkyline[i].mX + width;
+		for (std::size_t j = i; j < mSkyline.size() && mSkyline[j].mX < right; ++j)
+		{
+			const std::uint32_t spanned = std::min(right, mSkyline[j].mX + mSkyline[j].mWidth) - mSkyline[j].mX;
+			waste += static_cast<std::uint64_t>(y - mSkyline[j].mY) * spanned;
+		}
+		if (y + height < bestTop || (y + height == bestTop && waste < bestWaste))
+		{
+			bestIndex = i;
+			bestY = y;
+			bestTop = y + height;
+			bestWaste = waste;
+		}
+	}
+	if (bestIndex == mSkyline.size())
+	{
+		return false;
+	}
+
+	rect->mX = mSkyline[bestIndex].mX;
+	rect->mY = bestY;
+	rect->mWidth = width;
+	rect->mHeight = height;
+	mUsedArea += static_cast<std::uint64_t>(width) * height;
+
+	// The new top replaces whatever it covers; a segment it only partly
+	// covers keeps the rest.
+	const std::uint32_t right = rect->mX + width;
+	std::size_t end = bestIndex;
+	while (end < mSkyline.size() && mSkyline[end].mX + mSkyline[end].mWidth <= right)
+	{
+		++end;
+	}
+	if (end < mSkyline.size() && mSkyline[end].mX < right)
+	{
+		mSkyline[end].mWidth -= right - mSkyline[end].mX;
+		mSkyline[end].mX = right;
+	}
+	mSkyline.erase(mSkyline.begin() + bestIndex, mSkyline.begin() + end);
+	mSkyline.insert(mSkyline.begin() + bestIndex, Segment{ rect->mX, bestTop, width });
+
+	// Neighbours at the same height are one segment.
+	for (std::size_t i = (bestIndex > 0) ? bestIndex - 1 : 0; i + 1 < mSkyline.size() && i <= bestIndex;)
+	{
+		if (mSkyline[i].mY == mSkyline[i + 1].mY)
+		{
+			mSkyline[i].mWidth += mSkyline[i + 1].mWidth;
+			mSkyline.erase(mSkyline.begin() + i + 1);
+		}
+		else
+		{
+			++i;
+		}
+	}
+	return true;
+}
+
+float AtlasPacker::GetOccupancy() const
+{
+	const double area = static_cast<double>(mWidth) * mHeight;
+	return (area > 0.0) ? static_cast<float>(mUsedArea / area) : 0.0f;
+}
+
+bool AtlasPacker::Fit(std::size_t index, std::uint32_t width, std::uint32_t* y) const
+{
+	if (mSkyline[index].mX + width > mWidth)
+	{
+		return false;
+	}
+	const std::uint32_t right = mSkyline[index].mX + width;
+	std::uint32_t top = 0;
+	for (std::size_t i = index; i < mSkyline.size() && mSkyline[i].mX < right; ++i)
+	{
+		top = std::max(top, mSkyline[i].mY);
+	}
+	*y = top;
+	return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Packs rectangles into a fixed size area, skyline style: the packer only
+/// remembers the top edge of what's been placed so far, as a list of
+/// horizontal segments, and puts each new rectangle where its top ends
+/// lowest (then where it leaves the least gap underneath).
+///
+/// That forgets the holes under overhangs, which MaxRects would keep and
+/// fill, but inserts are linear in the number of segments rather than in
+/// the free rectangles, and for rectangles inserted tallest first the
+/// difference in occupancy is a few percent. Nothing can be taken out
+/// again short of Clear().
+/// </summary>
+class AtlasPacker {
+public:
+	struct Rect {
+		std::uint32_t	mX			= 0;
+		std::uint32_t	mY			= 0;
+		std::uint32_t	mWidth		= 0;
+		std::uint32_t	mHeight		= 0;
+	};
+
+	void Create(std::uint32_t width, std::uint32_t height);
+	void Clear();
+
+	/// <summary>
+	/// Finds room for a width x height rectangle. Returns false, and leaves
+	/// the packer as it was, if there is none.
+	/// </summary>
+	bool Insert(std::uint32_t width, std::uint32_t height, Rect* rect);
+
+	/// <summary>
+	/// The share of the area that's been handed out.
+	/// </summary>
+	float GetOccupancy() const;
+
+	std::uint32_t GetWidth() const { return mWidth; }
+	std::uint32_t GetHeight() const { return mHeight; }
+
+private:
+	// A run of the skyline: from mX, mWidth long, at height mY.
+	struct Segment {
+		std::uint32_t	mX;
+		std::uint32_t	mY;
+		std::uint32_t	mWidth;
+	};
+
+	/// <summary>
+	/// Where a rectangle 'width' wide sits if its left edge is at segment
+	/// 'index': on the highest segment it spans. False if it runs off the right.
+	/// </summary>
+	bool Fit(std::size_t index, std::uint32_t width, std::uint32_t* y) const;
+
+	std::uint32_t			mWidth		= 0;
+	std::uint32_t			mHeight		= 0;
+	std::uint64_t			mUsedArea	= 0;
+	std::vector<Segment>	mSkyline;
+};
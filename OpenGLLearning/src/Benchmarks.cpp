@@ -0,0 +1,1387 @@
+#include "Benchmarks.hpp"
+#include "MatrixKernels.hpp"
+#include "CpuDispatch.hpp"
+#include "MeshLod.hpp"
+#include "Meshlets.hpp"
+#include "ImageLoader.hpp"
+#include "MipGenerator.hpp"
+#include "TextureBackend.hpp"
+#include "TextureManager.hpp"
+#include "BlockCompressor.hpp"
+#include "TextureCache.hpp"
+#include "AtlasPacker.hpp"
+#include "ClusteredLighting.hpp"
+#include "ParticleSimulation.hpp"
+#include "AnimationSystem.hpp"
+#include "SkinnedModel.hpp"
+#include "Random.hpp"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	/// <summary>
+	/// Runs 'body' several times and returns the fastest run in milliseconds.
+	/// </summary>
+	template <typename Body>
+	double BestOfMilliseconds(int repeats, Body&& body)
+	{
+		double best = 1e30;
+		for (int i = 0; i < repeats; ++i)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			body();
+			const auto end = std::chrono::high_resolution_clock::now();
+			const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+			best = (ms < best) ? ms : best;
+		}
+		return best;
+	}
+	/// <summary>
+	/// Closest point to 'p' on the triangle abc (Ericson, Real-Time Collision Detection 5.1.5).
+	/// </summary>
+	glm::vec3 ClosestPointOnTriangle(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+	{
+		const glm::vec3 ab = b - a;
+		const glm::vec3 ac = c - a;
+		const glm::vec3 ap = p - a;
+		const float d1 = glm::dot(ab, ap);
+		const float d2 = glm::dot(ac, ap);
+		if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+		const glm::vec3 bp = p - b;
+		const float d3 = glm::dot(ab, bp);
+		const float d4 = glm::dot(ac, bp);
+		if (d3 >= 0.0f && d4 <= d3) return b;
+
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+		const glm::vec3 cp = p - c;
+		const float d5 = glm::dot(ab, cp);
+		const float d6 = glm::dot(ac, cp);
+		if (d6 >= 0.0f && d5 <= d6) return c;
+
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		const float denominator = 1.0f / (va + vb + vc);
+		return a + ab * (vb * denominator) + ac * (vc * denominator);
+	}
+}
+
+int RunMatrixKernelBenchmark()
+{
+	const std::size_t count = 100000;
+	const int repeats = 20;
+
+	std::vector<glm::vec3> translations(count);
+	std::vector<glm::quat> rotations(count);
+	std::vector<glm::vec3> scales(count);
+	std::vector<glm::mat4> models(count);
+	std::vector<glm::mat4> out(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		translations[i] = glm::vec3(f, -f, 0.5f * f);
+		rotations[i] = glm::angleAxis(0.001f * f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+		scales[i] = glm::vec3(1.0f + 0.001f * f);
+	}
+	const glm::mat4 viewProjection =
+		glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f) *
+		glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	CpuDispatch::PrintReport();
+	std::printf("%zu matrices, best of %d runs (ms)\n", count, repeats);
+	std::printf("%-8s %10s %10s %10s\n", "path", "mat*mat[]", "TRS", "normal");
+
+	// What main.cpp used to do: glm one matrix at a time.
+	{
+		const double multiply = BestOfMilliseconds(repeats, [&]() {
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				out[i] = viewProjection * models[i];
+			}
+		});
+		const double trs = BestOfMilliseconds(repeats, [&]() {
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				out[i] = glm::scale(glm::translate(glm::mat4(1.0f), translations[i]) * glm::mat4_cast(rotations[i]), scales[i]);
+			}
+		});
+		const double normal = BestOfMilliseconds(repeats, [&]() {
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				out[i] = glm::mat4(glm::transpose(glm::inverse(glm::mat3(models[i]))));
+			}
+		});
+		std::printf("%-8s %10.3f %10.3f %10.3f\n", "glm", multiply, trs, normal);
+	}
+
+	const SimdLevel previousCap = CpuDispatch::GetMaxLevel();
+	for (int level = 0; level < static_cast<int>(SimdLevel::Count); ++level)
+	{
+		const SimdLevel simd = static_cast<SimdLevel>(level);
+		const char* path = CpuDispatch::GetLevelName(simd);
+		if (!CpuDispatch::IsSupported(simd))
+		{
+			std::printf("%-8s (not supported on this CPU)\n", path);
+			continue;
+		}
+		CpuDispatch::SetMaxLevel(simd);
+		MatrixKernels::Reselect();
+		if (std::strcmp(MatrixKernels::GetActivePathName(), path) != 0)
+		{
+			std::printf("%-8s (not built for this target)\n", path);
+			continue;
+		}
+		MatrixKernels::ComposeTRSBatch(translations.data(), rotations.data(), scales.data(), models.data(), count);
+
+		const double multiply = BestOfMilliseconds(repeats, [&]() {
+			MatrixKernels::MultiplyBatch(viewProjection, models.data(), out.data(), count);
+		});
+		const double trs = BestOfMilliseconds(repeats, [&]() {
+			MatrixKernels::ComposeTRSBatch(translations.data(), rotations.data(), scales.data(), out.data(), count);
+		});
+		const double normal = BestOfMilliseconds(repeats, [&]() {
+			MatrixKernels::NormalMatrixBatch(models.data(), out.data(), count);
+		});
+		std::printf("%-8s %10.3f %10.3f %10.3f\n", path, multiply, trs, normal);
+	}
+
+	CpuDispatch::SetMaxLevel(previousCap);
+	MatrixKernels::Reselect();
+	return 0;
+}
+
+int RunMeshLodBenchmark()
+{
+	// A grid of gentle bumps, colored by height: position then color.
+	const std::uint32_t side = 96;
+	const std::uint32_t floatsPerVertex = 6;
+	std::vector<float> vertices;
+	for (std::uint32_t y = 0; y < side; ++y)
+	{
+		for (std::uint32_t x = 0; x < side; ++x)
+		{
+			const float u = static_cast<float>(x) / (side - 1);
+			const float v = static_cast<float>(y) / (side - 1);
+			const float height = 0.05f * std::sin(6.0f * u) * std::cos(4.0f * v) + 0.01f * std::sin(31.0f * u * v);
+			vertices.insert(vertices.end(), { u, v, height, 0.5f + 5.0f * height, 0.5f, 0.5f - 5.0f * height });
+		}
+	}
+	const std::uint32_t vertexCount = side * side;
+	std::vector<std::uint32_t> indices;
+	for (std::uint32_t y = 0; y + 1 < side; ++y)
+	{
+		for (std::uint32_t x = 0; x + 1 < side; ++x)
+		{
+			const std::uint32_t i = y * side + x;
+			indices.insert(indices.end(), { i, i + 1, i + side, i + 1, i + side + 1, i + side });
+		}
+	}
+
+	std::vector<MeshLod::Lod> lods;
+	std::vector<std::uint32_t> chain;
+	const double milliseconds = BestOfMilliseconds(3, [&]() {
+		chain = indices;
+		lods = MeshLod::BuildChain(vertices.data(), vertexCount, floatsPerVertex, &chain);
+	});
+	std::printf("%u vertices, %u triangles: %zu levels in %.3f ms (best of 3)\n",
+		vertexCount, static_cast<std::uint32_t>(indices.size() / 3), lods.size(), milliseconds);
+	std::printf("%-6s %10s %12s %12s\n", "level", "triangles", "error", "measured");
+
+	auto position = [&](std::uint32_t vertex) {
+		return glm::vec3(vertices[vertex * floatsPerVertex], vertices[vertex * floatsPerVertex + 1], vertices[vertex * floatsPerVertex + 2]);
+	};
+
+	bool passed = lods.size() > 1;
+	for (std::size_t level = 0; level < lods.size(); ++level)
+	{
+		const MeshLod::Lod& lod = lods[level];
+		const std::uint32_t* levelIndices = chain.data() + lod.mFirstIndex;
+
+		// How far the original vertices are from this level's surface.
+		float measured = 0.0f;
+		std::vector<bool> used(vertexCount, false);
+		for (std::uint32_t i = 0; i < lod.mIndexCount; ++i)
+		{
+			used[levelIndices[i]] = true;
+		}
+		for (std::uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+		{
+			const glm::vec3 p = position(vertex);
+			float nearest = 1e30f;
+			for (std::uint32_t i = 0; i < lod.mIndexCount && nearest > 0.0f; i += 3)
+			{
+				const glm::vec3 closest = ClosestPointOnTriangle(p,
+					position(levelIndices[i]), position(levelIndices[i + 1]), position(levelIndices[i + 2]));
+				nearest = std::min(nearest, glm::length(p - closest));
+			}
+			measured = std::max(measured, nearest);
+		}
+
+		bool ok = measured <= lod.mError + 1e-5f;
+		if (level > 0)
+		{
+			const MeshLod::Lod& previous = lods[level - 1];
+			ok = ok && lod.mIndexCount < previous.mIndexCount && lod.mError >= previous.mError;
+		}
+		// The border vertices are locked, so every level still has them all.
+		for (std::uint32_t i = 0; i < side; ++i)
+		{
+			ok = ok && used[i] && used[(side - 1) * side + i] && used[i * side] && used[i * side + side - 1];
+		}
+		std::printf("%-6zu %10u %12.6f %12.6f %s\n", level, lod.mIndexCount / 3, lod.mError, measured, ok ? "" : "FAILED");
+		passed = passed && ok;
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+int RunMeshletBenchmark()
+{
+	// A sphere with a few octaves of ripples, about as dense as a 3D scan:
+	// a latitude/longitude grid, its seam and poles duplicated. Position then color.
+	const std::uint32_t stacks = 224;
+	const std::uint32_t slices = 448;
+	const std::uint32_t floatsPerVertex = 6;
+	std::vector<float> vertices;
+	for (std::uint32_t stack = 0; stack <= stacks; ++stack)
+	{
+		for (std::uint32_t slice = 0; slice <= slices; ++slice)
+		{
+			const float theta = 3.14159265f * stack / stacks;
+			const float phi = 6.28318531f * slice / slices;
+			const float radius = 1.0f + 0.004f * std::sin(40.0f * theta) * std::sin(37.0f * phi) + 0.001f * std::sin(97.0f * theta + 53.0f * phi);
+			const glm::vec3 p = radius * glm::vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+			vertices.insert(vertices.end(), { p.x, p.y, p.z, 0.5f + p.x * 0.5f, 0.5f + p.y * 0.5f, 0.5f + p.z * 0.5f });
+		}
+	}
+	const std::uint32_t vertexCount = (stacks + 1) * (slices + 1);
+	auto position = [&](std::uint32_t vertex) {
+		return glm::vec3(vertices[vertex * floatsPerVertex], vertices[vertex * floatsPerVertex + 1], vertices[vertex * floatsPerVertex + 2]);
+	};
+	// Counter-clockwise seen from outside.
+	std::vector<std::uint32_t> indices;
+	for (std::uint32_t stack = 0; stack < stacks; ++stack)
+	{
+		for (std::uint32_t slice = 0; slice < slices; ++slice)
+		{
+			const std::uint32_t i = stack * (slices + 1) + slice;
+			indices.insert(indices.end(), { i, i + 1, i + slices + 1, i + 1, i + slices + 2, i + slices + 1 });
+		}
+	}
+	const std::uint32_t triangleCount = static_cast<std::uint32_t>(indices.size() / 3);
+
+	std::vector<Meshlets::Meshlet> meshlets;
+	std::vector<std::uint32_t> clustered;
+	const double milliseconds = BestOfMilliseconds(3, [&]() {
+		clustered = indices;
+		meshlets = Meshlets::Build(vertices.data(), vertexCount, floatsPerVertex, clustered.data(), static_cast<std::uint32_t>(clustered.size()));
+	});
+	std::printf("%u vertices, %u triangles: %zu meshlets (%.1f triangles each) in %.3f ms (best of 3)\n",
+		vertexCount, triangleCount, meshlets.size(), static_cast<double>(triangleCount) / meshlets.size(), milliseconds);
+
+	// The meshlets cover the indices end to end and stay within their limits.
+	bool passed = !meshlets.empty();
+	std::uint32_t next = 0;
+	for (const Meshlets::Meshlet& meshlet : meshlets)
+	{
+		const std::set<std::uint32_t> distinct(clustered.begin() + meshlet.mFirstIndex,
+			clustered.begin() + meshlet.mFirstIndex + meshlet.mIndexCount);
+		passed = passed && meshlet.mFirstIndex == next && meshlet.mIndexCount % 3 == 0
+			&& meshlet.mIndexCount / 3 <= Meshlets::MaxTriangles && distinct.size() <= Meshlets::MaxVertices;
+		next = meshlet.mFirstIndex + meshlet.mIndexCount;
+	}
+	passed = passed && next == indices.size();
+	// Every triangle is still there, winding included.
+	auto sortedTriangles = [](const std::vector<std::uint32_t>& list) {
+		std::vector<std::uint64_t> keys;
+		for (std::size_t i = 0; i < list.size(); i += 3)
+		{
+			// Rotated so the smallest index comes first, which keeps the winding.
+			std::size_t first = i + ((list[i + 1] < list[i]) ? 1 : 0);
+			first = (list[i + 2] < list[first]) ? i + 2 : first;
+			const std::size_t offset = first - i;
+			keys.push_back((static_cast<std::uint64_t>(list[i + offset]) << 42)
+				| (static_cast<std::uint64_t>(list[i + (offset + 1) % 3]) << 21) | list[i + (offset + 2) % 3]);
+		}
+		std::sort(keys.begin(), keys.end());
+		return keys;
+	};
+	passed = passed && sortedTriangles(clustered) == sortedTriangles(indices);
+	std::printf("Meshlet limits and triangles: %s\n", passed ? "ok" : "FAILED");
+
+	// Orbit the sphere from far enough to see all of it, and from up close
+	// where the frustum clips most of it.
+	const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 20.0f);
+	std::printf("%-9s %12s %12s %10s %10s\n", "distance", "meshlets", "triangles", "ranges", "cull us");
+	for (float distance : { 4.0f, 1.6f })
+	{
+		const int views = 32;
+		const int repeats = 20;
+		double keptMeshlets = 0.0, keptTriangles = 0.0, ranges = 0.0, microseconds = 0.0;
+		bool ok = true;
+		for (int view = 0; view < views; ++view)
+		{
+			const float angle = 6.28318531f * view / views;
+			const glm::vec3 eye = distance * glm::vec3(std::cos(angle), 0.4f * std::sin(2.0f * angle), std::sin(angle));
+			const glm::mat4 modelViewProjection = projection * glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+			std::vector<Meshlets::Range> visible;
+			std::size_t count = 0;
+			microseconds += 1000.0 * BestOfMilliseconds(repeats, [&]() {
+				count = Meshlets::Cull(meshlets, modelViewProjection, true, &visible);
+			});
+			ok = ok && glm::length(Meshlets::GetEyePosition(modelViewProjection) - eye) < 1e-3f;
+
+			// Culling is conservative: whatever was dropped faced away or was
+			// entirely outside one of the clip planes.
+			std::vector<bool> drawn(triangleCount, false);
+			std::uint32_t triangles = 0;
+			for (const Meshlets::Range& range : visible)
+			{
+				triangles += range.mIndexCount / 3;
+				for (std::uint32_t i = range.mFirstIndex; i < range.mFirstIndex + range.mIndexCount; i += 3)
+				{
+					drawn[i / 3] = true;
+				}
+			}
+			for (std::uint32_t triangle = 0; triangle < triangleCount && ok; ++triangle)
+			{
+				if (drawn[triangle])
+				{
+					continue;
+				}
+				const glm::vec3 p0 = position(clustered[triangle * 3]);
+				const glm::vec3 p1 = position(clustered[triangle * 3 + 1]);
+				const glm::vec3 p2 = position(clustered[triangle * 3 + 2]);
+				const bool backFacing = glm::dot(glm::cross(p1 - p0, p2 - p0), p0 - eye) >= -1e-6f;
+				const glm::vec4 c0 = modelViewProjection * glm::vec4(p0, 1.0f);
+				const glm::vec4 c1 = modelViewProjection * glm::vec4(p1, 1.0f);
+				const glm::vec4 c2 = modelViewProjection * glm::vec4(p2, 1.0f);
+				bool outside = false;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					outside = outside || (c0[axis] > c0.w && c1[axis] > c1.w && c2[axis] > c2.w)
+						|| (c0[axis] < -c0.w && c1[axis] < -c1.w && c2[axis] < -c2.w);
+				}
+				ok = backFacing || outside;
+			}
+
+			keptMeshlets += static_cast<double>(count) / meshlets.size();
+			keptTriangles += static_cast<double>(triangles) / triangleCount;
+			ranges += static_cast<double>(visible.size());
+		}
+		std::printf("%-9.1f %11.1f%% %11.1f%% %10.1f %10.2f %s\n", distance,
+			100.0 * keptMeshlets / views, 100.0 * keptTriangles / views, ranges / views, microseconds / views, ok ? "" : "FAILED");
+		passed = passed && ok;
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+namespace {
+
+	void Append16(std::vector<std::uint8_t>* out, std::uint32_t value)
+	{
+		out->insert(out->end(), { static_cast<std::uint8_t>(value), static_cast<std::uint8_t>(value >> 8) });
+	}
+
+	void Append32(std::vector<std::uint8_t>* out, std::uint32_t value, bool bigEndian = false)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			out->push_back(static_cast<std::uint8_t>(value >> (bigEndian ? 24 - 8 * i : 8 * i)));
+		}
+	}
+
+	/// <summary>
+	/// A 32 bit TGA, top to bottom, run length encoded.
+	/// </summary>
+	std::vector<std::uint8_t> EncodeTga(const ImageLoader::Level& level)
+	{
+		std::vector<std::uint8_t> out = { 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+		Append16(&out, level.mWidth);
+		Append16(&out, level.mHeight);
+		out.insert(out.end(), { 32, 0x28 });
+		for (std::uint32_t y = level.mHeight; y-- > 0;)
+		{
+			for (std::uint32_t x = 0; x < level.mWidth;)
+			{
+				// Runs of equal texels, raw packets of one otherwise.
+				const std::uint8_t* texel = &level.mPixels[(static_cast<std::size_t>(y) * level.mWidth + x) * 4];
+				std::uint32_t run = 1;
+				while (x + run < level.mWidth && run < 128 && std::memcmp(texel, texel + run * 4, 4) == 0)
+				{
+					++run;
+				}
+				out.push_back(static_cast<std::uint8_t>(run > 1 ? 0x80 | (run - 1) : 0));
+				out.insert(out.end(), { texel[2], texel[1], texel[0], texel[3] });
+				x += run;
+			}
+		}
+		return out;
+	}
+
+	/// <summary>
+	/// An 8 bit RGBA PNG, every row Paeth filtered, deflated as stored blocks.
+	/// </summary>
+	std::vector<std::uint8_t> EncodePng(const ImageLoader::Level& level)
+	{
+		const std::size_t stride = static_cast<std::size_t>(level.mWidth) * 4;
+		std::vector<std::uint8_t> filtered;
+		for (std::uint32_t y = level.mHeight; y-- > 0;)
+		{
+			const std::uint8_t* row = &level.mPixels[y * stride];
+			const std::uint8_t* above = (y + 1 < level.mHeight) ? row + stride : nullptr;
+			filtered.push_back(4);
+			for (std::size_t x = 0; x < stride; ++x)
+			{
+				const int a = (x >= 4) ? row[x - 4] : 0;
+				const int b = above ? above[x] : 0;
+				const int c = (above && x >= 4) ? above[x - 4] : 0;
+				const int p = a + b - c;
+				const int predictor = (std::abs(p - a) <= std::abs(p - b) && std::abs(p - a) <= std::abs(p - c))
+					? a : (std::abs(p - b) <= std::abs(p - c) ? b : c);
+				filtered.push_back(static_cast<std::uint8_t>(row[x] - predictor));
+			}
+		}
+
+		std::vector<std::uint8_t> zlib = { 0x78, 0x01 };
+		for (std::size_t offset = 0; offset < filtered.size(); offset += 65535)
+		{
+			const std::uint32_t length = static_cast<std::uint32_t>(std::min<std::size_t>(65535, filtered.size() - offset));
+			zlib.push_back(offset + length == filtered.size() ? 1 : 0);
+			Append16(&zlib, length);
+			Append16(&zlib, length ^ 0xFFFFu);
+			zlib.insert(zlib.end(), filtered.begin() + offset, filtered.begin() + offset + length);
+		}
+		// The Adler-32 the loader doesn't check.
+		Append32(&zlib, 0);
+
+		std::vector<std::uint8_t> out = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		auto chunk = [&](const char* type, const std::vector<std::uint8_t>& data) {
+			Append32(&out, static_cast<std::uint32_t>(data.size()), true);
+			out.insert(out.end(), type, type + 4);
+			out.insert(out.end(), data.begin(), data.end());
+			// Nor the CRC.
+			Append32(&out, 0);
+		};
+		std::vector<std::uint8_t> header;
+		Append32(&header, level.mWidth, true);
+		Append32(&header, level.mHeight, true);
+		header.insert(header.end(), { 8, 6, 0, 0, 0 });
+		chunk("IHDR", header);
+		chunk("IDAT", zlib);
+		chunk("IEND", {});
+		return out;
+	}
+
+	/// <summary>
+	/// An R8G8B8A8_UNORM KTX2 with the given levels, top to bottom (the default orientation).
+	/// </summary>
+	std::vector<std::uint8_t> EncodeKtx2(const std::vector<ImageLoader::Level>& levels)
+	{
+		std::vector<std::uint8_t> out = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		for (std::uint32_t value : { 37u, 1u, levels[0].mWidth, levels[0].mHeight, 0u, 0u, 1u, static_cast<std::uint32_t>(levels.size()), 0u })
+		{
+			Append32(&out, value);
+		}
+		// No data format descriptor, key/value data or supercompression data.
+		out.resize(80, 0);
+		std::size_t offset = 80 + levels.size() * 24;
+		for (const ImageLoader::Level& level : levels)
+		{
+			Append32(&out, static_cast<std::uint32_t>(offset));
+			Append32(&out, 0);
+			for (int i = 0; i < 2; ++i)
+			{
+				Append32(&out, static_cast<std::uint32_t>(level.mPixels.size()));
+				Append32(&out, 0);
+			}
+			offset += level.mPixels.size();
+		}
+		for (const ImageLoader::Level& level : levels)
+		{
+			const std::size_t stride = static_cast<std::size_t>(level.mWidth) * 4;
+			for (std::uint32_t y = level.mHeight; y-- > 0;)
+			{
+				out.insert(out.end(), level.mPixels.begin() + y * stride, level.mPixels.begin() + (y + 1) * stride);
+			}
+		}
+		return out;
+	}
+
+	/// <summary>
+	/// Smooth waves with a fine grain on top, and flat patches for RLE to find.
+	/// </summary>
+	ImageLoader::Level MakeTestImage(std::uint32_t width, std::uint32_t height, std::uint32_t seed)
+	{
+		ImageLoader::Level level;
+		level.mWidth = width;
+		level.mHeight = height;
+		level.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+		std::uint32_t random = seed * 2654435761u + 1;
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			for (std::uint32_t x = 0; x < width; ++x)
+			{
+				const std::uint32_t noise = NextRandomBits(random);
+				std::uint8_t* texel = &level.mPixels[(static_cast<std::size_t>(y) * width + x) * 4];
+				const bool flat = ((x / 16 + y / 16) % 3) == 0;
+				texel[0] = flat ? 200 : static_cast<std::uint8_t>(128 + 100 * std::sin(0.05f * x + seed));
+				texel[1] = flat ? 40 : static_cast<std::uint8_t>(128 + 100 * std::cos(0.07f * y));
+				texel[2] = flat ? 90 : static_cast<std::uint8_t>(noise >> 16);
+				texel[3] = static_cast<std::uint8_t>(255 - (x ^ y) % 64);
+			}
+		}
+		return level;
+	}
+}
+
+int RunTextureBenchmark()
+{
+	bool passed = true;
+
+	// Loaders: what we encode comes back unchanged.
+	{
+		const ImageLoader::Level source = MakeTestImage(301, 157, 1);
+		std::vector<ImageLoader::Level> chain = { source };
+		chain.push_back(MipGenerator::Downsample(source, MipGenerator::Filter::Box));
+		const std::pair<const char*, std::vector<std::uint8_t>> files[] = {
+			{ "TGA", EncodeTga(source) },
+			{ "PNG", EncodePng(source) },
+			{ "KTX2", EncodeKtx2(chain) },
+		};
+		for (const auto& file : files)
+		{
+			ImageLoader::Image image;
+			std::string error;
+			const bool decoded = ImageLoader::Decode(file.second.data(), file.second.size(), &image, &error);
+			bool ok = decoded && !image.mLevels.empty() && image.mLevels[0].mWidth == source.mWidth
+				&& image.mLevels[0].mHeight == source.mHeight && image.mLevels[0].mPixels == source.mPixels;
+			if (std::strcmp(file.first, "KTX2") == 0)
+			{
+				ok = ok && image.mLevels.size() == 2 && image.mLevels[1].mPixels == chain[1].mPixels;
+			}
+			std::printf("%-5s %8zu bytes: %s %s\n", file.first, file.second.size(), ok ? "ok" : "FAILED", error.c_str());
+			passed = passed && ok;
+		}
+	}
+
+	// Mip chains of a 2048x2048 image, per filter and path.
+	{
+		const ImageLoader::Level source = MakeTestImage(2048, 2048, 2);
+		std::printf("\nMip chain of 2048x2048, best of 5 (ms)\n%-8s %10s %10s\n", "path", "box", "kaiser");
+		ImageLoader::Image reference[2];
+		const SimdLevel previousCap = CpuDispatch::GetMaxLevel();
+		for (SimdLevel simd : { SimdLevel::Scalar, SimdLevel::SSE2 })
+		{
+			const char* path = CpuDispatch::GetLevelName(simd);
+			if (!CpuDispatch::IsSupported(simd))
+			{
+				std::printf("%-8s (not supported on this CPU)\n", path);
+				continue;
+			}
+			CpuDispatch::SetMaxLevel(simd);
+			MipGenerator::Reselect();
+			if (std::strcmp(MipGenerator::GetActivePathName(), path) != 0)
+			{
+				std::printf("%-8s (not built for this target)\n", path);
+				continue;
+			}
+			double milliseconds[2];
+			bool same = true;
+			for (int filter = 0; filter < 2; ++filter)
+			{
+				ImageLoader::Image image;
+				milliseconds[filter] = BestOfMilliseconds(5, [&]() {
+					image.mLevels.assign(1, source);
+					MipGenerator::BuildChain(&image, static_cast<MipGenerator::Filter>(filter));
+				});
+				same = same && image.mLevels.size() == 12 && image.mLevels.back().mWidth == 1;
+				if (reference[filter].mLevels.empty())
+				{
+					reference[filter] = image;
+				}
+				for (std::size_t level = 0; level < image.mLevels.size(); ++level)
+				{
+					same = same && image.mLevels[level].mPixels == reference[filter].mLevels[level].mPixels;
+				}
+			}
+			std::printf("%-8s %10.3f %10.3f %s\n", path, milliseconds[0], milliseconds[1], same ? "" : "FAILED (differs from scalar)");
+			passed = passed && same;
+		}
+		CpuDispatch::SetMaxLevel(previousCap);
+		MipGenerator::Reselect();
+	}
+
+	// Streaming: a row of textures, flown past by a camera that wants
+	// full detail up close and less further away.
+	{
+		const std::uint32_t textureCount = 24;
+		TextureManager::Settings settings;
+		settings.mBudgetBytes = 6u * 1024u * 1024u;
+		settings.mUploadBytesPerUpdate = 1024u * 1024u;
+		settings.mKeepUpdates = 10;
+		settings.mFilter = MipGenerator::Filter::Box;
+		TextureManager textures;
+		textures.Create(TextureBackends::GetStub(), settings);
+		std::vector<ImageLoader::Level> images;
+		for (std::uint32_t i = 0; i < textureCount; ++i)
+		{
+			images.push_back(MakeTestImage(512, 512, i));
+		}
+		std::vector<TextureManager::Handle> handles;
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (const ImageLoader::Level& image : images)
+		{
+			handles.push_back(textures.CreateFromPixels(image.mWidth, image.mHeight, image.mPixels.data()));
+		}
+		textures.WaitForLoads();
+		const double loadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		const int frames = 400;
+		std::size_t peakResident = 0;
+		std::size_t totalUploaded = 0;
+		std::uint32_t evictions = 0;
+		std::uint32_t streamIns = 0;
+		double unmet = 0.0;
+		bool ok = true;
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			const float cameraX = (static_cast<float>(frame) / frames) * (textureCount + 4) - 2.0f;
+			for (std::uint32_t i = 0; i < textureCount; ++i)
+			{
+				// A 1 unit quad 'distance' away covers 1000 / distance pixels.
+				const float distance = std::max(0.25f, std::abs(cameraX - i));
+				if (distance < 6.0f)
+				{
+					textures.RequestLevel(handles[i], TextureManager::GetDesiredLevel(512, 512, 1000.0f / distance));
+				}
+			}
+			textures.Update();
+
+			const TextureManager::Stats& stats = textures.GetStats();
+			ok = ok && stats.mResidentBytes == TextureBackends::GetStubAllocatedBytes();
+			ok = ok && stats.mResidentBytes <= std::max(settings.mBudgetBytes, stats.mTailBytes);
+			peakResident = std::max(peakResident, stats.mResidentBytes);
+			totalUploaded += stats.mUploadedBytes;
+			evictions += stats.mEvictions;
+			streamIns += stats.mStreamIns;
+			for (std::uint32_t i = 0; i < textureCount; ++i)
+			{
+				const float distance = std::max(0.25f, std::abs(cameraX - i));
+				const float desired = TextureManager::GetDesiredLevel(512, 512, 1000.0f / distance);
+				unmet += (distance < 6.0f && textures.GetResidentLevel(handles[i]) > std::floor(desired)) ? 1.0 : 0.0;
+			}
+		}
+		ok = ok && evictions > 0 && streamIns > 0;
+		std::printf("\n%u textures of 512x512 (%s backend), decoded and mipped on worker threads in %.1f ms\n",
+			textureCount, TextureBackends::GetStub()->mName, loadMilliseconds);
+		std::printf("Budget %.1f MB (tails %.2f MB): peak %.2f MB resident, %.1f MB uploaded over %d frames\n",
+			settings.mBudgetBytes / 1048576.0, textures.GetStats().mTailBytes / 1048576.0, peakResident / 1048576.0,
+			totalUploaded / 1048576.0, frames);
+		std::printf("%u stream-ins, %u evictions, %.2f visible textures per frame below their wanted level %s\n",
+			streamIns, evictions, unmet / frames, ok ? "" : "FAILED");
+		textures.Destroy();
+		ok = ok && TextureBackends::GetStubAllocatedBytes() == 0;
+		passed = passed && ok;
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+namespace {
+
+	/// <summary>
+	/// Peak signal to noise ratio of 'b' against 'a' over the first
+	/// 'channels' channels; with 'opaqueOnly', of the texels BC1 keeps.
+	/// </summary>
+	double GetPsnr(const ImageLoader::Level& a, const ImageLoader::Level& b, int channels, bool opaqueOnly = false)
+	{
+		double sum = 0.0;
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < a.mPixels.size(); i += 4)
+		{
+			if (opaqueOnly && a.mPixels[i + 3] < 128)
+			{
+				continue;
+			}
+			for (int channel = 0; channel < channels; ++channel)
+			{
+				const double difference = static_cast<double>(a.mPixels[i + channel]) - b.mPixels[i + channel];
+				sum += difference * difference;
+				++count;
+			}
+		}
+		const double mse = sum / static_cast<double>(count);
+		return (mse > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+	}
+
+	/// <summary>
+	/// Smooth gradients with soft edges, closer to a real texture than
+	/// MakeTestImage()'s noise, which no block format can keep.
+	/// </summary>
+	ImageLoader::Level MakeSmoothTestImage(std::uint32_t width, std::uint32_t height)
+	{
+		ImageLoader::Level level;
+		level.mWidth = width;
+		level.mHeight = height;
+		level.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			for (std::uint32_t x = 0; x < width; ++x)
+			{
+				std::uint8_t* texel = &level.mPixels[(static_cast<std::size_t>(y) * width + x) * 4];
+				const float u = static_cast<float>(x) / width;
+				const float v = static_cast<float>(y) / height;
+				const float ring = 0.5f + 0.5f * std::sin(40.0f * std::sqrt((u - 0.5f) * (u - 0.5f) + (v - 0.5f) * (v - 0.5f)));
+				texel[0] = static_cast<std::uint8_t>(255.0f * u);
+				texel[1] = static_cast<std::uint8_t>(255.0f * ring);
+				texel[2] = static_cast<std::uint8_t>(255.0f * (1.0f - v) * ring);
+				texel[3] = static_cast<std::uint8_t>(((x / 32 + y / 32) % 2) ? 255 : 64 + 128 * v);
+			}
+		}
+		return level;
+	}
+
+	bool WriteFile(const char* path, const std::vector<std::uint8_t>& data)
+	{
+		std::FILE* file = std::fopen(path, "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+		const bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+		return (std::fclose(file) == 0) && ok;
+	}
+}
+
+int RunBlockCompressionBenchmark()
+{
+	using BlockCompressor::Format;
+	using BlockCompressor::Quality;
+	bool passed = true;
+	const Format formats[] = { Format::BC1, Format::BC3, Format::BC5, Format::BC7 };
+	const Quality qualities[] = { Quality::Fast, Quality::Normal, Quality::High };
+	const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+	// Every format and quality on a 1024x1024 image, on every core.
+	{
+		const ImageLoader::Level source = MakeSmoothTestImage(1024, 1024);
+		std::printf("1024x1024 on %u threads (%s): ms, Mtexels/s and PSNR (dB)\n%-6s", threads,
+			BlockCompressor::GetActivePathName(), "");
+		for (Quality quality : qualities)
+		{
+			std::printf(" %26s", BlockCompressor::GetName(quality));
+		}
+		std::printf("\n");
+		for (Format format : formats)
+		{
+			// What each format keeps: BC1 has no real alpha, BC5 only red and green.
+			const int channels = (format == Format::BC1) ? 3 : (format == Format::BC5) ? 2 : 4;
+			std::printf("%-6s", BlockCompressor::GetName(format));
+			double previous = 0.0;
+			bool ok = true;
+			for (Quality quality : qualities)
+			{
+				ImageLoader::Level blocks;
+				const double milliseconds = BestOfMilliseconds(2, [&]() {
+					blocks = BlockCompressor::Compress(source, format, quality, threads);
+				});
+				const double psnr = GetPsnr(source, BlockCompressor::Decompress(blocks, format), channels, format == Format::BC1);
+				ok = ok && blocks.mPixels.size() == BlockCompressor::GetLevelBytes(BlockCompressor::GetGLFormat(format), 1024, 1024);
+				// More effort never loses more than rounding.
+				ok = ok && psnr >= previous - 0.01 && psnr > 30.0;
+				previous = psnr;
+				std::printf(" %9.1f %7.1f %8.2f", milliseconds, 1024.0 * 1024.0 / 1000.0 / milliseconds, psnr);
+			}
+			std::printf(" %s\n", ok ? "" : "FAILED");
+			passed = passed && ok;
+		}
+	}
+
+	// Paths and thread counts must not change a single block.
+	{
+		const ImageLoader::Level source = MakeSmoothTestImage(512, 512);
+		std::printf("\nBC7 normal, 512x512 (ms)\n");
+		ImageLoader::Level reference;
+		const SimdLevel previousCap = CpuDispatch::GetMaxLevel();
+		for (SimdLevel simd : { SimdLevel::Scalar, SimdLevel::SSE2 })
+		{
+			const char* path = CpuDispatch::GetLevelName(simd);
+			if (!CpuDispatch::IsSupported(simd))
+			{
+				std::printf("%-8s (not supported on this CPU)\n", path);
+				continue;
+			}
+			CpuDispatch::SetMaxLevel(simd);
+			BlockCompressor::Reselect();
+			if (std::strcmp(BlockCompressor::GetActivePathName(), path) != 0)
+			{
+				std::printf("%-8s (not built for this target)\n", path);
+				continue;
+			}
+			for (unsigned count : { 1u, std::max(4u, threads) })
+			{
+				ImageLoader::Level blocks;
+				const double milliseconds = BestOfMilliseconds(3, [&]() {
+					blocks = BlockCompressor::Compress(source, Format::BC7, Quality::Normal, count);
+				});
+				if (reference.mPixels.empty())
+				{
+					reference = blocks;
+				}
+				const bool same = blocks.mPixels == reference.mPixels;
+				std::printf("%-8s %2u thread(s) %9.2f %s\n", path, count, milliseconds, same ? "" : "FAILED (differs from scalar, 1 thread)");
+				passed = passed && same;
+			}
+		}
+		CpuDispatch::SetMaxLevel(previousCap);
+		BlockCompressor::Reselect();
+	}
+
+	// Sizes that aren't a multiple of the block. The tiny ones are a
+	// single color: four arbitrary colors are beyond any of the formats.
+	{
+		bool ok = true;
+		for (const std::pair<std::uint32_t, std::uint32_t>& size : { std::make_pair(301u, 157u), std::make_pair(2u, 2u), std::make_pair(1u, 1u) })
+		{
+			ImageLoader::Level source = MakeSmoothTestImage(size.first, size.second);
+			if (size.first < 4)
+			{
+				for (std::size_t i = 0; i < source.mPixels.size(); ++i)
+				{
+					source.mPixels[i] = static_cast<std::uint8_t>(60 + 50 * (i % 4));
+				}
+			}
+			for (Format format : formats)
+			{
+				const ImageLoader::Level blocks = BlockCompressor::Compress(source, format, Quality::Normal, threads);
+				const ImageLoader::Level back = BlockCompressor::Decompress(blocks, format);
+				ok = ok && blocks.mPixels.size() == BlockCompressor::GetLevelBytes(BlockCompressor::GetGLFormat(format), size.first, size.second);
+				ok = ok && back.mWidth == size.first && back.mHeight == size.second && GetPsnr(source, back, 2, format == Format::BC1) > 25.0;
+			}
+		}
+		std::printf("\nOdd sizes: %s\n", ok ? "ok" : "FAILED");
+		passed = passed && ok;
+	}
+
+	// Cache files: the first load compresses and writes one, the second
+	// reads it, and a changed source makes it stale.
+	{
+		const char* sourcePath = "bench-bcn.tga";
+		const std::string cachePath = TextureCache::GetPath(sourcePath, Format::BC7);
+		std::remove(cachePath.c_str());
+		bool ok = WriteFile(sourcePath, EncodeTga(MakeSmoothTestImage(1024, 1024)));
+
+		TextureManager::Settings settings;
+		settings.mCompress = true;
+		settings.mFormat = Format::BC7;
+		settings.mQuality = Quality::Normal;
+		std::vector<std::uint8_t> firstBlocks;
+		const auto load = [&](std::uint32_t* hits, std::uint32_t* writes, std::size_t* resident) {
+			TextureManager textures;
+			textures.Create(TextureBackends::GetStub(), settings);
+			const auto start = std::chrono::high_resolution_clock::now();
+			textures.Load(sourcePath);
+			textures.WaitForLoads();
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+			textures.RequestLevel(0, 0.0f);
+			textures.Update();
+			*hits = textures.GetStats().mCacheHits;
+			*writes = textures.GetStats().mCacheWrites;
+			*resident = textures.GetStats().mResidentBytes;
+			textures.Destroy();
+			return milliseconds;
+		};
+		std::uint32_t hits[3] = {};
+		std::uint32_t writes[3] = {};
+		std::size_t resident[3] = {};
+		const double compressMilliseconds = load(&hits[0], &writes[0], &resident[0]);
+		const double cachedMilliseconds = load(&hits[1], &writes[1], &resident[1]);
+		ok = ok && hits[0] == 0 && writes[0] == 1 && hits[1] == 1 && writes[1] == 0 && resident[0] == resident[1];
+
+		// The full chain of a 1024x1024 BC7 texture: a quarter of RGBA8's, plus the 1x1 and 2x2 blocks.
+		std::size_t expected = 0;
+		for (std::uint32_t side = 1024; side >= 1; side /= 2)
+		{
+			expected += BlockCompressor::GetLevelBytes(GL_COMPRESSED_RGBA_BPTC_UNORM_ARB, side, side);
+		}
+		ok = ok && resident[0] == expected;
+
+		ok = ok && WriteFile(sourcePath, EncodeTga(MakeSmoothTestImage(1024, 1023)));
+		load(&hits[2], &writes[2], &resident[2]);
+		ok = ok && hits[2] == 0 && writes[2] == 1;
+		std::remove(sourcePath);
+		std::remove(cachePath.c_str());
+
+		std::printf("\nLoading a 1024x1024 TGA as BC7: %.1f ms compressing, %.1f ms from %s; %.2f MB resident (RGBA8 %.2f MB) %s\n",
+			compressMilliseconds, cachedMilliseconds, cachePath.c_str(), resident[0] / 1048576.0,
+			1024.0 * 1024.0 * 4.0 * 4.0 / 3.0 / 1048576.0, ok ? "" : "FAILED");
+		passed = passed && ok;
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+int RunAtlasBenchmark()
+{
+	bool passed = true;
+	const std::uint32_t size = 2048;
+	struct Distribution {
+		const char*		mName;
+		std::uint32_t	mMin;
+		std::uint32_t	mMax;
+		// Height is width times up to this, or divided by it.
+		std::uint32_t	mAspect;
+	};
+	const Distribution distributions[] = {
+		{ "icons 8-64", 8, 64, 1 },
+		{ "sprites 16-256", 16, 256, 2 },
+		{ "strips 16-512", 16, 512, 8 },
+	};
+	std::printf("Skyline packing 4000 rectangles into %ux%u, keeping those that fit: occupancy, placed, us per Insert()\n", size, size);
+	std::printf("%-16s %30s %30s\n", "", "as generated", "tallest first");
+	for (const Distribution& distribution : distributions)
+	{
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> rects;
+		std::uint32_t random = 12345;
+		for (int i = 0; i < 4000; ++i)
+		{
+			const std::uint32_t width = distribution.mMin + NextRandomBits(random) % (distribution.mMax - distribution.mMin + 1);
+			const std::uint32_t stretch = 1 + NextRandomBits(random) % distribution.mAspect;
+			const std::uint32_t height = NextRandomBits(random) % 2 != 0 ? width * stretch : std::max(1u, width / stretch);
+			rects.emplace_back(width, std::min(height, size));
+		}
+
+		std::printf("%-16s", distribution.mName);
+		for (bool sorted : { false, true })
+		{
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> order = rects;
+			if (sorted)
+			{
+				std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+			}
+			AtlasPacker packer;
+			std::vector<AtlasPacker::Rect> placed;
+			std::vector<std::size_t> placedIndices;
+			const double milliseconds = BestOfMilliseconds(3, [&]() {
+				packer.Create(size, size);
+				placed.clear();
+				placedIndices.clear();
+				AtlasPacker::Rect rect;
+				for (std::size_t i = 0; i < order.size(); ++i)
+				{
+					if (packer.Insert(order[i].first, order[i].second, &rect))
+					{
+						placed.push_back(rect);
+						placedIndices.push_back(i);
+					}
+				}
+			});
+
+			// Every texel is covered at most once, and nothing sticks out.
+			std::vector<std::uint8_t> covered(static_cast<std::size_t>(size) * size, 0);
+			std::uint64_t area = 0;
+			bool ok = true;
+			for (std::size_t i = 0; ok && i < placed.size(); ++i)
+			{
+				const AtlasPacker::Rect& rect = placed[i];
+				ok = rect.mWidth == order[placedIndices[i]].first && rect.mHeight == order[placedIndices[i]].second
+					&& rect.mX + rect.mWidth <= size && rect.mY + rect.mHeight <= size;
+				for (std::uint32_t y = rect.mY; ok && y < rect.mY + rect.mHeight; ++y)
+				{
+					for (std::uint32_t x = rect.mX; ok && x < rect.mX + rect.mWidth; ++x)
+					{
+						ok = covered[static_cast<std::size_t>(y) * size + x]++ == 0;
+					}
+				}
+				area += static_cast<std::uint64_t>(rect.mWidth) * rect.mHeight;
+			}
+			const float occupancy = static_cast<float>(area) / (static_cast<float>(size) * size);
+			ok = ok && std::fabs(occupancy - packer.GetOccupancy()) < 1e-4f;
+			std::printf("  %6.1f%% %6u %8.3f %s", occupancy * 100.0f, static_cast<unsigned>(placed.size()),
+				1000.0 * milliseconds / order.size(), ok ? "  " : "FAILED");
+			passed = passed && ok;
+		}
+		std::printf("\n");
+	}
+
+	// A full packer refuses without changing; one that's cleared is empty again.
+	{
+		AtlasPacker packer;
+		packer.Create(64, 64);
+		AtlasPacker::Rect rect;
+		bool ok = packer.Insert(64, 40, &rect) && packer.Insert(30, 24, &rect)
+			&& !packer.Insert(40, 24, &rect) && !packer.Insert(65, 1, &rect) && !packer.Insert(0, 1, &rect)
+			&& packer.Insert(34, 24, &rect) && rect.mX == 30 && rect.mY == 40
+			&& packer.GetOccupancy() == 1.0f;
+		packer.Clear();
+		ok = ok && packer.GetOccupancy() == 0.0f && packer.Insert(64, 64, &rect);
+		std::printf("Full and cleared packer %s\n", ok ? "ok" : "FAILED");
+		passed = passed && ok;
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+namespace {
+
+	/// <summary>
+	/// 'count' point lights scattered through the first 40 units in front
+	/// of a camera at the origin looking down -z, some of them off screen.
+	/// </summary>
+	std::vector<ClusteredLighting::PointLight> MakeTestLights(std::size_t count)
+	{
+		std::uint32_t random = 7;
+		std::vector<ClusteredLighting::PointLight> lights(count);
+		for (ClusteredLighting::PointLight& light : lights)
+		{
+			const float depth = 0.5f + 40.0f * NextRandom(random);
+			light.mPosition = glm::vec3((2.0f * NextRandom(random) - 1.0f) * depth * 0.7f, (2.0f * NextRandom(random) - 1.0f) * depth * 0.5f, -depth);
+			light.mRadius = 0.2f + 0.8f * NextRandom(random);
+			light.mColor = glm::vec3(NextRandom(random), NextRandom(random), NextRandom(random));
+		}
+		return lights;
+	}
+}
+
+int RunClusteredLightingBenchmark()
+{
+	bool passed = true;
+	const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 680.0f / 480.0f, 0.1f, 100.0f);
+	const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+	const ClusteredLighting::Settings defaults;
+	std::printf("Assigning lights to %ux%ux%u clusters: ms per frame\n", defaults.mClustersX, defaults.mClustersY, defaults.mClustersZ);
+
+	for (std::size_t count : { 1000u, 10000u })
+	{
+		const std::vector<ClusteredLighting::PointLight> lights = MakeTestLights(count);
+
+		// Every light against every cluster, for reference.
+		ClusteredLighting lighting;
+		lighting.SetSettings(defaults);
+		lighting.SetProjection(projection);
+		std::vector<std::uint32_t> reference;
+		std::vector<std::uint32_t> referenceCounts;
+		for (std::uint32_t cluster = 0; cluster < lighting.GetClusterCount(); ++cluster)
+		{
+			glm::vec3 boxMin;
+			glm::vec3 boxMax;
+			lighting.GetClusterBounds(cluster, &boxMin, &boxMax);
+			std::uint32_t hits = 0;
+			for (std::uint32_t i = 0; i < lights.size(); ++i)
+			{
+				const glm::vec3 center = glm::vec3(view * glm::vec4(lights[i].mPosition, 1.0f));
+				const glm::vec3 outside = glm::max(boxMin - center, glm::vec3(0.0f)) + glm::max(center - boxMax, glm::vec3(0.0f));
+				if (outside.x * outside.x + outside.y * outside.y + outside.z * outside.z <= lights[i].mRadius * lights[i].mRadius)
+				{
+					reference.push_back(i);
+					++hits;
+				}
+			}
+			referenceCounts.push_back(hits);
+		}
+		std::uint32_t most = 0;
+		std::uint32_t lit = 0;
+		for (std::uint32_t hits : referenceCounts)
+		{
+			most = std::max(most, hits);
+			lit += (hits > 0) ? 1 : 0;
+		}
+		std::printf("\n%u lights: a fragment shades %.1f on average (%.1f in clusters with any), %u at most\n",
+			static_cast<unsigned>(count), static_cast<double>(reference.size()) / referenceCounts.size(),
+			static_cast<double>(reference.size()) / std::max(1u, lit), most);
+
+		const SimdLevel previousCap = CpuDispatch::GetMaxLevel();
+		for (SimdLevel simd : { SimdLevel::Scalar, SimdLevel::SSE2 })
+		{
+			const char* path = CpuDispatch::GetLevelName(simd);
+			if (!CpuDispatch::IsSupported(simd))
+			{
+				std::printf("%-8s (not supported on this CPU)\n", path);
+				continue;
+			}
+			CpuDispatch::SetMaxLevel(simd);
+			ClusteredLighting::Reselect();
+			if (std::strcmp(ClusteredLighting::GetActivePathName(), path) != 0)
+			{
+				std::printf("%-8s (not built for this target)\n", path);
+				continue;
+			}
+			for (unsigned threadCount : { 1u, std::max(4u, threads) })
+			{
+				ClusteredLighting::Settings settings;
+				settings.mThreads = threadCount;
+				lighting.SetSettings(settings);
+				lighting.SetProjection(projection);
+				const double milliseconds = BestOfMilliseconds(5, [&]() {
+					lighting.Assign(lights, view);
+				});
+
+				// Same lights in the same order as the reference, cluster by cluster.
+				bool same = lighting.GetLightIndices().size() == reference.size();
+				std::size_t next = 0;
+				for (std::uint32_t cluster = 0; same && cluster < lighting.GetClusterCount(); ++cluster)
+				{
+					const std::uint32_t first = lighting.GetClusterRanges()[cluster * 2];
+					const std::uint32_t hits = lighting.GetClusterRanges()[cluster * 2 + 1];
+					same = hits == referenceCounts[cluster]
+						&& std::equal(reference.begin() + next, reference.begin() + next + hits, lighting.GetLightIndices().begin() + first);
+					next += hits;
+				}
+				std::printf("%-8s %2u thread(s) %9.3f %s\n", path, threadCount, milliseconds, same ? "" : "FAILED (differs from every light against every cluster)");
+				passed = passed && same;
+			}
+		}
+		CpuDispatch::SetMaxLevel(previousCap);
+		ClusteredLighting::Reselect();
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+namespace {
+
+	/// <summary>
+	/// Two fountains sharing 'count' slots, each as fast as its half allows,
+	/// like --particles sets up.
+	/// </summary>
+	ParticleSimulation MakeTestParticles(std::uint32_t count, unsigned threads)
+	{
+		ParticleSimulation::Settings settings;
+		settings.mMaxParticles = count;
+		settings.mThreads = threads;
+		ParticleSimulation simulation(settings);
+		for (const float x : { -0.8f, 0.8f })
+		{
+			ParticleSimulation::Emitter emitter;
+			emitter.mPosition = glm::vec3(x, -1.0f, -3.0f);
+			emitter.mVelocity = glm::vec3(-0.3f * x, 2.2f, 0.0f);
+			emitter.mSpread = 0.4f;
+			emitter.mLifetime = 2.0f;
+			emitter.mRate = (static_cast<float>(count / 2) - 2.0f) / (emitter.mLifetime * (1.0f + ParticleSimulation::LifetimeVariation));
+			simulation.AddEmitter(emitter);
+		}
+		return simulation;
+	}
+}
+
+int RunParticleBenchmark()
+{
+	bool passed = true;
+	const float seconds = 1.0f / 60.0f;
+	// Longer than any particle lives, so the slots are as full as they get.
+	const int warmUpSteps = 180;
+	const int timedSteps = 30;
+	const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+	std::printf("CPU reference particle step at %d steps a second: ms per step\n", static_cast<int>(1.0f / seconds + 0.5f));
+
+	for (std::uint32_t count : { 100000u, 1000000u })
+	{
+		std::vector<ParticleSimulation::Particle> reference;
+		for (unsigned threadCount : { 1u, std::max(4u, threads) })
+		{
+			ParticleSimulation simulation = MakeTestParticles(count, threadCount);
+			std::vector<ParticleSimulation::Particle> particles;
+			for (int step = 0; step < warmUpSteps; ++step)
+			{
+				simulation.Step(seconds, &particles);
+			}
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (int step = 0; step < timedSteps; ++step)
+			{
+				simulation.Step(seconds, &particles);
+			}
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / timedSteps;
+
+			// The average lifetime over the longest is how full the ring gets.
+			std::size_t alive = 0;
+			for (const ParticleSimulation::Particle& particle : particles)
+			{
+				alive += (particle.mPositionAge.w < particle.mVelocityLifetime.w) ? 1 : 0;
+			}
+			const double full = static_cast<double>(alive) / simulation.GetUsedSlots();
+			const double expected = 1.0 / (1.0 + ParticleSimulation::LifetimeVariation);
+			const bool plausible = simulation.GetUsedSlots() <= count && std::abs(full - expected) < 0.05;
+
+			// Each slot only depends on itself, so the split can't change anything.
+			if (reference.empty())
+			{
+				reference = particles;
+			}
+			const bool same = particles.size() == reference.size()
+				&& std::memcmp(particles.data(), reference.data(), particles.size() * sizeof(particles[0])) == 0;
+			std::printf("%7u particles %2u thread(s) %9.3f   %.1f%% alive %s%s\n",
+				static_cast<unsigned>(simulation.GetUsedSlots()), threadCount, milliseconds, 100.0 * full,
+				plausible ? "" : "FAILED (not as many alive as the rate says) ",
+				same ? "" : "FAILED (differs from 1 thread)");
+			passed = passed && plausible && same;
+		}
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
+
+int RunAnimationBenchmark()
+{
+	bool passed = true;
+	const AnimationClip::Tolerances tolerances;
+	const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+	// The approximate slerp against glm's, over the angles clips step by.
+	float worstSlerp = 0.0f;
+	std::uint32_t random = 11;
+	for (int i = 0; i < 10000; ++i)
+	{
+		const glm::vec3 axis = glm::normalize(glm::vec3(NextRandom(random) - 0.5f, NextRandom(random) - 0.5f, NextRandom(random) - 0.5f) + glm::vec3(1e-3f));
+		const glm::quat from = glm::angleAxis(6.2831853f * NextRandom(random), axis);
+		const glm::quat to = from * glm::angleAxis(2.0f * NextRandom(random), glm::normalize(glm::vec3(NextRandom(random), NextRandom(random) - 0.5f, 0.5f)));
+		const float t = NextRandom(random);
+		const glm::quat exact = glm::slerp(from, to, t);
+		const glm::quat approximate = AnimationClip::Interpolate(from, to, t);
+		const float cosine = std::min(1.0f, std::fabs(glm::dot(exact, approximate)));
+		worstSlerp = std::max(worstSlerp, 2.0f * std::acos(cosine));
+	}
+	const bool slerpClose = worstSlerp < 2e-3f;
+	std::printf("Approximate slerp: %.2e rad from glm::slerp at most %s\n", worstSlerp, slerpClose ? "" : "FAILED");
+	passed = passed && slerpClose;
+
+	for (std::uint32_t jointCount : { 16u, 64u })
+	{
+		const SkinnedModel model = SkinnedModel::MakeTestCharacter(jointCount);
+		const RawClip& raw = model.mClips[0];
+		const AnimationClip clip = AnimationClip::Compress(raw, tolerances);
+
+		// Every frame of the clip, as it was and as it decodes.
+		float worstRotation = 0.0f;
+		float worstTranslation = 0.0f;
+		float worstScale = 0.0f;
+		std::vector<JointPose> poses(jointCount);
+		for (std::uint32_t frame = 0; frame < raw.mFrameCount; ++frame)
+		{
+			clip.Sample(frame / raw.mFramesPerSecond, poses.data());
+			for (std::uint32_t joint = 0; joint < jointCount; ++joint)
+			{
+				const JointPose& original = raw.mPoses[frame * jointCount + joint];
+				const float cosine = std::min(1.0f, std::fabs(glm::dot(glm::normalize(original.mRotation), poses[joint].mRotation)));
+				worstRotation = std::max(worstRotation, 2.0f * std::acos(cosine));
+				worstTranslation = std::max(worstTranslation, glm::length(original.mTranslation - poses[joint].mTranslation));
+				const glm::vec3 scale = glm::abs(original.mScale - poses[joint].mScale);
+				worstScale = std::max(worstScale, std::max(scale.x, std::max(scale.y, scale.z)));
+			}
+		}
+		// acos loses a little next to 1, where the tolerance was measured with atan2.
+		const bool bounded = worstRotation <= tolerances.mRotation + 5e-4f
+			&& worstTranslation <= tolerances.mTranslation * 1.01f
+			&& worstScale <= tolerances.mScale * 1.01f;
+		std::printf("\n%u joints, %u frames: %d keys of %d, %.1f KiB from %.1f KiB (%.1fx); off by %.2e rad, %.2e, %.2e at most %s\n",
+			jointCount, raw.mFrameCount, static_cast<int>(clip.GetKeyCount()), static_cast<int>(raw.mFrameCount * jointCount * 3),
+			clip.GetByteSize() / 1024.0, raw.GetByteSize() / 1024.0, static_cast<double>(raw.GetByteSize()) / clip.GetByteSize(),
+			worstRotation, worstTranslation, worstScale, bounded ? "" : "FAILED (beyond the tolerances)");
+		passed = passed && bounded;
+
+		// A crowd, as --characters sets up.
+		const std::uint32_t characters = 1000;
+		AnimationSystem animation;
+		for (std::uint32_t i = 0; i < characters; ++i)
+		{
+			animation.AddInstance(&model.mSkeleton, &clip, clip.GetDuration() * i / characters, 0.8f + 0.4f * (i % 7) / 6.0f);
+		}
+		animation.Advance(0.37f);
+
+		// What AnimationClip::Sample() and Skeleton make of the first one.
+		const float seconds = 0.37f * 0.8f;
+		std::vector<glm::mat4> skinning(jointCount);
+		clip.Sample(seconds, poses.data());
+		model.mSkeleton.GetSkinningMatrices(poses.data(), skinning.data());
+
+		std::printf("Posing %u characters: ms per update, characters per second\n", characters);
+		std::vector<glm::vec4> reference;
+		const SimdLevel previousCap = CpuDispatch::GetMaxLevel();
+		for (SimdLevel simd : { SimdLevel::Scalar, SimdLevel::SSE2 })
+		{
+			const char* path = CpuDispatch::GetLevelName(simd);
+			if (!CpuDispatch::IsSupported(simd))
+			{
+				std::printf("%-8s (not supported on this CPU)\n", path);
+				continue;
+			}
+			CpuDispatch::SetMaxLevel(simd);
+			AnimationSystem::Reselect();
+			if (std::strcmp(AnimationSystem::GetActivePathName(), path) != 0)
+			{
+				std::printf("%-8s (not built for this target)\n", path);
+				continue;
+			}
+			for (unsigned threadCount : { 1u, std::max(4u, threads) })
+			{
+				AnimationSystem::Settings settings;
+				settings.mThreads = threadCount;
+				animation.SetSettings(settings);
+				const double milliseconds = BestOfMilliseconds(5, [&]() {
+					animation.Update(0.0f);
+				});
+
+				const std::vector<glm::vec4>& palette = animation.GetPalette();
+				float worstMatrix = 0.0f;
+				for (std::uint32_t joint = 0; joint < jointCount; ++joint)
+				{
+					for (std::uint32_t row = 0; row < AnimationSystem::TexelsPerJoint; ++row)
+					{
+						const glm::vec4 expected(skinning[joint][0][row], skinning[joint][1][row], skinning[joint][2][row], skinning[joint][3][row]);
+						const glm::vec4 difference = glm::abs(palette[joint * AnimationSystem::TexelsPerJoint + row] - expected);
+						worstMatrix = std::max(worstMatrix, std::max(std::max(difference.x, difference.y), std::max(difference.z, difference.w)));
+					}
+				}
+				if (reference.empty())
+				{
+					reference = palette;
+				}
+				float worstPath = 0.0f;
+				for (std::size_t i = 0; i < palette.size(); ++i)
+				{
+					const glm::vec4 difference = glm::abs(palette[i] - reference[i]);
+					worstPath = std::max(worstPath, std::max(std::max(difference.x, difference.y), std::max(difference.z, difference.w)));
+				}
+				const bool matches = worstMatrix < 1e-4f;
+				const bool same = worstPath < 1e-4f;
+				std::printf("%-8s %2u thread(s) %9.3f %11.0f %s%s\n", path, threadCount, milliseconds, characters / (milliseconds / 1000.0),
+					matches ? "" : "FAILED (differs from Skeleton::GetSkinningMatrices()) ",
+					same ? "" : "FAILED (differs from the first path)");
+				passed = passed && matches && same;
+			}
+		}
+		CpuDispatch::SetMaxLevel(previousCap);
+		AnimationSystem::Reselect();
+	}
+
+	std::printf("%s\n", passed ? "All checks passed." : "Some checks FAILED.");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+/// <summary>
+/// Stand-alone benchmarks, selected from the command line in main().
+/// They don't need a window or a GL context, so they also run on machines
+/// without a GPU. Each returns the process exit code.
+/// </summary>
+
+/// <summary>
+/// --bench-matrix: every MatrixKernels path against plain glm.
+/// </summary>
+int RunMatrixKernelBenchmark();
+
+/// <summary>
+/// --bench-lod: builds the LOD chain of a bumpy grid, times it, and checks
+/// that every level has fewer triangles, keeps the border, and stays within
+/// the error it reports. Returns 1 if a check fails.
+/// </summary>
+int RunMeshLodBenchmark();
+
+/// <summary>
+/// --bench-meshlets: splits a dense, noisy sphere into meshlets, then orbits
+/// it and reports how many triangles meshlet culling leaves to draw. Checks
+/// the meshlet limits, that no triangle got lost, and that every culled
+/// triangle really faced away or was off screen. Returns 1 if a check fails.
+/// </summary>
+int RunMeshletBenchmark();
+
+/// <summary>
+/// --bench-textures: round-trips TGA, PNG and KTX2 images through the
+/// loader, times mip generation per filter and SIMD path (and checks the
+/// paths agree), then streams a set of textures under a VRAM budget with
+/// the stub GL backend while a camera flies past them. Checks the budget
+/// and the upload allowance hold. Returns 1 if a check fails.
+/// </summary>
+int RunTextureBenchmark();
+
+/// <summary>
+/// --bench-bcn: block compresses a test image into every format at every
+/// quality and reports speed and PSNR, then checks that the SIMD paths and
+/// thread counts make the same blocks, that odd sizes work, and that a
+/// texture loaded twice comes from its cache file the second time.
+/// Returns 1 if a check fails.
+/// </summary>
+int RunBlockCompressionBenchmark();
+
+/// <summary>
+/// --bench-atlas: packs random rectangles of a few shapes into an atlas
+/// page, keeping whichever fit, in the order made and tallest first, and
+/// reports occupancy and time per insert. Checks nothing overlaps or
+/// sticks out. Returns 1 if a check fails.
+/// </summary>
+int RunAtlasBenchmark();
+
+/// <summary>
+/// --bench-lights: assigns 1000 and 10000 point lights to the clusters of
+/// a view, per SIMD path and thread count, and reports the time per frame
+/// and how many lights a fragment ends up shading. Checks every path finds
+/// what testing every light against every cluster does. Returns 1 if a
+/// check fails.
+/// </summary>
+int RunClusteredLightingBenchmark();
+
+/// <summary>
+/// --bench-particles: runs the CPU reference of the particle system with
+/// 100k and 1M particles, once they've filled their slots, per thread
+/// count, and reports the time per step. Checks every thread count ends
+/// up with the same particles, and that about as many are alive as the
+/// rate and lifetime say. Returns 1 if a check fails.
+/// </summary>
+int RunParticleBenchmark();
+
+/// <summary>
+/// --bench-animation: compresses the test character's clip and reports how
+/// much smaller it got and how far it strays, and how far the approximate
+/// slerp is from glm's. Then poses 1000 characters per SIMD path and thread
+/// count and reports the time per update. Checks the error bounds hold,
+/// that the paths agree, and that the palette is what the skeleton makes
+/// of the sampled poses. Returns 1 if a check fails.
+/// </summary>
+int RunAnimationBenchmark();
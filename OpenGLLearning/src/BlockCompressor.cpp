@@ -0,0 +1,1178 @@
+#include "BlockCompressor.hpp"
+
+#include "CpuDispatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BLOCK_COMPRESSOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	/// <summary>
+	/// One 4x4 block of the source, as floats, one array per channel.
+	/// </summary>
+	struct Block {
+		alignas(16) float	mChannels[4][16];
+	};
+
+	/// <summary>
+	/// The inner loop of the endpoint search, so it can be SIMD.
+	/// </summary>
+	struct BlockKernelTable {
+		const char* mName;
+		/// <summary>
+		/// For each texel, the index of the closest of the 'count' palette
+		/// entries and its distance: the squared differences per channel,
+		/// times 'weights', summed. Ties go to the lower index.
+		/// </summary>
+		void (*mFitIndices)(const Block& block, const float (*palette)[4], int count, const float* weights,
+			std::uint8_t* indices, float* errors);
+	};
+
+	//------------------------------- Scalar -----------------------------------
+
+	void FitIndicesScalar(const Block& block, const float (*palette)[4], int count, const float* weights,
+		std::uint8_t* indices, float* errors)
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			float best = FLT_MAX;
+			int bestIndex = 0;
+			for (int p = 0; p < count; ++p)
+			{
+				const float r = block.mChannels[0][i] - palette[p][0];
+				const float g = block.mChannels[1][i] - palette[p][1];
+				const float b = block.mChannels[2][i] - palette[p][2];
+				const float a = block.mChannels[3][i] - palette[p][3];
+				const float distance = weights[0] * r * r + weights[1] * g * g + weights[2] * b * b + weights[3] * a * a;
+				if (distance < best)
+				{
+					best = distance;
+					bestIndex = p;
+				}
+			}
+			indices[i] = static_cast<std::uint8_t>(bestIndex);
+			errors[i] = best;
+		}
+	}
+
+	const BlockKernelTable* GetBlockKernelsScalar()
+	{
+		static const BlockKernelTable sTable = { "Scalar", FitIndicesScalar };
+		return &sTable;
+	}
+
+	//------------------------------- SSE2 -----------------------------------
+
+#ifdef BLOCK_COMPRESSOR_SSE2
+	// Four texels at a time, in the same order of operations as the scalar
+	// version, so both pick the same indices.
+	void FitIndicesSSE2(const Block& block, const float (*palette)[4], int count, const float* weights,
+		std::uint8_t* indices, float* errors)
+	{
+		const __m128 weightR = _mm_set1_ps(weights[0]);
+		const __m128 weightG = _mm_set1_ps(weights[1]);
+		const __m128 weightB = _mm_set1_ps(weights[2]);
+		const __m128 weightA = _mm_set1_ps(weights[3]);
+		for (int i = 0; i < 16; i += 4)
+		{
+			const __m128 texelR = _mm_load_ps(block.mChannels[0] + i);
+			const __m128 texelG = _mm_load_ps(block.mChannels[1] + i);
+			const __m128 texelB = _mm_load_ps(block.mChannels[2] + i);
+			const __m128 texelA = _mm_load_ps(block.mChannels[3] + i);
+			__m128 best = _mm_set1_ps(FLT_MAX);
+			__m128i bestIndex = _mm_setzero_si128();
+			for (int p = 0; p < count; ++p)
+			{
+				const __m128 r = _mm_sub_ps(texelR, _mm_set1_ps(palette[p][0]));
+				const __m128 g = _mm_sub_ps(texelG, _mm_set1_ps(palette[p][1]));
+				const __m128 b = _mm_sub_ps(texelB, _mm_set1_ps(palette[p][2]));
+				const __m128 a = _mm_sub_ps(texelA, _mm_set1_ps(palette[p][3]));
+				__m128 distance = _mm_mul_ps(_mm_mul_ps(weightR, r), r);
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_mul_ps(weightG, g), g));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_mul_ps(weightB, b), b));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_mul_ps(weightA, a), a));
+				const __m128 closer = _mm_cmplt_ps(distance, best);
+				best = _mm_or_ps(_mm_and_ps(closer, distance), _mm_andnot_ps(closer, best));
+				const __m128i mask = _mm_castps_si128(closer);
+				bestIndex = _mm_or_si128(_mm_and_si128(mask, _mm_set1_epi32(p)), _mm_andnot_si128(mask, bestIndex));
+			}
+			alignas(16) std::int32_t lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(lanes), bestIndex);
+			_mm_storeu_ps(errors + i, best);
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				indices[i + lane] = static_cast<std::uint8_t>(lanes[lane]);
+			}
+		}
+	}
+
+	const BlockKernelTable* GetBlockKernelsSSE2()
+	{
+		static const BlockKernelTable sTable = { "SSE2", FitIndicesSSE2 };
+		return &sTable;
+	}
+#else
+	const BlockKernelTable* GetBlockKernelsSSE2()
+	{
+		return nullptr;
+	}
+#endif
+
+	const BlockKernelTable* SelectKernels()
+	{
+		const BlockKernelTable* const candidates[] = {
+			GetBlockKernelsScalar(),
+			GetBlockKernelsSSE2(),
+			nullptr,
+			nullptr,
+		};
+		SimdLevel level = SimdLevel::Scalar;
+		const BlockKernelTable* table = CpuDispatch::Select(candidates, &level);
+		CpuDispatch::ReportActivePath("BlockCompressor", level);
+		return table;
+	}
+
+	const BlockKernelTable*& GetKernels()
+	{
+		static const BlockKernelTable* sKernels = SelectKernels();
+		return sKernels;
+	}
+
+	//------------------------------------------------------------------------------------
+
+	/// <summary>
+	/// How hard each quality looks.
+	/// </summary>
+	struct Effort {
+		// Least squares refits after the first fit; each stops early once it doesn't help.
+		int		mRefits;
+		// Rounds of trying every quantized endpoint value one step either way.
+		int		mNeighbourRounds;
+		// BC7: all four combinations of the shared bits, rather than equal ones.
+		bool	mAllSharedBits;
+	};
+
+	Effort GetEffort(BlockCompressor::Quality quality)
+	{
+		switch (quality)
+		{
+		case BlockCompressor::Quality::Fast:	return { 0, 0, false };
+		case BlockCompressor::Quality::Normal:	return { 2, 0, true };
+		default:								return { 4, 8, true };
+		}
+	}
+
+	constexpr std::uint16_t AllTexels = 0xFFFF;
+
+	/// <summary>
+	/// The block at (blockX, blockY), in blocks, repeating the last row and
+	/// column where it runs over the edge.
+	/// </summary>
+	void LoadBlock(const ImageLoader::Level& source, std::uint32_t blockX, std::uint32_t blockY, Block* block)
+	{
+		for (std::uint32_t y = 0; y < 4; ++y)
+		{
+			const std::uint32_t sourceY = std::min(blockY * 4 + y, source.mHeight - 1);
+			for (std::uint32_t x = 0; x < 4; ++x)
+			{
+				const std::uint32_t sourceX = std::min(blockX * 4 + x, source.mWidth - 1);
+				const std::uint8_t* texel = &source.mPixels[(static_cast<std::size_t>(sourceY) * source.mWidth + sourceX) * 4];
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					block->mChannels[channel][y * 4 + x] = texel[channel];
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// The kernel's fit, and its error over the texels in 'mask'.
+	/// </summary>
+	float Fit(const BlockKernelTable& kernels, const Block& block, const float (*palette)[4], int count,
+		const float* weights, std::uint16_t mask, std::uint8_t* indices)
+	{
+		float errors[16];
+		kernels.mFitIndices(block, palette, count, weights, indices, errors);
+		float error = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			error += ((mask >> i) & 1) ? errors[i] : 0.0f;
+		}
+		return error;
+	}
+
+	/// <summary>
+	/// The texels' mean, and the direction along which they vary most, over
+	/// the channels with a weight. The axis is zero for a flat block.
+	/// </summary>
+	void GetPrincipalAxis(const Block& block, const float* weights, float mean[4], float axis[4])
+	{
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			float sum = 0.0f;
+			for (int i = 0; i < 16; ++i)
+			{
+				sum += block.mChannels[channel][i];
+			}
+			mean[channel] = sum / 16.0f;
+		}
+		float covariance[4][4] = {};
+		for (int j = 0; j < 4; ++j)
+		{
+			for (int k = j; k < 4; ++k)
+			{
+				if (weights[j] == 0.0f || weights[k] == 0.0f)
+				{
+					continue;
+				}
+				float sum = 0.0f;
+				for (int i = 0; i < 16; ++i)
+				{
+					sum += (block.mChannels[j][i] - mean[j]) * (block.mChannels[k][i] - mean[k]);
+				}
+				covariance[j][k] = sum;
+				covariance[k][j] = sum;
+			}
+		}
+
+		// Power iteration, from the channel that varies most.
+		int widest = 0;
+		for (int channel = 1; channel < 4; ++channel)
+		{
+			widest = (covariance[channel][channel] > covariance[widest][widest]) ? channel : widest;
+		}
+		float vector[4] = { covariance[widest][0], covariance[widest][1], covariance[widest][2], covariance[widest][3] };
+		for (int iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[4];
+			float largest = 0.0f;
+			for (int j = 0; j < 4; ++j)
+			{
+				next[j] = covariance[j][0] * vector[0] + covariance[j][1] * vector[1] + covariance[j][2] * vector[2] + covariance[j][3] * vector[3];
+				largest = std::max(largest, std::abs(next[j]));
+			}
+			if (largest < 1e-6f)
+			{
+				break;
+			}
+			for (int j = 0; j < 4; ++j)
+			{
+				vector[j] = next[j] / largest;
+			}
+		}
+		const float length = std::sqrt(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2] + vector[3] * vector[3]);
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			axis[channel] = (length > 1e-6f) ? vector[channel] / length : 0.0f;
+		}
+	}
+
+	/// <summary>
+	/// Endpoints at the ends of the texels' spread along the principal axis.
+	/// </summary>
+	void GetAxisEndpoints(const Block& block, const float* weights, float start[4], float end[4])
+	{
+		float mean[4];
+		float axis[4];
+		GetPrincipalAxis(block, weights, mean, axis);
+		float low = 0.0f;
+		float high = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			float t = 0.0f;
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				t += (block.mChannels[channel][i] - mean[channel]) * axis[channel];
+			}
+			low = std::min(low, t);
+			high = std::max(high, t);
+		}
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			start[channel] = std::min(255.0f, std::max(0.0f, mean[channel] + axis[channel] * low));
+			end[channel] = std::min(255.0f, std::max(0.0f, mean[channel] + axis[channel] * high));
+		}
+	}
+
+	/// <summary>
+	/// The endpoints that best reproduce the texels in 'mask' with the
+	/// indices as they are, where index i sits 'positions[i]' of the way
+	/// from start to end. False if the indices don't pin them down.
+	/// </summary>
+	bool SolveEndpoints(const Block& block, const std::uint8_t* indices, const float* positions, std::uint16_t mask,
+		float start[4], float end[4])
+	{
+		float aa = 0.0f;
+		float ab = 0.0f;
+		float bb = 0.0f;
+		float startSums[4] = {};
+		float endSums[4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			if (((mask >> i) & 1) == 0)
+			{
+				continue;
+			}
+			const float t = positions[indices[i]];
+			const float s = 1.0f - t;
+			aa += s * s;
+			ab += s * t;
+			bb += t * t;
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				startSums[channel] += s * block.mChannels[channel][i];
+				endSums[channel] += t * block.mChannels[channel][i];
+			}
+		}
+		const float determinant = aa * bb - ab * ab;
+		if (std::abs(determinant) < 1e-4f)
+		{
+			return false;
+		}
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			start[channel] = std::min(255.0f, std::max(0.0f, (bb * startSums[channel] - ab * endSums[channel]) / determinant));
+			end[channel] = std::min(255.0f, std::max(0.0f, (aa * endSums[channel] - ab * startSums[channel]) / determinant));
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Least squares refits: endpoints from the indices, quantized by
+	/// 'quantize', refitted by 'evaluate', for as long as that helps.
+	/// 'values' are the quantized endpoints.
+	/// </summary>
+	template <typename Quantize, typename Evaluate>
+	float Refit(const Block& block, const float* positions, std::uint16_t mask, int refits, int* values, int valueCount,
+		float error, std::uint8_t* indices, Quantize&& quantize, Evaluate&& evaluate)
+	{
+		for (int refit = 0; refit < refits; ++refit)
+		{
+			float start[4];
+			float end[4];
+			if (!SolveEndpoints(block, indices, positions, mask, start, end))
+			{
+				break;
+			}
+			int trial[8];
+			quantize(start, end, trial);
+			std::uint8_t trialIndices[16];
+			const float trialError = evaluate(trial, trialIndices);
+			if (trialError >= error)
+			{
+				break;
+			}
+			error = trialError;
+			std::copy(trial, trial + valueCount, values);
+			std::copy(trialIndices, trialIndices + 16, indices);
+		}
+		return error;
+	}
+
+	/// <summary>
+	/// Tries each quantized endpoint value a step up and down, keeping what
+	/// lowers the error, for up to 'rounds' rounds.
+	/// </summary>
+	template <typename Evaluate>
+	float SearchNeighbours(int rounds, int* values, const int* maxima, int valueCount, float error, std::uint8_t* indices,
+		Evaluate&& evaluate)
+	{
+		for (int round = 0; round < rounds; ++round)
+		{
+			bool improved = false;
+			for (int i = 0; i < valueCount; ++i)
+			{
+				for (int step = -1; step <= 1; step += 2)
+				{
+					const int previous = values[i];
+					if (previous + step < 0 || previous + step > maxima[i])
+					{
+						continue;
+					}
+					values[i] = previous + step;
+					std::uint8_t trialIndices[16];
+					const float trialError = evaluate(values, trialIndices);
+					if (trialError < error)
+					{
+						error = trialError;
+						std::copy(trialIndices, trialIndices + 16, indices);
+						improved = true;
+					}
+					else
+					{
+						values[i] = previous;
+					}
+				}
+			}
+			if (!improved)
+			{
+				break;
+			}
+		}
+		return error;
+	}
+
+	int Quantize(float value, int maximum)
+	{
+		return std::min(maximum, std::max(0, static_cast<int>(value * maximum / 255.0f + 0.5f)));
+	}
+
+	//------------------------------- BC1 -----------------------------------
+
+	int Expand5(int value) { return (value << 3) | (value >> 2); }
+	int Expand6(int value) { return (value << 2) | (value >> 4); }
+
+	std::uint16_t Pack565(const int* rgb)
+	{
+		return static_cast<std::uint16_t>((rgb[0] << 11) | (rgb[1] << 5) | rgb[2]);
+	}
+
+	void Unpack565(std::uint16_t packed, int* rgb)
+	{
+		rgb[0] = Expand5((packed >> 11) & 31);
+		rgb[1] = Expand6((packed >> 5) & 63);
+		rgb[2] = Expand5(packed & 31);
+	}
+
+	/// <summary>
+	/// The colors of a BC1 block with endpoints 'start' and 'end' (8 bit),
+	/// in index order. Three color blocks have transparent black last.
+	/// </summary>
+	void GetColorPalette(const int* start, const int* end, bool threeColors, int palette[4][4])
+	{
+		for (int channel = 0; channel < 3; ++channel)
+		{
+			palette[0][channel] = start[channel];
+			palette[1][channel] = end[channel];
+			if (threeColors)
+			{
+				palette[2][channel] = (start[channel] + end[channel]) / 2;
+				palette[3][channel] = 0;
+			}
+			else
+			{
+				palette[2][channel] = (2 * start[channel] + end[channel] + 1) / 3;
+				palette[3][channel] = (start[channel] + 2 * end[channel] + 1) / 3;
+			}
+		}
+		palette[0][3] = palette[1][3] = palette[2][3] = 255;
+		palette[3][3] = threeColors ? 0 : 255;
+	}
+
+	constexpr float ColorPositions[2][4] = {
+		{ 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f },
+		{ 0.0f, 1.0f, 0.5f, 0.0f },
+	};
+
+	/// <summary>
+	/// The color half of BC1 and BC3. With 'punchThrough', texels whose
+	/// alpha is under 128 come out transparent (BC1 only: BC3 ignores the
+	/// three color mode on some hardware).
+	/// </summary>
+	void EncodeColor(const BlockKernelTable& kernels, const Effort& effort, const Block& source, bool punchThrough,
+		std::uint8_t* out)
+	{
+		static const float weights[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+		static const int maxima[6] = { 31, 63, 31, 31, 63, 31 };
+
+		// Transparent texels take the opaque ones' mean, so they don't pull
+		// on the axis, and no part in the error.
+		Block block = source;
+		std::uint16_t opaque = AllTexels;
+		if (punchThrough)
+		{
+			float sums[3] = {};
+			int count = 0;
+			for (int i = 0; i < 16; ++i)
+			{
+				if (block.mChannels[3][i] < 128.0f)
+				{
+					opaque &= static_cast<std::uint16_t>(~(1u << i));
+					continue;
+				}
+				for (int channel = 0; channel < 3; ++channel)
+				{
+					sums[channel] += block.mChannels[channel][i];
+				}
+				++count;
+			}
+			for (int i = 0; i < 16; ++i)
+			{
+				for (int channel = 0; channel < 3 && ((opaque >> i) & 1) == 0; ++channel)
+				{
+					block.mChannels[channel][i] = (count > 0) ? sums[channel] / count : 0.0f;
+				}
+			}
+		}
+		const bool threeColors = opaque != AllTexels;
+
+		const auto quantize = [](const float* start, const float* end, int* values) {
+			for (int channel = 0; channel < 3; ++channel)
+			{
+				const int maximum = (channel == 1) ? 63 : 31;
+				values[channel] = Quantize(start[channel], maximum);
+				values[3 + channel] = Quantize(end[channel], maximum);
+			}
+		};
+		const auto evaluate = [&](const int* values, std::uint8_t* indices) {
+			const int start[3] = { Expand5(values[0]), Expand6(values[1]), Expand5(values[2]) };
+			const int end[3] = { Expand5(values[3]), Expand6(values[4]), Expand5(values[5]) };
+			int colors[4][4];
+			GetColorPalette(start, end, threeColors, colors);
+			float palette[4][4];
+			for (int p = 0; p < 4; ++p)
+			{
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					palette[p][channel] = static_cast<float>(colors[p][channel]);
+				}
+			}
+			return Fit(kernels, block, palette, threeColors ? 3 : 4, weights, opaque, indices);
+		};
+
+		float start[4];
+		float end[4];
+		GetAxisEndpoints(block, weights, start, end);
+		int values[6];
+		quantize(start, end, values);
+		std::uint8_t indices[16];
+		float error = evaluate(values, indices);
+		error = Refit(block, ColorPositions[threeColors ? 1 : 0], opaque, effort.mRefits, values, 6, error, indices, quantize, evaluate);
+		SearchNeighbours(effort.mNeighbourRounds, values, maxima, 6, error, indices, evaluate);
+
+		// The mode is in the endpoints' order: four colors if the first is
+		// larger, so swap to suit, which swaps the indices too.
+		std::uint16_t first = Pack565(values);
+		std::uint16_t second = Pack565(values + 3);
+		if (threeColors ? first > second : first < second)
+		{
+			std::swap(first, second);
+			static const std::uint8_t swapped[2][4] = { { 1, 0, 3, 2 }, { 1, 0, 2, 3 } };
+			for (std::uint8_t& index : indices)
+			{
+				index = swapped[threeColors ? 1 : 0][index];
+			}
+		}
+		else if (!threeColors && first == second)
+		{
+			// Equal endpoints read as three colors, and every one of them is the first.
+			std::fill(indices, indices + 16, static_cast<std::uint8_t>(0));
+		}
+		std::uint32_t bits = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			const std::uint32_t index = ((opaque >> i) & 1) ? indices[i] : 3u;
+			bits |= index << (i * 2);
+		}
+		out[0] = static_cast<std::uint8_t>(first);
+		out[1] = static_cast<std::uint8_t>(first >> 8);
+		out[2] = static_cast<std::uint8_t>(second);
+		out[3] = static_cast<std::uint8_t>(second >> 8);
+		std::memcpy(out + 4, &bits, 4);
+	}
+
+	void DecodeColor(const std::uint8_t* in, bool punchThrough, std::uint8_t texels[16][4])
+	{
+		const std::uint16_t first = static_cast<std::uint16_t>(in[0] | (in[1] << 8));
+		const std::uint16_t second = static_cast<std::uint16_t>(in[2] | (in[3] << 8));
+		int start[3];
+		int end[3];
+		Unpack565(first, start);
+		Unpack565(second, end);
+		int palette[4][4];
+		GetColorPalette(start, end, punchThrough && first <= second, palette);
+		std::uint32_t bits;
+		std::memcpy(&bits, in + 4, 4);
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				texels[i][channel] = static_cast<std::uint8_t>(palette[(bits >> (i * 2)) & 3][channel]);
+			}
+		}
+	}
+
+	//------------------------------- BC4 -----------------------------------
+
+	/// <summary>
+	/// The values of a BC4 block, in index order: eight steps from start to
+	/// end, or with 'sixSteps', six plus 0 and 255.
+	/// </summary>
+	void GetValuePalette(int start, int end, bool sixSteps, int palette[8])
+	{
+		palette[0] = start;
+		palette[1] = end;
+		if (sixSteps)
+		{
+			for (int i = 2; i < 6; ++i)
+			{
+				palette[i] = ((6 - i) * start + (i - 1) * end + 2) / 5;
+			}
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+		else
+		{
+			for (int i = 2; i < 8; ++i)
+			{
+				palette[i] = ((8 - i) * start + (i - 1) * end + 3) / 7;
+			}
+		}
+	}
+
+	constexpr float ValuePositions[8] = { 0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+
+	/// <summary>
+	/// One channel: the alpha of BC3, red or green of BC5.
+	/// </summary>
+	void EncodeValues(const BlockKernelTable& kernels, const Effort& effort, const Block& block, int channel,
+		std::uint8_t* out)
+	{
+		float weights[4] = {};
+		weights[channel] = 1.0f;
+		static const int maxima[2] = { 255, 255 };
+
+		// The six step mode only wins with texels at 0 or 255, which it has
+		// for free; its endpoints then only need to span the rest.
+		int low = 255;
+		int high = 0;
+		int innerLow = 255;
+		int innerHigh = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			const int value = static_cast<int>(block.mChannels[channel][i]);
+			low = std::min(low, value);
+			high = std::max(high, value);
+			if (value != 0 && value != 255)
+			{
+				innerLow = std::min(innerLow, value);
+				innerHigh = std::max(innerHigh, value);
+			}
+		}
+
+		int bestValues[2] = { high, low };
+		std::uint8_t bestIndices[16];
+		bool bestSixSteps = false;
+		float bestError = FLT_MAX;
+		for (int mode = 0; mode < 2; ++mode)
+		{
+			const bool sixSteps = mode == 1;
+			if (sixSteps && (effort.mRefits == 0 || (low > 0 && high < 255)))
+			{
+				continue;
+			}
+			const auto evaluate = [&](const int* values, std::uint8_t* indices) {
+				// Which mode a block is in hangs on its endpoints' order.
+				if (sixSteps && values[0] > values[1])
+				{
+					return FLT_MAX;
+				}
+				int steps[8];
+				GetValuePalette(values[0], values[1], sixSteps, steps);
+				float palette[8][4] = {};
+				for (int p = 0; p < 8; ++p)
+				{
+					palette[p][channel] = static_cast<float>(steps[p]);
+				}
+				return Fit(kernels, block, palette, 8, weights, AllTexels, indices);
+			};
+			int values[2] = { high, low };
+			if (sixSteps)
+			{
+				values[0] = (innerLow <= innerHigh) ? innerLow : 0;
+				values[1] = (innerLow <= innerHigh) ? innerHigh : 0;
+			}
+			std::uint8_t indices[16];
+			float error = evaluate(values, indices);
+			if (!sixSteps)
+			{
+				const auto quantize = [channel](const float* start, const float* end, int* quantized) {
+					quantized[0] = Quantize(start[channel], 255);
+					quantized[1] = Quantize(end[channel], 255);
+				};
+				error = Refit(block, ValuePositions, AllTexels, effort.mRefits, values, 2, error, indices, quantize, evaluate);
+			}
+			error = SearchNeighbours(effort.mNeighbourRounds, values, maxima, 2, error, indices, evaluate);
+			if (error < bestError)
+			{
+				bestError = error;
+				bestValues[0] = values[0];
+				bestValues[1] = values[1];
+				std::copy(indices, indices + 16, bestIndices);
+				bestSixSteps = sixSteps;
+			}
+		}
+
+		// Eight steps need the first endpoint larger.
+		if (!bestSixSteps && bestValues[0] < bestValues[1])
+		{
+			std::swap(bestValues[0], bestValues[1]);
+			static const std::uint8_t swapped[8] = { 1, 0, 7, 6, 5, 4, 3, 2 };
+			for (std::uint8_t& index : bestIndices)
+			{
+				index = swapped[index];
+			}
+		}
+		else if (!bestSixSteps && bestValues[0] == bestValues[1])
+		{
+			std::fill(bestIndices, bestIndices + 16, static_cast<std::uint8_t>(0));
+		}
+		out[0] = static_cast<std::uint8_t>(bestValues[0]);
+		out[1] = static_cast<std::uint8_t>(bestValues[1]);
+		std::uint64_t bits = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			bits |= static_cast<std::uint64_t>(bestIndices[i]) << (i * 3);
+		}
+		for (int i = 0; i < 6; ++i)
+		{
+			out[2 + i] = static_cast<std::uint8_t>(bits >> (i * 8));
+		}
+	}
+
+	void DecodeValues(const std::uint8_t* in, int channel, std::uint8_t texels[16][4])
+	{
+		int palette[8];
+		GetValuePalette(in[0], in[1], in[0] <= in[1], palette);
+		std::uint64_t bits = 0;
+		for (int i = 0; i < 6; ++i)
+		{
+			bits |= static_cast<std::uint64_t>(in[2 + i]) << (i * 8);
+		}
+		for (int i = 0; i < 16; ++i)
+		{
+			texels[i][channel] = static_cast<std::uint8_t>(palette[(bits >> (i * 3)) & 7]);
+		}
+	}
+
+	//------------------------------- BC7 -----------------------------------
+
+	constexpr int Bc7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	/// <summary>
+	/// Little endian bits in and out of a 16 byte block.
+	/// </summary>
+	struct BlockBits {
+		std::uint8_t*	mBytes;
+		int				mPosition;
+
+		void Write(std::uint32_t value, int count)
+		{
+			for (int i = 0; i < count; ++i, ++mPosition)
+			{
+				mBytes[mPosition / 8] |= static_cast<std::uint8_t>(((value >> i) & 1) << (mPosition % 8));
+			}
+		}
+
+		std::uint32_t Read(int count)
+		{
+			std::uint32_t value = 0;
+			for (int i = 0; i < count; ++i, ++mPosition)
+			{
+				value |= static_cast<std::uint32_t>((mBytes[mPosition / 8] >> (mPosition % 8)) & 1) << i;
+			}
+			return value;
+		}
+	};
+
+	void GetBc7Palette(const int* start, const int* end, float palette[16][4])
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				palette[i][channel] = static_cast<float>(((64 - Bc7Weights[i]) * start[channel] + Bc7Weights[i] * end[channel] + 32) >> 6);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Mode 6: one subset, RGBA endpoints of 7 bits plus a bit each that
+	/// all their channels share, 4 bit indices.
+	/// </summary>
+	void EncodeBc7(const BlockKernelTable& kernels, const Effort& effort, const Block& block, std::uint8_t* out)
+	{
+		static const float weights[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		static const int maxima[8] = { 127, 127, 127, 127, 127, 127, 127, 127 };
+		float positions[16];
+		for (int i = 0; i < 16; ++i)
+		{
+			positions[i] = Bc7Weights[i] / 64.0f;
+		}
+
+		float start[4];
+		float end[4];
+		GetAxisEndpoints(block, weights, start, end);
+
+		int bestValues[8] = {};
+		int bestBits[2] = {};
+		std::uint8_t bestIndices[16] = {};
+		float bestError = FLT_MAX;
+		for (int combination = 0; combination < 4; ++combination)
+		{
+			const int shared[2] = { combination & 1, combination >> 1 };
+			if (!effort.mAllSharedBits && shared[0] != shared[1])
+			{
+				continue;
+			}
+			const auto quantize = [&shared](const float* from, const float* to, int* values) {
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					values[channel] = std::min(127, std::max(0, static_cast<int>((from[channel] - shared[0]) / 2.0f + 0.5f)));
+					values[4 + channel] = std::min(127, std::max(0, static_cast<int>((to[channel] - shared[1]) / 2.0f + 0.5f)));
+				}
+			};
+			const auto evaluate = [&](const int* values, std::uint8_t* indices) {
+				int from[4];
+				int to[4];
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					from[channel] = (values[channel] << 1) | shared[0];
+					to[channel] = (values[4 + channel] << 1) | shared[1];
+				}
+				float palette[16][4];
+				GetBc7Palette(from, to, palette);
+				return Fit(kernels, block, palette, 16, weights, AllTexels, indices);
+			};
+			int values[8];
+			quantize(start, end, values);
+			std::uint8_t indices[16];
+			float error = evaluate(values, indices);
+			error = Refit(block, positions, AllTexels, effort.mRefits, values, 8, error, indices, quantize, evaluate);
+			if (error < bestError)
+			{
+				bestError = error;
+				std::copy(values, values + 8, bestValues);
+				std::copy(indices, indices + 16, bestIndices);
+				bestBits[0] = shared[0];
+				bestBits[1] = shared[1];
+			}
+		}
+		// The neighbour search is the expensive part: only on the best bits.
+		{
+			const int shared[2] = { bestBits[0], bestBits[1] };
+			const auto evaluate = [&](const int* values, std::uint8_t* indices) {
+				int from[4];
+				int to[4];
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					from[channel] = (values[channel] << 1) | shared[0];
+					to[channel] = (values[4 + channel] << 1) | shared[1];
+				}
+				float palette[16][4];
+				GetBc7Palette(from, to, palette);
+				return Fit(kernels, block, palette, 16, weights, AllTexels, indices);
+			};
+			SearchNeighbours(effort.mNeighbourRounds, bestValues, maxima, 8, bestError, bestIndices, evaluate);
+		}
+
+		// The first texel's index drops its top bit, so it must be under 8.
+		if (bestIndices[0] >= 8)
+		{
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				std::swap(bestValues[channel], bestValues[4 + channel]);
+			}
+			std::swap(bestBits[0], bestBits[1]);
+			for (std::uint8_t& index : bestIndices)
+			{
+				index = static_cast<std::uint8_t>(15 - index);
+			}
+		}
+		std::memset(out, 0, 16);
+		BlockBits bits = { out, 0 };
+		bits.Write(1u << 6, 7);
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			bits.Write(static_cast<std::uint32_t>(bestValues[channel]), 7);
+			bits.Write(static_cast<std::uint32_t>(bestValues[4 + channel]), 7);
+		}
+		bits.Write(static_cast<std::uint32_t>(bestBits[0]), 1);
+		bits.Write(static_cast<std::uint32_t>(bestBits[1]), 1);
+		for (int i = 0; i < 16; ++i)
+		{
+			bits.Write(bestIndices[i], (i == 0) ? 3 : 4);
+		}
+	}
+
+	void DecodeBc7(const std::uint8_t* in, std::uint8_t texels[16][4])
+	{
+		std::uint8_t bytes[16];
+		std::memcpy(bytes, in, 16);
+		BlockBits bits = { bytes, 0 };
+		if (bits.Read(7) != (1u << 6))
+		{
+			// Not a mode we write; magenta, so it shows.
+			for (int i = 0; i < 16; ++i)
+			{
+				texels[i][0] = 255;
+				texels[i][1] = 0;
+				texels[i][2] = 255;
+				texels[i][3] = 255;
+			}
+			return;
+		}
+		int start[4];
+		int end[4];
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			start[channel] = static_cast<int>(bits.Read(7)) << 1;
+			end[channel] = static_cast<int>(bits.Read(7)) << 1;
+		}
+		const int startBit = static_cast<int>(bits.Read(1));
+		const int endBit = static_cast<int>(bits.Read(1));
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			start[channel] |= startBit;
+			end[channel] |= endBit;
+		}
+		float palette[16][4];
+		GetBc7Palette(start, end, palette);
+		for (int i = 0; i < 16; ++i)
+		{
+			const std::uint32_t index = bits.Read((i == 0) ? 3 : 4);
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				texels[i][channel] = static_cast<std::uint8_t>(palette[index][channel]);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------
+
+	std::uint32_t GetBlockBytes(BlockCompressor::Format format)
+	{
+		return (format == BlockCompressor::Format::BC1) ? 8 : 16;
+	}
+
+	void EncodeBlock(const BlockKernelTable& kernels, const Effort& effort, BlockCompressor::Format format, const Block& block,
+		std::uint8_t* out)
+	{
+		switch (format)
+		{
+		case BlockCompressor::Format::BC1:
+			EncodeColor(kernels, effort, block, true, out);
+			break;
+		case BlockCompressor::Format::BC3:
+			EncodeValues(kernels, effort, block, 3, out);
+			EncodeColor(kernels, effort, block, false, out + 8);
+			break;
+		case BlockCompressor::Format::BC5:
+			EncodeValues(kernels, effort, block, 0, out);
+			EncodeValues(kernels, effort, block, 1, out + 8);
+			break;
+		case BlockCompressor::Format::BC7:
+			EncodeBc7(kernels, effort, block, out);
+			break;
+		}
+	}
+
+	void DecodeBlock(BlockCompressor::Format format, const std::uint8_t* in, std::uint8_t texels[16][4])
+	{
+		switch (format)
+		{
+		case BlockCompressor::Format::BC1:
+			DecodeColor(in, true, texels);
+			break;
+		case BlockCompressor::Format::BC3:
+			DecodeColor(in + 8, false, texels);
+			DecodeValues(in, 3, texels);
+			break;
+		case BlockCompressor::Format::BC5:
+			DecodeValues(in, 0, texels);
+			DecodeValues(in + 8, 1, texels);
+			for (int i = 0; i < 16; ++i)
+			{
+				texels[i][2] = 0;
+				texels[i][3] = 255;
+			}
+			break;
+		case BlockCompressor::Format::BC7:
+			DecodeBc7(in, texels);
+			break;
+		}
+	}
+}
+
+const char* BlockCompressor::GetName(Format format)
+{
+	switch (format)
+	{
+	case Format::BC1:	return "BC1";
+	case Format::BC3:	return "BC3";
+	case Format::BC5:	return "BC5";
+	default:			return "BC7";
+	}
+}
+
+const char* BlockCompressor::GetName(Quality quality)
+{
+	switch (quality)
+	{
+	case Quality::Fast:		return "fast";
+	case Quality::Normal:	return "normal";
+	default:				return "high";
+	}
+}
+
+bool BlockCompressor::Parse(const char* name, Format* format)
+{
+	for (Format candidate : { Format::BC1, Format::BC3, Format::BC5, Format::BC7 })
+	{
+		const char* known = GetName(candidate);
+		if (std::tolower(static_cast<unsigned char>(name[0])) == 'b' && std::tolower(static_cast<unsigned char>(name[1])) == 'c'
+			&& std::strcmp(name + 2, known + 2) == 0)
+		{
+			*format = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool BlockCompressor::Parse(const char* name, Quality* quality)
+{
+	for (Quality candidate : { Quality::Fast, Quality::Normal, Quality::High })
+	{
+		if (std::strcmp(name, GetName(candidate)) == 0)
+		{
+			*quality = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+GLenum BlockCompressor::GetGLFormat(Format format)
+{
+	switch (format)
+	{
+	case Format::BC1:	return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+	case Format::BC3:	return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+	case Format::BC5:	return GL_COMPRESSED_RG_RGTC2;
+	default:			return GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+	}
+}
+
+bool BlockCompressor::IsSupportedByContext(Format format)
+{
+	switch (format)
+	{
+	case Format::BC1:
+	case Format::BC3:	return GLAD_GL_EXT_texture_compression_s3tc != 0;
+	case Format::BC5:	return true;
+	default:			return GLAD_GL_ARB_texture_compression_bptc != 0;
+	}
+}
+
+std::size_t BlockCompressor::GetLevelBytes(GLenum internalFormat, std::uint32_t width, std::uint32_t height)
+{
+	if (internalFormat == GL_RGBA8)
+	{
+		return static_cast<std::size_t>(width) * height * 4;
+	}
+	const std::size_t blocks = static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4);
+	const bool half = internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT || internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+		|| internalFormat == GL_COMPRESSED_RED_RGTC1;
+	return blocks * (half ? 8 : 16);
+}
+
+ImageLoader::Level BlockCompressor::Compress(const ImageLoader::Level& source, Format format, Quality quality, unsigned threads)
+{
+	const std::uint32_t blocksX = (source.mWidth + 3) / 4;
+	const std::uint32_t blocksY = (source.mHeight + 3) / 4;
+	const std::uint32_t blockBytes = GetBlockBytes(format);
+	ImageLoader::Level out;
+	out.mWidth = source.mWidth;
+	out.mHeight = source.mHeight;
+	out.mPixels.resize(static_cast<std::size_t>(blocksX) * blocksY * blockBytes);
+
+	const BlockKernelTable& kernels = *GetKernels();
+	const Effort effort = GetEffort(quality);
+	std::atomic<std::uint32_t> nextRow(0);
+	const auto work = [&]() {
+		for (std::uint32_t row = nextRow++; row < blocksY; row = nextRow++)
+		{
+			for (std::uint32_t column = 0; column < blocksX; ++column)
+			{
+				Block block;
+				LoadBlock(source, column, row, &block);
+				EncodeBlock(kernels, effort, format, block, &out.mPixels[(static_cast<std::size_t>(row) * blocksX + column) * blockBytes]);
+			}
+		}
+	};
+
+	// A row of blocks at a time, whichever thread is free; this one too.
+	if (threads == 0)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::min(threads, blocksY);
+	std::vector<std::thread> helpers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		helpers.emplace_back(work);
+	}
+	work();
+	for (std::thread& helper : helpers)
+	{
+		helper.join();
+	}
+	return out;
+}
+
+void BlockCompressor::CompressImage(ImageLoader::Image* image, Format format, Quality quality, unsigned threads)
+{
+	for (ImageLoader::Level& level : image->mLevels)
+	{
+		level = Compress(level, format, quality, threads);
+	}
+	image->mBlockFormat = GetGLFormat(format);
+}
+
+ImageLoader::Level BlockCompressor::Decompress(const ImageLoader::Level& blocks, Format format)
+{
+	const std::uint32_t blocksX = (blocks.mWidth + 3) / 4;
+	const std::uint32_t blocksY = (blocks.mHeight + 3) / 4;
+	const std::uint32_t blockBytes = GetBlockBytes(format);
+	ImageLoader::Level out;
+	out.mWidth = blocks.mWidth;
+	out.mHeight = blocks.mHeight;
+	out.mPixels.resize(static_cast<std::size_t>(out.mWidth) * out.mHeight * 4);
+	for (std::uint32_t row = 0; row < blocksY; ++row)
+	{
+		for (std::uint32_t column = 0; column < blocksX; ++column)
+		{
+			std::uint8_t texels[16][4];
+			DecodeBlock(format, &blocks.mPixels[(static_cast<std::size_t>(row) * blocksX + column) * blockBytes], texels);
+			for (std::uint32_t y = 0; y < 4 && row * 4 + y < out.mHeight; ++y)
+			{
+				for (std::uint32_t x = 0; x < 4 && column * 4 + x < out.mWidth; ++x)
+				{
+					std::memcpy(&out.mPixels[((static_cast<std::size_t>(row) * 4 + y) * out.mWidth + column * 4 + x) * 4], texels[y * 4 + x], 4);
+				}
+			}
+		}
+	}
+	return out;
+}
+
+const char* BlockCompressor::GetActivePathName()
+{
+	return GetKernels()->mName;
+}
+
+void BlockCompressor::Reselect()
+{
+	GetKernels() = SelectKernels();
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "ImageLoader.hpp"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Compresses 8 bit RGBA levels into the 4x4 block formats GPUs sample
+/// directly, at 1/8 (BC1) or 1/4 (the others) the memory of RGBA8:
+///		BC1		RGB, and 1 bit alpha: texels under 128 become transparent
+///		BC3		RGB as BC1, plus alpha with its own 8 steps
+///		BC5		two channels (red and green) at 8 steps each; for normal maps,
+///				and what the shader samples has blue 0 and alpha 1
+///		BC7		RGBA at 16 steps, in mode 6 only (one subset, 7 bit endpoints
+///				plus a shared bit). The partitioned modes would fit sharp
+///				edges better, at many times the search.
+///
+/// Each block's endpoints start on the principal axis of its colors, then
+/// the quality decides how hard to look for better ones:
+///		Fast	the axis' extent, quantized
+///		Normal	plus least squares refits of the endpoints to the indices
+///		High	plus a search of the neighbouring quantized endpoints
+/// The search spends its time matching texels to palette entries, which
+/// runs on SSE2 when the CPU has it (see CpuDispatch); both paths give the
+/// same blocks. Blocks are independent, so rows of them go to threads.
+///
+/// Blocks are in the order glCompressedTexImage2D wants them, bottom row
+/// first, like the pixels. Levels that aren't a multiple of 4 pad their
+/// last blocks by repeating the edge.
+/// </summary>
+namespace BlockCompressor {
+	enum class Format {
+		BC1,
+		BC3,
+		BC5,
+		BC7,
+	};
+
+	enum class Quality {
+		Fast,
+		Normal,
+		High,
+	};
+
+	const char* GetName(Format format);
+	const char* GetName(Quality quality);
+	/// <summary>
+	/// "bc1", "bc3", "bc5", "bc7"; "fast", "normal", "high". False if unknown.
+	/// </summary>
+	bool Parse(const char* name, Format* format);
+	bool Parse(const char* name, Quality* quality);
+
+	/// <summary>
+	/// The internal format to hand glCompressedTexImage2D.
+	/// </summary>
+	GLenum GetGLFormat(Format format);
+	/// <summary>
+	/// Whether the current context can sample the format: BC1 and BC3 need
+	/// EXT_texture_compression_s3tc, BC7 needs ARB_texture_compression_bptc
+	/// (core since 4.2), BC5 is core.
+	/// </summary>
+	bool IsSupportedByContext(Format format);
+
+	/// <summary>
+	/// The size of one width x height level in 'internalFormat', which is
+	/// GL_RGBA8 or one of GetGLFormat()'s.
+	/// </summary>
+	std::size_t GetLevelBytes(GLenum internalFormat, std::uint32_t width, std::uint32_t height);
+
+	/// <summary>
+	/// Compresses 'source' with up to 'threads' threads (0 for one per
+	/// core). The result keeps the source's size; its mPixels are the blocks.
+	/// </summary>
+	ImageLoader::Level Compress(const ImageLoader::Level& source, Format format, Quality quality, unsigned threads);
+
+	/// <summary>
+	/// Compresses every level of 'image' in place and marks it as 'format'.
+	/// </summary>
+	void CompressImage(ImageLoader::Image* image, Format format, Quality quality, unsigned threads);
+
+	/// <summary>
+	/// Back to RGBA8, as the GPU would sample it. For checking what
+	/// Compress() makes, so BC7 only knows mode 6.
+	/// </summary>
+	ImageLoader::Level Decompress(const ImageLoader::Level& blocks, Format format);
+
+	const char* GetActivePathName();
+
+	/// <summary>
+	/// Picks the scalar or SSE2 path again, e.g. after CpuDispatch::SetMaxLevel().
+	/// </summary>
+	void Reselect();
+}
@@ -1,7 +1,6 @@
 #include "Camera.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 #include "glm/gtx/rotate_vector.hpp"
-#include <iostream>
 
 Camera::Camera() {
 	// Assume we are looking out into the world
@@ -27,14 +26,11 @@ glm::mat4 Camera::GetProjectionMatrix() const {
 }
 
 void Camera::MouseLook(int mouseX, int mouseY) {
-	std::cout << "mousePos: " << mouseX << "," << mouseY << std::endl;
-
 	glm::vec2 currentMouse = glm::vec2(mouseX, mouseY);
 
-	static bool firstLook = true;
-	if (firstLook) {
+	if (!mHasMousePosition) {
 		mOldMousePosition = currentMouse;
-		firstLook = false;
+		mHasMousePosition = true;
 	}
 
 	glm::vec2 mouseDelta = mOldMousePosition - currentMouse;
@@ -42,6 +38,10 @@ void Camera::MouseLook(int mouseX, int mouseY) {
 
 	mOldMousePosition = currentMouse;
 }
+void Camera::LookAt(const glm::vec3& eye, const glm::vec3& target) {
+	mEye = eye;
+	mViewDirection = glm::normalize(target - eye);
+}
 void Camera::MoveForward(float speed) {
 	mEye += (mViewDirection*speed);
 }
@@ -55,4 +55,16 @@ void Camera::MoveLeft(float speed) {
 void Camera::MoveRight(float speed) {
 	glm::vec3 rightVector = glm::cross(mViewDirection, mUpVector);
 	mEye += rightVector * speed;
+}
+Camera Camera::Interpolate(const Camera& from, const Camera& to, float alpha) {
+	Camera camera = to;
+	camera.mEye = glm::mix(from.mEye, to.mEye, alpha);
+	// Normalized lerp; a tick turns the camera far less than half way round,
+	// but if it did, there's no telling which way, so look where 'to' looks.
+	const glm::vec3 direction = glm::mix(from.mViewDirection, to.mViewDirection, alpha);
+	const float length = glm::length(direction);
+	if (length > 1e-4f) {
+		camera.mViewDirection = direction / length;
+	}
+	return camera;
 }
\ No newline at end of file
@@ -13,15 +13,28 @@ public:
 	glm::mat4 GetProjectionMatrix() const;
 
 	void MouseLook(int mouseX, int mouseY);
+	/// <summary>
+	/// Puts the eye at 'eye', looking at 'target'.
+	/// </summary>
+	void LookAt(const glm::vec3& eye, const glm::vec3& target);
 	void MoveForward(float speed);
 	void MoveBackward(float speed);
 	void MoveLeft(float speed);
 	void MoveRight(float speed);
 
+	/// <summary>
+	/// The camera 'alpha' of the way from 'from' to 'to', for rendering
+	/// in between two simulation ticks. Both where it is and where it looks
+	/// are blended, so a camera path turns as smoothly as it moves.
+	/// </summary>
+	static Camera Interpolate(const Camera& from, const Camera& to, float alpha);
+
 private:
 	glm::mat4 mProjectionMatrix;
 	glm::vec3 mEye;
 	glm::vec3 mViewDirection;
 	glm::vec3 mUpVector;
 	glm::vec2 mOldMousePosition;
+	// The first MouseLook() only remembers where the mouse is.
+	bool mHasMousePosition = false;
 };
\ No newline at end of file
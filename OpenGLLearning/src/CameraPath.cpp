@@ -0,0 +1,68 @@
+#include "CameraPath.hpp"
+#include "glm/gtx/spline.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+bool CameraPath::Load(const char* path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	mKeys.clear();
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		std::istringstream fields(line);
+		Key key;
+		fields >> key.mSeconds
+			>> key.mEye.x >> key.mEye.y >> key.mEye.z
+			>> key.mTarget.x >> key.mTarget.y >> key.mTarget.z;
+		if (fields.fail() || (!mKeys.empty() && key.mSeconds <= mKeys.back().mSeconds))
+		{
+			mKeys.clear();
+			return false;
+		}
+		mKeys.push_back(key);
+	}
+	return !mKeys.empty();
+}
+
+void CameraPath::Evaluate(float seconds, glm::vec3* eye, glm::vec3* target) const
+{
+	if (mKeys.size() == 1 || seconds <= mKeys.front().mSeconds)
+	{
+		*eye = mKeys.front().mEye;
+		*target = mKeys.front().mTarget;
+		return;
+	}
+	if (seconds >= mKeys.back().mSeconds)
+	{
+		*eye = mKeys.back().mEye;
+		*target = mKeys.back().mTarget;
+		return;
+	}
+
+	// The segment we're in is keys[i] to keys[i + 1]; the ends repeat their
+	// key so the curve still goes through them.
+	const auto next = std::upper_bound(mKeys.begin(), mKeys.end(), seconds,
+		[](float time, const Key& key) { return time < key.mSeconds; });
+	const std::size_t i = static_cast<std::size_t>(next - mKeys.begin()) - 1;
+	const Key& k0 = mKeys[i > 0 ? i - 1 : i];
+	const Key& k1 = mKeys[i];
+	const Key& k2 = mKeys[i + 1];
+	const Key& k3 = mKeys[std::min(i + 2, mKeys.size() - 1)];
+
+	const float s = (seconds - k1.mSeconds) / (k2.mSeconds - k1.mSeconds);
+	*eye = glm::catmullRom(k0.mEye, k1.mEye, k2.mEye, k3.mEye, s);
+	*target = glm::catmullRom(k0.mTarget, k1.mTarget, k2.mTarget, k3.mTarget, s);
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include <vector>
+
+/// <summary>
+/// A scripted flythrough: the eye and the point it looks at, both on
+/// Catmull-Rom splines through a list of keys. The main loop advances it
+/// by a fixed step every simulation tick, so the same path always shows
+/// the same frames, whatever the frame rate.
+///
+/// Paths are text files with one key per line:
+///		seconds  eyeX eyeY eyeZ  targetX targetY targetZ
+/// in increasing time. Empty lines and lines starting with '#' are skipped.
+/// </summary>
+class CameraPath {
+public:
+	bool Load(const char* path);
+
+	bool IsEmpty() const { return mKeys.empty(); }
+	float GetDuration() const { return mKeys.empty() ? 0.0f : mKeys.back().mSeconds; }
+
+	/// <summary>
+	/// Eye and target 'seconds' into the path, clamped to its ends.
+	/// </summary>
+	void Evaluate(float seconds, glm::vec3* eye, glm::vec3* target) const;
+
+private:
+	struct Key {
+		float		mSeconds;
+		glm::vec3	mEye;
+		glm::vec3	mTarget;
+	};
+
+	std::vector<Key>	mKeys;
+};
@@ -0,0 +1,270 @@
+#include "CascadedShadowMaps.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+namespace {
+
+// Mirrors the Shadows block in lighting.glsl (std140).
+struct ShadowsBlock {
+	// View space to each cascade's shadow map: uv, then depth, all 0 to 1.
+	glm::mat4	mShadowMatrices[CascadedShadowMaps::MaxCascades];
+	// The view depth each cascade reaches.
+	glm::vec4	mCascadeEnds;
+	// The world size of a texel in each cascade.
+	glm::vec4	mTexelSizes;
+	// View space, towards the light; w is the cascade count.
+	glm::vec4	mSunDirection;
+	glm::vec4	mSunColor;
+};
+
+}
+
+CascadedShadowMaps::~CascadedShadowMaps()
+{
+	Destroy();
+}
+
+bool CascadedShadowMaps::Create(const Settings& settings)
+{
+	mSettings = settings;
+	mSettings.mCascadeCount = std::max(1u, std::min(mSettings.mCascadeCount, MaxCascades));
+	const GLsizei resolution = static_cast<GLsizei>(mSettings.mResolution);
+
+	// Linear filtering with a compare mode gives 2x2 PCF for free.
+	glGenTextures(1, &mShadowMap);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, mShadowMap);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, resolution, resolution, static_cast<GLsizei>(mSettings.mCascadeCount),
+		0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	// Depth only; BeginCascade() picks the layer.
+	glGenFramebuffers(1, &mFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, mShadowMap, 0, 0);
+	const GLenum none = GL_NONE;
+	glDrawBuffers(1, &none);
+	const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	glGenBuffers(1, &mBlockBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(ShadowsBlock), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	if (!complete || glGetError() != GL_NO_ERROR)
+	{
+		Destroy();
+		return false;
+	}
+	InvalidateCache();
+	return true;
+}
+
+void CascadedShadowMaps::Destroy()
+{
+	for (Cascade& cascade : mCascades)
+	{
+		cascade.mTimer.Destroy();
+	}
+	if (mShadowMap != 0)
+	{
+		glDeleteTextures(1, &mShadowMap);
+		glDeleteFramebuffers(1, &mFramebuffer);
+		glDeleteBuffers(1, &mBlockBuffer);
+	}
+	mShadowMap = mFramebuffer = mBlockBuffer = 0;
+}
+
+void CascadedShadowMaps::InvalidateCache()
+{
+	for (Cascade& cascade : mCascades)
+	{
+		cascade.mCached = false;
+	}
+}
+
+void CascadedShadowMaps::Update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& lightDirection, const std::vector<Caster>& casters)
+{
+	++mFrameCount;
+
+	const glm::vec3 direction = glm::normalize(lightDirection);
+	if (direction != mLightDirection)
+	{
+		mLightDirection = direction;
+		const glm::vec3 up = (std::abs(direction.y) > 0.99f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+		mLightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+		InvalidateCache();
+	}
+
+	// The camera's planes, and how far the view spreads: the half diagonal
+	// of its cross section at depth 1, squared.
+	const float nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+	const float farPlane = projection[3][2] / (projection[2][2] + 1.0f);
+	const float shadowEnd = std::min(farPlane, mSettings.mShadowDistance);
+	const float spread = 1.0f / (projection[0][0] * projection[0][0]) + 1.0f / (projection[1][1] * projection[1][1]);
+	const glm::mat4 viewToLight = mLightView * glm::inverse(view);
+	const float resolution = static_cast<float>(mSettings.mResolution);
+	const float threshold = mSettings.mCacheTexelThreshold;
+
+	const auto allStatic = [&casters](const std::vector<std::uint32_t>& culled) {
+		return std::all_of(culled.begin(), culled.end(), [&casters](std::uint32_t caster) { return casters[caster].mStatic; });
+	};
+
+	float begin = nearPlane;
+	for (std::uint32_t i = 0; i < mSettings.mCascadeCount; ++i)
+	{
+		Cascade& cascade = mCascades[i];
+		const float t = static_cast<float>(i + 1) / static_cast<float>(mSettings.mCascadeCount);
+		const float logarithmic = nearPlane * std::pow(shadowEnd / nearPlane, t);
+		const float uniform = nearPlane + (shadowEnd - nearPlane) * t;
+		cascade.mEnd = mSettings.mSplitLambda * logarithmic + (1.0f - mSettings.mSplitLambda) * uniform;
+		const float end = cascade.mEnd;
+
+		// The smallest sphere around the slice is centered on the view axis,
+		// where the near and far corners are equally far. Turning the camera
+		// doesn't change it, only moving does.
+		const float depth = std::min((begin + end) * (1.0f + spread) * 0.5f, end);
+		const float radius = std::sqrt(std::max(
+			(depth - begin) * (depth - begin) + begin * begin * spread,
+			(end - depth) * (end - depth) + end * end * spread));
+
+		// Room for snapping to a texel, and for a cached fit to fall behind.
+		const bool cacheable = i >= mSettings.mFirstCachedCascade;
+		const float margin = 1.0f + (cacheable ? threshold : 0.0f);
+		Fit fit;
+		fit.mRadius = radius / (1.0f - 2.0f * margin / resolution);
+		const float texel = 2.0f * fit.mRadius / resolution;
+		const glm::vec3 center = glm::vec3(viewToLight * glm::vec4(0.0f, 0.0f, -depth, 1.0f));
+		fit.mCenter = glm::vec3(std::floor(center.x / texel) * texel, std::floor(center.y / texel) * texel, -center.z);
+
+		cascade.mNeedsRender = true;
+		if (cascade.mCached
+			&& std::abs(cascade.mFit.mRadius - fit.mRadius) <= 1e-4f * fit.mRadius
+			&& std::abs(cascade.mFit.mCenter.x - fit.mCenter.x) <= threshold * texel
+			&& std::abs(cascade.mFit.mCenter.y - fit.mCenter.y) <= threshold * texel
+			&& std::abs(cascade.mFit.mCenter.z - fit.mCenter.z) <= threshold * texel)
+		{
+			// Still covers the slice; it stays unless something that moves came in.
+			Fit cached = cascade.mFit;
+			Cull(casters, &cached, &cascade.mCasters);
+			cascade.mNeedsRender = !allStatic(cascade.mCasters);
+		}
+		if (cascade.mNeedsRender)
+		{
+			Cull(casters, &fit, &cascade.mCasters);
+			cascade.mFit = fit;
+			cascade.mViewProjection = GetViewProjection(fit);
+			cascade.mCached = cacheable && allStatic(cascade.mCasters);
+		}
+		begin = end;
+	}
+}
+
+void CascadedShadowMaps::Cull(const std::vector<Caster>& casters, Fit* fit, std::vector<std::uint32_t>* culled) const
+{
+	culled->clear();
+	float nearest = fit->mCenter.z - fit->mRadius;
+	const float farthest = fit->mCenter.z + fit->mRadius;
+	for (std::uint32_t i = 0; i < casters.size(); ++i)
+	{
+		const glm::vec4& sphere = casters[i].mBoundingSphere;
+		const glm::vec3 center = glm::vec3(mLightView * glm::vec4(glm::vec3(sphere), 1.0f));
+		// Only the slice's sphere is ever looked up, so the cylinder it sweeps
+		// along the light is enough, rather than the whole box: the box's
+		// corners would keep casters no pixel of the slice sees. Nothing
+		// towards the light is culled, it can still shadow the slice.
+		const float reach = fit->mRadius + sphere.w;
+		const glm::vec2 across = glm::vec2(center) - glm::vec2(fit->mCenter);
+		if (glm::dot(across, across) > reach * reach
+			|| -center.z - sphere.w > farthest)
+		{
+			continue;
+		}
+		culled->push_back(i);
+		nearest = std::min(nearest, -center.z - sphere.w);
+	}
+	fit->mNear = nearest;
+}
+
+glm::mat4 CascadedShadowMaps::GetViewProjection(const Fit& fit) const
+{
+	return glm::ortho(
+		fit.mCenter.x - fit.mRadius, fit.mCenter.x + fit.mRadius,
+		fit.mCenter.y - fit.mRadius, fit.mCenter.y + fit.mRadius,
+		fit.mNear, fit.mCenter.z + fit.mRadius) * mLightView;
+}
+
+void CascadedShadowMaps::BeginCascade(std::uint32_t cascade)
+{
+	mActiveCascade = cascade;
+	Cascade& active = mCascades[cascade];
+	++active.mRenderCount;
+	active.mCasterCount += active.mCasters.size();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, mShadowMap, 0, static_cast<GLint>(cascade));
+	glViewport(0, 0, static_cast<GLsizei>(mSettings.mResolution), static_cast<GLsizei>(mSettings.mResolution));
+	active.mTimer.Begin();
+	glClear(GL_DEPTH_BUFFER_BIT);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	// Slope scaled, against acne where the light grazes a surface.
+	glEnable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(2.0f, 4.0f);
+}
+
+void CascadedShadowMaps::EndCascade(GLuint framebuffer)
+{
+	mCascades[mActiveCascade].mTimer.End();
+	glDisable(GL_POLYGON_OFFSET_FILL);
+	glDisable(GL_DEPTH_TEST);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+void CascadedShadowMaps::Upload(const glm::mat4& view, const glm::vec3& color)
+{
+	// Clip space to 0 to 1, for texture coordinates and the depth compare.
+	const glm::mat4 bias = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.5f)), glm::vec3(0.5f));
+	const glm::mat4 inverseView = glm::inverse(view);
+	ShadowsBlock block = {};
+	block.mCascadeEnds = glm::vec4(0.0f);
+	for (std::uint32_t i = 0; i < mSettings.mCascadeCount; ++i)
+	{
+		block.mShadowMatrices[i] = bias * mCascades[i].mViewProjection * inverseView;
+		block.mCascadeEnds[i] = mCascades[i].mEnd;
+		block.mTexelSizes[i] = 2.0f * mCascades[i].mFit.mRadius / static_cast<float>(mSettings.mResolution);
+	}
+	block.mSunDirection = glm::vec4(-glm::normalize(glm::mat3(view) * mLightDirection), static_cast<float>(mSettings.mCascadeCount));
+	block.mSunColor = glm::vec4(color, 0.0f);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(block), &block);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void CascadedShadowMaps::Bind(GLuint binding, GLuint unit) const
+{
+	glBindBufferBase(GL_UNIFORM_BUFFER, binding, mBlockBuffer);
+	glActiveTexture(GL_TEXTURE0 + unit);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, mShadowMap);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+CascadedShadowMaps::CascadeStats CascadedShadowMaps::GetStats(std::uint32_t cascade)
+{
+	Cascade& source = mCascades[cascade];
+	CascadeStats stats;
+	stats.mEnd = source.mEnd;
+	stats.mRenderCount = source.mRenderCount;
+	stats.mAverageMilliseconds = source.mTimer.GetAverageMilliseconds();
+	stats.mAverageCasters = source.mRenderCount > 0 ? static_cast<double>(source.mCasterCount) / source.mRenderCount : 0.0;
+	return stats;
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "GpuTimer.hpp"
+
+/// <summary>
+/// Shadows from one directional light (the sun), with cascaded shadow maps:
+/// the camera's view, out to Settings::mShadowDistance, is cut into slices
+/// that grow with distance, and each slice gets a shadow map of its own,
+/// one layer of a depth texture array.
+///
+/// Each cascade is an orthographic projection along the light around the
+/// bounding sphere of its slice. The sphere doesn't change as the camera
+/// turns, and its center is snapped to whole texels of the light's view,
+/// so shadow edges stay put rather than crawl as the camera moves.
+///
+/// Casters are culled per cascade: against the cylinder its slice's sphere
+/// sweeps along the light, and its far end; anything between the box and
+/// the light is kept and pulls the near plane towards the light instead of
+/// being clipped.
+///
+/// Cascades from Settings::mFirstCachedCascade on whose casters are all
+/// static keep their shadow map from frame to frame: they're drawn again
+/// only once the fit they'd get now is more than mCacheTexelThreshold
+/// texels away from the one they were drawn with, or a caster that moves
+/// enters them. They're fitted around the camera rather than the slice,
+/// so turning doesn't move them, and with that many texels to spare, so
+/// the slice stays covered until then. InvalidateCache() draws them all
+/// again.
+///
+/// Every frame: Update(), then per cascade that NeedsRender(),
+/// BeginCascade(), draw GetCasters() with GetViewProjection(), EndCascade().
+/// Upload() and Bind() then hand the cascades to the shaders (SHADOWS in
+/// lighting.glsl).
+/// </summary>
+class CascadedShadowMaps {
+public:
+	static constexpr std::uint32_t MaxCascades = 4;
+
+	struct Settings {
+		std::uint32_t		mCascadeCount		= 4;
+		// Width and height of each cascade's shadow map.
+		std::uint32_t		mResolution			= 1024;
+		// How far from the camera there are shadows, at most to its far plane.
+		float				mShadowDistance		= 40.0f;
+		// Where the splits go: 0 evenly, 1 logarithmically, in between a blend.
+		float				mSplitLambda		= 0.75f;
+		// Cascades from this one on are cached while they only have static casters.
+		std::uint32_t		mFirstCachedCascade	= 2;
+		// How many texels a cached cascade may be off before it's drawn again.
+		float				mCacheTexelThreshold	= 8.0f;
+	};
+
+	/// <summary>
+	/// Something that casts a shadow: its world space bounding sphere
+	/// (center, radius), and whether it ever moves.
+	/// </summary>
+	struct Caster {
+		glm::vec4			mBoundingSphere		= glm::vec4(0.0f);
+		bool				mStatic				= false;
+	};
+
+	~CascadedShadowMaps();
+
+	bool Create(const Settings& settings);
+	void Destroy();
+	bool IsCreated() const { return mShadowMap != 0; }
+
+	/// <summary>
+	/// Fits the cascades to the camera's 'view' and 'projection' (a
+	/// perspective one), for light travelling along 'lightDirection' (world
+	/// space), decides which ones to draw, and culls 'casters' for those.
+	/// </summary>
+	void Update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& lightDirection, const std::vector<Caster>& casters);
+	/// <summary>
+	/// Draws every cascade again on the next Update(), say once something static moved.
+	/// </summary>
+	void InvalidateCache();
+
+	std::uint32_t GetCascadeCount() const { return mSettings.mCascadeCount; }
+	bool NeedsRender(std::uint32_t cascade) const { return mCascades[cascade].mNeedsRender; }
+	/// <summary>
+	/// World space to the cascade's clip space.
+	/// </summary>
+	const glm::mat4& GetViewProjection(std::uint32_t cascade) const { return mCascades[cascade].mViewProjection; }
+	/// <summary>
+	/// The casters to draw into the cascade, as indices into Update()'s 'casters'.
+	/// </summary>
+	const std::vector<std::uint32_t>& GetCasters(std::uint32_t cascade) const { return mCascades[cascade].mCasters; }
+
+	/// <summary>
+	/// Binds the cascade's layer to draw depth into, clears it and starts
+	/// timing it. The caller draws, with a depth-only program.
+	/// </summary>
+	void BeginCascade(std::uint32_t cascade);
+	/// <summary>
+	/// Stops timing, and goes back to drawing into 'framebuffer'. The
+	/// viewport is left at the shadow map's size.
+	/// </summary>
+	void EndCascade(GLuint framebuffer);
+
+	/// <summary>
+	/// Uploads the Shadows block for the camera's 'view', with the light's
+	/// 'color'.
+	/// </summary>
+	void Upload(const glm::mat4& view, const glm::vec3& color);
+	/// <summary>
+	/// Binds the Shadows block to 'binding' and the shadow map to 'unit'.
+	/// </summary>
+	void Bind(GLuint binding, GLuint unit) const;
+
+	/// <summary>
+	/// Per cascade, since Create(): how far from the camera it reaches, in
+	/// how many of GetFrameCount() frames it was drawn, the GPU time that
+	/// took on average, and how many casters it drew on average.
+	/// </summary>
+	struct CascadeStats {
+		float				mEnd				= 0.0f;
+		std::uint64_t		mRenderCount		= 0;
+		double				mAverageMilliseconds	= 0.0;
+		double				mAverageCasters		= 0.0;
+	};
+	/// <summary>
+	/// Waits for the GPU times still outstanding.
+	/// </summary>
+	CascadeStats GetStats(std::uint32_t cascade);
+	std::uint64_t GetFrameCount() const { return mFrameCount; }
+
+private:
+	// A cascade's orthographic box, in the light's view (see mLightView).
+	struct Fit {
+		// Snapped center across the light (xy) and along it (z, distance from the origin).
+		glm::vec3			mCenter				= glm::vec3(0.0f);
+		float				mRadius				= 0.0f;
+		float				mNear				= 0.0f;
+	};
+
+	struct Cascade {
+		float				mEnd				= 0.0f;
+		Fit					mFit;
+		glm::mat4			mViewProjection		= glm::mat4(1.0f);
+		std::vector<std::uint32_t>	mCasters;
+		bool				mNeedsRender		= true;
+		// Whether mFit can be kept for the frames after, having only static casters.
+		bool				mCached				= false;
+
+		std::uint64_t		mRenderCount		= 0;
+		std::uint64_t		mCasterCount		= 0;
+		GpuTimer			mTimer;
+	};
+
+	// The casters inside the box, and the box's near end pulled in to them.
+	void Cull(const std::vector<Caster>& casters, Fit* fit, std::vector<std::uint32_t>* culled) const;
+	glm::mat4 GetViewProjection(const Fit& fit) const;
+
+	Settings				mSettings;
+	Cascade					mCascades[MaxCascades];
+	// Turns world space so the light shines along -z, about the origin.
+	glm::mat4				mLightView			= glm::mat4(1.0f);
+	glm::vec3				mLightDirection		= glm::vec3(0.0f);
+	std::uint64_t			mFrameCount			= 0;
+	// The cascade between BeginCascade() and EndCascade().
+	std::uint32_t			mActiveCascade		= 0;
+
+	GLuint					mShadowMap			= 0;
+	GLuint					mFramebuffer		= 0;
+	GLuint					mBlockBuffer		= 0;
+};
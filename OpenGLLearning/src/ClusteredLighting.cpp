@@ -0,0 +1,434 @@
+#include "ClusteredLighting.hpp"
+
+#include "CpuDispatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CLUSTERED_LIGHTING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	/// <summary>
+	/// The sphere-AABB test, so it can be SIMD.
+	/// </summary>
+	struct LightKernelTable {
+		const char* mName;
+		/// <summary>
+		/// Of the 'count' spheres, writes the positions of those that touch
+		/// the box to 'hits', in order, and returns how many there are. A
+		/// sphere touches the box if the squared distance from its center to
+		/// the box is at most its radius squared.
+		/// </summary>
+		std::uint32_t (*mCullSpheres)(const float* x, const float* y, const float* z, const float* radius, std::uint32_t count,
+			const float* boxMin, const float* boxMax, std::uint32_t* hits);
+	};
+
+	//------------------------------- Scalar -----------------------------------
+
+	std::uint32_t CullSpheresScalar(const float* x, const float* y, const float* z, const float* radius, std::uint32_t count,
+		const float* boxMin, const float* boxMax, std::uint32_t* hits)
+	{
+		std::uint32_t hitCount = 0;
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			const float dx = std::max(boxMin[0] - x[i], 0.0f) + std::max(x[i] - boxMax[0], 0.0f);
+			const float dy = std::max(boxMin[1] - y[i], 0.0f) + std::max(y[i] - boxMax[1], 0.0f);
+			const float dz = std::max(boxMin[2] - z[i], 0.0f) + std::max(z[i] - boxMax[2], 0.0f);
+			if (dx * dx + dy * dy + dz * dz <= radius[i] * radius[i])
+			{
+				hits[hitCount++] = i;
+			}
+		}
+		return hitCount;
+	}
+
+	const LightKernelTable* GetLightKernelsScalar()
+	{
+		static const LightKernelTable sTable = { "Scalar", CullSpheresScalar };
+		return &sTable;
+	}
+
+	//------------------------------- SSE2 -----------------------------------
+
+#ifdef CLUSTERED_LIGHTING_SSE2
+	std::uint32_t CullSpheresSSE2(const float* x, const float* y, const float* z, const float* radius, std::uint32_t count,
+		const float* boxMin, const float* boxMax, std::uint32_t* hits)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 minX = _mm_set1_ps(boxMin[0]);
+		const __m128 minY = _mm_set1_ps(boxMin[1]);
+		const __m128 minZ = _mm_set1_ps(boxMin[2]);
+		const __m128 maxX = _mm_set1_ps(boxMax[0]);
+		const __m128 maxY = _mm_set1_ps(boxMax[1]);
+		const __m128 maxZ = _mm_set1_ps(boxMax[2]);
+		std::uint32_t hitCount = 0;
+		std::uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 cx = _mm_loadu_ps(x + i);
+			const __m128 cy = _mm_loadu_ps(y + i);
+			const __m128 cz = _mm_loadu_ps(z + i);
+			const __m128 r = _mm_loadu_ps(radius + i);
+			// The same operations in the same order as the scalar path, so both find the same lights.
+			const __m128 dx = _mm_add_ps(_mm_max_ps(_mm_sub_ps(minX, cx), zero), _mm_max_ps(_mm_sub_ps(cx, maxX), zero));
+			const __m128 dy = _mm_add_ps(_mm_max_ps(_mm_sub_ps(minY, cy), zero), _mm_max_ps(_mm_sub_ps(cy, maxY), zero));
+			const __m128 dz = _mm_add_ps(_mm_max_ps(_mm_sub_ps(minZ, cz), zero), _mm_max_ps(_mm_sub_ps(cz, maxZ), zero));
+			const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			int mask = _mm_movemask_ps(_mm_cmple_ps(distance, _mm_mul_ps(r, r)));
+			while (mask != 0)
+			{
+				const int lane = (mask & 1) ? 0 : (mask & 2) ? 1 : (mask & 4) ? 2 : 3;
+				hits[hitCount++] = i + static_cast<std::uint32_t>(lane);
+				mask &= mask - 1;
+			}
+		}
+		const std::uint32_t tail = CullSpheresScalar(x + i, y + i, z + i, radius + i, count - i, boxMin, boxMax, hits + hitCount);
+		for (std::uint32_t j = 0; j < tail; ++j)
+		{
+			hits[hitCount + j] += i;
+		}
+		return hitCount + tail;
+	}
+
+	const LightKernelTable* GetLightKernelsSSE2()
+	{
+		static const LightKernelTable sTable = { "SSE2", CullSpheresSSE2 };
+		return &sTable;
+	}
+#else
+	const LightKernelTable* GetLightKernelsSSE2()
+	{
+		return nullptr;
+	}
+#endif
+
+	const LightKernelTable* SelectKernels()
+	{
+		const LightKernelTable* const candidates[] = {
+			GetLightKernelsScalar(),
+			GetLightKernelsSSE2(),
+			nullptr,
+			nullptr,
+		};
+		SimdLevel level = SimdLevel::Scalar;
+		const LightKernelTable* table = CpuDispatch::Select(candidates, &level);
+		CpuDispatch::ReportActivePath("ClusteredLighting", level);
+		return table;
+	}
+
+	const LightKernelTable*& GetKernels()
+	{
+		static const LightKernelTable* sKernels = SelectKernels();
+		return sKernels;
+	}
+
+	std::uint32_t Cull(const ClusteredLighting::LightSet& lights, const glm::vec3* bounds, std::uint32_t* hits)
+	{
+		return GetKernels()->mCullSpheres(lights.mX.data(), lights.mY.data(), lights.mZ.data(), lights.mRadius.data(),
+			lights.Size(), &bounds[0].x, &bounds[1].x, hits);
+	}
+
+	void Merge(const glm::vec3* bounds, glm::vec3* into)
+	{
+		into[0] = glm::min(into[0], bounds[0]);
+		into[1] = glm::max(into[1], bounds[1]);
+	}
+
+	// Mirrors the Lighting block in lighting.glsl (std140).
+	struct LightingBlock {
+		glm::mat4		mInverseProjection;
+		glm::vec4		mClusterGrid;
+		glm::vec4		mClusterDepth;
+		glm::vec4		mAmbient;
+	};
+}
+
+void ClusteredLighting::LightSet::Clear()
+{
+	mX.clear();
+	mY.clear();
+	mZ.clear();
+	mRadius.clear();
+	mIndex.clear();
+}
+
+void ClusteredLighting::LightSet::Gather(const LightSet& source, const std::uint32_t* hits, std::uint32_t count)
+{
+	mX.resize(count);
+	mY.resize(count);
+	mZ.resize(count);
+	mRadius.resize(count);
+	mIndex.resize(count);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		mX[i] = source.mX[hits[i]];
+		mY[i] = source.mY[hits[i]];
+		mZ[i] = source.mZ[hits[i]];
+		mRadius[i] = source.mRadius[hits[i]];
+		mIndex[i] = source.mIndex[hits[i]];
+	}
+}
+
+ClusteredLighting::~ClusteredLighting()
+{
+	Destroy();
+}
+
+void ClusteredLighting::SetSettings(const Settings& settings)
+{
+	mSettings = settings;
+	mClusterBounds.clear();
+	mClusterRanges.assign(static_cast<std::size_t>(GetClusterCount()) * 2, 0);
+	mLightIndices.clear();
+}
+
+bool ClusteredLighting::Create(const Settings& settings)
+{
+	SetSettings(settings);
+	glGenBuffers(1, &mBlockBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(LightingBlock), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	const GLenum formats[TextureUnitCount] = { GL_RGBA32F, GL_RG32UI, GL_R32UI };
+	glGenBuffers(TextureUnitCount, mBuffers);
+	glGenTextures(TextureUnitCount, mTextures);
+	for (GLuint i = 0; i < TextureUnitCount; ++i)
+	{
+		// Never empty, so there's always something to sample.
+		glBindBuffer(GL_TEXTURE_BUFFER, mBuffers[i]);
+		glBufferData(GL_TEXTURE_BUFFER, sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+		glBindTexture(GL_TEXTURE_BUFFER, mTextures[i]);
+		glTexBuffer(GL_TEXTURE_BUFFER, formats[i], mBuffers[i]);
+	}
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	return glGetError() == GL_NO_ERROR;
+}
+
+void ClusteredLighting::Destroy()
+{
+	if (mBlockBuffer != 0)
+	{
+		glDeleteTextures(TextureUnitCount, mTextures);
+		glDeleteBuffers(TextureUnitCount, mBuffers);
+		glDeleteBuffers(1, &mBlockBuffer);
+		mBlockBuffer = 0;
+		std::fill(mBuffers, mBuffers + TextureUnitCount, 0);
+		std::fill(mTextures, mTextures + TextureUnitCount, 0);
+	}
+}
+
+void ClusteredLighting::SetProjection(const glm::mat4& projection)
+{
+	if (projection == mProjection && !mClusterBounds.empty())
+	{
+		return;
+	}
+	mProjection = projection;
+	// As glm::perspective() builds them: [2][2] = -(far + near) / (far - near), [3][2] = -2 far near / (far - near).
+	mNear = projection[3][2] / (projection[2][2] - 1.0f);
+	mFar = projection[3][2] / (projection[2][2] + 1.0f);
+
+	const std::uint32_t clustersX = mSettings.mClustersX;
+	const std::uint32_t clustersY = mSettings.mClustersY;
+	const std::uint32_t clustersZ = mSettings.mClustersZ;
+	const glm::mat4 inverse = glm::inverse(projection);
+	// Where the tile corners' rays cross the near plane; at depth d they're d / near times further out.
+	std::vector<glm::vec3> corners((clustersX + 1) * (clustersY + 1));
+	for (std::uint32_t y = 0; y <= clustersY; ++y)
+	{
+		for (std::uint32_t x = 0; x <= clustersX; ++x)
+		{
+			const glm::vec4 ndc(2.0f * x / clustersX - 1.0f, 2.0f * y / clustersY - 1.0f, -1.0f, 1.0f);
+			const glm::vec4 view = inverse * ndc;
+			corners[y * (clustersX + 1) + x] = glm::vec3(view) / view.w;
+		}
+	}
+
+	const glm::vec3 empty[2] = { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+	mClusterBounds.resize(static_cast<std::size_t>(GetClusterCount()) * 2);
+	mRowBounds.assign(static_cast<std::size_t>(clustersY) * clustersZ * 2, empty[0]);
+	mSliceBounds.assign(static_cast<std::size_t>(clustersZ) * 2, empty[0]);
+	for (std::uint32_t z = 0; z < clustersZ; ++z)
+	{
+		const float depths[2] = {
+			mNear * std::pow(mFar / mNear, static_cast<float>(z) / clustersZ),
+			mNear * std::pow(mFar / mNear, static_cast<float>(z + 1) / clustersZ),
+		};
+		std::copy(empty, empty + 2, &mSliceBounds[z * 2]);
+		for (std::uint32_t y = 0; y < clustersY; ++y)
+		{
+			glm::vec3* row = &mRowBounds[(z * clustersY + y) * 2];
+			std::copy(empty, empty + 2, row);
+			for (std::uint32_t x = 0; x < clustersX; ++x)
+			{
+				glm::vec3* bounds = &mClusterBounds[((z * clustersY + y) * clustersX + x) * 2];
+				std::copy(empty, empty + 2, bounds);
+				for (std::uint32_t corner = 0; corner < 8; ++corner)
+				{
+					const glm::vec3 onNear = corners[(y + ((corner >> 1) & 1)) * (clustersX + 1) + x + (corner & 1)];
+					const glm::vec3 point = onNear * (depths[corner >> 2] / mNear);
+					bounds[0] = glm::min(bounds[0], point);
+					bounds[1] = glm::max(bounds[1], point);
+				}
+				Merge(bounds, row);
+			}
+			Merge(row, &mSliceBounds[z * 2]);
+		}
+	}
+}
+
+void ClusteredLighting::Assign(const std::vector<PointLight>& lights, const glm::mat4& view)
+{
+	const std::uint32_t count = static_cast<std::uint32_t>(lights.size());
+	mViewLights.Clear();
+	mLightData.resize(static_cast<std::size_t>(count) * 2);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		const PointLight& light = lights[i];
+		const glm::vec3 position = glm::vec3(view * glm::vec4(light.mPosition, 1.0f));
+		mViewLights.mX.push_back(position.x);
+		mViewLights.mY.push_back(position.y);
+		mViewLights.mZ.push_back(position.z);
+		mViewLights.mRadius.push_back(light.mRadius);
+		mViewLights.mIndex.push_back(i);
+		mLightData[i * 2] = glm::vec4(position, light.mRadius);
+		mLightData[i * 2 + 1] = glm::vec4(light.mColor * light.mIntensity, 0.0f);
+	}
+
+	// A slice at a time, whichever thread is free; this one too.
+	const std::uint32_t slices = mSettings.mClustersZ;
+	mSliceIndices.resize(slices);
+	std::atomic<std::uint32_t> nextSlice(0);
+	const auto work = [&]() {
+		LightSet sliceLights;
+		LightSet rowLights;
+		std::vector<std::uint32_t> hits(count);
+		for (std::uint32_t slice = nextSlice++; slice < slices; slice = nextSlice++)
+		{
+			AssignSlice(slice, &sliceLights, &rowLights, &hits);
+		}
+	};
+	unsigned threads = mSettings.mThreads;
+	if (threads == 0)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::min(threads, slices);
+	std::vector<std::thread> helpers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		helpers.emplace_back(work);
+	}
+	work();
+	for (std::thread& helper : helpers)
+	{
+		helper.join();
+	}
+
+	// The slices' lists, one after the other; their ranges were relative to their own.
+	mLightIndices.clear();
+	const std::uint32_t clustersPerSlice = mSettings.mClustersX * mSettings.mClustersY;
+	for (std::uint32_t slice = 0; slice < slices; ++slice)
+	{
+		const std::uint32_t offset = static_cast<std::uint32_t>(mLightIndices.size());
+		for (std::uint32_t cluster = slice * clustersPerSlice; cluster < (slice + 1) * clustersPerSlice; ++cluster)
+		{
+			mClusterRanges[cluster * 2] += offset;
+		}
+		mLightIndices.insert(mLightIndices.end(), mSliceIndices[slice].begin(), mSliceIndices[slice].end());
+	}
+}
+
+void ClusteredLighting::AssignSlice(std::uint32_t slice, LightSet* sliceLights, LightSet* rowLights, std::vector<std::uint32_t>* hits)
+{
+	const std::uint32_t clustersX = mSettings.mClustersX;
+	const std::uint32_t clustersY = mSettings.mClustersY;
+	std::vector<std::uint32_t>& indices = mSliceIndices[slice];
+	indices.clear();
+
+	sliceLights->Gather(mViewLights, hits->data(), Cull(mViewLights, &mSliceBounds[slice * 2], hits->data()));
+	for (std::uint32_t y = 0; y < clustersY; ++y)
+	{
+		const std::uint32_t row = slice * clustersY + y;
+		rowLights->Gather(*sliceLights, hits->data(), Cull(*sliceLights, &mRowBounds[row * 2], hits->data()));
+		for (std::uint32_t x = 0; x < clustersX; ++x)
+		{
+			const std::uint32_t cluster = row * clustersX + x;
+			const std::uint32_t hitCount = rowLights->Size() > 0 ? Cull(*rowLights, &mClusterBounds[cluster * 2], hits->data()) : 0;
+			mClusterRanges[cluster * 2] = static_cast<std::uint32_t>(indices.size());
+			mClusterRanges[cluster * 2 + 1] = hitCount;
+			for (std::uint32_t i = 0; i < hitCount; ++i)
+			{
+				indices.push_back(rowLights->mIndex[(*hits)[i]]);
+			}
+		}
+	}
+}
+
+void ClusteredLighting::Upload(int width, int height, const glm::vec3& ambient)
+{
+	const float clustersZ = static_cast<float>(mSettings.mClustersZ);
+	const float logRange = std::log(mFar / mNear);
+	LightingBlock block;
+	block.mInverseProjection = glm::inverse(mProjection);
+	block.mClusterGrid = glm::vec4(mSettings.mClustersX, mSettings.mClustersY, clustersZ, static_cast<float>(mLightData.size() / 2));
+	block.mClusterDepth = glm::vec4(clustersZ / logRange, -clustersZ * std::log(mNear) / logRange, width, height);
+	block.mAmbient = glm::vec4(ambient, 0.0f);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(block), &block);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	// New storage every frame, so we never wait for the GPU to finish with the last.
+	const void* data[TextureUnitCount] = { mLightData.data(), mClusterRanges.data(), mLightIndices.data() };
+	const GLsizeiptr sizes[TextureUnitCount] = {
+		static_cast<GLsizeiptr>(mLightData.size() * sizeof(glm::vec4)),
+		static_cast<GLsizeiptr>(mClusterRanges.size() * sizeof(std::uint32_t)),
+		static_cast<GLsizeiptr>(mLightIndices.size() * sizeof(std::uint32_t)),
+	};
+	for (GLuint i = 0; i < TextureUnitCount; ++i)
+	{
+		glBindBuffer(GL_TEXTURE_BUFFER, mBuffers[i]);
+		glBufferData(GL_TEXTURE_BUFFER, std::max<GLsizeiptr>(sizes[i], sizeof(glm::vec4)), nullptr, GL_STREAM_DRAW);
+		if (sizes[i] > 0)
+		{
+			glBufferSubData(GL_TEXTURE_BUFFER, 0, sizes[i], data[i]);
+		}
+	}
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void ClusteredLighting::Bind(GLuint binding, GLuint firstUnit) const
+{
+	glBindBufferBase(GL_UNIFORM_BUFFER, binding, mBlockBuffer);
+	for (GLuint i = 0; i < TextureUnitCount; ++i)
+	{
+		glActiveTexture(GL_TEXTURE0 + firstUnit + i);
+		glBindTexture(GL_TEXTURE_BUFFER, mTextures[i]);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void ClusteredLighting::GetClusterBounds(std::uint32_t cluster, glm::vec3* boxMin, glm::vec3* boxMax) const
+{
+	*boxMin = mClusterBounds[cluster * 2];
+	*boxMax = mClusterBounds[cluster * 2 + 1];
+}
+
+const char* ClusteredLighting::GetActivePathName()
+{
+	return GetKernels()->mName;
+}
+
+void ClusteredLighting::Reselect()
+{
+	GetKernels() = SelectKernels();
+}
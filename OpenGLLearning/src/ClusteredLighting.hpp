@@ -0,0 +1,148 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Clustered forward lighting: the view frustum is cut into a grid of
+/// clusters, tiles on screen times slices in depth, and every point light
+/// is listed in the clusters its sphere touches. A fragment then finds its
+/// cluster and only shades with the lights listed there, so thousands of
+/// small lights cost about what the few nearby ones do.
+///
+/// Depth slices grow exponentially from the near plane, like perspective
+/// does to everything else: slice = log(depth) * scale + bias. Each
+/// cluster's view space AABB is built from the projection (SetProjection()).
+///
+/// Assign() runs on the CPU every frame: per slice, lights are culled
+/// against the slice, then per row against the row, then per cluster, each
+/// step a sphere-AABB test over the survivors of the last, four lights at a
+/// time with SSE2. Slices are handed out to threads. The bounds of a slice
+/// or a row are the union of its clusters', so the result is the same as
+/// testing every light against every cluster.
+///
+/// The results go to the shaders through texture buffers (GL 4.1 has no
+/// storage buffers): the lights' view space positions and colors, a first
+/// index and count per cluster, and the light indices they point into. The
+/// Lighting uniform block has the grid's layout. See lighting.glsl.
+/// </summary>
+class ClusteredLighting {
+public:
+	struct Settings {
+		std::uint32_t		mClustersX		= 16;
+		std::uint32_t		mClustersY		= 9;
+		std::uint32_t		mClustersZ		= 24;
+		// Threads for Assign(), this one included; 0 is one per core.
+		unsigned			mThreads		= 0;
+	};
+
+	/// <summary>
+	/// A point light in world space. Its influence ends at mRadius.
+	/// </summary>
+	struct PointLight {
+		glm::vec3			mPosition		= glm::vec3(0.0f);
+		float				mRadius			= 1.0f;
+		glm::vec3			mColor			= glm::vec3(1.0f);
+		float				mIntensity		= 1.0f;
+	};
+
+	/// <summary>
+	/// Where the texture buffers go: units 'first' to 'first' + 2.
+	/// </summary>
+	static constexpr GLuint TextureUnitCount = 3;
+
+	~ClusteredLighting();
+
+	/// <summary>
+	/// The CPU side only needs the settings; Create() also makes the buffers.
+	/// </summary>
+	void SetSettings(const Settings& settings);
+	bool Create(const Settings& settings);
+	void Destroy();
+
+	/// <summary>
+	/// Rebuilds the clusters' bounds when 'projection' (a perspective one,
+	/// say Camera::GetProjectionMatrix()) isn't the last one.
+	/// </summary>
+	void SetProjection(const glm::mat4& projection);
+
+	/// <summary>
+	/// Lists every light in the clusters it reaches, as seen through 'view'.
+	/// </summary>
+	void Assign(const std::vector<PointLight>& lights, const glm::mat4& view);
+
+	/// <summary>
+	/// Uploads what Assign() made, and the Lighting block for a viewport
+	/// of width x height pixels with 'ambient' light.
+	/// </summary>
+	void Upload(int width, int height, const glm::vec3& ambient);
+	/// <summary>
+	/// Binds the Lighting block to 'binding' and the texture buffers to
+	/// units 'firstUnit' onwards, in the order the shaders expect.
+	/// </summary>
+	void Bind(GLuint binding, GLuint firstUnit) const;
+
+	std::uint32_t GetClusterCount() const { return mSettings.mClustersX * mSettings.mClustersY * mSettings.mClustersZ; }
+	/// <summary>
+	/// The view space bounds of cluster (x, y, z), index (z * Y + y) * X + x.
+	/// </summary>
+	void GetClusterBounds(std::uint32_t cluster, glm::vec3* boxMin, glm::vec3* boxMax) const;
+	/// <summary>
+	/// Per cluster, where its lights start in GetLightIndices() and how many there are.
+	/// </summary>
+	const std::vector<std::uint32_t>& GetClusterRanges() const { return mClusterRanges; }
+	const std::vector<std::uint32_t>& GetLightIndices() const { return mLightIndices; }
+
+	/// <summary>
+	/// The name of the sphere-AABB path in use, and picks it again (after
+	/// CpuDispatch::SetMaxLevel()).
+	/// </summary>
+	static const char* GetActivePathName();
+	static void Reselect();
+
+	/// <summary>
+	/// The lights' view space spheres, one array per component so they can
+	/// be culled four at a time, and which light each one is.
+	/// </summary>
+	struct LightSet {
+		std::vector<float>			mX;
+		std::vector<float>			mY;
+		std::vector<float>			mZ;
+		std::vector<float>			mRadius;
+		std::vector<std::uint32_t>	mIndex;
+
+		void Clear();
+		std::uint32_t Size() const { return static_cast<std::uint32_t>(mIndex.size()); }
+		/// <summary>
+		/// Keeps 'source''s spheres at 'hits', 'count' of them.
+		/// </summary>
+		void Gather(const LightSet& source, const std::uint32_t* hits, std::uint32_t count);
+	};
+
+private:
+	// The clusters of one slice.
+	void AssignSlice(std::uint32_t slice, LightSet* sliceLights, LightSet* rowLights, std::vector<std::uint32_t>* hits);
+
+	Settings					mSettings;
+	glm::mat4					mProjection		= glm::mat4(0.0f);
+	float						mNear			= 0.1f;
+	float						mFar			= 100.0f;
+	// Per cluster, then per row and per slice: min xyz, max xyz.
+	std::vector<glm::vec3>		mClusterBounds;
+	std::vector<glm::vec3>		mRowBounds;
+	std::vector<glm::vec3>		mSliceBounds;
+
+	LightSet					mViewLights;
+	std::vector<glm::vec4>		mLightData;
+	// Assign()'s result, and per slice, what its clusters got.
+	std::vector<std::uint32_t>	mClusterRanges;
+	std::vector<std::uint32_t>	mLightIndices;
+	std::vector<std::vector<std::uint32_t>>	mSliceIndices;
+
+	GLuint						mBlockBuffer	= 0;
+	// Light data, cluster ranges, light indices: a buffer and its texture each.
+	GLuint						mBuffers[TextureUnitCount]	= {};
+	GLuint						mTextures[TextureUnitCount]	= {};
+};
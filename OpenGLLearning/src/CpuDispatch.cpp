@@ -0,0 +1,236 @@
+#include "CpuDispatch.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+namespace {
+
+	void Cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t regs[4])
+	{
+		regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		int r[4];
+		__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+		for (int i = 0; i < 4; ++i)
+		{
+			regs[i] = static_cast<std::uint32_t>(r[i]);
+		}
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#else
+		(void)leaf;
+		(void)subleaf;
+#endif
+	}
+
+	std::uint64_t ReadXCR0()
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		return _xgetbv(0);
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		std::uint32_t eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#else
+		return 0;
+#endif
+	}
+
+	CpuFeatures DetectCpuFeatures()
+	{
+		CpuFeatures features;
+		std::uint32_t regs[4];
+		Cpuid(0, 0, regs);
+		const std::uint32_t maxLeaf = regs[0];
+		if (maxLeaf < 1)
+		{
+			std::snprintf(features.mBrand, sizeof(features.mBrand), "unknown");
+			return features;
+		}
+
+		Cpuid(1, 0, regs);
+		features.mSSE2 = (regs[3] & (1u << 26)) != 0;
+		features.mSSE41 = (regs[2] & (1u << 19)) != 0;
+		const bool osxsave = (regs[2] & (1u << 27)) != 0;
+		const bool avx = (regs[2] & (1u << 28)) != 0;
+		const bool fma = (regs[2] & (1u << 12)) != 0;
+
+		// The OS has to save the wide registers on context switches too,
+		// otherwise the instructions are there but unusable.
+		const std::uint64_t xcr0 = osxsave ? ReadXCR0() : 0;
+		const bool osYmm = (xcr0 & 0x6) == 0x6;
+		const bool osZmm = (xcr0 & 0xE6) == 0xE6;
+
+		features.mAVX = avx && osYmm;
+		features.mFMA = fma && features.mAVX;
+		if (maxLeaf >= 7)
+		{
+			Cpuid(7, 0, regs);
+			features.mAVX2 = features.mAVX && (regs[1] & (1u << 5)) != 0;
+			features.mAVX512F = features.mAVX2 && osZmm && (regs[1] & (1u << 16)) != 0;
+		}
+
+		Cpuid(0x80000000u, 0, regs);
+		if (regs[0] >= 0x80000004u)
+		{
+			for (std::uint32_t i = 0; i < 3; ++i)
+			{
+				Cpuid(0x80000002u + i, 0, regs);
+				std::memcpy(features.mBrand + 16 * i, regs, 16);
+			}
+		}
+		else
+		{
+			std::snprintf(features.mBrand, sizeof(features.mBrand), "unknown");
+		}
+		return features;
+	}
+
+	std::string ReadEnvironment(const char* name)
+	{
+#if defined(_MSC_VER)
+		char* value = nullptr;
+		std::size_t length = 0;
+		std::string result;
+		if (_dupenv_s(&value, &length, name) == 0 && value != nullptr)
+		{
+			result = value;
+			std::free(value);
+		}
+		return result;
+#else
+		const char* value = std::getenv(name);
+		return value ? value : "";
+#endif
+	}
+
+	struct DispatchState {
+		SimdLevel mMaxLevel = SimdLevel::AVX512;
+		std::vector<std::pair<std::string, SimdLevel>> mActivePaths;
+	};
+
+	DispatchState& GetState()
+	{
+		static DispatchState sState = []() {
+			DispatchState state;
+			const std::string cap = ReadEnvironment("OPENGL_LEARNING_SIMD");
+			if (!cap.empty() && !CpuDispatch::ParseLevel(cap.c_str(), &state.mMaxLevel))
+			{
+				std::printf("OPENGL_LEARNING_SIMD=%s not understood, ignoring it.\n", cap.c_str());
+			}
+			return state;
+		}();
+		return sState;
+	}
+}
+
+namespace CpuDispatch {
+
+	const CpuFeatures& GetCpuFeatures()
+	{
+		static const CpuFeatures sFeatures = DetectCpuFeatures();
+		return sFeatures;
+	}
+
+	bool IsSupported(SimdLevel level)
+	{
+		const CpuFeatures& cpu = GetCpuFeatures();
+		switch (level)
+		{
+		case SimdLevel::Scalar:	return true;
+		case SimdLevel::SSE2:	return cpu.mSSE2;
+		case SimdLevel::AVX2:	return cpu.mAVX2 && cpu.mFMA;
+		case SimdLevel::AVX512:	return cpu.mAVX512F;
+		default:				return false;
+		}
+	}
+
+	SimdLevel GetBestLevel()
+	{
+		for (int level = static_cast<int>(GetState().mMaxLevel); level > 0; --level)
+		{
+			if (IsSupported(static_cast<SimdLevel>(level)))
+			{
+				return static_cast<SimdLevel>(level);
+			}
+		}
+		return SimdLevel::Scalar;
+	}
+
+	void SetMaxLevel(SimdLevel level)
+	{
+		GetState().mMaxLevel = level;
+	}
+
+	SimdLevel GetMaxLevel()
+	{
+		return GetState().mMaxLevel;
+	}
+
+	const char* GetLevelName(SimdLevel level)
+	{
+		switch (level)
+		{
+		case SimdLevel::Scalar:	return "Scalar";
+		case SimdLevel::SSE2:	return "SSE2";
+		case SimdLevel::AVX2:	return "AVX2";
+		case SimdLevel::AVX512:	return "AVX-512";
+		default:				return "?";
+		}
+	}
+
+	bool ParseLevel(const char* name, SimdLevel* level)
+	{
+		const struct { const char* mName; SimdLevel mLevel; } names[] = {
+			{ "scalar",	SimdLevel::Scalar },
+			{ "sse2",	SimdLevel::SSE2 },
+			{ "avx2",	SimdLevel::AVX2 },
+			{ "avx512",	SimdLevel::AVX512 },
+		};
+		for (const auto& entry : names)
+		{
+			if (std::strcmp(entry.mName, name) == 0)
+			{
+				*level = entry.mLevel;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void ReportActivePath(const char* family, SimdLevel level)
+	{
+		for (auto& path : GetState().mActivePaths)
+		{
+			if (path.first == family)
+			{
+				path.second = level;
+				return;
+			}
+		}
+		GetState().mActivePaths.emplace_back(family, level);
+	}
+
+	void PrintReport()
+	{
+		const CpuFeatures& cpu = GetCpuFeatures();
+		std::printf("CPU: %s\n", cpu.mBrand);
+		std::printf("CPU features: SSE2=%d SSE4.1=%d AVX=%d FMA=%d AVX2=%d AVX-512F=%d\n",
+			cpu.mSSE2, cpu.mSSE41, cpu.mAVX, cpu.mFMA, cpu.mAVX2, cpu.mAVX512F);
+		std::printf("SIMD level: %s (cap %s)\n", GetLevelName(GetBestLevel()), GetLevelName(GetMaxLevel()));
+		for (const auto& path : GetState().mActivePaths)
+		{
+			std::printf("  %-16s %s\n", path.first.c_str(), GetLevelName(path.second));
+		}
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/// <summary>
+/// The instruction sets our hot kernels are compiled for, narrowest first.
+/// </summary>
+enum class SimdLevel {
+	Scalar = 0,
+	SSE2,
+	AVX2,		// includes FMA
+	AVX512,		// AVX-512F
+	Count
+};
+
+/// <summary>
+/// What cpuid (and the OS, via xgetbv) says we may use.
+/// </summary>
+struct CpuFeatures {
+	bool mSSE2		= false;
+	bool mSSE41		= false;
+	bool mAVX		= false;
+	bool mFMA		= false;
+	bool mAVX2		= false;
+	bool mAVX512F	= false;
+	char mBrand[49]	= {};
+};
+
+/// <summary>
+/// Runtime selection between versions of a kernel built for different
+/// instruction sets, so one binary runs everywhere and still uses the
+/// widest registers available.
+///
+/// glm itself is still configured at compile time (GLM_ARCH), so the
+/// program as a whole stays at the baseline. Only the kernels that go
+/// through here are built for wider ISAs, each in its own translation unit.
+///
+/// The level can be capped with the OPENGL_LEARNING_SIMD environment
+/// variable ("scalar", "sse2", "avx2" or "avx512"), e.g. to reproduce what
+/// an older machine would run.
+/// </summary>
+namespace CpuDispatch {
+
+	const CpuFeatures& GetCpuFeatures();
+
+	bool IsSupported(SimdLevel level);
+
+	/// <summary>
+	/// The widest supported level that isn't above the current cap.
+	/// </summary>
+	SimdLevel GetBestLevel();
+
+	/// <summary>
+	/// Caps the level handed out by GetBestLevel() and Select(). Kernel
+	/// families that already picked a path keep it until they select again.
+	/// </summary>
+	void SetMaxLevel(SimdLevel level);
+	SimdLevel GetMaxLevel();
+
+	const char* GetLevelName(SimdLevel level);
+
+	/// <summary>
+	/// Parses the names used by OPENGL_LEARNING_SIMD. Returns false if unknown.
+	/// </summary>
+	bool ParseLevel(const char* name, SimdLevel* level);
+
+	/// <summary>
+	/// Picks the best candidate, indexed by SimdLevel, that was built for
+	/// this target (non-null), is supported and isn't above the cap.
+	/// </summary>
+	template <typename Table>
+	const Table* Select(const Table* const (&candidates)[static_cast<int>(SimdLevel::Count)], SimdLevel* chosen = nullptr)
+	{
+		for (int level = static_cast<int>(GetBestLevel()); level >= 0; --level)
+		{
+			if (candidates[level] != nullptr)
+			{
+				if (chosen)
+				{
+					*chosen = static_cast<SimdLevel>(level);
+				}
+				return candidates[level];
+			}
+		}
+		return nullptr;
+	}
+
+	/// <summary>
+	/// Kernel families call this whenever they pick a path, for PrintReport().
+	/// </summary>
+	void ReportActivePath(const char* family, SimdLevel level);
+
+	/// <summary>
+	/// Prints the CPU, its features and which path every kernel family uses.
+	/// </summary>
+	void PrintReport();
+}
@@ -0,0 +1,112 @@
+#include "DeferredShading.hpp"
+
+DeferredShading::~DeferredShading()
+{
+	Destroy();
+}
+
+bool DeferredShading::Create(GLuint lightingProgram, GLuint firstUnit, int width, int height)
+{
+	mProgram = lightingProgram;
+	mFirstUnit = firstUnit;
+	mWidth = width;
+	mHeight = height;
+
+	const char* const samplers[TargetCount] = { "u_GBufferAlbedoRoughness", "u_GBufferNormal", "u_GBufferDepth" };
+	for (GLuint i = 0; i < TargetCount; ++i)
+	{
+		glProgramUniform1i(mProgram, glGetUniformLocation(mProgram, samplers[i]), static_cast<GLint>(mFirstUnit + i));
+	}
+
+	// The lighting pass reads single texels, no filtering or mips.
+	const GLint internalFormats[TargetCount] = { GL_RGBA8, GL_RG16, GL_DEPTH_COMPONENT24 };
+	const GLenum formats[TargetCount] = { GL_RGBA, GL_RG, GL_DEPTH_COMPONENT };
+	const GLenum types[TargetCount] = { GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+	glGenTextures(TargetCount, mTextures);
+	for (GLuint i = 0; i < TargetCount; ++i)
+	{
+		glBindTexture(GL_TEXTURE_2D, mTextures[i]);
+		glTexImage2D(GL_TEXTURE_2D, 0, internalFormats[i], mWidth, mHeight, 0, formats[i], types[i], nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenFramebuffers(1, &mFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTextures[AlbedoRoughnessTarget], 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, mTextures[NormalTarget], 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, mTextures[DepthTarget], 0);
+	const GLenum drawBuffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+	glDrawBuffers(2, drawBuffers);
+	const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	glGenVertexArrays(1, &mVertexArray);
+
+	if (!complete || glGetError() != GL_NO_ERROR)
+	{
+		Destroy();
+		return false;
+	}
+	return true;
+}
+
+void DeferredShading::Destroy()
+{
+	if (mFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mFramebuffer);
+		glDeleteTextures(TargetCount, mTextures);
+		glDeleteVertexArrays(1, &mVertexArray);
+		glDeleteProgram(mProgram);
+	}
+	mFramebuffer = 0;
+	for (GLuint& texture : mTextures)
+	{
+		texture = 0;
+	}
+	mVertexArray = 0;
+	mProgram = 0;
+}
+
+void DeferredShading::BeginGeometryPass()
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glViewport(0, 0, mWidth, mHeight);
+	// Depth cleared to 1 marks the pixels nothing covers; the lighting pass
+	// skips them. glClearBuffer leaves the clear color to the screen's.
+	const GLfloat zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	const GLfloat one = 1.0f;
+	glClearBufferfv(GL_COLOR, 0, zero);
+	glClearBufferfv(GL_COLOR, 1, zero);
+	glClearBufferfv(GL_DEPTH, 0, &one);
+
+	// The forward pass draws without a depth test, the last draw wins. We
+	// keep that order, so both paths show the same picture, but still need
+	// the depth written: a test that always passes does both.
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_ALWAYS);
+}
+
+void DeferredShading::Shade(GLuint framebuffer)
+{
+	glDisable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+	for (GLuint i = 0; i < TargetCount; ++i)
+	{
+		glActiveTexture(GL_TEXTURE0 + mFirstUnit + i);
+		glBindTexture(GL_TEXTURE_2D, mTextures[i]);
+	}
+	glActiveTexture(GL_TEXTURE0);
+
+	glUseProgram(mProgram);
+	glBindVertexArray(mVertexArray);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	glBindVertexArray(0);
+	glUseProgram(0);
+}
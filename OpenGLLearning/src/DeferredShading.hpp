@@ -0,0 +1,75 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstdint>
+
+/// <summary>
+/// Deferred shading: the opaque pass only writes down what its surfaces
+/// are, into a G-buffer, and one full screen pass then lights every pixel
+/// once, however many surfaces were drawn over it. Forward shading lights
+/// every fragment drawn, so with overdraw and many lights this wins.
+///
+/// The G-buffer takes 12 bytes a pixel:
+///	- albedo and roughness, RGBA8;
+///	- the view space normal, octahedral encoded into RG16;
+///	- depth, 24 bits (in 32). There is no position target, the lighting
+///	  pass rebuilds it from the depth and the inverse projection.
+///
+/// The geometry pass draws the materials' GBuffer permutation (see
+/// MaterialSystem::GBuffer and frag.glsl). The lighting pass
+/// (deferred_frag.glsl) takes its lights from ClusteredLighting: the
+/// clusters are the screen tiles of tiled deferred shading, cut in depth
+/// as well, and each pixel walks the list of the cluster its rebuilt
+/// position is in, exactly as the forward path's fragments do.
+/// </summary>
+class DeferredShading {
+public:
+	/// <summary>
+	/// The G-buffer's textures, in the order they go to texture units.
+	/// </summary>
+	enum Target : GLuint {
+		AlbedoRoughnessTarget,
+		NormalTarget,
+		DepthTarget,
+		TargetCount,
+	};
+	static constexpr GLuint TextureUnitCount = TargetCount;
+	static constexpr std::uint32_t BytesPerPixel = 4 + 4 + 4;
+
+	~DeferredShading();
+
+	/// <summary>
+	/// Makes a width x height G-buffer. Takes the lighting pass's program,
+	/// built from fullscreen_vert.glsl and deferred_frag.glsl, which reads
+	/// the G-buffer from units 'firstUnit' onwards. Destroy() deletes it.
+	/// </summary>
+	bool Create(GLuint lightingProgram, GLuint firstUnit, int width, int height);
+	void Destroy();
+	bool IsCreated() const { return mFramebuffer != 0; }
+
+	/// <summary>
+	/// Binds the G-buffer and clears it, for the opaque pass's draws.
+	/// </summary>
+	void BeginGeometryPass();
+	/// <summary>
+	/// Lights the G-buffer into 'framebuffer', where only pixels something
+	/// was drawn on change. The Lighting block and ClusteredLighting's
+	/// texture buffers have to be bound already, if the program is LIT.
+	/// </summary>
+	void Shade(GLuint framebuffer);
+
+	GLuint GetTexture(Target target) const { return mTextures[target]; }
+	int GetWidth() const { return mWidth; }
+	int GetHeight() const { return mHeight; }
+	std::uint64_t GetMemoryBytes() const { return static_cast<std::uint64_t>(mWidth) * mHeight * BytesPerPixel; }
+
+private:
+	GLuint					mFramebuffer	= 0;
+	GLuint					mTextures[TargetCount]	= {};
+	GLuint					mProgram		= 0;
+	// Core profile draws need one bound, even with no attributes.
+	GLuint					mVertexArray	= 0;
+	GLuint					mFirstUnit		= 0;
+	int						mWidth			= 0;
+	int						mHeight			= 0;
+};
@@ -0,0 +1,161 @@
+#include "FramePacer.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+
+void FramePacer::Create()
+{
+	for (Frame& frame : mFrames)
+	{
+		glGenQueries(1, &frame.mQuery);
+	}
+	Calibrate();
+}
+
+void FramePacer::Destroy()
+{
+	for (Frame& frame : mFrames)
+	{
+		if (frame.mFence)
+		{
+			glDeleteSync(frame.mFence);
+			frame.mFence = nullptr;
+		}
+		glDeleteQueries(1, &frame.mQuery);
+		frame.mQuery = 0;
+	}
+	mQueued = 0;
+}
+
+void FramePacer::SetFramesInFlight(int frames)
+{
+	mFramesInFlight = std::max(1, std::min(frames, MaxFramesInFlight));
+}
+
+void FramePacer::Calibrate()
+{
+	// Both clocks read back to back; the GPU one is behind by the time it
+	// takes to get there, which is small next to a frame.
+	GLint64 gpuTime = 0;
+	glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+	const std::int64_t cpuTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+	mGpuClockOffset = gpuTime - cpuTime;
+	mFramesSinceCalibration = 0;
+}
+
+bool FramePacer::Retire(bool wait)
+{
+	Frame& frame = mFrames[mOldest];
+	GLenum result = glClientWaitSync(frame.mFence, 0, 0);
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		if (!wait)
+		{
+			return false;
+		}
+		do
+		{
+			result = glClientWaitSync(frame.mFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		} while (result == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(frame.mFence);
+	frame.mFence = nullptr;
+
+	// The fence came after the query, so the result is there already.
+	GLuint64 gpuTime = 0;
+	glGetQueryObjectui64v(frame.mQuery, GL_QUERY_RESULT, &gpuTime);
+	const Clock::time_point completed(std::chrono::duration_cast<Clock::duration>(
+		std::chrono::nanoseconds(static_cast<std::int64_t>(gpuTime) - mGpuClockOffset)));
+	const double latency = std::chrono::duration<double, std::milli>(completed - frame.mInputTime).count();
+	mLatencies[mLatencyCount % HistorySize] = std::max(latency, 0.0);
+	++mLatencyCount;
+
+	mOldest = (mOldest + 1) % MaxFramesInFlight;
+	--mQueued;
+	return true;
+}
+
+void FramePacer::BeginFrame()
+{
+	const Clock::time_point start = Clock::now();
+
+	// Pick up whatever finished by now, so the measurements don't lag.
+	while (mQueued > 0 && Retire(false))
+	{
+	}
+	while (mQueued >= mFramesInFlight)
+	{
+		Retire(true);
+	}
+
+	mWaits[mWaitCount % HistorySize] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	++mWaitCount;
+
+	// The GPU clock drifts against ours, slowly.
+	if (++mFramesSinceCalibration >= 600)
+	{
+		Calibrate();
+	}
+}
+
+void FramePacer::MarkInputSampled()
+{
+	mInputTime = Clock::now();
+}
+
+void FramePacer::EndFrame()
+{
+	if (mQueued == MaxFramesInFlight)
+	{
+		Retire(true);
+	}
+
+	Frame& frame = mFrames[(mOldest + mQueued) % MaxFramesInFlight];
+	glQueryCounter(frame.mQuery, GL_TIMESTAMP);
+	frame.mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	frame.mInputTime = mInputTime;
+	++mQueued;
+
+	// Make sure the fence reaches the GPU, or waiting on it could wait forever.
+	glFlush();
+}
+
+FramePacer::Stats FramePacer::GetStats() const
+{
+	Stats stats;
+	stats.mSamples = std::min(mLatencyCount, HistorySize);
+	if (stats.mSamples > 0)
+	{
+		stats.mMinLatency = mLatencies[0];
+		stats.mMaxLatency = mLatencies[0];
+		double sum = 0.0;
+		for (int i = 0; i < stats.mSamples; ++i)
+		{
+			sum += mLatencies[i];
+			stats.mMinLatency = std::min(stats.mMinLatency, mLatencies[i]);
+			stats.mMaxLatency = std::max(stats.mMaxLatency, mLatencies[i]);
+		}
+		stats.mAverageLatency = sum / stats.mSamples;
+	}
+
+	const int waits = std::min(mWaitCount, HistorySize);
+	if (waits > 0)
+	{
+		double sum = 0.0;
+		for (int i = 0; i < waits; ++i)
+		{
+			sum += mWaits[i];
+		}
+		stats.mAverageWait = sum / waits;
+	}
+	return stats;
+}
+
+void FramePacer::PrintStats() const
+{
+	const Stats stats = GetStats();
+	printf("Frame pacing: %d frame(s) in flight, late latching %s\n", mFramesInFlight, mLateLatching ? "on" : "off");
+	printf("  input to GPU done: %.2f ms average, %.2f min, %.2f max (%d frames)\n",
+		stats.mAverageLatency, stats.mMinLatency, stats.mMaxLatency, stats.mSamples);
+	printf("  waiting for the GPU: %.2f ms per frame\n", stats.mAverageWait);
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstdint>
+
+/// <summary>
+/// Bounds how far the CPU runs ahead of the GPU, and measures what that
+/// costs in latency.
+///
+/// Without this the driver queues as many frames as it likes behind
+/// SDL_GL_SwapWindow, and input read at the start of a frame may only show
+/// up on screen several frames later. Here every frame ends with a fence,
+/// and BeginFrame() waits until fewer than N frames are still queued before
+/// we read any input. N = 1 gives the lowest latency, higher N lets the
+/// CPU and GPU overlap more.
+///
+/// Latency is measured from MarkInputSampled() to when the GPU finished the
+/// frame (a GL_TIMESTAMP query after the swap, moved onto the CPU clock).
+///
+/// With late latching the main loop reads input a second time just before
+/// building the view, so the camera reflects the newest mouse position
+/// even if the simulation for the frame took a while.
+/// </summary>
+class FramePacer {
+public:
+	/// <summary>
+	/// Frames the GPU may be behind by, at most. More than
+	/// StreamingBuffer::FrameCount - 1 would only make it stall instead.
+	/// </summary>
+	static constexpr int MaxFramesInFlight = 4;
+
+	struct Stats {
+		int		mSamples				= 0;
+		// Input to GPU completion, in milliseconds.
+		double	mAverageLatency			= 0.0;
+		double	mMinLatency				= 0.0;
+		double	mMaxLatency				= 0.0;
+		// Time BeginFrame() spent waiting for the GPU, in milliseconds per frame.
+		double	mAverageWait			= 0.0;
+	};
+
+	void Create();
+	void Destroy();
+
+	void SetFramesInFlight(int frames);
+	int GetFramesInFlight() const { return mFramesInFlight; }
+	void SetLateLatching(bool enabled) { mLateLatching = enabled; }
+	bool IsLateLatching() const { return mLateLatching; }
+
+	/// <summary>
+	/// Waits until fewer than GetFramesInFlight() frames are queued. Call
+	/// before reading input for the frame.
+	/// </summary>
+	void BeginFrame();
+
+	/// <summary>
+	/// Call right after reading input, and again after late latching.
+	/// </summary>
+	void MarkInputSampled();
+
+	/// <summary>
+	/// Call right after SDL_GL_SwapWindow.
+	/// </summary>
+	void EndFrame();
+
+	/// <summary>
+	/// Over the last HistorySize frames that completed.
+	/// </summary>
+	Stats GetStats() const;
+	void PrintStats() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+	static constexpr int HistorySize = 128;
+
+	struct Frame {
+		GLsync				mFence			= nullptr;
+		GLuint				mQuery			= 0;
+		Clock::time_point	mInputTime;
+	};
+
+	// Takes the oldest frame off the queue, waiting for it if 'wait' is set.
+	// Returns false if it isn't done yet and we didn't wait.
+	bool Retire(bool wait);
+	void Calibrate();
+
+	Frame				mFrames[MaxFramesInFlight];
+	int					mOldest					= 0;
+	int					mQueued					= 0;
+	int					mFramesInFlight			= 2;
+	bool				mLateLatching			= false;
+	Clock::time_point	mInputTime;
+
+	// GL_TIMESTAMP minus Clock, in nanoseconds.
+	std::int64_t		mGpuClockOffset			= 0;
+	int					mFramesSinceCalibration	= 0;
+
+	double				mLatencies[HistorySize]	= {};
+	double				mWaits[HistorySize]		= {};
+	int					mLatencyCount			= 0;
+	int					mWaitCount				= 0;
+};
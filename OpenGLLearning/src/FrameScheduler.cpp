@@ -0,0 +1,92 @@
+#include "FrameScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+FrameScheduler::FrameScheduler(double ticksPerSecond)
+	: mTickSeconds(1.0 / ticksPerSecond)
+{
+}
+
+void FrameScheduler::SetTickRate(double ticksPerSecond)
+{
+	mTickSeconds = 1.0 / ticksPerSecond;
+}
+
+void FrameScheduler::SetFrameLimit(double framesPerSecond)
+{
+	mFrameLimit = framesPerSecond > 0.0
+		? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond))
+		: Clock::duration::zero();
+	mNextDeadline = Clock::now() + mFrameLimit;
+}
+
+int FrameScheduler::BeginFrame()
+{
+	const Clock::time_point now = Clock::now();
+	if (!mStarted)
+	{
+		// Nothing to catch up with on the first frame.
+		mStarted = true;
+		mLastFrame = now;
+		mNextDeadline = now + mFrameLimit;
+	}
+
+	mFrameSeconds = std::chrono::duration<double>(now - mLastFrame).count();
+	mLastFrame = now;
+
+	mAccumulator = std::min(mAccumulator + mFrameSeconds, MaxTicksPerFrame * mTickSeconds);
+	const int ticks = static_cast<int>(mAccumulator / mTickSeconds);
+	mAccumulator -= ticks * mTickSeconds;
+	return ticks;
+}
+
+void FrameScheduler::EndFrame()
+{
+	if (mFrameLimit == Clock::duration::zero())
+	{
+		return;
+	}
+
+	SleepUntil(mNextDeadline);
+
+	// Advance the deadline itself rather than restarting from now, so small
+	// oversleeps don't add up. After a slow frame that deadline has passed
+	// already; start over a whole frame from now instead of letting the next
+	// one through unthrottled to make up for it.
+	const Clock::time_point now = Clock::now();
+	mNextDeadline += mFrameLimit;
+	if (mNextDeadline < now)
+	{
+		mNextDeadline = now + mFrameLimit;
+	}
+}
+
+void FrameScheduler::SleepUntil(Clock::time_point deadline)
+{
+	// Sleep in 1 ms steps while we're sure to wake up in time, which depends
+	// on the OS scheduler, so keep track of how long those steps really take.
+	// Then spin for the rest.
+	for (;;)
+	{
+		const double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+		if (remaining <= mSleepMean + 2.0 * mSleepDeviation)
+		{
+			break;
+		}
+
+		const Clock::time_point before = Clock::now();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		const double slept = std::chrono::duration<double>(Clock::now() - before).count();
+
+		const double error = slept - mSleepMean;
+		mSleepMean += 0.1 * error;
+		mSleepDeviation += 0.1 * (std::fabs(error) - mSleepDeviation);
+	}
+
+	while (Clock::now() < deadline)
+	{
+		std::this_thread::yield();
+	}
+}
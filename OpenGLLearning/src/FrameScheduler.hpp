@@ -0,0 +1,69 @@
+#pragma once
+#include <chrono>
+
+/// <summary>
+/// Paces the main loop. The simulation advances in fixed ticks no matter
+/// how long frames take, so it behaves the same at 30 or 300 fps, and
+/// rendering interpolates between the last two ticks so motion stays smooth
+/// when the two rates don't line up.
+///
+/// Every frame:
+///		int ticks = BeginFrame();
+///		for (...ticks...) { ... simulate GetTickSeconds() ... }
+///		... render at GetInterpolation() ...
+///		EndFrame();		// sleeps if we're ahead of the frame limit
+/// </summary>
+class FrameScheduler {
+public:
+	/// <summary>
+	/// After a long stall (a breakpoint, dragging the window) we'd rather
+	/// slow the simulation down than run hundreds of ticks to catch up.
+	/// </summary>
+	static constexpr int MaxTicksPerFrame = 8;
+
+	explicit FrameScheduler(double ticksPerSecond = 60.0);
+
+	void SetTickRate(double ticksPerSecond);
+	double GetTickSeconds() const { return mTickSeconds; }
+
+	/// <summary>
+	/// Caps the frame rate, 0 for uncapped (vsync may still apply).
+	/// </summary>
+	void SetFrameLimit(double framesPerSecond);
+
+	/// <summary>
+	/// Starts a frame and returns how many ticks to simulate to catch up with the clock.
+	/// </summary>
+	int BeginFrame();
+
+	/// <summary>
+	/// Where this frame is between the state before the last tick (0) and after it (1).
+	/// </summary>
+	float GetInterpolation() const { return static_cast<float>(mAccumulator / mTickSeconds); }
+
+	/// <summary>
+	/// Ends the frame, sleeping as long as the frame limit asks for.
+	/// </summary>
+	void EndFrame();
+
+	/// <summary>
+	/// Time between the last two BeginFrame() calls, in seconds.
+	/// </summary>
+	double GetFrameSeconds() const { return mFrameSeconds; }
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	void SleepUntil(Clock::time_point deadline);
+
+	double				mTickSeconds;
+	double				mAccumulator			= 0.0;
+	double				mFrameSeconds			= 0.0;
+	Clock::duration		mFrameLimit				= Clock::duration::zero();
+	Clock::time_point	mLastFrame;
+	Clock::time_point	mNextDeadline;
+	bool				mStarted				= false;
+	// How long a 1 ms sleep really takes: running mean and deviation.
+	double				mSleepMean				= 0.002;
+	double				mSleepDeviation			= 0.0;
+};
@@ -0,0 +1,386 @@
+#include "GLCapture.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GLTrace.hpp"
+
+namespace {
+
+// Calls are collected in memory and written out in chunks this big.
+constexpr std::size_t FlushSize = 1024 * 1024;
+
+struct Mapping {
+	char*		mPointer	= nullptr;
+	GLsizeiptr	mLength		= 0;
+	GLbitfield	mAccess		= 0;
+};
+
+std::FILE*			sFile		= nullptr;
+std::vector<char>	sBuffer;
+std::size_t			sCallStart	= 0;
+std::size_t			sFrameCount	= 0;
+std::size_t			sByteCount	= 0;
+// Wrappers may be called from any thread that has a context; the lock is
+// held across the real call too, so the trace has them in the order they ran.
+std::mutex			sMutex;
+// Mapped ranges by buffer name, to find the bytes written through them.
+std::unordered_map<GLuint, Mapping>	sMappings;
+
+void Flush()
+{
+	if (!sBuffer.empty())
+	{
+		std::fwrite(sBuffer.data(), 1, sBuffer.size(), sFile);
+		sByteCount += sBuffer.size();
+		sBuffer.clear();
+	}
+}
+
+void Put(const void* data, std::size_t size)
+{
+	const char* bytes = static_cast<const char*>(data);
+	sBuffer.insert(sBuffer.end(), bytes, bytes + size);
+}
+
+template <typename T>
+void Put(const T& value)
+{
+	Put(&value, sizeof(T));
+}
+
+void BeginCall(GLTrace::Opcode opcode)
+{
+	Put(opcode);
+	sCallStart = sBuffer.size();
+	Put(std::uint32_t(0));
+}
+
+void EndCall()
+{
+	const std::uint32_t size = static_cast<std::uint32_t>(sBuffer.size() - sCallStart - sizeof(std::uint32_t));
+	std::memcpy(&sBuffer[sCallStart], &size, sizeof(size));
+	if (sBuffer.size() >= FlushSize)
+	{
+		Flush();
+	}
+}
+
+void WriteEnum(GLenum value)				{ Put(value); }
+void WriteBitfield(GLbitfield value)		{ Put(value); }
+void WriteBoolean(GLboolean value)			{ Put(value); }
+void WriteInt(GLint value)					{ Put(value); }
+void WriteUInt(GLuint value)				{ Put(value); }
+void WriteSizei(GLsizei value)				{ Put(value); }
+void WriteFloat(GLfloat value)				{ Put(value); }
+void WriteIntptr(GLintptr value)			{ Put(static_cast<std::int64_t>(value)); }
+void WriteSizeiptr(GLsizeiptr value)		{ Put(static_cast<std::int64_t>(value)); }
+void WriteOffset(const void* value)			{ Put(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value))); }
+void WriteBuffer(GLuint name)				{ Put(name); }
+void WriteTexture(GLuint name)				{ Put(name); }
+void WriteFramebuffer(GLuint name)			{ Put(name); }
+void WriteVertexArray(GLuint name)			{ Put(name); }
+void WriteQuery(GLuint name)				{ Put(name); }
+void WriteProgram(GLuint name)				{ Put(name); }
+void WriteSync(GLsync sync)					{ Put(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(sync))); }
+void WriteLocation(GLint location)			{ Put(location); }
+void WriteBlockIndex(GLuint index)			{ Put(index); }
+void WriteString(const GLchar* string)		{ Put(string, std::strlen(string) + 1); }
+
+void WriteBlob(const void* data, std::size_t size)
+{
+	if (data == nullptr)
+	{
+		Put(GLTrace::NullBlob);
+		return;
+	}
+	Put(static_cast<std::uint64_t>(size));
+	Put(data, size);
+}
+
+GLuint GetBoundBuffer(GLenum target)
+{
+	GLint buffer = 0;
+	glGetIntegerv(GLTrace::GetBufferBinding(target), &buffer);
+	return static_cast<GLuint>(buffer);
+}
+
+#define TRACE_ARG(kind, name) Write##kind(name);
+#define TRACE_BLOB(name, size) WriteBlob(name, static_cast<std::size_t>(size));
+
+#define GL_TRACE_CALL(name, parameters, arguments, recording)					\
+	decltype(glad_gl##name) sReal##name = nullptr;								\
+	void APIENTRY Capture##name parameters										\
+	{																			\
+		std::lock_guard<std::mutex> lock(sMutex);								\
+		BeginCall(GLTrace::Opcode::name);										\
+		recording																\
+		EndCall();																\
+		sReal##name arguments;													\
+	}
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording)	\
+	decltype(glad_gl##name) sReal##name = nullptr;								\
+	type APIENTRY Capture##name parameters										\
+	{																			\
+		std::lock_guard<std::mutex> lock(sMutex);								\
+		BeginCall(GLTrace::Opcode::name);										\
+		recording																\
+		const type result = sReal##name arguments;								\
+		Write##kind(result);													\
+		EndCall();																\
+		return result;															\
+	}
+#define GL_TRACE_GEN(name, kind)												\
+	decltype(glad_gl##name) sReal##name = nullptr;								\
+	void APIENTRY Capture##name(GLsizei n, GLuint* names)						\
+	{																			\
+		std::lock_guard<std::mutex> lock(sMutex);								\
+		sReal##name(n, names);													\
+		BeginCall(GLTrace::Opcode::name);										\
+		WriteSizei(n);															\
+		for (GLsizei i = 0; i < n; ++i)											\
+		{																		\
+			Write##kind(names[i]);												\
+		}																		\
+		EndCall();																\
+	}
+#define GL_TRACE_DELETE(name, kind)												\
+	decltype(glad_gl##name) sReal##name = nullptr;								\
+	void APIENTRY Capture##name(GLsizei n, const GLuint* names)					\
+	{																			\
+		std::lock_guard<std::mutex> lock(sMutex);								\
+		BeginCall(GLTrace::Opcode::name);										\
+		WriteSizei(n);															\
+		for (GLsizei i = 0; i < n; ++i)											\
+		{																		\
+			Write##kind(names[i]);												\
+		}																		\
+		EndCall();																\
+		sReal##name(n, names);													\
+	}
+#include "GLTraceCalls.inl"
+#undef TRACE_ARG
+#undef TRACE_BLOB
+
+decltype(glad_glMapBufferRange) sRealMapBufferRange = nullptr;
+decltype(glad_glFlushMappedBufferRange) sRealFlushMappedBufferRange = nullptr;
+decltype(glad_glUnmapBuffer) sRealUnmapBuffer = nullptr;
+decltype(glad_glShaderSource) sRealShaderSource = nullptr;
+decltype(glad_glTransformFeedbackVaryings) sRealTransformFeedbackVaryings = nullptr;
+
+void* APIENTRY CaptureMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	BeginCall(GLTrace::Opcode::MapBufferRange);
+	WriteEnum(target);
+	WriteIntptr(offset);
+	WriteSizeiptr(length);
+	WriteBitfield(access);
+	EndCall();
+
+	void* pointer = sRealMapBufferRange(target, offset, length, access);
+	if (pointer != nullptr)
+	{
+		Mapping& mapping = sMappings[GetBoundBuffer(target)];
+		mapping.mPointer = static_cast<char*>(pointer);
+		mapping.mLength = length;
+		mapping.mAccess = access;
+	}
+	return pointer;
+}
+
+void APIENTRY CaptureFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	const auto found = sMappings.find(GetBoundBuffer(target));
+
+	BeginCall(GLTrace::Opcode::FlushMappedBufferRange);
+	WriteEnum(target);
+	WriteIntptr(offset);
+	WriteSizeiptr(length);
+	// Offsets are from the start of the mapped range, not of the buffer.
+	WriteBlob(found != sMappings.end() ? found->second.mPointer + offset : nullptr, static_cast<std::size_t>(length));
+	EndCall();
+
+	sRealFlushMappedBufferRange(target, offset, length);
+}
+
+GLboolean APIENTRY CaptureUnmapBuffer(GLenum target)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	const auto found = sMappings.find(GetBoundBuffer(target));
+
+	// With explicit flushes we already have everything that was written.
+	const char* written = nullptr;
+	std::size_t size = 0;
+	if (found != sMappings.end()
+		&& (found->second.mAccess & GL_MAP_WRITE_BIT)
+		&& !(found->second.mAccess & GL_MAP_FLUSH_EXPLICIT_BIT))
+	{
+		written = found->second.mPointer;
+		size = static_cast<std::size_t>(found->second.mLength);
+	}
+
+	BeginCall(GLTrace::Opcode::UnmapBuffer);
+	WriteEnum(target);
+	WriteBlob(written, size);
+	EndCall();
+
+	if (found != sMappings.end())
+	{
+		sMappings.erase(found);
+	}
+	return sRealUnmapBuffer(target);
+}
+
+void APIENTRY CaptureShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	std::string source;
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		if (length != nullptr && length[i] >= 0)
+		{
+			source.append(string[i], length[i]);
+		}
+		else
+		{
+			source.append(string[i]);
+		}
+	}
+
+	BeginCall(GLTrace::Opcode::ShaderSource);
+	WriteProgram(shader);
+	WriteString(source.c_str());
+	EndCall();
+
+	sRealShaderSource(shader, count, string, length);
+}
+
+void APIENTRY CaptureTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	BeginCall(GLTrace::Opcode::TransformFeedbackVaryings);
+	WriteProgram(program);
+	WriteSizei(count);
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		WriteString(varyings[i]);
+	}
+	WriteEnum(bufferMode);
+	EndCall();
+
+	sRealTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+template <typename Function>
+void Install(Function& glad, Function& real, Function capture)
+{
+	// Functions the driver doesn't have stay null, so calling them still crashes.
+	if (glad != nullptr)
+	{
+		real = glad;
+		glad = capture;
+	}
+}
+
+template <typename Function>
+void Uninstall(Function& glad, Function& real)
+{
+	if (real != nullptr)
+	{
+		glad = real;
+		real = nullptr;
+	}
+}
+
+}
+
+namespace GLCapture {
+
+bool Begin(const char* path, int width, int height)
+{
+	if (sFile != nullptr)
+	{
+		return false;
+	}
+	sFile = std::fopen(path, "wb");
+	if (sFile == nullptr)
+	{
+		return false;
+	}
+
+	GLTrace::Header header = {};
+	header.mMagic = GLTrace::Magic;
+	header.mVersion = GLTrace::Version;
+	header.mWidth = width;
+	header.mHeight = height;
+	std::fwrite(&header, sizeof(header), 1, sFile);
+	sBuffer.reserve(FlushSize + 64 * 1024);
+	sFrameCount = 0;
+	sByteCount = sizeof(header);
+
+	// See the header: only maps we can see the end of.
+	GLAD_GL_ARB_buffer_storage = 0;
+
+#define GL_TRACE_CALL(name, parameters, arguments, recording) Install(glad_gl##name, sReal##name, Capture##name);
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording) Install(glad_gl##name, sReal##name, Capture##name);
+#define GL_TRACE_GEN(name, kind) Install(glad_gl##name, sReal##name, Capture##name);
+#define GL_TRACE_DELETE(name, kind) Install(glad_gl##name, sReal##name, Capture##name);
+#include "GLTraceCalls.inl"
+	Install(glad_glMapBufferRange, sRealMapBufferRange, CaptureMapBufferRange);
+	Install(glad_glFlushMappedBufferRange, sRealFlushMappedBufferRange, CaptureFlushMappedBufferRange);
+	Install(glad_glUnmapBuffer, sRealUnmapBuffer, CaptureUnmapBuffer);
+	Install(glad_glShaderSource, sRealShaderSource, CaptureShaderSource);
+	Install(glad_glTransformFeedbackVaryings, sRealTransformFeedbackVaryings, CaptureTransformFeedbackVaryings);
+	return true;
+}
+
+void MarkFrame()
+{
+	if (sFile == nullptr)
+	{
+		return;
+	}
+	std::lock_guard<std::mutex> lock(sMutex);
+	BeginCall(GLTrace::Opcode::EndFrame);
+	EndCall();
+	++sFrameCount;
+}
+
+void End()
+{
+	if (sFile == nullptr)
+	{
+		return;
+	}
+
+#define GL_TRACE_CALL(name, parameters, arguments, recording) Uninstall(glad_gl##name, sReal##name);
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording) Uninstall(glad_gl##name, sReal##name);
+#define GL_TRACE_GEN(name, kind) Uninstall(glad_gl##name, sReal##name);
+#define GL_TRACE_DELETE(name, kind) Uninstall(glad_gl##name, sReal##name);
+#include "GLTraceCalls.inl"
+	Uninstall(glad_glMapBufferRange, sRealMapBufferRange);
+	Uninstall(glad_glFlushMappedBufferRange, sRealFlushMappedBufferRange);
+	Uninstall(glad_glUnmapBuffer, sRealUnmapBuffer);
+	Uninstall(glad_glShaderSource, sRealShaderSource);
+	Uninstall(glad_glTransformFeedbackVaryings, sRealTransformFeedbackVaryings);
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	Flush();
+	std::fclose(sFile);
+	sFile = nullptr;
+	sMappings.clear();
+	printf("GL capture: %d frames, %.2f MiB\n", static_cast<int>(sFrameCount), sByteCount / (1024.0 * 1024.0));
+}
+
+bool IsRecording()
+{
+	return sFile != nullptr;
+}
+
+}
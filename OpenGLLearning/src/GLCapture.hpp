@@ -0,0 +1,34 @@
+#pragma once
+
+/// <summary>
+/// Records every GL call the app makes into a trace file, with the data it
+/// uploads, so GLReplay can play the exact same workload back later.
+///
+/// Recording works by swapping glad's function pointers (glad_glDrawElements
+/// and so on) for wrappers that write the call and then forward it, so the
+/// rest of the code doesn't know it's being recorded. GLTraceCalls.inl lists
+/// the functions that are wrapped.
+///
+/// Writes into persistently mapped buffers happen without any GL call we
+/// could see, so while recording GL_ARB_buffer_storage is reported as
+/// missing and StreamingBuffer maps every frame instead.
+/// </summary>
+namespace GLCapture {
+	/// <summary>
+	/// Starts recording to 'path'. Call right after gladLoadGLLoader, before
+	/// any GL object is created, or the replay won't know about it.
+	/// </summary>
+	bool Begin(const char* path, int width, int height);
+
+	/// <summary>
+	/// Call after every SDL_GL_SwapWindow.
+	/// </summary>
+	void MarkFrame();
+
+	/// <summary>
+	/// Stops recording, closes the file and puts glad's pointers back.
+	/// </summary>
+	void End();
+
+	bool IsRecording();
+}
@@ -0,0 +1,483 @@
+#include "GLReplay.hpp"
+
+#include <SDL2/SDL.h>
+#include <glad/glad.h>
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GLTrace.hpp"
+
+namespace {
+
+/// <summary>
+/// A blob's bytes, as whatever pointer the call takes (const void*,
+/// const GLenum*, ...).
+/// </summary>
+struct BlobPointer {
+	const void*		mData;
+
+	template <typename T>
+	operator const T*() const { return static_cast<const T*>(mData); }
+};
+
+/// <summary>
+/// Reads calls out of a trace and makes them, translating every object name,
+/// sync object and uniform location from what the capturing driver handed
+/// out to what this one did.
+/// </summary>
+class Replayer {
+public:
+	bool Load(const char* path);
+	const GLTrace::Header& GetHeader() const { return mHeader; }
+
+	/// <summary>
+	/// Makes calls until the end of the next frame, returns false once the
+	/// trace has nothing more.
+	/// </summary>
+	bool ReplayFrame();
+
+private:
+	template <typename T>
+	T Read()
+	{
+		T value;
+		std::memcpy(&value, &mData[mPosition], sizeof(T));
+		mPosition += sizeof(T);
+		return value;
+	}
+
+	GLenum			ReadEnum()			{ return Read<GLenum>(); }
+	GLbitfield		ReadBitfield()		{ return Read<GLbitfield>(); }
+	GLboolean		ReadBoolean()		{ return Read<GLboolean>(); }
+	GLint			ReadInt()			{ return Read<GLint>(); }
+	GLuint			ReadUInt()			{ return Read<GLuint>(); }
+	GLsizei			ReadSizei()			{ return Read<GLsizei>(); }
+	GLfloat			ReadFloat()			{ return Read<GLfloat>(); }
+	GLintptr		ReadIntptr()		{ return static_cast<GLintptr>(Read<std::int64_t>()); }
+	GLsizeiptr		ReadSizeiptr()		{ return static_cast<GLsizeiptr>(Read<std::int64_t>()); }
+	const void*		ReadOffset()		{ return reinterpret_cast<const void*>(static_cast<std::uintptr_t>(Read<std::uint64_t>())); }
+	GLuint			ReadBuffer()		{ return Translate(mBuffers, Read<GLuint>()); }
+	GLuint			ReadTexture()		{ return Translate(mTextures, Read<GLuint>()); }
+	GLuint			ReadFramebuffer()	{ return Translate(mFramebuffers, Read<GLuint>()); }
+	GLuint			ReadVertexArray()	{ return Translate(mVertexArrays, Read<GLuint>()); }
+	GLuint			ReadQuery()			{ return Translate(mQueries, Read<GLuint>()); }
+	GLuint			ReadProgram()		{ return mCallProgram = Translate(mPrograms, Read<GLuint>()); }
+	GLsync			ReadSync();
+	GLint			ReadLocation();
+	GLuint			ReadBlockIndex();
+	const GLchar*	ReadString();
+	const void*		ReadBlob();
+
+	// The replayed value for one the capture returned, which comes next in the trace.
+	void RememberBuffer(GLuint name)		{ mBuffers[Read<GLuint>()] = name; }
+	void RememberTexture(GLuint name)		{ mTextures[Read<GLuint>()] = name; }
+	void RememberFramebuffer(GLuint name)	{ mFramebuffers[Read<GLuint>()] = name; }
+	void RememberVertexArray(GLuint name)	{ mVertexArrays[Read<GLuint>()] = name; }
+	void RememberQuery(GLuint name)			{ mQueries[Read<GLuint>()] = name; }
+	void RememberProgram(GLuint name)		{ mPrograms[Read<GLuint>()] = name; }
+	void RememberSync(GLsync sync)			{ mSyncs[Read<std::uint64_t>()] = sync; }
+	void RememberLocation(GLint location)	{ mLocations[std::make_pair(mCallProgram, Read<GLint>())] = location; }
+	void RememberBlockIndex(GLuint index)	{ mBlockIndices[std::make_pair(mCallProgram, Read<GLuint>())] = index; }
+
+	static GLuint Translate(const std::unordered_map<GLuint, GLuint>& names, GLuint name)
+	{
+		const auto found = names.find(name);
+		return found != names.end() ? found->second : name;
+	}
+
+	GLuint GetBoundBuffer(GLenum target) const;
+	void Execute(GLTrace::Opcode opcode);
+
+	GLTrace::Header		mHeader						= {};
+	std::vector<char>	mData;
+	std::size_t			mPosition					= 0;
+	std::size_t			mLastBlobSize				= 0;
+
+	std::unordered_map<GLuint, GLuint>	mBuffers;
+	std::unordered_map<GLuint, GLuint>	mTextures;
+	std::unordered_map<GLuint, GLuint>	mFramebuffers;
+	std::unordered_map<GLuint, GLuint>	mVertexArrays;
+	std::unordered_map<GLuint, GLuint>	mQueries;
+	// Shaders too, they share names with programs.
+	std::unordered_map<GLuint, GLuint>	mPrograms;
+	std::unordered_map<std::uint64_t, GLsync>	mSyncs;
+	// Locations and block indices only mean something for one program.
+	std::map<std::pair<GLuint, GLint>, GLint>	mLocations;
+	std::map<std::pair<GLuint, GLuint>, GLuint>	mBlockIndices;
+	// Current mappings by buffer.
+	std::unordered_map<GLuint, char*>	mMappings;
+
+	// glUniform* applies to the program in use, glProgramUniform* and the
+	// lookups to the one they name.
+	GLuint				mCurrentProgram				= 0;
+	GLuint				mCallProgram				= 0;
+};
+
+bool Replayer::Load(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	const long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	bool loaded = size >= static_cast<long>(sizeof(mHeader))
+		&& fread(&mHeader, sizeof(mHeader), 1, file) == 1
+		&& mHeader.mMagic == GLTrace::Magic
+		&& mHeader.mVersion == GLTrace::Version;
+	if (loaded)
+	{
+		mData.resize(size - sizeof(mHeader));
+		loaded = fread(mData.data(), 1, mData.size(), file) == mData.size();
+	}
+	fclose(file);
+	mPosition = 0;
+	return loaded;
+}
+
+GLsync Replayer::ReadSync()
+{
+	const auto found = mSyncs.find(Read<std::uint64_t>());
+	return found != mSyncs.end() ? found->second : nullptr;
+}
+
+GLint Replayer::ReadLocation()
+{
+	const GLint location = Read<GLint>();
+	const auto found = mLocations.find(std::make_pair(mCallProgram != 0 ? mCallProgram : mCurrentProgram, location));
+	return found != mLocations.end() ? found->second : location;
+}
+
+GLuint Replayer::ReadBlockIndex()
+{
+	const GLuint index = Read<GLuint>();
+	const auto found = mBlockIndices.find(std::make_pair(mCallProgram, index));
+	return found != mBlockIndices.end() ? found->second : index;
+}
+
+const GLchar* Replayer::ReadString()
+{
+	const GLchar* string = &mData[mPosition];
+	mPosition += std::strlen(string) + 1;
+	return string;
+}
+
+const void* Replayer::ReadBlob()
+{
+	const std::uint64_t size = Read<std::uint64_t>();
+	if (size == GLTrace::NullBlob)
+	{
+		mLastBlobSize = 0;
+		return nullptr;
+	}
+	const void* data = &mData[mPosition];
+	mLastBlobSize = static_cast<std::size_t>(size);
+	mPosition += mLastBlobSize;
+	return data;
+}
+
+GLuint Replayer::GetBoundBuffer(GLenum target) const
+{
+	GLint buffer = 0;
+	glGetIntegerv(GLTrace::GetBufferBinding(target), &buffer);
+	return static_cast<GLuint>(buffer);
+}
+
+void Replayer::Execute(GLTrace::Opcode opcode)
+{
+	mCallProgram = 0;
+
+	switch (opcode)
+	{
+#define TRACE_ARG(kind, name) const auto name = Read##kind();
+#define TRACE_BLOB(name, size) const BlobPointer name = { ReadBlob() };
+#define GL_TRACE_CALL(name, parameters, arguments, recording)					\
+	case GLTrace::Opcode::name:													\
+	{																			\
+		recording																\
+		gl##name arguments;														\
+		break;																	\
+	}
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording)	\
+	case GLTrace::Opcode::name:													\
+	{																			\
+		recording																\
+		Remember##kind(gl##name arguments);										\
+		break;																	\
+	}
+#define GL_TRACE_GEN(name, kind)												\
+	case GLTrace::Opcode::name:													\
+	{																			\
+		std::vector<GLuint> names(ReadSizei());									\
+		gl##name(static_cast<GLsizei>(names.size()), names.data());				\
+		for (GLuint replayed : names)											\
+		{																		\
+			Remember##kind(replayed);											\
+		}																		\
+		break;																	\
+	}
+#define GL_TRACE_DELETE(name, kind)												\
+	case GLTrace::Opcode::name:													\
+	{																			\
+		std::vector<GLuint> names(ReadSizei());									\
+		for (GLuint& replayed : names)											\
+		{																		\
+			replayed = Read##kind();											\
+		}																		\
+		gl##name(static_cast<GLsizei>(names.size()), names.data());				\
+		break;																	\
+	}
+#include "GLTraceCalls.inl"
+#undef TRACE_ARG
+#undef TRACE_BLOB
+
+	case GLTrace::Opcode::MapBufferRange:
+	{
+		const GLenum target = ReadEnum();
+		const GLintptr offset = ReadIntptr();
+		const GLsizeiptr length = ReadSizeiptr();
+		const GLbitfield access = ReadBitfield();
+		mMappings[GetBoundBuffer(target)] = static_cast<char*>(glMapBufferRange(target, offset, length, access));
+		break;
+	}
+	case GLTrace::Opcode::FlushMappedBufferRange:
+	{
+		const GLenum target = ReadEnum();
+		const GLintptr offset = ReadIntptr();
+		const GLsizeiptr length = ReadSizeiptr();
+		const void* written = ReadBlob();
+		char* mapping = mMappings[GetBoundBuffer(target)];
+		if (mapping != nullptr && written != nullptr)
+		{
+			std::memcpy(mapping + offset, written, mLastBlobSize);
+		}
+		glFlushMappedBufferRange(target, offset, length);
+		break;
+	}
+	case GLTrace::Opcode::UnmapBuffer:
+	{
+		const GLenum target = ReadEnum();
+		const void* written = ReadBlob();
+		const GLuint buffer = GetBoundBuffer(target);
+		char* mapping = mMappings[buffer];
+		if (mapping != nullptr && written != nullptr)
+		{
+			std::memcpy(mapping, written, mLastBlobSize);
+		}
+		mMappings.erase(buffer);
+		glUnmapBuffer(target);
+		break;
+	}
+	case GLTrace::Opcode::ShaderSource:
+	{
+		const GLuint shader = ReadProgram();
+		const GLchar* source = ReadString();
+		glShaderSource(shader, 1, &source, nullptr);
+		break;
+	}
+	case GLTrace::Opcode::TransformFeedbackVaryings:
+	{
+		const GLuint program = ReadProgram();
+		const GLsizei count = ReadSizei();
+		// ReadString() points into the trace, so the names stay valid.
+		std::vector<const GLchar*> varyings(static_cast<std::size_t>(std::max(count, 0)));
+		for (const GLchar*& varying : varyings)
+		{
+			varying = ReadString();
+		}
+		const GLenum bufferMode = ReadEnum();
+		glTransformFeedbackVaryings(program, count, varyings.data(), bufferMode);
+		break;
+	}
+	default:
+		break;
+	}
+
+	if (opcode == GLTrace::Opcode::UseProgram)
+	{
+		mCurrentProgram = mCallProgram;
+	}
+}
+
+bool Replayer::ReplayFrame()
+{
+	while (mPosition + sizeof(std::uint16_t) + sizeof(std::uint32_t) <= mData.size())
+	{
+		const GLTrace::Opcode opcode = Read<GLTrace::Opcode>();
+		const std::uint32_t size = Read<std::uint32_t>();
+		const std::size_t end = mPosition + size;
+		if (end > mData.size())
+		{
+			printf("Trace is cut off.\n");
+			return false;
+		}
+
+		// Calls from a newer version of the format are skipped.
+		if (opcode < GLTrace::Opcode::Count)
+		{
+			Execute(opcode);
+		}
+		mPosition = end;
+
+		if (opcode == GLTrace::Opcode::EndFrame)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+struct Summary {
+	double	mAverage	= 0.0;
+	double	mMin		= 0.0;
+	double	mMax		= 0.0;
+	double	mPercentile	= 0.0;
+};
+
+Summary Summarize(std::vector<double> times)
+{
+	Summary summary;
+	if (times.empty())
+	{
+		return summary;
+	}
+	std::sort(times.begin(), times.end());
+	double sum = 0.0;
+	for (double time : times)
+	{
+		sum += time;
+	}
+	summary.mAverage = sum / times.size();
+	summary.mMin = times.front();
+	summary.mMax = times.back();
+	summary.mPercentile = times[std::min(times.size() - 1, times.size() * 95 / 100)];
+	return summary;
+}
+
+}
+
+namespace GLReplay {
+
+int Run(const char* tracePath, const char* csvPath)
+{
+	Replayer replayer;
+	if (!replayer.Load(tracePath))
+	{
+		printf("%s is not a GL trace we can read.\n", tracePath);
+		return 1;
+	}
+
+	if (SDL_Init(SDL_INIT_VIDEO) < 0)
+	{
+		printf("SDL2 video subsystem could not be initialized!\n");
+		return 1;
+	}
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+	SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+
+	SDL_Window* window = SDL_CreateWindow(
+		"OpenGL Replay",
+		SDL_WINDOWPOS_UNDEFINED,
+		SDL_WINDOWPOS_UNDEFINED,
+		replayer.GetHeader().mWidth,
+		replayer.GetHeader().mHeight,
+		SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+	);
+	SDL_GLContext context = window != nullptr ? SDL_GL_CreateContext(window) : nullptr;
+	if (context == nullptr || !gladLoadGLLoader(SDL_GL_GetProcAddress))
+	{
+		printf("OpenGL context couldn't be created.\n");
+		SDL_Quit();
+		return 1;
+	}
+	// As fast as it goes, vsync would only measure the display.
+	SDL_GL_SetSwapInterval(0);
+
+	printf("Replaying %s on %s\n", tracePath, glGetString(GL_RENDERER));
+
+	using Clock = std::chrono::steady_clock;
+	std::vector<double> cpuTimes;
+	std::vector<GLuint> queries;
+	const Clock::time_point start = Clock::now();
+	for (;;)
+	{
+		// A timestamp on either side of the frame.
+		GLuint frameQueries[2] = {};
+		glGenQueries(2, frameQueries);
+		glQueryCounter(frameQueries[0], GL_TIMESTAMP);
+
+		const Clock::time_point frameStart = Clock::now();
+		const bool more = replayer.ReplayFrame();
+		glQueryCounter(frameQueries[1], GL_TIMESTAMP);
+		if (!more)
+		{
+			glDeleteQueries(2, frameQueries);
+			break;
+		}
+		SDL_GL_SwapWindow(window);
+
+		cpuTimes.push_back(std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+		queries.insert(queries.end(), frameQueries, frameQueries + 2);
+	}
+	glFinish();
+	const double totalSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	std::vector<double> gpuTimes(cpuTimes.size());
+	for (std::size_t i = 0; i < gpuTimes.size(); ++i)
+	{
+		GLuint64 begin = 0;
+		GLuint64 end = 0;
+		glGetQueryObjectui64v(queries[2 * i], GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(queries[2 * i + 1], GL_QUERY_RESULT, &end);
+		gpuTimes[i] = end > begin ? (end - begin) / 1000000.0 : 0.0;
+	}
+	if (!queries.empty())
+	{
+		glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+	}
+
+	if (csvPath != nullptr)
+	{
+		FILE* csv = fopen(csvPath, "w");
+		if (csv == nullptr)
+		{
+			printf("Could not write %s\n", csvPath);
+		}
+		else
+		{
+			fprintf(csv, "frame,cpu_ms,gpu_ms\n");
+			for (std::size_t i = 0; i < cpuTimes.size(); ++i)
+			{
+				fprintf(csv, "%d,%.4f,%.4f\n", static_cast<int>(i), cpuTimes[i], gpuTimes[i]);
+			}
+			fclose(csv);
+		}
+	}
+
+	const Summary cpu = Summarize(cpuTimes);
+	const Summary gpu = Summarize(gpuTimes);
+	printf("%d frames in %.3f s, %.1f fps\n", static_cast<int>(cpuTimes.size()), totalSeconds,
+		totalSeconds > 0.0 ? cpuTimes.size() / totalSeconds : 0.0);
+	printf("  CPU: %.3f ms average, %.3f min, %.3f max, %.3f 95th percentile\n", cpu.mAverage, cpu.mMin, cpu.mMax, cpu.mPercentile);
+	printf("  GPU: %.3f ms average, %.3f min, %.3f max, %.3f 95th percentile\n", gpu.mAverage, gpu.mMin, gpu.mMax, gpu.mPercentile);
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+	return 0;
+}
+
+}
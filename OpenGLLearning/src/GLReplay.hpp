@@ -0,0 +1,17 @@
+#pragma once
+
+/// <summary>
+/// Plays back a trace written by GLCapture, as fast as the driver goes, in a
+/// hidden window, and reports how long every frame took on the CPU (issuing
+/// the calls) and on the GPU (a GL_TIME_ELAPSED query around each frame).
+///
+/// Nothing but the trace drives it, so two replays of the same trace are the
+/// same workload: run one per build or driver to compare them.
+/// </summary>
+namespace GLReplay {
+	/// <summary>
+	/// Returns the exit code for main(). Per-frame timings go to 'csvPath'
+	/// when it isn't null, a summary is always printed.
+	/// </summary>
+	int Run(const char* tracePath, const char* csvPath);
+}
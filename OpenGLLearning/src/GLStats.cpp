@@ -0,0 +1,413 @@
+#include "GLStats.hpp"
+
+#include <glad/glad.h>
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "GLTrace.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using GLTrace::Opcode;
+
+constexpr std::size_t FunctionCount = static_cast<std::size_t>(Opcode::Count);
+
+struct Function {
+	const char*		mName			= nullptr;
+	std::uint64_t	mCalls			= 0;
+	double			mMilliseconds	= 0.0;
+};
+
+struct Mapping {
+	GLsizeiptr		mLength			= 0;
+	GLbitfield		mAccess			= 0;
+};
+
+bool				sInstalled		= false;
+bool				sTiming			= false;
+FILE*				sCsv			= nullptr;
+std::uint64_t		sFrameIndex		= 0;
+GLStats::FrameStats	sFrame;
+GLStats::FrameStats	sLastFrame;
+Function			sFunctions[FunctionCount];
+// Ranges mapped for writing, by target, to count what gets unmapped.
+std::vector<std::pair<GLenum, Mapping>>	sMappings;
+
+void Count(Opcode opcode)
+{
+	++sFrame.mCalls;
+	++sFunctions[static_cast<std::size_t>(opcode)].mCalls;
+
+	switch (opcode)
+	{
+	case Opcode::DrawArrays:
+	case Opcode::DrawArraysInstanced:
+	case Opcode::DrawElements:
+	case Opcode::DrawElementsBaseVertex:
+	case Opcode::MultiDrawElementsIndirect:
+	case Opcode::MultiDrawElementsIndirectCountARB:
+		++sFrame.mDrawCalls;
+		break;
+	case Opcode::DispatchCompute:
+		++sFrame.mDispatches;
+		break;
+	case Opcode::UseProgram:
+		++sFrame.mProgramBinds;
+		break;
+	case Opcode::BindBuffer:
+	case Opcode::BindBufferBase:
+	case Opcode::BindBufferRange:
+		++sFrame.mBufferBinds;
+		break;
+	case Opcode::BindTexture:
+	case Opcode::BindImageTexture:
+		++sFrame.mTextureBinds;
+		break;
+	case Opcode::BindVertexArray:
+		++sFrame.mVertexArrayBinds;
+		break;
+	case Opcode::Uniform1f:
+	case Opcode::Uniform1i:
+	case Opcode::Uniform1ui:
+	case Opcode::ProgramUniform1i:
+		++sFrame.mUniformUpdates;
+		break;
+	default:
+		break;
+	}
+}
+
+/// <summary>
+/// Counts a call and times it, if timing is on.
+/// </summary>
+class CallScope {
+public:
+	explicit CallScope(Opcode opcode)
+		: mOpcode(opcode)
+	{
+		Count(opcode);
+		if (sTiming)
+		{
+			mStart = Clock::now();
+		}
+	}
+
+	~CallScope()
+	{
+		if (sTiming)
+		{
+			const double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - mStart).count();
+			sFrame.mDriverMilliseconds += milliseconds;
+			sFunctions[static_cast<std::size_t>(mOpcode)].mMilliseconds += milliseconds;
+		}
+	}
+
+private:
+	Opcode				mOpcode;
+	Clock::time_point	mStart;
+};
+
+void AddUpload(const void* data, std::size_t size)
+{
+	if (data != nullptr)
+	{
+		sFrame.mBytesUploaded += size;
+	}
+}
+
+// Only payloads count: a blob in the table is data we hand to GL.
+#define TRACE_ARG(kind, name)
+#define TRACE_BLOB(name, size) AddUpload(name, static_cast<std::size_t>(size));
+
+#define GL_TRACE_CALL(name, parameters, arguments, recording)					\
+	decltype(glad_gl##name) sNext##name = nullptr;								\
+	void APIENTRY Count##name parameters										\
+	{																			\
+		recording																\
+		CallScope scope(Opcode::name);											\
+		sNext##name arguments;													\
+	}
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording)	\
+	decltype(glad_gl##name) sNext##name = nullptr;								\
+	type APIENTRY Count##name parameters										\
+	{																			\
+		recording																\
+		CallScope scope(Opcode::name);											\
+		return sNext##name arguments;											\
+	}
+#define GL_TRACE_GEN(name, kind)												\
+	decltype(glad_gl##name) sNext##name = nullptr;								\
+	void APIENTRY Count##name(GLsizei n, GLuint* names)							\
+	{																			\
+		CallScope scope(Opcode::name);											\
+		sNext##name(n, names);													\
+	}
+#define GL_TRACE_DELETE(name, kind)												\
+	decltype(glad_gl##name) sNext##name = nullptr;								\
+	void APIENTRY Count##name(GLsizei n, const GLuint* names)					\
+	{																			\
+		CallScope scope(Opcode::name);											\
+		sNext##name(n, names);													\
+	}
+#include "GLTraceCalls.inl"
+#undef TRACE_ARG
+#undef TRACE_BLOB
+
+decltype(glad_glMapBufferRange) sNextMapBufferRange = nullptr;
+decltype(glad_glFlushMappedBufferRange) sNextFlushMappedBufferRange = nullptr;
+decltype(glad_glUnmapBuffer) sNextUnmapBuffer = nullptr;
+decltype(glad_glShaderSource) sNextShaderSource = nullptr;
+decltype(glad_glTransformFeedbackVaryings) sNextTransformFeedbackVaryings = nullptr;
+
+Mapping* FindMapping(GLenum target)
+{
+	for (auto& mapping : sMappings)
+	{
+		if (mapping.first == target)
+		{
+			return &mapping.second;
+		}
+	}
+	return nullptr;
+}
+
+void* APIENTRY CountMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	CallScope scope(Opcode::MapBufferRange);
+	Mapping* mapping = FindMapping(target);
+	if (mapping == nullptr)
+	{
+		sMappings.emplace_back(target, Mapping());
+		mapping = &sMappings.back().second;
+	}
+	mapping->mLength = length;
+	mapping->mAccess = access;
+	return sNextMapBufferRange(target, offset, length, access);
+}
+
+void APIENTRY CountFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	CallScope scope(Opcode::FlushMappedBufferRange);
+	sFrame.mBytesUploaded += length;
+	sNextFlushMappedBufferRange(target, offset, length);
+}
+
+GLboolean APIENTRY CountUnmapBuffer(GLenum target)
+{
+	CallScope scope(Opcode::UnmapBuffer);
+	// With explicit flushes the flushes counted it already.
+	Mapping* mapping = FindMapping(target);
+	if (mapping != nullptr && (mapping->mAccess & GL_MAP_WRITE_BIT) && !(mapping->mAccess & GL_MAP_FLUSH_EXPLICIT_BIT))
+	{
+		sFrame.mBytesUploaded += mapping->mLength;
+	}
+	if (mapping != nullptr)
+	{
+		mapping->mAccess = 0;
+	}
+	return sNextUnmapBuffer(target);
+}
+
+void APIENTRY CountShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+	CallScope scope(Opcode::ShaderSource);
+	sNextShaderSource(shader, count, string, length);
+}
+
+void APIENTRY CountTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode)
+{
+	CallScope scope(Opcode::TransformFeedbackVaryings);
+	sNextTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+template <typename Function>
+void Install(Function& glad, Function& next, Function counting)
+{
+	if (glad != nullptr)
+	{
+		next = glad;
+		glad = counting;
+	}
+}
+
+template <typename Function>
+void Uninstall(Function& glad, Function& next)
+{
+	if (next != nullptr)
+	{
+		glad = next;
+		next = nullptr;
+	}
+}
+
+}
+
+namespace GLStats {
+
+void Install(bool timing)
+{
+	if (sInstalled)
+	{
+		return;
+	}
+	sInstalled = true;
+	sTiming = timing;
+	sFrame = FrameStats();
+	sLastFrame = FrameStats();
+	sFrameIndex = 0;
+
+	sFunctions[static_cast<std::size_t>(Opcode::MapBufferRange)].mName = "glMapBufferRange";
+	sFunctions[static_cast<std::size_t>(Opcode::FlushMappedBufferRange)].mName = "glFlushMappedBufferRange";
+	sFunctions[static_cast<std::size_t>(Opcode::UnmapBuffer)].mName = "glUnmapBuffer";
+	sFunctions[static_cast<std::size_t>(Opcode::ShaderSource)].mName = "glShaderSource";
+	sFunctions[static_cast<std::size_t>(Opcode::TransformFeedbackVaryings)].mName = "glTransformFeedbackVaryings";
+	::Install(glad_glMapBufferRange, sNextMapBufferRange, CountMapBufferRange);
+	::Install(glad_glFlushMappedBufferRange, sNextFlushMappedBufferRange, CountFlushMappedBufferRange);
+	::Install(glad_glUnmapBuffer, sNextUnmapBuffer, CountUnmapBuffer);
+	::Install(glad_glShaderSource, sNextShaderSource, CountShaderSource);
+	::Install(glad_glTransformFeedbackVaryings, sNextTransformFeedbackVaryings, CountTransformFeedbackVaryings);
+
+#define GL_TRACE_INSTALL(name)													\
+	sFunctions[static_cast<std::size_t>(Opcode::name)].mName = "gl" #name;		\
+	::Install(glad_gl##name, sNext##name, Count##name);
+#define GL_TRACE_CALL(name, parameters, arguments, recording) GL_TRACE_INSTALL(name)
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording) GL_TRACE_INSTALL(name)
+#define GL_TRACE_GEN(name, kind) GL_TRACE_INSTALL(name)
+#define GL_TRACE_DELETE(name, kind) GL_TRACE_INSTALL(name)
+#include "GLTraceCalls.inl"
+#undef GL_TRACE_INSTALL
+}
+
+void Uninstall()
+{
+	if (!sInstalled)
+	{
+		return;
+	}
+	sInstalled = false;
+
+	::Uninstall(glad_glMapBufferRange, sNextMapBufferRange);
+	::Uninstall(glad_glFlushMappedBufferRange, sNextFlushMappedBufferRange);
+	::Uninstall(glad_glUnmapBuffer, sNextUnmapBuffer);
+	::Uninstall(glad_glShaderSource, sNextShaderSource);
+	::Uninstall(glad_glTransformFeedbackVaryings, sNextTransformFeedbackVaryings);
+
+#define GL_TRACE_CALL(name, parameters, arguments, recording) ::Uninstall(glad_gl##name, sNext##name);
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording) ::Uninstall(glad_gl##name, sNext##name);
+#define GL_TRACE_GEN(name, kind) ::Uninstall(glad_gl##name, sNext##name);
+#define GL_TRACE_DELETE(name, kind) ::Uninstall(glad_gl##name, sNext##name);
+#include "GLTraceCalls.inl"
+
+	if (sCsv != nullptr)
+	{
+		fclose(sCsv);
+		sCsv = nullptr;
+	}
+}
+
+bool IsInstalled()
+{
+	return sInstalled;
+}
+
+bool OpenCsv(const char* path)
+{
+	if (sCsv != nullptr)
+	{
+		fclose(sCsv);
+	}
+	sCsv = fopen(path, "w");
+	if (sCsv == nullptr)
+	{
+		return false;
+	}
+	fprintf(sCsv, "frame,calls,draws,dispatches,program_binds,buffer_binds,texture_binds,vertex_array_binds,uniform_updates,bytes_uploaded,driver_ms\n");
+	return true;
+}
+
+void CountUpload(std::uint64_t bytes)
+{
+	if (sInstalled)
+	{
+		sFrame.mBytesUploaded += bytes;
+	}
+}
+
+void EndFrame()
+{
+	if (!sInstalled)
+	{
+		return;
+	}
+	sLastFrame = sFrame;
+	sFrame = FrameStats();
+
+	if (sCsv != nullptr)
+	{
+		const FrameStats& s = sLastFrame;
+		fprintf(sCsv, "%llu,%u,%u,%u,%u,%u,%u,%u,%u,%llu,%.4f\n",
+			static_cast<unsigned long long>(sFrameIndex),
+			s.mCalls, s.mDrawCalls, s.mDispatches, s.mProgramBinds, s.mBufferBinds,
+			s.mTextureBinds, s.mVertexArrayBinds, s.mUniformUpdates,
+			static_cast<unsigned long long>(s.mBytesUploaded), s.mDriverMilliseconds);
+	}
+	++sFrameIndex;
+}
+
+const FrameStats& GetLastFrame()
+{
+	return sLastFrame;
+}
+
+std::string Describe(const FrameStats& stats)
+{
+	char text[256];
+	snprintf(text, sizeof(text), "%u GL calls, %u draws, %u dispatches, %u programs, %u uniforms, %.1f KiB up",
+		stats.mCalls, stats.mDrawCalls, stats.mDispatches, stats.mProgramBinds, stats.mUniformUpdates,
+		stats.mBytesUploaded / 1024.0);
+	std::string description = text;
+	if (sTiming)
+	{
+		snprintf(text, sizeof(text), ", %.3f ms in GL", stats.mDriverMilliseconds);
+		description += text;
+	}
+	return description;
+}
+
+void PrintReport()
+{
+	std::vector<const Function*> functions;
+	for (const Function& function : sFunctions)
+	{
+		if (function.mCalls > 0)
+		{
+			functions.push_back(&function);
+		}
+	}
+	std::sort(functions.begin(), functions.end(), [](const Function* a, const Function* b) {
+		return sTiming ? a->mMilliseconds > b->mMilliseconds : a->mCalls > b->mCalls;
+	});
+
+	printf("GL calls over %llu frames:\n", static_cast<unsigned long long>(sFrameIndex));
+	for (const Function* function : functions)
+	{
+		const double perFrame = sFrameIndex > 0 ? static_cast<double>(function->mCalls) / sFrameIndex : 0.0;
+		if (sTiming)
+		{
+			printf("  %-36s %10llu calls, %8.2f per frame, %9.3f ms, %7.3f us per call\n", function->mName,
+				static_cast<unsigned long long>(function->mCalls), perFrame, function->mMilliseconds,
+				function->mMilliseconds * 1000.0 / function->mCalls);
+		}
+		else
+		{
+			printf("  %-36s %10llu calls, %8.2f per frame\n", function->mName,
+				static_cast<unsigned long long>(function->mCalls), perFrame);
+		}
+	}
+}
+
+}
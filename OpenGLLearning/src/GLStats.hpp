@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// Counts what every frame asks of the driver: GL calls, draws, state
+/// changes, bytes uploaded, and optionally the time spent inside GL.
+///
+/// Like GLCapture it swaps glad's function pointers for wrappers, for the
+/// functions GLTraceCalls.inl lists, so it costs nothing unless installed.
+/// Both can be installed at once, as long as they're uninstalled in the
+/// opposite order.
+///
+/// Bytes written through a persistent mapping make no GL call, so whoever
+/// writes them reports them with CountUpload().
+/// </summary>
+namespace GLStats {
+	struct FrameStats {
+		// Every wrapped call.
+		std::uint32_t	mCalls					= 0;
+		// glDraw* and glMultiDraw*; a multi-draw counts once.
+		std::uint32_t	mDrawCalls				= 0;
+		std::uint32_t	mDispatches				= 0;
+		std::uint32_t	mProgramBinds			= 0;
+		std::uint32_t	mBufferBinds			= 0;
+		std::uint32_t	mTextureBinds			= 0;
+		std::uint32_t	mVertexArrayBinds		= 0;
+		std::uint32_t	mUniformUpdates			= 0;
+		// Buffer and texture data handed to GL, including flushed and
+		// unmapped ranges.
+		std::uint64_t	mBytesUploaded			= 0;
+		// Time inside the wrapped calls, when timing is on.
+		double			mDriverMilliseconds		= 0.0;
+	};
+
+	/// <summary>
+	/// Starts counting. Timing every call takes two clock reads per call,
+	/// which is more than some calls cost, so it's optional.
+	/// </summary>
+	void Install(bool timing);
+	void Uninstall();
+	bool IsInstalled();
+
+	/// <summary>
+	/// Writes a line per frame to 'path' from now on.
+	/// </summary>
+	bool OpenCsv(const char* path);
+
+	/// <summary>
+	/// For data that reaches the GPU without a GL call, through a persistent
+	/// mapping. Does nothing unless installed.
+	/// </summary>
+	void CountUpload(std::uint64_t bytes);
+
+	/// <summary>
+	/// Call after every SDL_GL_SwapWindow; what came before counts for the frame.
+	/// </summary>
+	void EndFrame();
+
+	/// <summary>
+	/// The last frame that ended.
+	/// </summary>
+	const FrameStats& GetLastFrame();
+
+	/// <summary>
+	/// One line, short enough for a window title.
+	/// </summary>
+	std::string Describe(const FrameStats& stats);
+
+	/// <summary>
+	/// Calls and time per GL function since Install(), the busiest first.
+	/// </summary>
+	void PrintReport();
+}
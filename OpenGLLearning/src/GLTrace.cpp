@@ -0,0 +1,71 @@
+#include "GLTrace.hpp"
+
+namespace GLTrace {
+
+std::size_t PixelSize(GLenum format, GLenum type)
+{
+	std::size_t components = 4;
+	switch (format)
+	{
+	case GL_RED:
+	case GL_RED_INTEGER:
+	case GL_DEPTH_COMPONENT:
+		components = 1;
+		break;
+	case GL_RG:
+	case GL_RG_INTEGER:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+		components = 3;
+		break;
+	}
+
+	switch (type)
+	{
+	case GL_UNSIGNED_BYTE:
+	case GL_BYTE:
+		return components;
+	case GL_UNSIGNED_SHORT:
+	case GL_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+		// Packed, all components in one.
+		return 4;
+	default:
+		return components * 4;
+	}
+}
+
+std::size_t TexImageSize(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+	const std::size_t row = (static_cast<std::size_t>(width) * PixelSize(format, type) + 3) / 4 * 4;
+	return row * static_cast<std::size_t>(height);
+}
+
+GLenum GetBufferBinding(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER:				return GL_ARRAY_BUFFER_BINDING;
+	case GL_ELEMENT_ARRAY_BUFFER:		return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+	// These three are their own binding query.
+	case GL_COPY_READ_BUFFER:			return GL_COPY_READ_BUFFER;
+	case GL_COPY_WRITE_BUFFER:			return GL_COPY_WRITE_BUFFER;
+	case GL_UNIFORM_BUFFER:				return GL_UNIFORM_BUFFER_BINDING;
+	case GL_SHADER_STORAGE_BUFFER:		return GL_SHADER_STORAGE_BUFFER_BINDING;
+	case GL_DRAW_INDIRECT_BUFFER:		return GL_DRAW_INDIRECT_BUFFER_BINDING;
+	case GL_PIXEL_PACK_BUFFER:			return GL_PIXEL_PACK_BUFFER_BINDING;
+	case GL_PIXEL_UNPACK_BUFFER:		return GL_PIXEL_UNPACK_BUFFER_BINDING;
+	case GL_TEXTURE_BUFFER:				return GL_TEXTURE_BUFFER;
+	case GL_TRANSFORM_FEEDBACK_BUFFER:	return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+	default:							return GL_NONE;
+	}
+}
+
+}
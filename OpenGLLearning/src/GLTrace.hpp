@@ -0,0 +1,71 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// The file format shared by GLCapture, which writes traces, and GLReplay,
+/// which plays them back.
+///
+/// A trace is a Header followed by calls. Every call is its Opcode (uint16)
+/// and the size of its arguments in bytes (uint32), then the arguments in
+/// the order GLTraceCalls.inl lists them:
+///	- plain values at their own size, GLintptr and GLsizeiptr as int64;
+///	- object names and uniform locations as the capturing driver returned
+///	  them, returned values after the arguments;
+///	- buffer offsets passed as pointers, and sync objects, as uint64;
+///	- strings with their terminating zero;
+///	- blobs as a uint64 size (NullBlob for a null pointer), then the bytes.
+/// </summary>
+namespace GLTrace {
+	constexpr std::uint32_t Magic = 0x52544c47;		// "GLTR"
+	constexpr std::uint32_t Version = 1;
+	constexpr std::uint64_t NullBlob = ~0ull;
+
+	struct Header {
+		std::uint32_t	mMagic;
+		std::uint32_t	mVersion;
+		std::int32_t	mWidth;
+		std::int32_t	mHeight;
+	};
+
+	enum class Opcode : std::uint16_t {
+		// Marks a SDL_GL_SwapWindow, no arguments.
+		EndFrame,
+		// Target, offset, length, access.
+		MapBufferRange,
+		// Target, offset, length, and the bytes written there.
+		FlushMappedBufferRange,
+		// Target, and a blob of the whole mapped range unless it was mapped
+		// for explicit flushes or for reading only.
+		UnmapBuffer,
+		// Shader, and all its strings joined into one.
+		ShaderSource,
+		// Program, the varying count, each varying's name, and the buffer mode.
+		TransformFeedbackVaryings,
+#define GL_TRACE_CALL(name, parameters, arguments, recording) name,
+#define GL_TRACE_CALL_RETURN(name, type, kind, parameters, arguments, recording) name,
+#define GL_TRACE_GEN(name, kind) name,
+#define GL_TRACE_DELETE(name, kind) name,
+#include "GLTraceCalls.inl"
+		Count
+	};
+
+	/// <summary>
+	/// Bytes in one pixel of the given format and type, as a clear value.
+	/// </summary>
+	std::size_t PixelSize(GLenum format, GLenum type);
+
+	/// <summary>
+	/// Bytes glTexImage2D reads, with the default unpack state (rows
+	/// aligned to 4 bytes, nothing skipped).
+	/// </summary>
+	std::size_t TexImageSize(GLsizei width, GLsizei height, GLenum format, GLenum type);
+
+	/// <summary>
+	/// The glGetIntegerv query for the buffer bound to a target, since
+	/// glMapBufferRange and friends only name the target.
+	/// </summary>
+	GLenum GetBufferBinding(GLenum target);
+}
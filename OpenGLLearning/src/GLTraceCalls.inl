@@ -0,0 +1,184 @@
+// Every GL function GLCapture records, GLReplay plays back and GLStats
+// counts, besides the few that need special handling (see GLTrace::Opcode).
+// Include this with the macros below defined; it undefines them again at
+// the end.
+//
+//	GL_TRACE_CALL(name, (parameters), (arguments), recording)
+//	GL_TRACE_CALL_RETURN(name, return type, return kind, (parameters), (arguments), recording)
+//	GL_TRACE_GEN(name, kind)		glGen*(GLsizei n, GLuint* names)
+//	GL_TRACE_DELETE(name, kind)		glDelete*(GLsizei n, const GLuint* names)
+//
+// 'recording' lists every parameter in order, as TRACE_ARG(kind, parameter)
+// or TRACE_BLOB(parameter, size in bytes). Object names, sync objects and
+// uniform locations have their own kinds, so the replay can translate them
+// to whatever the driver hands out there.
+//
+// Functions that only read state (glGet*, glClientWaitSync) aren't here:
+// they change nothing a replay needs, and the pointers stay untouched.
+
+GL_TRACE_CALL(ActiveTexture, (GLenum texture), (texture),
+	TRACE_ARG(Enum, texture))
+GL_TRACE_CALL(AttachShader, (GLuint program, GLuint shader), (program, shader),
+	TRACE_ARG(Program, program) TRACE_ARG(Program, shader))
+GL_TRACE_CALL(BeginQuery, (GLenum target, GLuint id), (target, id),
+	TRACE_ARG(Enum, target) TRACE_ARG(Query, id))
+GL_TRACE_CALL(BeginTransformFeedback, (GLenum primitiveMode), (primitiveMode),
+	TRACE_ARG(Enum, primitiveMode))
+GL_TRACE_CALL(BindBuffer, (GLenum target, GLuint buffer), (target, buffer),
+	TRACE_ARG(Enum, target) TRACE_ARG(Buffer, buffer))
+GL_TRACE_CALL(BindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer),
+	TRACE_ARG(Enum, target) TRACE_ARG(UInt, index) TRACE_ARG(Buffer, buffer))
+GL_TRACE_CALL(BindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size),
+	TRACE_ARG(Enum, target) TRACE_ARG(UInt, index) TRACE_ARG(Buffer, buffer) TRACE_ARG(Intptr, offset) TRACE_ARG(Sizeiptr, size))
+GL_TRACE_CALL(BindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer),
+	TRACE_ARG(Enum, target) TRACE_ARG(Framebuffer, framebuffer))
+GL_TRACE_CALL(BindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format),
+	TRACE_ARG(UInt, unit) TRACE_ARG(Texture, texture) TRACE_ARG(Int, level) TRACE_ARG(Boolean, layered) TRACE_ARG(Int, layer) TRACE_ARG(Enum, access) TRACE_ARG(Enum, format))
+GL_TRACE_CALL(BindTexture, (GLenum target, GLuint texture), (target, texture),
+	TRACE_ARG(Enum, target) TRACE_ARG(Texture, texture))
+GL_TRACE_CALL(BindVertexArray, (GLuint array), (array),
+	TRACE_ARG(VertexArray, array))
+GL_TRACE_CALL(BlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor),
+	TRACE_ARG(Enum, sfactor) TRACE_ARG(Enum, dfactor))
+GL_TRACE_CALL(BufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage),
+	TRACE_ARG(Enum, target) TRACE_ARG(Sizeiptr, size) TRACE_BLOB(data, size) TRACE_ARG(Enum, usage))
+GL_TRACE_CALL(BufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data),
+	TRACE_ARG(Enum, target) TRACE_ARG(Intptr, offset) TRACE_ARG(Sizeiptr, size) TRACE_BLOB(data, size))
+GL_TRACE_CALL(Clear, (GLbitfield mask), (mask),
+	TRACE_ARG(Bitfield, mask))
+GL_TRACE_CALL(ClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data), (target, internalformat, offset, size, format, type, data),
+	TRACE_ARG(Enum, target) TRACE_ARG(Enum, internalformat) TRACE_ARG(Intptr, offset) TRACE_ARG(Sizeiptr, size) TRACE_ARG(Enum, format) TRACE_ARG(Enum, type) TRACE_BLOB(data, GLTrace::PixelSize(format, type)))
+GL_TRACE_CALL(ClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat* value), (buffer, drawbuffer, value),
+	TRACE_ARG(Enum, buffer) TRACE_ARG(Int, drawbuffer) TRACE_BLOB(value, (buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat)))
+GL_TRACE_CALL(ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha),
+	TRACE_ARG(Float, red) TRACE_ARG(Float, green) TRACE_ARG(Float, blue) TRACE_ARG(Float, alpha))
+GL_TRACE_CALL(CompileShader, (GLuint shader), (shader),
+	TRACE_ARG(Program, shader))
+GL_TRACE_CALL(CompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, border, imageSize, data),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Enum, internalformat) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Int, border) TRACE_ARG(Sizei, imageSize)
+	TRACE_BLOB(data, imageSize))
+GL_TRACE_CALL(CompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, width, height, format, imageSize, data),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Int, xoffset) TRACE_ARG(Int, yoffset) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Enum, format) TRACE_ARG(Sizei, imageSize)
+	TRACE_BLOB(data, imageSize))
+GL_TRACE_CALL(CopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size),
+	TRACE_ARG(Enum, readTarget) TRACE_ARG(Enum, writeTarget) TRACE_ARG(Intptr, readOffset) TRACE_ARG(Intptr, writeOffset) TRACE_ARG(Sizeiptr, size))
+GL_TRACE_CALL_RETURN(CreateProgram, GLuint, Program, (), (),
+	)
+GL_TRACE_CALL_RETURN(CreateShader, GLuint, Program, (GLenum type), (type),
+	TRACE_ARG(Enum, type))
+GL_TRACE_CALL(DeleteProgram, (GLuint program), (program),
+	TRACE_ARG(Program, program))
+GL_TRACE_CALL(DeleteShader, (GLuint shader), (shader),
+	TRACE_ARG(Program, shader))
+GL_TRACE_CALL(DeleteSync, (GLsync sync), (sync),
+	TRACE_ARG(Sync, sync))
+GL_TRACE_CALL(DepthFunc, (GLenum func), (func),
+	TRACE_ARG(Enum, func))
+GL_TRACE_CALL(DetachShader, (GLuint program, GLuint shader), (program, shader),
+	TRACE_ARG(Program, program) TRACE_ARG(Program, shader))
+GL_TRACE_CALL(Disable, (GLenum cap), (cap),
+	TRACE_ARG(Enum, cap))
+GL_TRACE_CALL(DisableVertexAttribArray, (GLuint index), (index),
+	TRACE_ARG(UInt, index))
+GL_TRACE_CALL(DispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z),
+	TRACE_ARG(UInt, num_groups_x) TRACE_ARG(UInt, num_groups_y) TRACE_ARG(UInt, num_groups_z))
+GL_TRACE_CALL(DrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Int, first) TRACE_ARG(Sizei, count))
+GL_TRACE_CALL(DrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Int, first) TRACE_ARG(Sizei, count) TRACE_ARG(Sizei, instancecount))
+GL_TRACE_CALL(DrawBuffers, (GLsizei n, const GLenum* bufs), (n, bufs),
+	TRACE_ARG(Sizei, n) TRACE_BLOB(bufs, n * sizeof(GLenum)))
+GL_TRACE_CALL(DrawElements, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Sizei, count) TRACE_ARG(Enum, type) TRACE_ARG(Offset, indices))
+GL_TRACE_CALL(DrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, count, type, indices, basevertex),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Sizei, count) TRACE_ARG(Enum, type) TRACE_ARG(Offset, indices) TRACE_ARG(Int, basevertex))
+GL_TRACE_CALL(Enable, (GLenum cap), (cap),
+	TRACE_ARG(Enum, cap))
+GL_TRACE_CALL(EnableVertexAttribArray, (GLuint index), (index),
+	TRACE_ARG(UInt, index))
+GL_TRACE_CALL(EndQuery, (GLenum target), (target),
+	TRACE_ARG(Enum, target))
+GL_TRACE_CALL(EndTransformFeedback, (), (),
+	)
+GL_TRACE_CALL_RETURN(FenceSync, GLsync, Sync, (GLenum condition, GLbitfield flags), (condition, flags),
+	TRACE_ARG(Enum, condition) TRACE_ARG(Bitfield, flags))
+GL_TRACE_CALL(Flush, (), (),
+	)
+GL_TRACE_CALL(FramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level),
+	TRACE_ARG(Enum, target) TRACE_ARG(Enum, attachment) TRACE_ARG(Enum, textarget) TRACE_ARG(Texture, texture) TRACE_ARG(Int, level))
+GL_TRACE_CALL(FramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer),
+	TRACE_ARG(Enum, target) TRACE_ARG(Enum, attachment) TRACE_ARG(Texture, texture) TRACE_ARG(Int, level) TRACE_ARG(Int, layer))
+GL_TRACE_CALL(GenerateMipmap, (GLenum target), (target),
+	TRACE_ARG(Enum, target))
+GL_TRACE_CALL_RETURN(GetUniformBlockIndex, GLuint, BlockIndex, (GLuint program, const GLchar* uniformBlockName), (program, uniformBlockName),
+	TRACE_ARG(Program, program) TRACE_ARG(String, uniformBlockName))
+GL_TRACE_CALL_RETURN(GetUniformLocation, GLint, Location, (GLuint program, const GLchar* name), (program, name),
+	TRACE_ARG(Program, program) TRACE_ARG(String, name))
+GL_TRACE_CALL(LinkProgram, (GLuint program), (program),
+	TRACE_ARG(Program, program))
+GL_TRACE_CALL(MemoryBarrier, (GLbitfield barriers), (barriers),
+	TRACE_ARG(Bitfield, barriers))
+GL_TRACE_CALL(MultiDrawElementsIndirect, (GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Enum, type) TRACE_ARG(Offset, indirect) TRACE_ARG(Sizei, drawcount) TRACE_ARG(Sizei, stride))
+GL_TRACE_CALL(MultiDrawElementsIndirectCountARB, (GLenum mode, GLenum type, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride),
+	TRACE_ARG(Enum, mode) TRACE_ARG(Enum, type) TRACE_ARG(Offset, indirect) TRACE_ARG(Intptr, drawcount) TRACE_ARG(Sizei, maxdrawcount) TRACE_ARG(Sizei, stride))
+GL_TRACE_CALL(PolygonOffset, (GLfloat factor, GLfloat units), (factor, units),
+	TRACE_ARG(Float, factor) TRACE_ARG(Float, units))
+GL_TRACE_CALL(ProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0),
+	TRACE_ARG(Program, program) TRACE_ARG(Location, location) TRACE_ARG(Int, v0))
+GL_TRACE_CALL(QueryCounter, (GLuint id, GLenum target), (id, target),
+	TRACE_ARG(Query, id) TRACE_ARG(Enum, target))
+GL_TRACE_CALL(TexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer),
+	TRACE_ARG(Enum, target) TRACE_ARG(Enum, internalformat) TRACE_ARG(Buffer, buffer))
+GL_TRACE_CALL(TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, border, format, type, pixels),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Int, internalformat) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Int, border) TRACE_ARG(Enum, format) TRACE_ARG(Enum, type)
+	TRACE_BLOB(pixels, GLTrace::TexImageSize(width, height, format, type)))
+GL_TRACE_CALL(TexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Int, internalformat) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Sizei, depth) TRACE_ARG(Int, border) TRACE_ARG(Enum, format) TRACE_ARG(Enum, type)
+	TRACE_BLOB(pixels, GLTrace::TexImageSize(width, height, format, type) * depth))
+GL_TRACE_CALL(TexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param),
+	TRACE_ARG(Enum, target) TRACE_ARG(Enum, pname) TRACE_ARG(Int, param))
+GL_TRACE_CALL(TexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height),
+	TRACE_ARG(Enum, target) TRACE_ARG(Sizei, levels) TRACE_ARG(Enum, internalformat) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height))
+GL_TRACE_CALL(TexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth),
+	TRACE_ARG(Enum, target) TRACE_ARG(Sizei, levels) TRACE_ARG(Enum, internalformat) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Sizei, depth))
+GL_TRACE_CALL(TexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Int, xoffset) TRACE_ARG(Int, yoffset) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Enum, format) TRACE_ARG(Enum, type)
+	TRACE_BLOB(pixels, GLTrace::TexImageSize(width, height, format, type)))
+GL_TRACE_CALL(TexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels),
+	TRACE_ARG(Enum, target) TRACE_ARG(Int, level) TRACE_ARG(Int, xoffset) TRACE_ARG(Int, yoffset) TRACE_ARG(Int, zoffset) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height) TRACE_ARG(Sizei, depth) TRACE_ARG(Enum, format) TRACE_ARG(Enum, type)
+	TRACE_BLOB(pixels, GLTrace::TexImageSize(width, height, format, type) * depth))
+GL_TRACE_CALL(Uniform1f, (GLint location, GLfloat v0), (location, v0),
+	TRACE_ARG(Location, location) TRACE_ARG(Float, v0))
+GL_TRACE_CALL(Uniform1i, (GLint location, GLint v0), (location, v0),
+	TRACE_ARG(Location, location) TRACE_ARG(Int, v0))
+GL_TRACE_CALL(Uniform1ui, (GLint location, GLuint v0), (location, v0),
+	TRACE_ARG(Location, location) TRACE_ARG(UInt, v0))
+GL_TRACE_CALL(UniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding),
+	TRACE_ARG(Program, program) TRACE_ARG(BlockIndex, uniformBlockIndex) TRACE_ARG(UInt, uniformBlockBinding))
+GL_TRACE_CALL(UseProgram, (GLuint program), (program),
+	TRACE_ARG(Program, program))
+GL_TRACE_CALL(ValidateProgram, (GLuint program), (program),
+	TRACE_ARG(Program, program))
+GL_TRACE_CALL(VertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor),
+	TRACE_ARG(UInt, index) TRACE_ARG(UInt, divisor))
+GL_TRACE_CALL(VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer), (index, size, type, normalized, stride, pointer),
+	TRACE_ARG(UInt, index) TRACE_ARG(Int, size) TRACE_ARG(Enum, type) TRACE_ARG(Boolean, normalized) TRACE_ARG(Sizei, stride) TRACE_ARG(Offset, pointer))
+GL_TRACE_CALL(Viewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height),
+	TRACE_ARG(Int, x) TRACE_ARG(Int, y) TRACE_ARG(Sizei, width) TRACE_ARG(Sizei, height))
+
+GL_TRACE_GEN(GenBuffers, Buffer)
+GL_TRACE_GEN(GenFramebuffers, Framebuffer)
+GL_TRACE_GEN(GenQueries, Query)
+GL_TRACE_GEN(GenTextures, Texture)
+GL_TRACE_GEN(GenVertexArrays, VertexArray)
+GL_TRACE_DELETE(DeleteBuffers, Buffer)
+GL_TRACE_DELETE(DeleteFramebuffers, Framebuffer)
+GL_TRACE_DELETE(DeleteQueries, Query)
+GL_TRACE_DELETE(DeleteTextures, Texture)
+GL_TRACE_DELETE(DeleteVertexArrays, VertexArray)
+
+#undef GL_TRACE_CALL
+#undef GL_TRACE_CALL_RETURN
+#undef GL_TRACE_GEN
+#undef GL_TRACE_DELETE
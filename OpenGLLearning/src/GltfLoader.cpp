@@ -0,0 +1,959 @@
+#include "GltfLoader.hpp"
+
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "ImageLoader.hpp"
+
+namespace {
+
+constexpr float ResampleFramesPerSecond = 30.0f;
+constexpr std::uint32_t MaxJoints = 256;
+
+/// <summary>
+/// A parsed JSON value. Objects keep their members in order; looking one
+/// up that isn't there gives a null.
+/// </summary>
+struct JsonValue {
+	enum class Type { Null, Bool, Number, String, Array, Object };
+
+	Type					mType		= Type::Null;
+	bool					mBool		= false;
+	double					mNumber		= 0.0;
+	std::string				mString;
+	std::vector<JsonValue>	mArray;
+	std::vector<std::pair<std::string, JsonValue>>	mObject;
+
+	bool IsNull() const { return mType == Type::Null; }
+	bool IsNumber() const { return mType == Type::Number; }
+	std::size_t Size() const { return mType == Type::Array ? mArray.size() : 0; }
+
+	const JsonValue& operator[](const char* key) const
+	{
+		static const JsonValue null;
+		if (mType == Type::Object)
+		{
+			for (const std::pair<std::string, JsonValue>& member : mObject)
+			{
+				if (member.first == key)
+				{
+					return member.second;
+				}
+			}
+		}
+		return null;
+	}
+	const JsonValue& operator[](std::size_t index) const
+	{
+		static const JsonValue null;
+		return index < Size() ? mArray[index] : null;
+	}
+	// Literal indices, and -1 for a missing one.
+	const JsonValue& operator[](int index) const
+	{
+		return (*this)[index < 0 ? ~static_cast<std::size_t>(0) : static_cast<std::size_t>(index)];
+	}
+	double Number(double fallback) const { return IsNumber() ? mNumber : fallback; }
+	int Int(int fallback) const { return IsNumber() ? static_cast<int>(mNumber) : fallback; }
+	const std::string& String() const { return mString; }
+};
+
+/// <summary>
+/// Recursive descent over RFC 8259 JSON. Strings keep \u escapes below 0x80
+/// and turn the rest into '?', which is plenty for names.
+/// </summary>
+class JsonParser {
+public:
+	JsonParser(const char* begin, const char* end) : mPosition(begin), mEnd(end) {}
+
+	bool Parse(JsonValue* value)
+	{
+		if (!ParseValue(value, 0))
+		{
+			return false;
+		}
+		SkipSpace();
+		return mPosition == mEnd;
+	}
+
+private:
+	static constexpr int MaxDepth = 64;
+
+	void SkipSpace()
+	{
+		while (mPosition < mEnd && (*mPosition == ' ' || *mPosition == '\t' || *mPosition == '\n' || *mPosition == '\r'))
+		{
+			++mPosition;
+		}
+	}
+
+	bool Expect(const char* word)
+	{
+		const std::size_t length = strlen(word);
+		if (static_cast<std::size_t>(mEnd - mPosition) < length || memcmp(mPosition, word, length) != 0)
+		{
+			return false;
+		}
+		mPosition += length;
+		return true;
+	}
+
+	bool ParseValue(JsonValue* value, int depth)
+	{
+		SkipSpace();
+		if (mPosition == mEnd || depth > MaxDepth)
+		{
+			return false;
+		}
+		switch (*mPosition)
+		{
+		case '{':
+			return ParseObject(value, depth);
+		case '[':
+			return ParseArray(value, depth);
+		case '"':
+			value->mType = JsonValue::Type::String;
+			return ParseString(&value->mString);
+		case 't':
+			value->mType = JsonValue::Type::Bool;
+			value->mBool = true;
+			return Expect("true");
+		case 'f':
+			value->mType = JsonValue::Type::Bool;
+			return Expect("false");
+		case 'n':
+			return Expect("null");
+		default:
+			return ParseNumber(value);
+		}
+	}
+
+	bool ParseObject(JsonValue* value, int depth)
+	{
+		value->mType = JsonValue::Type::Object;
+		++mPosition;
+		SkipSpace();
+		if (mPosition < mEnd && *mPosition == '}')
+		{
+			++mPosition;
+			return true;
+		}
+		while (true)
+		{
+			SkipSpace();
+			std::pair<std::string, JsonValue> member;
+			if (mPosition == mEnd || *mPosition != '"' || !ParseString(&member.first))
+			{
+				return false;
+			}
+			SkipSpace();
+			if (mPosition == mEnd || *mPosition++ != ':' || !ParseValue(&member.second, depth + 1))
+			{
+				return false;
+			}
+			value->mObject.push_back(std::move(member));
+			SkipSpace();
+			if (mPosition == mEnd)
+			{
+				return false;
+			}
+			const char next = *mPosition++;
+			if (next == '}')
+			{
+				return true;
+			}
+			if (next != ',')
+			{
+				return false;
+			}
+		}
+	}
+
+	bool ParseArray(JsonValue* value, int depth)
+	{
+		value->mType = JsonValue::Type::Array;
+		++mPosition;
+		SkipSpace();
+		if (mPosition < mEnd && *mPosition == ']')
+		{
+			++mPosition;
+			return true;
+		}
+		while (true)
+		{
+			value->mArray.emplace_back();
+			if (!ParseValue(&value->mArray.back(), depth + 1))
+			{
+				return false;
+			}
+			SkipSpace();
+			if (mPosition == mEnd)
+			{
+				return false;
+			}
+			const char next = *mPosition++;
+			if (next == ']')
+			{
+				return true;
+			}
+			if (next != ',')
+			{
+				return false;
+			}
+		}
+	}
+
+	bool ParseString(std::string* text)
+	{
+		++mPosition;
+		while (mPosition < mEnd && *mPosition != '"')
+		{
+			char c = *mPosition++;
+			if (c == '\\')
+			{
+				if (mPosition == mEnd)
+				{
+					return false;
+				}
+				c = *mPosition++;
+				switch (c)
+				{
+				case 'b': c = '\b'; break;
+				case 'f': c = '\f'; break;
+				case 'n': c = '\n'; break;
+				case 'r': c = '\r'; break;
+				case 't': c = '\t'; break;
+				case 'u':
+				{
+					if (mEnd - mPosition < 4)
+					{
+						return false;
+					}
+					const std::string hex(mPosition, mPosition + 4);
+					mPosition += 4;
+					const long code = strtol(hex.c_str(), nullptr, 16);
+					c = code < 0x80 ? static_cast<char>(code) : '?';
+					break;
+				}
+				default:
+					break;
+				}
+			}
+			text->push_back(c);
+		}
+		if (mPosition == mEnd)
+		{
+			return false;
+		}
+		++mPosition;
+		return true;
+	}
+
+	bool ParseNumber(JsonValue* value)
+	{
+		// strtod needs a terminated string; numbers are short.
+		const char* start = mPosition;
+		while (mPosition < mEnd && (strchr("+-0123456789.eE", *mPosition) != nullptr))
+		{
+			++mPosition;
+		}
+		if (mPosition == start || mPosition - start > 63)
+		{
+			return false;
+		}
+		const std::string number(start, mPosition);
+		char* end = nullptr;
+		value->mType = JsonValue::Type::Number;
+		value->mNumber = strtod(number.c_str(), &end);
+		return end == number.c_str() + number.size();
+	}
+
+	const char*		mPosition;
+	const char*		mEnd;
+};
+
+bool DecodeBase64(const char* text, std::size_t length, std::vector<std::uint8_t>* data)
+{
+	data->clear();
+	std::uint32_t bits = 0;
+	int count = 0;
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		const char c = text[i];
+		int value;
+		if (c >= 'A' && c <= 'Z') value = c - 'A';
+		else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+		else if (c >= '0' && c <= '9') value = c - '0' + 52;
+		else if (c == '+' || c == '-') value = 62;
+		else if (c == '/' || c == '_') value = 63;
+		else if (c == '=') break;
+		else return false;
+		bits = (bits << 6) | static_cast<std::uint32_t>(value);
+		count += 6;
+		if (count >= 8)
+		{
+			count -= 8;
+			data->push_back(static_cast<std::uint8_t>(bits >> count));
+		}
+	}
+	return true;
+}
+
+std::uint32_t ReadU32(const std::uint8_t* data)
+{
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+/// <summary>
+/// A glTF document: its JSON and the bytes of each of its buffers.
+/// </summary>
+struct Document {
+	JsonValue								mJson;
+	std::vector<std::vector<std::uint8_t>>	mBuffers;
+};
+
+/// <summary>
+/// Where an accessor's elements are, and how to read them.
+/// </summary>
+struct Accessor {
+	const std::uint8_t*		mData			= nullptr;
+	std::size_t				mCount			= 0;
+	std::size_t				mStride			= 0;
+	int						mComponents		= 0;
+	int						mComponentType	= 0;
+	bool					mNormalized		= false;
+};
+
+int GetComponentSize(int componentType)
+{
+	switch (componentType)
+	{
+	case 5120: case 5121: return 1;
+	case 5122: case 5123: return 2;
+	case 5125: case 5126: return 4;
+	default: return 0;
+	}
+}
+
+int GetComponentCount(const std::string& type)
+{
+	if (type == "SCALAR") return 1;
+	if (type == "VEC2") return 2;
+	if (type == "VEC3") return 3;
+	if (type == "VEC4") return 4;
+	if (type == "MAT4") return 16;
+	return 0;
+}
+
+bool GetAccessor(const Document& document, int index, Accessor* accessor, std::string* error)
+{
+	const JsonValue& json = document.mJson["accessors"][static_cast<std::size_t>(index)];
+	const JsonValue& view = document.mJson["bufferViews"][static_cast<std::size_t>(json["bufferView"].Int(-1))];
+	accessor->mCount = static_cast<std::size_t>(json["count"].Number(0.0));
+	accessor->mComponents = GetComponentCount(json["type"].String());
+	accessor->mComponentType = json["componentType"].Int(0);
+	accessor->mNormalized = json["normalized"].mBool;
+	const std::size_t elementSize = static_cast<std::size_t>(GetComponentSize(accessor->mComponentType) * accessor->mComponents);
+	if (json.IsNull() || view.IsNull() || elementSize == 0 || !json["sparse"].IsNull())
+	{
+		*error = "accessor " + std::to_string(index) + " is missing, sparse or of an unknown type";
+		return false;
+	}
+	const std::size_t buffer = static_cast<std::size_t>(view["buffer"].Int(-1));
+	const std::size_t offset = static_cast<std::size_t>(view["byteOffset"].Number(0.0) + json["byteOffset"].Number(0.0));
+	const std::size_t viewEnd = static_cast<std::size_t>(view["byteOffset"].Number(0.0) + view["byteLength"].Number(0.0));
+	accessor->mStride = static_cast<std::size_t>(view["byteStride"].Number(static_cast<double>(elementSize)));
+	if (buffer >= document.mBuffers.size() || viewEnd > document.mBuffers[buffer].size()
+		|| (accessor->mCount > 0 && offset + accessor->mStride * (accessor->mCount - 1) + elementSize > viewEnd))
+	{
+		*error = "accessor " + std::to_string(index) + " is out of its buffer";
+		return false;
+	}
+	accessor->mData = document.mBuffers[buffer].data() + offset;
+	return true;
+}
+
+/// <summary>
+/// Component 'component' of element 'element', as a float; normalized
+/// integers map to 0..1 (or -1..1 if signed).
+/// </summary>
+float ReadFloat(const Accessor& accessor, std::size_t element, int component)
+{
+	const int size = GetComponentSize(accessor.mComponentType);
+	const std::uint8_t* source = accessor.mData + element * accessor.mStride + component * size;
+	switch (accessor.mComponentType)
+	{
+	case 5126: { float value; memcpy(&value, source, 4); return value; }
+	case 5121: return accessor.mNormalized ? *source / 255.0f : *source;
+	case 5120: { const float value = static_cast<std::int8_t>(*source); return accessor.mNormalized ? std::max(value / 127.0f, -1.0f) : value; }
+	case 5123: { std::uint16_t value; memcpy(&value, source, 2); return accessor.mNormalized ? value / 65535.0f : value; }
+	case 5122: { std::int16_t value; memcpy(&value, source, 2); return accessor.mNormalized ? std::max(value / 32767.0f, -1.0f) : value; }
+	case 5125: { std::uint32_t value; memcpy(&value, source, 4); return static_cast<float>(value); }
+	default: return 0.0f;
+	}
+}
+
+std::uint32_t ReadIndex(const Accessor& accessor, std::size_t element, int component)
+{
+	const std::uint8_t* source = accessor.mData + element * accessor.mStride + component * GetComponentSize(accessor.mComponentType);
+	switch (accessor.mComponentType)
+	{
+	case 5121: return *source;
+	case 5123: { std::uint16_t value; memcpy(&value, source, 2); return value; }
+	case 5125: { std::uint32_t value; memcpy(&value, source, 4); return value; }
+	default: return ~0u;
+	}
+}
+
+/// <summary>
+/// A node's own transform, from its matrix or its TRS.
+/// </summary>
+JointPose GetNodePose(const JsonValue& node)
+{
+	JointPose pose;
+	const JsonValue& matrix = node["matrix"];
+	if (matrix.Size() == 16)
+	{
+		glm::mat4 m;
+		for (int i = 0; i < 16; ++i)
+		{
+			glm::value_ptr(m)[i] = static_cast<float>(matrix[static_cast<std::size_t>(i)].Number(0.0));
+		}
+		pose.mTranslation = glm::vec3(m[3]);
+		pose.mScale = glm::vec3(glm::length(glm::vec3(m[0])), glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2])));
+		if (glm::determinant(glm::mat3(m)) < 0.0f)
+		{
+			pose.mScale.x = -pose.mScale.x;
+		}
+		const glm::mat3 rotation(glm::vec3(m[0]) / pose.mScale.x, glm::vec3(m[1]) / pose.mScale.y, glm::vec3(m[2]) / pose.mScale.z);
+		pose.mRotation = glm::normalize(glm::quat_cast(rotation));
+		return pose;
+	}
+	const JsonValue& translation = node["translation"];
+	const JsonValue& rotation = node["rotation"];
+	const JsonValue& scale = node["scale"];
+	if (translation.Size() == 3)
+	{
+		pose.mTranslation = glm::vec3(translation[0].Number(0.0), translation[1].Number(0.0), translation[2].Number(0.0));
+	}
+	if (rotation.Size() == 4)
+	{
+		// glTF stores x, y, z, w.
+		pose.mRotation = glm::normalize(glm::quat(
+			static_cast<float>(rotation[3].Number(1.0)), static_cast<float>(rotation[0].Number(0.0)),
+			static_cast<float>(rotation[1].Number(0.0)), static_cast<float>(rotation[2].Number(0.0))));
+	}
+	if (scale.Size() == 3)
+	{
+		pose.mScale = glm::vec3(scale[0].Number(1.0), scale[1].Number(1.0), scale[2].Number(1.0));
+	}
+	return pose;
+}
+
+glm::mat4 GetPoseMatrix(const JointPose& pose)
+{
+	return glm::translate(glm::mat4(1.0f), pose.mTranslation) * glm::mat4_cast(pose.mRotation) * glm::scale(glm::mat4(1.0f), pose.mScale);
+}
+
+bool ReadMesh(const Document& document, const JsonValue& mesh, const std::vector<std::uint32_t>& jointRemap, SkinnedModel* model, std::string* error)
+{
+	const JsonValue& primitives = mesh["primitives"];
+	for (std::size_t p = 0; p < primitives.Size(); ++p)
+	{
+		const JsonValue& primitive = primitives[p];
+		const JsonValue& attributes = primitive["attributes"];
+		if (primitive["mode"].Int(4) != 4 || attributes["POSITION"].IsNull() || attributes["JOINTS_0"].IsNull() || attributes["WEIGHTS_0"].IsNull())
+		{
+			continue;
+		}
+		Accessor positions, joints, weights, colors;
+		if (!GetAccessor(document, attributes["POSITION"].Int(-1), &positions, error)
+			|| !GetAccessor(document, attributes["JOINTS_0"].Int(-1), &joints, error)
+			|| !GetAccessor(document, attributes["WEIGHTS_0"].Int(-1), &weights, error)
+			|| (!attributes["COLOR_0"].IsNull() && !GetAccessor(document, attributes["COLOR_0"].Int(-1), &colors, error)))
+		{
+			return false;
+		}
+		if (positions.mComponents != 3 || joints.mComponents != 4 || weights.mComponents != 4
+			|| joints.mCount < positions.mCount || weights.mCount < positions.mCount
+			|| (colors.mData != nullptr && (colors.mComponents < 3 || colors.mCount < positions.mCount)))
+		{
+			*error = "a skinned primitive's attributes don't match";
+			return false;
+		}
+
+		glm::vec3 baseColor(1.0f);
+		const JsonValue& factor = document.mJson["materials"][static_cast<std::size_t>(primitive["material"].Int(-1))]["pbrMetallicRoughness"]["baseColorFactor"];
+		if (factor.Size() == 4)
+		{
+			baseColor = glm::vec3(factor[0].Number(1.0), factor[1].Number(1.0), factor[2].Number(1.0));
+		}
+
+		const std::uint32_t firstVertex = static_cast<std::uint32_t>(model->mVertices.size());
+		for (std::size_t i = 0; i < positions.mCount; ++i)
+		{
+			SkinnedVertex vertex;
+			vertex.mPosition = glm::vec3(ReadFloat(positions, i, 0), ReadFloat(positions, i, 1), ReadFloat(positions, i, 2));
+			vertex.mColor = baseColor;
+			if (colors.mData != nullptr)
+			{
+				vertex.mColor *= glm::vec3(ReadFloat(colors, i, 0), ReadFloat(colors, i, 1), ReadFloat(colors, i, 2));
+			}
+			float vertexWeights[4];
+			for (int j = 0; j < 4; ++j)
+			{
+				const std::uint32_t joint = ReadIndex(joints, i, j);
+				vertexWeights[j] = ReadFloat(weights, i, j);
+				if (joint >= jointRemap.size())
+				{
+					if (vertexWeights[j] > 0.0f)
+					{
+						*error = "a vertex is bound to a joint the skin doesn't have";
+						return false;
+					}
+					vertex.mJoints[j] = 0;
+					continue;
+				}
+				vertex.mJoints[j] = static_cast<std::uint8_t>(jointRemap[joint]);
+			}
+			SkinnedModel::QuantizeWeights(vertexWeights, vertex.mWeights);
+			model->mVertices.push_back(vertex);
+		}
+
+		if (primitive["indices"].IsNull())
+		{
+			for (std::uint32_t i = 0; i < positions.mCount; ++i)
+			{
+				model->mIndices.push_back(firstVertex + i);
+			}
+			continue;
+		}
+		Accessor indices;
+		if (!GetAccessor(document, primitive["indices"].Int(-1), &indices, error))
+		{
+			return false;
+		}
+		for (std::size_t i = 0; i < indices.mCount; ++i)
+		{
+			const std::uint32_t index = ReadIndex(indices, i, 0);
+			if (index >= positions.mCount)
+			{
+				*error = "an index is out of its primitive's vertices";
+				return false;
+			}
+			model->mIndices.push_back(firstVertex + index);
+		}
+	}
+	if (model->mIndices.empty())
+	{
+		*error = "the skinned mesh has no triangles with JOINTS_0 and WEIGHTS_0";
+		return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// One animation channel: which joint and property it drives, and its keys.
+/// </summary>
+struct Channel {
+	std::uint32_t			mJoint		= 0;
+	// 0 translation, 1 rotation, 2 scale.
+	int						mPath		= 0;
+	bool					mStep		= false;
+	std::vector<float>		mTimes;
+	// 3 or 4 floats per key.
+	std::vector<float>		mValues;
+};
+
+bool ReadAnimation(const Document& document, const JsonValue& animation, const std::vector<std::int32_t>& nodeJoints, const Skeleton& skeleton,
+	RawClip* clip, std::string* error)
+{
+	const JsonValue& samplers = animation["samplers"];
+	const JsonValue& channels = animation["channels"];
+	std::vector<Channel> read;
+	float duration = 0.0f;
+	for (std::size_t c = 0; c < channels.Size(); ++c)
+	{
+		const JsonValue& target = channels[c]["target"];
+		const int node = target["node"].Int(-1);
+		const std::string& path = target["path"].String();
+		const int pathIndex = path == "translation" ? 0 : path == "rotation" ? 1 : path == "scale" ? 2 : -1;
+		if (node < 0 || static_cast<std::size_t>(node) >= nodeJoints.size() || nodeJoints[node] < 0 || pathIndex < 0)
+		{
+			// Not one of our joints, or morph weights.
+			continue;
+		}
+		const JsonValue& sampler = samplers[static_cast<std::size_t>(channels[c]["sampler"].Int(-1))];
+		Accessor input, output;
+		if (sampler.IsNull() || !GetAccessor(document, sampler["input"].Int(-1), &input, error) || !GetAccessor(document, sampler["output"].Int(-1), &output, error))
+		{
+			if (error->empty())
+			{
+				*error = "an animation channel has no sampler";
+			}
+			return false;
+		}
+		const std::string& interpolation = sampler["interpolation"].String();
+		const bool cubic = interpolation == "CUBICSPLINE";
+		const int components = pathIndex == 1 ? 4 : 3;
+		if (input.mComponents != 1 || output.mComponents != components || output.mCount < input.mCount * (cubic ? 3 : 1) || input.mCount == 0)
+		{
+			*error = "an animation sampler's keys don't match its times";
+			return false;
+		}
+		Channel channel;
+		channel.mJoint = static_cast<std::uint32_t>(nodeJoints[node]);
+		channel.mPath = pathIndex;
+		channel.mStep = interpolation == "STEP";
+		for (std::size_t k = 0; k < input.mCount; ++k)
+		{
+			channel.mTimes.push_back(ReadFloat(input, k, 0));
+			// A cubic spline's keys are in-tangent, value, out-tangent.
+			const std::size_t element = cubic ? k * 3 + 1 : k;
+			for (int i = 0; i < components; ++i)
+			{
+				channel.mValues.push_back(ReadFloat(output, element, i));
+			}
+		}
+		duration = std::max(duration, channel.mTimes.back());
+		read.push_back(std::move(channel));
+	}
+
+	clip->mName = animation["name"].String();
+	clip->mFramesPerSecond = ResampleFramesPerSecond;
+	clip->mFrameCount = static_cast<std::uint32_t>(std::round(duration * ResampleFramesPerSecond)) + 1;
+	clip->mJointCount = skeleton.GetJointCount();
+	if (clip->mFrameCount > 65536)
+	{
+		*error = "an animation is longer than 65536 frames";
+		return false;
+	}
+	clip->mPoses.clear();
+	for (std::uint32_t frame = 0; frame < clip->mFrameCount; ++frame)
+	{
+		clip->mPoses.insert(clip->mPoses.end(), skeleton.mBindPoses.begin(), skeleton.mBindPoses.end());
+	}
+	for (const Channel& channel : read)
+	{
+		const int components = channel.mPath == 1 ? 4 : 3;
+		for (std::uint32_t frame = 0; frame < clip->mFrameCount; ++frame)
+		{
+			const float time = std::min(frame / ResampleFramesPerSecond, duration);
+			// The keys either side of 'time', clamped to the first and last.
+			const std::size_t next = static_cast<std::size_t>(std::upper_bound(channel.mTimes.begin(), channel.mTimes.end(), time) - channel.mTimes.begin());
+			const std::size_t from = next == 0 ? 0 : next - 1;
+			const std::size_t to = std::min(next, channel.mTimes.size() - 1);
+			const float span = channel.mTimes[to] - channel.mTimes[from];
+			const float t = (channel.mStep || span <= 0.0f) ? 0.0f : std::min(std::max((time - channel.mTimes[from]) / span, 0.0f), 1.0f);
+			const float* a = &channel.mValues[from * components];
+			const float* b = &channel.mValues[to * components];
+			JointPose& pose = clip->mPoses[frame * clip->mJointCount + channel.mJoint];
+			if (channel.mPath == 1)
+			{
+				const glm::quat qa = glm::normalize(glm::quat(a[3], a[0], a[1], a[2]));
+				const glm::quat qb = glm::normalize(glm::quat(b[3], b[0], b[1], b[2]));
+				pose.mRotation = glm::slerp(qa, glm::dot(qa, qb) < 0.0f ? -qb : qb, t);
+			}
+			else
+			{
+				const glm::vec3 value = glm::mix(glm::vec3(a[0], a[1], a[2]), glm::vec3(b[0], b[1], b[2]), t);
+				(channel.mPath == 0 ? pose.mTranslation : pose.mScale) = value;
+			}
+		}
+	}
+	return true;
+}
+
+}
+
+bool GltfLoader::Decode(const std::uint8_t* data, std::size_t size, const std::string& directory, SkinnedModel* model, std::string* error)
+{
+	error->clear();
+	Document document;
+	const char* jsonBegin = reinterpret_cast<const char*>(data);
+	const char* jsonEnd = jsonBegin + size;
+	std::vector<std::uint8_t> binaryChunk;
+	bool binary = false;
+	if (size >= 12 && ReadU32(data) == 0x46546C67u)
+	{
+		// .glb: a header, then a JSON chunk and maybe a BIN one.
+		binary = true;
+		const std::size_t length = std::min<std::size_t>(ReadU32(data + 8), size);
+		std::size_t offset = 12;
+		bool hasJson = false;
+		while (offset + 8 <= length)
+		{
+			const std::size_t chunkLength = ReadU32(data + offset);
+			const std::uint32_t type = ReadU32(data + offset + 4);
+			if (offset + 8 + chunkLength > length)
+			{
+				*error = "a .glb chunk is cut short";
+				return false;
+			}
+			if (type == 0x4E4F534Au && !hasJson)
+			{
+				jsonBegin = reinterpret_cast<const char*>(data + offset + 8);
+				jsonEnd = jsonBegin + chunkLength;
+				hasJson = true;
+			}
+			else if (type == 0x004E4942u && binaryChunk.empty())
+			{
+				binaryChunk.assign(data + offset + 8, data + offset + 8 + chunkLength);
+			}
+			offset += 8 + ((chunkLength + 3) & ~static_cast<std::size_t>(3));
+		}
+		if (!hasJson)
+		{
+			*error = "the .glb has no JSON chunk";
+			return false;
+		}
+	}
+	JsonParser parser(jsonBegin, jsonEnd);
+	if (!parser.Parse(&document.mJson) || document.mJson.mType != JsonValue::Type::Object)
+	{
+		*error = "not valid glTF JSON";
+		return false;
+	}
+	const JsonValue& json = document.mJson;
+	if (json["asset"]["version"].String().compare(0, 1, "2") != 0)
+	{
+		*error = "not glTF 2";
+		return false;
+	}
+
+	const JsonValue& buffers = json["buffers"];
+	for (std::size_t i = 0; i < buffers.Size(); ++i)
+	{
+		const std::string& uri = buffers[i]["uri"].String();
+		std::vector<std::uint8_t> bytes;
+		const std::string::size_type comma = uri.find(',');
+		if (uri.empty())
+		{
+			if (!binary || i != 0)
+			{
+				*error = "buffer " + std::to_string(i) + " has no data";
+				return false;
+			}
+			bytes = binaryChunk;
+		}
+		else if (uri.compare(0, 5, "data:") == 0)
+		{
+			if (comma == std::string::npos || uri.rfind(";base64", comma) == std::string::npos
+				|| !DecodeBase64(uri.c_str() + comma + 1, uri.size() - comma - 1, &bytes))
+			{
+				*error = "buffer " + std::to_string(i) + " isn't base64";
+				return false;
+			}
+		}
+		else
+		{
+			// Percent escapes, for names with spaces.
+			std::string path = directory;
+			for (std::size_t c = 0; c < uri.size(); ++c)
+			{
+				if (uri[c] == '%' && c + 2 < uri.size())
+				{
+					path.push_back(static_cast<char>(strtol(uri.substr(c + 1, 2).c_str(), nullptr, 16)));
+					c += 2;
+				}
+				else
+				{
+					path.push_back(uri[c]);
+				}
+			}
+			if (!ImageLoader::ReadFile(path.c_str(), &bytes, error))
+			{
+				return false;
+			}
+		}
+		if (bytes.size() < static_cast<std::size_t>(buffers[i]["byteLength"].Number(0.0)))
+		{
+			*error = "buffer " + std::to_string(i) + " is shorter than it says";
+			return false;
+		}
+		document.mBuffers.push_back(std::move(bytes));
+	}
+
+	// The first node with a mesh and a skin.
+	const JsonValue& nodes = json["nodes"];
+	std::size_t skinnedNode = nodes.Size();
+	for (std::size_t i = 0; i < nodes.Size() && skinnedNode == nodes.Size(); ++i)
+	{
+		if (!nodes[i]["mesh"].IsNull() && !nodes[i]["skin"].IsNull())
+		{
+			skinnedNode = i;
+		}
+	}
+	const JsonValue& skin = json["skins"][static_cast<std::size_t>(nodes[skinnedNode]["skin"].Int(-1))];
+	const JsonValue& mesh = json["meshes"][static_cast<std::size_t>(nodes[skinnedNode]["mesh"].Int(-1))];
+	const JsonValue& skinJoints = skin["joints"];
+	if (skinnedNode == nodes.Size() || skin.IsNull() || mesh.IsNull() || skinJoints.Size() == 0)
+	{
+		*error = "no node has both a mesh and a skin";
+		return false;
+	}
+	if (skinJoints.Size() > MaxJoints)
+	{
+		*error = "the skin has more than 256 joints";
+		return false;
+	}
+
+	std::vector<int> nodeParents(nodes.Size(), -1);
+	for (std::size_t i = 0; i < nodes.Size(); ++i)
+	{
+		const JsonValue& children = nodes[i]["children"];
+		for (std::size_t c = 0; c < children.Size(); ++c)
+		{
+			const int child = children[c].Int(-1);
+			if (child < 0 || static_cast<std::size_t>(child) >= nodes.Size())
+			{
+				*error = "a node has a child that isn't there";
+				return false;
+			}
+			nodeParents[child] = static_cast<int>(i);
+		}
+	}
+
+	// Each skin joint's nearest ancestor that is a joint too, and how deep
+	// it is among them; sorting by depth puts parents first.
+	const std::size_t jointCount = skinJoints.Size();
+	std::vector<std::int32_t> skinIndexOfNode(nodes.Size(), -1);
+	for (std::size_t j = 0; j < jointCount; ++j)
+	{
+		const int node = skinJoints[j].Int(-1);
+		if (node < 0 || static_cast<std::size_t>(node) >= nodes.Size() || skinIndexOfNode[node] >= 0)
+		{
+			*error = "the skin's joints aren't distinct nodes";
+			return false;
+		}
+		skinIndexOfNode[node] = static_cast<std::int32_t>(j);
+	}
+	std::vector<std::int32_t> jointParents(jointCount, Skeleton::NoParent);
+	std::vector<std::size_t> depths(jointCount, 0);
+	std::vector<int> rootHolders(jointCount, -1);
+	for (std::size_t j = 0; j < jointCount; ++j)
+	{
+		int node = nodeParents[skinJoints[j].Int(-1)];
+		std::size_t steps = 0;
+		while (node >= 0 && skinIndexOfNode[node] < 0 && ++steps <= nodes.Size())
+		{
+			node = nodeParents[node];
+		}
+		if (steps > nodes.Size())
+		{
+			*error = "the node hierarchy has a cycle";
+			return false;
+		}
+		if (node >= 0)
+		{
+			jointParents[j] = skinIndexOfNode[node];
+		}
+		else
+		{
+			rootHolders[j] = nodeParents[skinJoints[j].Int(-1)];
+		}
+	}
+	for (std::size_t j = 0; j < jointCount; ++j)
+	{
+		for (std::int32_t parent = jointParents[j]; parent != Skeleton::NoParent; parent = jointParents[parent])
+		{
+			if (++depths[j] > jointCount)
+			{
+				*error = "the joints' hierarchy has a cycle";
+				return false;
+			}
+		}
+	}
+	std::vector<std::uint32_t> order(jointCount);
+	for (std::size_t j = 0; j < jointCount; ++j)
+	{
+		order[j] = static_cast<std::uint32_t>(j);
+	}
+	std::stable_sort(order.begin(), order.end(), [&depths](std::uint32_t a, std::uint32_t b) { return depths[a] < depths[b]; });
+	std::vector<std::uint32_t> remap(jointCount);
+	for (std::size_t j = 0; j < jointCount; ++j)
+	{
+		remap[order[j]] = static_cast<std::uint32_t>(j);
+	}
+
+	std::vector<glm::mat4> inverseBinds(jointCount, glm::mat4(1.0f));
+	if (!skin["inverseBindMatrices"].IsNull())
+	{
+		Accessor matrices;
+		if (!GetAccessor(document, skin["inverseBindMatrices"].Int(-1), &matrices, error))
+		{
+			return false;
+		}
+		if (matrices.mComponents != 16 || matrices.mCount < jointCount)
+		{
+			*error = "the skin's inverse bind matrices don't match its joints";
+			return false;
+		}
+		for (std::size_t j = 0; j < jointCount; ++j)
+		{
+			for (int i = 0; i < 16; ++i)
+			{
+				glm::value_ptr(inverseBinds[j])[i] = ReadFloat(matrices, j, i);
+			}
+		}
+	}
+
+	*model = SkinnedModel();
+	Skeleton& skeleton = model->mSkeleton;
+	std::vector<std::int32_t> nodeJoints(nodes.Size(), -1);
+	for (std::size_t i = 0; i < jointCount; ++i)
+	{
+		const std::size_t j = order[i];
+		const JsonValue& node = nodes[static_cast<std::size_t>(skinJoints[j].Int(-1))];
+		skeleton.mParents.push_back(jointParents[j] == Skeleton::NoParent ? Skeleton::NoParent : static_cast<std::int32_t>(remap[jointParents[j]]));
+		skeleton.mBindPoses.push_back(GetNodePose(node));
+		skeleton.mInverseBindMatrices.push_back(inverseBinds[j]);
+		skeleton.mNames.push_back(node["name"].String());
+		nodeJoints[skinJoints[j].Int(-1)] = static_cast<std::int32_t>(i);
+	}
+	// Whatever holds the first root joint, all the way up.
+	for (int node = rootHolders[order[0]]; node >= 0; node = nodeParents[node])
+	{
+		skeleton.mRoot = GetPoseMatrix(GetNodePose(nodes[static_cast<std::size_t>(node)])) * skeleton.mRoot;
+	}
+
+	if (!ReadMesh(document, mesh, remap, model, error))
+	{
+		return false;
+	}
+
+	const JsonValue& animations = json["animations"];
+	for (std::size_t i = 0; i < animations.Size(); ++i)
+	{
+		RawClip clip;
+		if (!ReadAnimation(document, animations[i], nodeJoints, skeleton, &clip, error))
+		{
+			return false;
+		}
+		if (clip.mName.empty())
+		{
+			clip.mName = "animation" + std::to_string(i);
+		}
+		model->mClips.push_back(std::move(clip));
+	}
+	return true;
+}
+
+bool GltfLoader::Load(const char* path, SkinnedModel* model, std::string* error)
+{
+	std::vector<std::uint8_t> data;
+	if (!ImageLoader::ReadFile(path, &data, error))
+	{
+		return false;
+	}
+	const std::string file(path);
+	const std::string::size_type slash = file.find_last_of("/\\");
+	const std::string directory = slash == std::string::npos ? std::string() : file.substr(0, slash + 1);
+	return Decode(data.data(), data.size(), directory, model, error);
+}
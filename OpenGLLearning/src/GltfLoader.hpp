@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SkinnedModel.hpp"
+
+/// <summary>
+/// Reads the first skinned mesh of a glTF 2.0 file, with its skeleton and
+/// every animation of it, into a SkinnedModel.
+///
+/// What it reads:
+///		files		.gltf with its buffers embedded (data: URIs, base64) or
+///					next to it, or binary .glb
+///		mesh		the triangle primitives of the first node with both a
+///					mesh and a skin: POSITION, JOINTS_0 and WEIGHTS_0, and
+///					COLOR_0 or the material's base color if there is one;
+///					all of them merged into one
+///		skeleton	the skin's joints, reordered parents first (at most 256);
+///					whatever holds the root joints becomes Skeleton::mRoot,
+///					taken from the first root
+///		animations	translation, rotation and scale channels of the joints,
+///					LINEAR or STEP; CUBICSPLINE is read as linear between its
+///					keys. Each is resampled at 30 frames a second into a
+///					RawClip, for AnimationClip to compress.
+/// Not sparse accessors, morph targets, or more than four joints a vertex.
+/// </summary>
+namespace GltfLoader {
+	/// <summary>
+	/// Returns false, with the reason in 'error', if the data isn't a glTF
+	/// file with a skinned mesh. 'directory' is where its external buffers
+	/// are, with a trailing separator, or empty.
+	/// </summary>
+	bool Decode(const std::uint8_t* data, std::size_t size, const std::string& directory, SkinnedModel* model, std::string* error);
+
+	bool Load(const char* path, SkinnedModel* model, std::string* error);
+}
@@ -0,0 +1,573 @@
+#include "GpuCulling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "IndirectDrawList.hpp"
+
+namespace {
+
+// How close to a threshold, relative to the values compared, float
+// rounding could put the GPU on the other side of it. Depths are 24 bit
+// at best, so those get an absolute one.
+const float BorderlineEpsilon = 1e-4f;
+const float BorderlineDepth = 1e-5f;
+
+// A reference test's answer, or both when it's too close to call.
+enum class Outcome {
+	No,
+	Yes,
+	Either,
+};
+
+glm::vec4 Row(const glm::mat4& matrix, int row)
+{
+	return glm::vec4(matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]);
+}
+
+// IsInsideFrustum() in cull_comp.glsl.
+Outcome ReferenceInsideFrustum(const glm::mat4& mvp, const glm::vec4& sphere)
+{
+	const glm::vec4 rowW = Row(mvp, 3);
+	const glm::vec4 planes[6] = {
+		rowW + Row(mvp, 0), rowW - Row(mvp, 0),
+		rowW + Row(mvp, 1), rowW - Row(mvp, 1),
+		rowW + Row(mvp, 2), rowW - Row(mvp, 2),
+	};
+
+	Outcome outcome = Outcome::Yes;
+	for (const glm::vec4& plane : planes)
+	{
+		const float distance = glm::dot(glm::vec3(plane), glm::vec3(sphere)) + plane.w;
+		const float radius = sphere.w * glm::length(glm::vec3(plane));
+		const float scale = std::abs(distance) + radius + std::abs(plane.w);
+		if (std::abs(distance + radius) <= BorderlineEpsilon * scale)
+		{
+			outcome = Outcome::Either;
+		}
+		else if (distance < -radius)
+		{
+			return Outcome::No;
+		}
+	}
+	return outcome;
+}
+
+// One level of the depth pyramid, as read back.
+struct PyramidLevel {
+	int					mWidth;
+	int					mHeight;
+	std::vector<float>	mDepths;
+};
+
+// The lowest and highest depth a nearest-filtered fetch at 'uv' could
+// return, with the texel edges rounding either way.
+void FetchRange(const PyramidLevel& level, const glm::vec2& uv, float* lowest, float* highest)
+{
+	const float x = uv.x * level.mWidth;
+	const float y = uv.y * level.mHeight;
+	*lowest = 1.0f;
+	*highest = 0.0f;
+	for (float dy : { -BorderlineEpsilon, BorderlineEpsilon })
+	{
+		for (float dx : { -BorderlineEpsilon, BorderlineEpsilon })
+		{
+			const int texelX = std::max(0, std::min(static_cast<int>(std::floor(x + dx)), level.mWidth - 1));
+			const int texelY = std::max(0, std::min(static_cast<int>(std::floor(y + dy)), level.mHeight - 1));
+			const float depth = level.mDepths[texelY * level.mWidth + texelX];
+			*lowest = std::min(*lowest, depth);
+			*highest = std::max(*highest, depth);
+		}
+	}
+}
+
+// IsOccluded() in cull_comp.glsl.
+Outcome ReferenceOccluded(const glm::mat4& mvp, const glm::vec4& sphere, const std::vector<PyramidLevel>& pyramid)
+{
+	glm::vec3 minimum(1.0f);
+	glm::vec3 maximum(-1.0f);
+	for (int i = 0; i < 8; ++i)
+	{
+		const glm::vec3 corner = glm::vec3(sphere) + sphere.w * glm::vec3((i & 1) != 0 ? 1.0f : -1.0f, (i & 2) != 0 ? 1.0f : -1.0f, (i & 4) != 0 ? 1.0f : -1.0f);
+		const glm::vec4 clip = mvp * glm::vec4(corner, 1.0f);
+		if (clip.w <= 0.0f)
+		{
+			return Outcome::No;
+		}
+		const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+		minimum = glm::min(minimum, ndc);
+		maximum = glm::max(maximum, ndc);
+	}
+
+	const glm::vec2 uvMin = glm::clamp(glm::vec2(minimum) * 0.5f + 0.5f, 0.0f, 1.0f);
+	const glm::vec2 uvMax = glm::clamp(glm::vec2(maximum) * 0.5f + 0.5f, 0.0f, 1.0f);
+	const float nearestDepth = minimum.z * 0.5f + 0.5f;
+
+	// A size right at a power of two could round to either level.
+	const glm::vec2 size = (uvMax - uvMin) * glm::vec2(static_cast<float>(pyramid[0].mWidth), static_cast<float>(pyramid[0].mHeight));
+	const float exactLevel = std::log2(std::max(std::max(size.x, size.y), 1.0f));
+	int firstLevel = static_cast<int>(std::ceil(exactLevel));
+	int lastLevel = firstLevel;
+	if (std::abs(exactLevel - std::round(exactLevel)) < BorderlineEpsilon)
+	{
+		firstLevel = static_cast<int>(std::round(exactLevel));
+		lastLevel = firstLevel + 1;
+	}
+	const int maxLevel = static_cast<int>(pyramid.size()) - 1;
+
+	float lowestFarthest = 1.0f;
+	float highestFarthest = 0.0f;
+	for (int level = std::min(firstLevel, maxLevel); level <= std::min(lastLevel, maxLevel); ++level)
+	{
+		const glm::vec2 corners[4] = { uvMin, glm::vec2(uvMax.x, uvMin.y), glm::vec2(uvMin.x, uvMax.y), uvMax };
+		float lowest = 0.0f;
+		float highest = 0.0f;
+		for (const glm::vec2& uv : corners)
+		{
+			float cornerLowest = 0.0f;
+			float cornerHighest = 0.0f;
+			FetchRange(pyramid[level], uv, &cornerLowest, &cornerHighest);
+			lowest = std::max(lowest, cornerLowest);
+			highest = std::max(highest, cornerHighest);
+		}
+		lowestFarthest = std::min(lowestFarthest, lowest);
+		highestFarthest = std::max(highestFarthest, highest);
+	}
+
+	if (nearestDepth > highestFarthest + BorderlineDepth)
+	{
+		return Outcome::Yes;
+	}
+	if (nearestDepth <= lowestFarthest - BorderlineDepth)
+	{
+		return Outcome::No;
+	}
+	return Outcome::Either;
+}
+
+// SelectLod() in cull_comp.glsl, as an offset from the first level.
+// 'borderline' is set when some level's error is too close to the
+// threshold to tell which one the GPU picked.
+GLuint ReferenceSelectLod(const glm::mat4& mvp, const glm::vec4& sphere, const std::vector<float>& errors,
+	float halfViewportHeight, float threshold, bool* borderline)
+{
+	const glm::vec3 rowY = glm::vec3(Row(mvp, 1));
+	const glm::vec4 rowW = Row(mvp, 3);
+	const float distance = glm::dot(glm::vec3(rowW), glm::vec3(sphere)) + rowW.w - sphere.w * glm::length(glm::vec3(rowW));
+	*borderline = false;
+	if (distance <= 0.0f)
+	{
+		return 0;
+	}
+	const float pixelsPerUnit = glm::length(rowY) / distance * halfViewportHeight;
+
+	for (GLuint i = static_cast<GLuint>(errors.size()) - 1; i > 0; --i)
+	{
+		const float pixels = errors[i] * pixelsPerUnit;
+		if (std::abs(pixels - threshold) <= BorderlineEpsilon * std::max(pixels, threshold))
+		{
+			*borderline = true;
+		}
+		if (pixels <= threshold)
+		{
+			return i;
+		}
+	}
+	return 0;
+}
+
+}
+
+bool GpuCulling::IsSupported()
+{
+	return GLAD_GL_ARB_compute_shader
+		&& GLAD_GL_ARB_shader_storage_buffer_object
+		&& GLAD_GL_ARB_shader_image_load_store
+		&& GLAD_GL_ARB_shader_image_size
+		&& GLAD_GL_ARB_shading_language_420pack
+		&& GLAD_GL_ARB_clear_buffer_object
+		&& IndirectDrawList::IsSupported();
+}
+
+void GpuCulling::Create(GLuint cullProgram, GLuint depthPyramidProgram)
+{
+	mCullProgram = cullProgram;
+	mDepthPyramidProgram = depthPyramidProgram;
+
+	glProgramUniform1i(mCullProgram, glGetUniformLocation(mCullProgram, "u_DepthPyramid"), 0);
+	glProgramUniform1i(mDepthPyramidProgram, glGetUniformLocation(mDepthPyramidProgram, "u_Source"), 0);
+
+	glGenBuffers(1, &mInstanceBuffer);
+	glGenBuffers(1, &mLodBuffer);
+	glGenBuffers(1, &mCommandBuffer);
+	glGenBuffers(1, &mCounterBuffer);
+}
+
+void GpuCulling::Destroy()
+{
+	glDeleteProgram(mCullProgram);
+	glDeleteProgram(mDepthPyramidProgram);
+	glDeleteBuffers(1, &mInstanceBuffer);
+	glDeleteBuffers(1, &mLodBuffer);
+	glDeleteBuffers(1, &mCommandBuffer);
+	glDeleteBuffers(1, &mCounterBuffer);
+	glDeleteTextures(1, &mDepthPyramid);
+	mCullProgram = mDepthPyramidProgram = 0;
+	mInstanceBuffer = mLodBuffer = mCommandBuffer = mCounterBuffer = 0;
+	mDepthPyramid = 0;
+	mCapacity = 0;
+}
+
+void GpuCulling::Clear()
+{
+	mInstances.clear();
+	mLods.clear();
+	mBatches.clear();
+	mInstancesDirty = true;
+}
+
+void GpuCulling::Add(const MeshBufferPool::DrawRange& range, const glm::vec4& boundingSphere, GLuint drawIndex,
+	const std::vector<MeshLod::Lod>& lods, GLuint program)
+{
+	GLuint batch = 0;
+	while (batch < mBatches.size() && (mBatches[batch].mVertexArray != range.mVertexArray || mBatches[batch].mProgram != program))
+	{
+		++batch;
+	}
+	if (batch == mBatches.size())
+	{
+		mBatches.emplace_back();
+		mBatches.back().mVertexArray = range.mVertexArray;
+		mBatches.back().mProgram = program;
+	}
+	++mBatches[batch].mSize;
+
+	Instance instance = {};
+	instance.mBoundingSphere = boundingSphere;
+	// The range holds every level, the first one is the full mesh.
+	instance.mCount = lods.empty() ? static_cast<GLuint>(range.mIndexCount) : lods[0].mIndexCount;
+	instance.mFirstIndex = range.mFirstIndex + (lods.empty() ? 0 : lods[0].mFirstIndex);
+	instance.mBaseVertex = range.mBaseVertex;
+	instance.mBaseInstance = drawIndex;
+	instance.mBatch = batch;
+	instance.mFirstLod = static_cast<GLuint>(mLods.size());
+	instance.mLodCount = static_cast<GLuint>(lods.size());
+	for (const MeshLod::Lod& lod : lods)
+	{
+		mLods.push_back({ lod.mIndexCount, range.mFirstIndex + lod.mFirstIndex, lod.mError, 0 });
+	}
+	mInstances.push_back(instance);
+	mInstancesDirty = true;
+}
+
+void GpuCulling::SetLodSelection(float viewportHeight, float pixelThreshold)
+{
+	mViewportHeight = viewportHeight;
+	mLodThreshold = pixelThreshold;
+}
+
+void GpuCulling::Upload()
+{
+	// Every batch gets room for all of its draws in the command buffer.
+	GLuint offset = 0;
+	for (Batch& batch : mBatches)
+	{
+		batch.mOffset = offset;
+		offset += batch.mSize;
+	}
+	for (Instance& instance : mInstances)
+	{
+		instance.mBatchOffset = mBatches[instance.mBatch].mOffset;
+	}
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mInstanceBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, mInstances.size() * sizeof(Instance), mInstances.data(), GL_STATIC_DRAW);
+	// Never empty, so there's always something to bind.
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mLodBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, std::max<std::size_t>(mLods.size(), 1) * sizeof(Lod), mLods.empty() ? nullptr : mLods.data(), GL_STATIC_DRAW);
+
+	const GLsizeiptr capacity = static_cast<GLsizeiptr>(mInstances.size());
+	if (capacity > mCapacity)
+	{
+		mCapacity = capacity;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, mCommandBuffer);
+		glBufferData(GL_COPY_WRITE_BUFFER, mCapacity * sizeof(DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_COPY);
+		// At most one batch per draw.
+		glBindBuffer(GL_COPY_WRITE_BUFFER, mCounterBuffer);
+		glBufferData(GL_COPY_WRITE_BUFFER, mCapacity * sizeof(GLuint), nullptr, GL_DYNAMIC_COPY);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	mInstancesDirty = false;
+}
+
+void GpuCulling::BuildDepthPyramid(GLuint depthTexture, int width, int height)
+{
+	if (mDepthPyramid == 0 || width != mDepthPyramidWidth || height != mDepthPyramidHeight)
+	{
+		glDeleteTextures(1, &mDepthPyramid);
+		mDepthPyramidWidth = width;
+		mDepthPyramidHeight = height;
+		mDepthPyramidLevels = 1;
+		while ((std::max(width, height) >> mDepthPyramidLevels) > 0)
+		{
+			++mDepthPyramidLevels;
+		}
+
+		glGenTextures(1, &mDepthPyramid);
+		glBindTexture(GL_TEXTURE_2D, mDepthPyramid);
+		for (int level = 0; level < mDepthPyramidLevels; ++level)
+		{
+			glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, std::max(width >> level, 1), std::max(height >> level, 1), 0, GL_RED, GL_FLOAT, nullptr);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mDepthPyramidLevels - 1);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+
+	// Level 0 is a copy of the depth buffer, every level after that is the
+	// max of the 2x2 (or 3x3, at odd edges) texels above it.
+	glUseProgram(mDepthPyramidProgram);
+	const GLint sourceLevelLocation = glGetUniformLocation(mDepthPyramidProgram, "u_SourceLevel");
+	glActiveTexture(GL_TEXTURE0);
+	for (int level = 0; level < mDepthPyramidLevels; ++level)
+	{
+		glBindTexture(GL_TEXTURE_2D, level == 0 ? depthTexture : mDepthPyramid);
+		glUniform1i(sourceLevelLocation, level == 0 ? 0 : level - 1);
+		glBindImageTexture(0, mDepthPyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+		glDispatchCompute(
+			(std::max(width >> level, 1) + 7) / 8,
+			(std::max(height >> level, 1) + 7) / 8,
+			1
+		);
+		glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+}
+
+void GpuCulling::Cull(GLuint perObjectBuffer, GLintptr offset, GLsizeiptr stride, GLsizeiptr objectCount)
+{
+	mPerObjectBuffer = perObjectBuffer;
+	mPerObjectOffset = offset;
+	mPerObjectStride = stride;
+	if (mInstances.empty())
+	{
+		return;
+	}
+	if (mInstancesDirty)
+	{
+		Upload();
+	}
+
+	// A null clear value means zero.
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mCounterBuffer);
+	glClearBufferSubData(GL_COPY_WRITE_BUFFER, GL_R32UI, 0, mBatches.size() * sizeof(GLuint), GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+	if (!GLAD_GL_ARB_indirect_parameters)
+	{
+		// Without a draw count from the GPU we draw every slot, and the ones
+		// nothing was written to must draw nothing.
+		glBindBuffer(GL_COPY_WRITE_BUFFER, mCommandBuffer);
+		glClearBufferSubData(GL_COPY_WRITE_BUFFER, GL_R32UI, 0, mInstances.size() * sizeof(DrawElementsIndirectCommand), GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	const bool useOcclusion = mOcclusionEnabled && mDepthPyramid != 0;
+	mUsedOcclusion = useOcclusion;
+	glUseProgram(mCullProgram);
+	glUniform1ui(glGetUniformLocation(mCullProgram, "u_InstanceCount"), static_cast<GLuint>(mInstances.size()));
+	glUniform1ui(glGetUniformLocation(mCullProgram, "u_PerObjectStride"), static_cast<GLuint>(stride / sizeof(glm::vec4)));
+	glUniform1i(glGetUniformLocation(mCullProgram, "u_UseOcclusion"), useOcclusion);
+	glUniform1i(glGetUniformLocation(mCullProgram, "u_DepthPyramidLevels"), mDepthPyramidLevels);
+	glUniform1f(glGetUniformLocation(mCullProgram, "u_LodHalfViewportHeight"), mViewportHeight * 0.5f);
+	glUniform1f(glGetUniformLocation(mCullProgram, "u_LodThreshold"), mLodThreshold);
+	if (useOcclusion)
+	{
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, mDepthPyramid);
+	}
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mInstanceBuffer);
+	glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 1, perObjectBuffer, offset, stride * objectCount);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mCommandBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mCounterBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, mLodBuffer);
+
+	glDispatchCompute(static_cast<GLuint>((mInstances.size() + 63) / 64), 1, 1);
+
+	// The draws read the commands (and counts) as indirect arguments.
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+
+	for (GLuint binding = 0; binding < 5; ++binding)
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+}
+
+void GpuCulling::Submit(GLuint instanceLocation, GLuint instanceVectors, GLenum mode) const
+{
+	if (mInstances.empty())
+	{
+		return;
+	}
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+	if (GLAD_GL_ARB_indirect_parameters)
+	{
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, mCounterBuffer);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, mPerObjectBuffer);
+
+	for (std::size_t i = 0; i < mBatches.size(); ++i)
+	{
+		const Batch& batch = mBatches[i];
+		if (batch.mProgram != 0)
+		{
+			glUseProgram(batch.mProgram);
+		}
+		glBindVertexArray(batch.mVertexArray);
+		IndirectDrawList::PointInstanceMatrices(instanceLocation, instanceVectors, mPerObjectOffset, static_cast<GLsizei>(mPerObjectStride));
+
+		const void* commands = reinterpret_cast<const void*>(batch.mOffset * sizeof(DrawElementsIndirectCommand));
+		if (GLAD_GL_ARB_indirect_parameters)
+		{
+			glMultiDrawElementsIndirectCountARB(mode, GL_UNSIGNED_INT, commands, static_cast<GLintptr>(i * sizeof(GLuint)), batch.mSize, 0);
+		}
+		else
+		{
+			glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT, commands, batch.mSize, 0);
+		}
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	if (GLAD_GL_ARB_indirect_parameters)
+	{
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0);
+	}
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void GpuCulling::Validate(const std::vector<glm::mat4>& modelViewProjections, Validation* validation) const
+{
+	if (mInstances.empty() || mInstancesDirty)
+	{
+		return;
+	}
+
+	// The compute shaders wrote these through storage buffers and images.
+	glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+	std::vector<GLuint> counts(mBatches.size());
+	glBindBuffer(GL_COPY_READ_BUFFER, mCounterBuffer);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, counts.size() * sizeof(GLuint), counts.data());
+	std::vector<DrawElementsIndirectCommand> commands(mInstances.size());
+	glBindBuffer(GL_COPY_READ_BUFFER, mCommandBuffer);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data());
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+	std::vector<PyramidLevel> pyramid;
+	if (mUsedOcclusion)
+	{
+		pyramid.resize(mDepthPyramidLevels);
+		glBindTexture(GL_TEXTURE_2D, mDepthPyramid);
+		for (int level = 0; level < mDepthPyramidLevels; ++level)
+		{
+			pyramid[level].mWidth = std::max(mDepthPyramidWidth >> level, 1);
+			pyramid[level].mHeight = std::max(mDepthPyramidHeight >> level, 1);
+			pyramid[level].mDepths.resize(static_cast<std::size_t>(pyramid[level].mWidth) * pyramid[level].mHeight);
+			glGetTexImage(GL_TEXTURE_2D, level, GL_RED, GL_FLOAT, pyramid[level].mDepths.data());
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	// Which command, if any, the GPU wrote for each draw. Every draw has
+	// an object of its own, so baseInstance tells them apart.
+	std::unordered_map<GLuint, std::size_t> drawsByObject;
+	for (std::size_t i = 0; i < mInstances.size(); ++i)
+	{
+		drawsByObject[mInstances[i].mBaseInstance] = i;
+	}
+	std::vector<const DrawElementsIndirectCommand*> written(mInstances.size(), nullptr);
+	for (std::size_t batch = 0; batch < mBatches.size(); ++batch)
+	{
+		// More than the batch has room for would be a mismatch of its own.
+		const GLuint count = std::min(counts[batch], mBatches[batch].mSize);
+		validation->mMismatches += counts[batch] - count;
+		for (GLuint slot = 0; slot < count; ++slot)
+		{
+			const DrawElementsIndirectCommand& command = commands[mBatches[batch].mOffset + slot];
+			const auto draw = drawsByObject.find(command.mBaseInstance);
+			if (draw == drawsByObject.end() || mInstances[draw->second].mBatch != batch || written[draw->second] != nullptr)
+			{
+				++validation->mMismatches;
+				continue;
+			}
+			written[draw->second] = &command;
+		}
+	}
+
+	++validation->mCulls;
+	for (std::size_t i = 0; i < mInstances.size(); ++i)
+	{
+		const Instance& instance = mInstances[i];
+		const DrawElementsIndirectCommand* command = written[i];
+		++validation->mDraws;
+		validation->mVisible += command != nullptr ? 1 : 0;
+		if (instance.mBaseInstance >= modelViewProjections.size())
+		{
+			++validation->mMismatches;
+			continue;
+		}
+		const glm::mat4& mvp = modelViewProjections[instance.mBaseInstance];
+
+		const Outcome inside = ReferenceInsideFrustum(mvp, instance.mBoundingSphere);
+		const Outcome occluded = (inside != Outcome::No && mUsedOcclusion)
+			? ReferenceOccluded(mvp, instance.mBoundingSphere, pyramid)
+			: Outcome::No;
+		if (inside == Outcome::Either || occluded == Outcome::Either)
+		{
+			++validation->mBorderline;
+			continue;
+		}
+		const bool visible = inside == Outcome::Yes && occluded == Outcome::No;
+		validation->mReferenceVisible += visible ? 1 : 0;
+		validation->mOccluded += (inside == Outcome::Yes && occluded == Outcome::Yes) ? 1 : 0;
+		if (visible != (command != nullptr))
+		{
+			++validation->mMismatches;
+			continue;
+		}
+		if (!visible)
+		{
+			continue;
+		}
+
+		GLuint count = instance.mCount;
+		GLuint firstIndex = instance.mFirstIndex;
+		if (instance.mLodCount > 1)
+		{
+			std::vector<float> errors(instance.mLodCount);
+			for (GLuint lod = 0; lod < instance.mLodCount; ++lod)
+			{
+				errors[lod] = mLods[instance.mFirstLod + lod].mError;
+			}
+			bool borderline = false;
+			const GLuint lod = ReferenceSelectLod(mvp, instance.mBoundingSphere, errors, mViewportHeight * 0.5f, mLodThreshold, &borderline);
+			if (borderline)
+			{
+				++validation->mBorderline;
+				continue;
+			}
+			count = mLods[instance.mFirstLod + lod].mCount;
+			firstIndex = mLods[instance.mFirstLod + lod].mFirstIndex;
+		}
+		if (command->mCount != count || command->mFirstIndex != firstIndex || command->mBaseVertex != instance.mBaseVertex || command->mInstanceCount != 1)
+		{
+			++validation->mMismatches;
+		}
+	}
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "MeshBufferPool.hpp"
+#include "MeshLod.hpp"
+
+/// <summary>
+/// Frustum and occlusion culling on the GPU.
+///
+/// The draws to consider are registered once (Add()) and kept in a GPU
+/// buffer. Every frame a compute shader tests each one's bounding sphere
+/// against that frame's matrices and appends the survivors, per vertex
+/// array and program, to an indirect command buffer with an atomic
+/// counter. Submit() then draws them with glMultiDrawElementsIndirect, so
+/// visibility never comes back to the CPU.
+///
+/// Draws are laid out like IndirectDrawList's: baseInstance is the index of
+/// the object's per-object block, which the vertex shader reads as an
+/// instanced mat4.
+///
+/// With a max-depth pyramid of the previous frame (BuildDepthPyramid())
+/// draws hidden behind what was in front last frame are culled as well.
+/// That's a frame late: something that comes out from behind an occluder
+/// shows up a frame after it should.
+///
+/// Draws registered with levels of detail get the coarsest one whose error
+/// stays under SetLodSelection()'s threshold on screen, as MeshLod::Select()
+/// would pick on the CPU.
+///
+/// Needs GL 4.3 (compute shaders, storage buffers, multi-draw indirect),
+/// checked through the ARB extensions as our glad stops at 4.1; the
+/// shaders are GLSL 4.10 with the same extensions enabled. With
+/// ARB_indirect_parameters the draw count comes straight from the counter,
+/// otherwise the command buffer is cleared and culled slots draw nothing.
+/// </summary>
+class GpuCulling {
+public:
+	static bool IsSupported();
+
+	/// <summary>
+	/// Takes the linked compute programs built from cull_comp.glsl and
+	/// depth_pyramid_comp.glsl. They're deleted by Destroy().
+	/// </summary>
+	void Create(GLuint cullProgram, GLuint depthPyramidProgram);
+	void Destroy();
+	bool IsCreated() const { return mCullProgram != 0; }
+
+	void Clear();
+	/// <summary>
+	/// Registers a draw. 'boundingSphere' is in model space (center, radius)
+	/// and 'drawIndex' is the object's per-object block, as in IndirectDrawList.
+	/// 'lods' index from the start of 'range'; without them the whole range is drawn.
+	/// Draws with a 'program' are drawn with it, as in IndirectDrawList::Add().
+	/// </summary>
+	void Add(const MeshBufferPool::DrawRange& range, const glm::vec4& boundingSphere, GLuint drawIndex,
+		const std::vector<MeshLod::Lod>& lods = std::vector<MeshLod::Lod>(), GLuint program = 0);
+
+	/// <summary>
+	/// For picking levels of detail: the viewport's height, and how many
+	/// pixels of error are acceptable. A threshold of 0 always draws the full mesh.
+	/// </summary>
+	void SetLodSelection(float viewportHeight, float pixelThreshold);
+
+	/// <summary>
+	/// Builds the max-depth pyramid from 'depthTexture' for the next Cull().
+	/// Occlusion culling stays off until this is called, and until it's
+	/// enabled again after SetOcclusionEnabled(false), so a pyramid of some
+	/// other view (or of nothing) is never tested against.
+	/// </summary>
+	void BuildDepthPyramid(GLuint depthTexture, int width, int height);
+	void SetOcclusionEnabled(bool enabled) { mOcclusionEnabled = enabled; }
+
+	/// <summary>
+	/// Culls every registered draw against the per-object blocks, which
+	/// start at 'offset' in 'perObjectBuffer' and are 'stride' bytes apart.
+	/// The offset has to be GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT aligned.
+	/// </summary>
+	void Cull(GLuint perObjectBuffer, GLintptr offset, GLsizeiptr stride, GLsizeiptr objectCount);
+
+	/// <summary>
+	/// Draws what survived the last Cull(), with the instanced mat4 at
+	/// 'instanceLocation' reading the same per-object blocks (see
+	/// IndirectDrawList::PointInstanceMatrices() for 'instanceVectors').
+	/// Leaves the last batch's program in use.
+	/// </summary>
+	void Submit(GLuint instanceLocation, GLuint instanceVectors, GLenum mode = GL_TRIANGLES) const;
+
+	std::size_t GetDrawCount() const { return mInstances.size(); }
+
+	/// <summary>
+	/// What Validate() found, summed over every call.
+	/// </summary>
+	struct Validation {
+		std::uint64_t	mCulls				= 0;
+		std::uint64_t	mDraws				= 0;
+		std::uint64_t	mVisible			= 0;	// on the GPU
+		std::uint64_t	mReferenceVisible	= 0;	// on the CPU
+		std::uint64_t	mOccluded			= 0;	// on the CPU, inside the frustum
+		std::uint64_t	mMismatches			= 0;
+		// Draws too close to a plane, a depth or a level's threshold for
+		// float rounding to decide them the same way on both sides.
+		std::uint64_t	mBorderline			= 0;
+	};
+
+	/// <summary>
+	/// Reads back the commands the last Cull() wrote, and the depth pyramid
+	/// it tested against, and runs the same frustum, occlusion and level of
+	/// detail tests on the CPU with 'modelViewProjections' (indexed like the
+	/// per-object blocks). Counts every draw the two disagree on into
+	/// 'validation'. Waits for the GPU, so it's for --validate-culling only.
+	/// </summary>
+	void Validate(const std::vector<glm::mat4>& modelViewProjections, Validation* validation) const;
+
+private:
+	// Mirrors CullingInstance in cull_comp.glsl (std430).
+	struct Instance {
+		glm::vec4		mBoundingSphere;
+		GLuint			mCount;
+		GLuint			mFirstIndex;
+		GLint			mBaseVertex;
+		GLuint			mBaseInstance;
+		GLuint			mBatch;
+		GLuint			mBatchOffset;
+		GLuint			mFirstLod;
+		GLuint			mLodCount;
+	};
+
+	// Mirrors CullingLod in cull_comp.glsl (std430).
+	struct Lod {
+		GLuint			mCount;
+		GLuint			mFirstIndex;
+		float			mError;
+		GLuint			mPad;
+	};
+
+	struct Batch {
+		GLuint			mVertexArray	= 0;
+		GLuint			mProgram		= 0;
+		GLuint			mSize			= 0;
+		GLuint			mOffset			= 0;
+	};
+
+	void Upload();
+
+	GLuint					mCullProgram			= 0;
+	GLuint					mDepthPyramidProgram	= 0;
+
+	std::vector<Instance>	mInstances;
+	std::vector<Lod>		mLods;
+	std::vector<Batch>		mBatches;
+	bool					mInstancesDirty			= false;
+
+	GLuint					mInstanceBuffer			= 0;
+	GLuint					mLodBuffer				= 0;
+	GLuint					mCommandBuffer			= 0;
+	GLuint					mCounterBuffer			= 0;
+	GLsizeiptr				mCapacity				= 0;
+
+	GLuint					mDepthPyramid			= 0;
+	int						mDepthPyramidWidth		= 0;
+	int						mDepthPyramidHeight		= 0;
+	int						mDepthPyramidLevels		= 0;
+	bool					mOcclusionEnabled		= true;
+	bool					mUsedOcclusion			= false;	// by the last Cull()
+
+	float					mViewportHeight			= 0.0f;
+	float					mLodThreshold			= 0.0f;
+
+	// What the last Cull() read from, for Submit().
+	GLuint					mPerObjectBuffer		= 0;
+	GLintptr				mPerObjectOffset		= 0;
+	GLsizeiptr				mPerObjectStride		= 0;
+};
@@ -0,0 +1,66 @@
+#include "GpuTimer.hpp"
+
+void GpuTimer::Destroy()
+{
+	if (!mPendingQueries.empty())
+	{
+		glDeleteQueries(static_cast<GLsizei>(mPendingQueries.size()), mPendingQueries.data());
+	}
+	if (!mFreeQueries.empty())
+	{
+		glDeleteQueries(static_cast<GLsizei>(mFreeQueries.size()), mFreeQueries.data());
+	}
+	mPendingQueries.clear();
+	mFreeQueries.clear();
+}
+
+void GpuTimer::Begin()
+{
+	Collect(false);
+	GLuint query = 0;
+	if (mFreeQueries.empty())
+	{
+		glGenQueries(1, &query);
+	}
+	else
+	{
+		query = mFreeQueries.back();
+		mFreeQueries.pop_back();
+	}
+	mPendingQueries.push_back(query);
+	glBeginQuery(GL_TIME_ELAPSED, query);
+}
+
+void GpuTimer::End()
+{
+	glEndQuery(GL_TIME_ELAPSED);
+}
+
+double GpuTimer::GetAverageMilliseconds()
+{
+	Collect(true);
+	return mTimedCount > 0 ? mMilliseconds / mTimedCount : 0.0;
+}
+
+void GpuTimer::Collect(bool wait)
+{
+	while (!mPendingQueries.empty())
+	{
+		const GLuint query = mPendingQueries.front();
+		if (!wait)
+		{
+			GLint available = 0;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+			{
+				break;
+			}
+		}
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+		mMilliseconds += nanoseconds / 1000000.0;
+		++mTimedCount;
+		mPendingQueries.erase(mPendingQueries.begin());
+		mFreeQueries.push_back(query);
+	}
+}
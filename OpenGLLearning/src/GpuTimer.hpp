@@ -0,0 +1,43 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Times a span of GPU work, as often as it comes up, with GL_TIME_ELAPSED
+/// queries between Begin() and End().
+///
+/// The results are read only once the GPU has them, at the next Begin(),
+/// so timing never stalls a frame. Queries are reused once read, so there
+/// are only ever as many as there are spans in flight.
+/// </summary>
+class GpuTimer {
+public:
+	/// <summary>
+	/// Deletes the queries, and forgets the spans not read yet.
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// Spans don't nest, with each other or any other GL_TIME_ELAPSED query.
+	/// </summary>
+	void Begin();
+	void End();
+
+	/// <summary>
+	/// The average GPU time of a span, in milliseconds. Waits for the ones
+	/// still outstanding.
+	/// </summary>
+	double GetAverageMilliseconds();
+
+private:
+	// Reads the finished queries; all of them if 'wait'.
+	void Collect(bool wait);
+
+	double					mMilliseconds	= 0.0;
+	std::uint64_t			mTimedCount		= 0;
+	// Queries not read yet, oldest first, and ones to reuse.
+	std::vector<GLuint>		mPendingQueries;
+	std::vector<GLuint>		mFreeQueries;
+};
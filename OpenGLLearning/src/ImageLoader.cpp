@@ -0,0 +1,730 @@
+#include "ImageLoader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+	std::uint32_t Read16(const std::uint8_t* p) { return p[0] | (p[1] << 8); }
+	std::uint32_t Read32(const std::uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<std::uint32_t>(p[3]) << 24); }
+	std::uint64_t Read64(const std::uint8_t* p) { return Read32(p) | (static_cast<std::uint64_t>(Read32(p + 4)) << 32); }
+	std::uint32_t Read32BigEndian(const std::uint8_t* p) { return (static_cast<std::uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+	bool Fail(std::string* error, const char* reason)
+	{
+		*error = reason;
+		return false;
+	}
+
+	/// <summary>
+	/// Turns top to bottom rows into bottom to top ones, or back.
+	/// </summary>
+	void FlipRows(ImageLoader::Level* level)
+	{
+		const std::size_t stride = static_cast<std::size_t>(level->mWidth) * 4;
+		for (std::uint32_t y = 0; y < level->mHeight / 2; ++y)
+		{
+			std::swap_ranges(
+				level->mPixels.begin() + y * stride,
+				level->mPixels.begin() + (y + 1) * stride,
+				level->mPixels.begin() + (level->mHeight - 1 - y) * stride);
+		}
+	}
+
+	//--------------------------- TGA --------------------------------
+
+	bool DecodeTga(const std::uint8_t* data, std::size_t size, ImageLoader::Image* image, std::string* error)
+	{
+		if (size < 18)
+		{
+			return Fail(error, "TGA header cut short");
+		}
+		const std::uint32_t idLength = data[0];
+		const std::uint32_t colorMapType = data[1];
+		const std::uint32_t imageType = data[2];
+		const std::uint32_t colorMapLength = Read16(data + 5);
+		const std::uint32_t colorMapEntryBits = data[7];
+		const std::uint32_t width = Read16(data + 12);
+		const std::uint32_t height = Read16(data + 14);
+		const std::uint32_t bitsPerPixel = data[16];
+		const bool topToBottom = (data[17] & 0x20) != 0;
+
+		const bool rle = imageType == 10 || imageType == 11;
+		const bool gray = imageType == 3 || imageType == 11;
+		if (imageType != 2 && imageType != 3 && !rle)
+		{
+			return Fail(error, "TGA: only true color and grayscale images are supported");
+		}
+		const std::uint32_t bytesPerPixel = bitsPerPixel / 8;
+		if (gray ? bitsPerPixel != 8 : (bitsPerPixel != 24 && bitsPerPixel != 32))
+		{
+			return Fail(error, "TGA: unsupported bits per pixel");
+		}
+		if (width == 0 || height == 0)
+		{
+			return Fail(error, "TGA: empty image");
+		}
+
+		std::size_t offset = 18 + idLength + (colorMapType == 1 ? colorMapLength * ((colorMapEntryBits + 7) / 8) : 0);
+		ImageLoader::Level level;
+		level.mWidth = width;
+		level.mHeight = height;
+		level.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+
+		// Pixels are BGR(A), or one gray byte.
+		auto convert = [&](const std::uint8_t* in, std::uint8_t* out) {
+			if (gray)
+			{
+				out[0] = out[1] = out[2] = in[0];
+				out[3] = 255;
+			}
+			else
+			{
+				out[0] = in[2];
+				out[1] = in[1];
+				out[2] = in[0];
+				out[3] = (bytesPerPixel == 4) ? in[3] : 255;
+			}
+		};
+
+		const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+		std::size_t pixel = 0;
+		while (pixel < pixelCount)
+		{
+			std::size_t run = 1;
+			bool repeat = false;
+			if (rle)
+			{
+				if (offset >= size)
+				{
+					return Fail(error, "TGA: pixel data cut short");
+				}
+				repeat = (data[offset] & 0x80) != 0;
+				run = (data[offset] & 0x7F) + 1u;
+				++offset;
+			}
+			else
+			{
+				run = pixelCount;
+			}
+			run = std::min(run, pixelCount - pixel);
+
+			const std::size_t bytes = repeat ? bytesPerPixel : run * bytesPerPixel;
+			if (offset + bytes > size)
+			{
+				return Fail(error, "TGA: pixel data cut short");
+			}
+			for (std::size_t i = 0; i < run; ++i)
+			{
+				convert(data + offset + (repeat ? 0 : i * bytesPerPixel), &level.mPixels[(pixel + i) * 4]);
+			}
+			offset += bytes;
+			pixel += run;
+		}
+
+		if (topToBottom)
+		{
+			FlipRows(&level);
+		}
+		image->mLevels.push_back(std::move(level));
+		return true;
+	}
+
+	//--------------------------- Inflate (RFC 1951) --------------------------------
+
+	/// <summary>
+	/// Reads deflate's bit stream, least significant bit first.
+	/// </summary>
+	struct BitReader {
+		const std::uint8_t*	mData		= nullptr;
+		std::size_t			mSize		= 0;
+		std::size_t			mPosition	= 0;
+		std::uint32_t		mBits		= 0;
+		int					mBitCount	= 0;
+		bool				mOverrun	= false;
+
+		std::uint32_t Read(int count)
+		{
+			while (mBitCount < count)
+			{
+				if (mPosition >= mSize)
+				{
+					mOverrun = true;
+					return 0;
+				}
+				mBits |= static_cast<std::uint32_t>(mData[mPosition++]) << mBitCount;
+				mBitCount += 8;
+			}
+			const std::uint32_t value = mBits & ((1u << count) - 1u);
+			mBits >>= count;
+			mBitCount -= count;
+			return value;
+		}
+	};
+
+	/// <summary>
+	/// A canonical Huffman code: how many codes have each length, and the
+	/// symbols ordered by code.
+	/// </summary>
+	struct Huffman {
+		std::uint16_t	mCounts[16];
+		std::uint16_t	mSymbols[288];
+
+		/// <summary>
+		/// False if the lengths ask for more codes than there are.
+		/// </summary>
+		bool Build(const std::uint8_t* lengths, int symbolCount)
+		{
+			std::memset(mCounts, 0, sizeof(mCounts));
+			for (int symbol = 0; symbol < symbolCount; ++symbol)
+			{
+				++mCounts[lengths[symbol]];
+			}
+			int left = 1;
+			for (int length = 1; length < 16; ++length)
+			{
+				left = (left << 1) - mCounts[length];
+				if (left < 0)
+				{
+					return false;
+				}
+			}
+			std::uint16_t offsets[16];
+			offsets[1] = 0;
+			for (int length = 1; length < 15; ++length)
+			{
+				offsets[length + 1] = offsets[length] + mCounts[length];
+			}
+			for (int symbol = 0; symbol < symbolCount; ++symbol)
+			{
+				if (lengths[symbol] != 0)
+				{
+					mSymbols[offsets[lengths[symbol]]++] = static_cast<std::uint16_t>(symbol);
+				}
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// The next symbol, or -1 if the bits don't make a code.
+		/// </summary>
+		int Decode(BitReader* reader) const
+		{
+			// Codes are stored most significant bit first, so one bit at a time.
+			int code = 0;
+			int first = 0;
+			int index = 0;
+			for (int length = 1; length < 16; ++length)
+			{
+				code |= static_cast<int>(reader->Read(1));
+				const int count = mCounts[length];
+				if (code - first < count)
+				{
+					return mSymbols[index + code - first];
+				}
+				index += count;
+				first = (first + count) << 1;
+				code <<= 1;
+			}
+			return -1;
+		}
+	};
+
+	bool InflateBlock(BitReader* reader, const Huffman& literals, const Huffman& distances, std::vector<std::uint8_t>* out)
+	{
+		static const std::uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		static const std::uint8_t lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+		static const std::uint16_t distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+		static const std::uint8_t distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		while (!reader->mOverrun)
+		{
+			const int symbol = literals.Decode(reader);
+			if (symbol < 0 || symbol > 285)
+			{
+				return false;
+			}
+			if (symbol < 256)
+			{
+				out->push_back(static_cast<std::uint8_t>(symbol));
+				continue;
+			}
+			if (symbol == 256)
+			{
+				return true;
+			}
+			const std::size_t length = lengthBase[symbol - 257] + reader->Read(lengthExtra[symbol - 257]);
+			const int distanceSymbol = distances.Decode(reader);
+			if (distanceSymbol < 0 || distanceSymbol > 29)
+			{
+				return false;
+			}
+			const std::size_t distance = distanceBase[distanceSymbol] + reader->Read(distanceExtra[distanceSymbol]);
+			if (distance > out->size())
+			{
+				return false;
+			}
+			// Byte by byte, the copy may overlap what it writes.
+			const std::size_t from = out->size() - distance;
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				out->push_back((*out)[from + i]);
+			}
+		}
+		return false;
+	}
+
+	bool Inflate(const std::uint8_t* data, std::size_t size, std::vector<std::uint8_t>* out)
+	{
+		BitReader reader;
+		reader.mData = data;
+		reader.mSize = size;
+
+		bool last = false;
+		while (!last)
+		{
+			last = reader.Read(1) != 0;
+			const std::uint32_t type = reader.Read(2);
+			if (type == 0)
+			{
+				// Stored: byte aligned, a length and its complement, then raw bytes.
+				reader.mBits = 0;
+				reader.mBitCount = 0;
+				if (reader.mPosition + 4 > size)
+				{
+					return false;
+				}
+				const std::uint32_t length = Read16(data + reader.mPosition);
+				if ((length ^ 0xFFFFu) != Read16(data + reader.mPosition + 2) || reader.mPosition + 4 + length > size)
+				{
+					return false;
+				}
+				out->insert(out->end(), data + reader.mPosition + 4, data + reader.mPosition + 4 + length);
+				reader.mPosition += 4 + length;
+				continue;
+			}
+
+			Huffman literals;
+			Huffman distances;
+			std::uint8_t lengths[288 + 32];
+			if (type == 1)
+			{
+				std::memset(lengths, 8, 144);
+				std::memset(lengths + 144, 9, 112);
+				std::memset(lengths + 256, 7, 24);
+				std::memset(lengths + 280, 8, 8);
+				literals.Build(lengths, 288);
+				std::memset(lengths, 5, 30);
+				distances.Build(lengths, 30);
+			}
+			else if (type == 2)
+			{
+				const int literalCount = static_cast<int>(reader.Read(5)) + 257;
+				const int distanceCount = static_cast<int>(reader.Read(5)) + 1;
+				const int codeLengthCount = static_cast<int>(reader.Read(4)) + 4;
+				static const std::uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+				std::uint8_t codeLengths[19] = {};
+				for (int i = 0; i < codeLengthCount; ++i)
+				{
+					codeLengths[order[i]] = static_cast<std::uint8_t>(reader.Read(3));
+				}
+				Huffman codeLengthCode;
+				if (literalCount > 286 || distanceCount > 30 || !codeLengthCode.Build(codeLengths, 19))
+				{
+					return false;
+				}
+
+				int count = 0;
+				while (count < literalCount + distanceCount)
+				{
+					const int symbol = codeLengthCode.Decode(&reader);
+					if (symbol < 0 || reader.mOverrun)
+					{
+						return false;
+					}
+					if (symbol < 16)
+					{
+						lengths[count++] = static_cast<std::uint8_t>(symbol);
+						continue;
+					}
+					std::uint8_t value = 0;
+					int repeat = 0;
+					if (symbol == 16)
+					{
+						if (count == 0)
+						{
+							return false;
+						}
+						value = lengths[count - 1];
+						repeat = 3 + static_cast<int>(reader.Read(2));
+					}
+					else if (symbol == 17)
+					{
+						repeat = 3 + static_cast<int>(reader.Read(3));
+					}
+					else
+					{
+						repeat = 11 + static_cast<int>(reader.Read(7));
+					}
+					if (count + repeat > literalCount + distanceCount)
+					{
+						return false;
+					}
+					std::memset(lengths + count, value, repeat);
+					count += repeat;
+				}
+				if (lengths[256] == 0 || !literals.Build(lengths, literalCount) || !distances.Build(lengths + literalCount, distanceCount))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				return false;
+			}
+
+			if (!InflateBlock(&reader, literals, distances, out))
+			{
+				return false;
+			}
+		}
+		return !reader.mOverrun;
+	}
+
+	//--------------------------- PNG --------------------------------
+
+	bool DecodePng(const std::uint8_t* data, std::size_t size, ImageLoader::Image* image, std::string* error)
+	{
+		std::uint32_t width = 0;
+		std::uint32_t height = 0;
+		std::uint32_t bitDepth = 0;
+		std::uint32_t colorType = 0;
+		std::uint32_t interlace = 0;
+		std::vector<std::uint8_t> palette;
+		std::vector<std::uint8_t> transparency;
+		std::vector<std::uint8_t> compressed;
+
+		std::size_t offset = 8;
+		bool ended = false;
+		while (!ended && offset + 12 <= size)
+		{
+			const std::uint32_t length = Read32BigEndian(data + offset);
+			const std::uint8_t* type = data + offset + 4;
+			const std::uint8_t* chunk = data + offset + 8;
+			if (length > size - offset - 12)
+			{
+				return Fail(error, "PNG: chunk cut short");
+			}
+			if (std::memcmp(type, "IHDR", 4) == 0 && length >= 13)
+			{
+				width = Read32BigEndian(chunk);
+				height = Read32BigEndian(chunk + 4);
+				bitDepth = chunk[8];
+				colorType = chunk[9];
+				interlace = chunk[12];
+			}
+			else if (std::memcmp(type, "PLTE", 4) == 0)
+			{
+				palette.assign(chunk, chunk + length);
+			}
+			else if (std::memcmp(type, "tRNS", 4) == 0)
+			{
+				transparency.assign(chunk, chunk + length);
+			}
+			else if (std::memcmp(type, "IDAT", 4) == 0)
+			{
+				compressed.insert(compressed.end(), chunk, chunk + length);
+			}
+			else if (std::memcmp(type, "IEND", 4) == 0)
+			{
+				ended = true;
+			}
+			offset += 12 + length;
+		}
+
+		static const std::uint32_t channelsOf[7] = { 1, 0, 3, 1, 2, 0, 4 };
+		if (width == 0 || height == 0 || colorType > 6 || channelsOf[colorType] == 0)
+		{
+			return Fail(error, "PNG: missing or bad header");
+		}
+		if (interlace != 0)
+		{
+			return Fail(error, "PNG: interlaced images aren't supported");
+		}
+		const bool subByte = bitDepth == 1 || bitDepth == 2 || bitDepth == 4;
+		if (!(bitDepth == 8 || bitDepth == 16 || (subByte && (colorType == 0 || colorType == 3))))
+		{
+			return Fail(error, "PNG: unsupported bit depth");
+		}
+		if (colorType == 3 && palette.empty())
+		{
+			return Fail(error, "PNG: palette missing");
+		}
+
+		// zlib: two header bytes, deflate data, and a checksum we don't check.
+		std::vector<std::uint8_t> filtered;
+		if (compressed.size() < 6 || (compressed[0] & 0x0F) != 8 || (compressed[1] & 0x20) != 0
+			|| !Inflate(compressed.data() + 2, compressed.size() - 2, &filtered))
+		{
+			return Fail(error, "PNG: bad compressed data");
+		}
+
+		const std::uint32_t channels = channelsOf[colorType];
+		const std::size_t stride = (static_cast<std::size_t>(width) * channels * bitDepth + 7) / 8;
+		const std::size_t filterStep = std::max<std::size_t>(1, channels * bitDepth / 8);
+		if (filtered.size() < (stride + 1) * height)
+		{
+			return Fail(error, "PNG: image data cut short");
+		}
+
+		// Undo the per-row filters in place; each row starts with its filter type.
+		std::vector<std::uint8_t> zeroRow(stride, 0);
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			std::uint8_t* row = &filtered[y * (stride + 1) + 1];
+			const std::uint8_t* above = (y > 0) ? row - (stride + 1) : zeroRow.data();
+			const std::uint8_t filter = row[-1];
+			for (std::size_t x = 0; x < stride; ++x)
+			{
+				const int a = (x >= filterStep) ? row[x - filterStep] : 0;
+				const int b = above[x];
+				const int c = (x >= filterStep) ? above[x - filterStep] : 0;
+				int predictor = 0;
+				switch (filter)
+				{
+				case 0: predictor = 0; break;
+				case 1: predictor = a; break;
+				case 2: predictor = b; break;
+				case 3: predictor = (a + b) / 2; break;
+				case 4:
+				{
+					const int p = a + b - c;
+					const int pa = std::abs(p - a);
+					const int pb = std::abs(p - b);
+					const int pc = std::abs(p - c);
+					predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+					break;
+				}
+				default:
+					return Fail(error, "PNG: bad filter type");
+				}
+				row[x] = static_cast<std::uint8_t>(row[x] + predictor);
+			}
+		}
+
+		ImageLoader::Level level;
+		level.mWidth = width;
+		level.mHeight = height;
+		level.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+		const std::uint32_t maxValue = (1u << std::min(bitDepth, 8u)) - 1u;
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			const std::uint8_t* row = &filtered[y * (stride + 1) + 1];
+			// PNG rows go top to bottom.
+			std::uint8_t* out = &level.mPixels[static_cast<std::size_t>(height - 1 - y) * width * 4];
+			for (std::uint32_t x = 0; x < width; ++x, out += 4)
+			{
+				// Sample 'channel' of this pixel at its full precision, and its high 8 bits.
+				auto raw = [&](std::uint32_t channel) -> std::uint32_t {
+					if (subByte)
+					{
+						const std::size_t bit = static_cast<std::size_t>(x) * bitDepth;
+						return (row[bit / 8] >> (8 - bitDepth - bit % 8)) & maxValue;
+					}
+					const std::size_t index = (static_cast<std::size_t>(x) * channels + channel) * (bitDepth / 8);
+					return bitDepth == 16 ? (row[index] << 8) | row[index + 1] : row[index];
+				};
+				auto sample = [&](std::uint32_t channel) -> std::uint8_t {
+					const std::uint32_t value = raw(channel);
+					return static_cast<std::uint8_t>(bitDepth == 16 ? value >> 8 : value * 255 / maxValue);
+				};
+
+				switch (colorType)
+				{
+				case 0:
+					out[0] = out[1] = out[2] = sample(0);
+					out[3] = (transparency.size() >= 2 && raw(0) == static_cast<std::uint32_t>((transparency[0] << 8) | transparency[1])) ? 0 : 255;
+					break;
+				case 2:
+					out[0] = sample(0);
+					out[1] = sample(1);
+					out[2] = sample(2);
+					out[3] = (transparency.size() >= 6 && raw(0) == static_cast<std::uint32_t>((transparency[0] << 8) | transparency[1])
+						&& raw(1) == static_cast<std::uint32_t>((transparency[2] << 8) | transparency[3])
+						&& raw(2) == static_cast<std::uint32_t>((transparency[4] << 8) | transparency[5])) ? 0 : 255;
+					break;
+				case 3:
+				{
+					const std::uint32_t index = raw(0);
+					if (index * 3 + 2 >= palette.size())
+					{
+						return Fail(error, "PNG: palette index out of range");
+					}
+					out[0] = palette[index * 3];
+					out[1] = palette[index * 3 + 1];
+					out[2] = palette[index * 3 + 2];
+					out[3] = (index < transparency.size()) ? transparency[index] : 255;
+					break;
+				}
+				case 4:
+					out[0] = out[1] = out[2] = sample(0);
+					out[3] = sample(1);
+					break;
+				case 6:
+					out[0] = sample(0);
+					out[1] = sample(1);
+					out[2] = sample(2);
+					out[3] = sample(3);
+					break;
+				}
+			}
+		}
+		image->mLevels.push_back(std::move(level));
+		return true;
+	}
+
+	//--------------------------- KTX2 --------------------------------
+
+	bool DecodeKtx2(const std::uint8_t* data, std::size_t size, ImageLoader::Image* image, std::string* error)
+	{
+		if (size < 80)
+		{
+			return Fail(error, "KTX2: header cut short");
+		}
+		const std::uint32_t format = Read32(data + 12);
+		const std::uint32_t width = Read32(data + 20);
+		const std::uint32_t height = Read32(data + 24);
+		const std::uint32_t depth = Read32(data + 28);
+		const std::uint32_t layers = Read32(data + 32);
+		const std::uint32_t faces = Read32(data + 36);
+		const std::uint32_t levelCount = std::max(1u, Read32(data + 40));
+		const std::uint32_t supercompression = Read32(data + 44);
+		const std::uint32_t keyValueOffset = Read32(data + 56);
+		const std::uint32_t keyValueLength = Read32(data + 60);
+
+		// VK_FORMAT_R8G8B8_UNORM/SRGB and VK_FORMAT_R8G8B8A8_UNORM/SRGB.
+		std::uint32_t channels = 0;
+		if (format == 23 || format == 29)
+		{
+			channels = 3;
+		}
+		else if (format == 37 || format == 43)
+		{
+			channels = 4;
+		}
+		if (channels == 0)
+		{
+			return Fail(error, "KTX2: only uncompressed 8 bit RGB(A) formats are supported");
+		}
+		if (width == 0 || height == 0 || depth > 1 || layers > 1 || faces != 1)
+		{
+			return Fail(error, "KTX2: only plain 2D textures are supported");
+		}
+		if (supercompression != 0)
+		{
+			return Fail(error, "KTX2: supercompressed files aren't supported");
+		}
+		if (80 + static_cast<std::size_t>(levelCount) * 24 > size || levelCount > 32)
+		{
+			return Fail(error, "KTX2: level index cut short");
+		}
+
+		// Rows go top to bottom unless KTXorientation says they go up.
+		bool bottomToTop = false;
+		if (static_cast<std::size_t>(keyValueOffset) + keyValueLength <= size)
+		{
+			std::size_t offset = keyValueOffset;
+			while (offset + 4 <= static_cast<std::size_t>(keyValueOffset) + keyValueLength)
+			{
+				const std::uint32_t length = Read32(data + offset);
+				const char* entry = reinterpret_cast<const char*>(data + offset + 4);
+				if (offset + 4 + length > size)
+				{
+					break;
+				}
+				static const char key[] = "KTXorientation";
+				if (length > sizeof(key) && std::memcmp(entry, key, sizeof(key)) == 0)
+				{
+					bottomToTop = length > sizeof(key) + 1 && entry[sizeof(key) + 1] == 'u';
+				}
+				offset += 4 + ((length + 3) & ~3u);
+			}
+		}
+
+		for (std::uint32_t i = 0; i < levelCount; ++i)
+		{
+			const std::uint64_t levelOffset = Read64(data + 80 + i * 24);
+			const std::uint64_t levelLength = Read64(data + 80 + i * 24 + 8);
+			ImageLoader::Level level;
+			level.mWidth = std::max(1u, width >> i);
+			level.mHeight = std::max(1u, height >> i);
+			// Uncompressed rows are tightly packed.
+			const std::size_t texels = static_cast<std::size_t>(level.mWidth) * level.mHeight;
+			if (levelLength < texels * channels || levelOffset + levelLength > size)
+			{
+				return Fail(error, "KTX2: level data cut short");
+			}
+			const std::uint8_t* in = data + levelOffset;
+			level.mPixels.resize(texels * 4);
+			for (std::size_t texel = 0; texel < texels; ++texel)
+			{
+				std::memcpy(&level.mPixels[texel * 4], in + texel * channels, channels);
+				if (channels == 3)
+				{
+					level.mPixels[texel * 4 + 3] = 255;
+				}
+			}
+			if (!bottomToTop)
+			{
+				FlipRows(&level);
+			}
+			image->mLevels.push_back(std::move(level));
+		}
+		return true;
+	}
+}
+
+bool ImageLoader::Decode(const std::uint8_t* data, std::size_t size, Image* image, std::string* error)
+{
+	static const std::uint8_t pngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	static const std::uint8_t ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	image->mLevels.clear();
+	if (size >= sizeof(pngSignature) && std::memcmp(data, pngSignature, sizeof(pngSignature)) == 0)
+	{
+		return DecodePng(data, size, image, error);
+	}
+	if (size >= sizeof(ktx2Identifier) && std::memcmp(data, ktx2Identifier, sizeof(ktx2Identifier)) == 0)
+	{
+		return DecodeKtx2(data, size, image, error);
+	}
+	// TGA has no signature; DecodeTga() checks what it can.
+	return DecodeTga(data, size, image, error);
+}
+
+bool ImageLoader::Load(const char* path, Image* image, std::string* error)
+{
+	std::vector<std::uint8_t> data;
+	return ReadFile(path, &data, error) && Decode(data.data(), data.size(), image, error);
+}
+
+bool ImageLoader::ReadFile(const char* path, std::vector<std::uint8_t>* data, std::string* error)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == nullptr)
+	{
+		*error = std::string("can't open ") + path;
+		return false;
+	}
+	data->clear();
+	std::uint8_t chunk[65536];
+	std::size_t read = 0;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+	{
+		data->insert(data->end(), chunk, chunk + read);
+	}
+	fclose(file);
+	return true;
+}
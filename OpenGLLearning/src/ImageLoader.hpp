@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Reads images into 8 bit RGBA, rows bottom to top as glTexImage2D wants
+/// them.
+///
+/// Formats:
+///		TGA		true color or grayscale, 8/24/32 bits, raw or RLE
+///		PNG		every color type, 8 or 16 bits (16 keeps the high byte), not interlaced
+///		KTX2	uncompressed R8G8B8(A8) UNORM or SRGB, 2D, no supercompression;
+///				all the mip levels in the file are kept
+/// The format is told by the data, not the file name.
+/// </summary>
+namespace ImageLoader {
+	struct Level {
+		std::uint32_t				mWidth		= 0;
+		std::uint32_t				mHeight		= 0;
+		std::vector<std::uint8_t>	mPixels;
+	};
+
+	struct Image {
+		// The first is the full size image, any others are its mip levels.
+		std::vector<Level>			mLevels;
+		// 0 while the levels hold RGBA8 pixels; once BlockCompressor has
+		// been at them, the GL internal format of the blocks they hold.
+		std::uint32_t				mBlockFormat	= 0;
+	};
+
+	/// <summary>
+	/// Returns false, with the reason in 'error', if the data isn't an image we can read.
+	/// </summary>
+	bool Decode(const std::uint8_t* data, std::size_t size, Image* image, std::string* error);
+
+	bool Load(const char* path, Image* image, std::string* error);
+
+	/// <summary>
+	/// The whole file at 'path', for callers that want the bytes too.
+	/// </summary>
+	bool ReadFile(const char* path, std::vector<std::uint8_t>* data, std::string* error);
+}
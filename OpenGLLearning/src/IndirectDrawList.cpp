@@ -0,0 +1,157 @@
+#include "IndirectDrawList.hpp"
+
+#include <cstring>
+#include <utility>
+
+bool IndirectDrawList::IsSupported()
+{
+	return GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_base_instance;
+}
+
+void IndirectDrawList::Clear()
+{
+	// Keep the batches (and their capacity), most frames draw from the same vertex arrays.
+	for (Batch& batch : mBatches)
+	{
+		batch.mCommands.clear();
+	}
+}
+
+void IndirectDrawList::Add(const MeshBufferPool::DrawRange& range, GLuint drawIndex, GLuint program)
+{
+	Batch* batch = nullptr;
+	for (Batch& candidate : mBatches)
+	{
+		if (candidate.mVertexArray == range.mVertexArray && candidate.mProgram == program)
+		{
+			batch = &candidate;
+			break;
+		}
+	}
+	if (batch == nullptr)
+	{
+		mBatches.emplace_back();
+		batch = &mBatches.back();
+		batch->mVertexArray = range.mVertexArray;
+		batch->mProgram = program;
+	}
+
+	DrawElementsIndirectCommand command;
+	command.mCount = static_cast<GLuint>(range.mIndexCount);
+	command.mInstanceCount = 1;
+	command.mFirstIndex = range.mFirstIndex;
+	command.mBaseVertex = range.mBaseVertex;
+	command.mBaseInstance = drawIndex;
+	batch->mCommands.push_back(command);
+}
+
+bool IndirectDrawList::Write(StreamingBuffer* buffer)
+{
+	// Drop vertex arrays nothing was queued for this time.
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < mBatches.size(); ++i)
+	{
+		if (!mBatches[i].mCommands.empty())
+		{
+			if (kept != i)
+			{
+				std::swap(mBatches[kept], mBatches[i]);
+			}
+			++kept;
+		}
+	}
+	mBatches.resize(kept);
+
+	const std::size_t count = GetDrawCount();
+	if (count == 0)
+	{
+		return true;
+	}
+
+	GLintptr offset = 0;
+	char* commands = static_cast<char*>(buffer->Allocate(
+		count * sizeof(DrawElementsIndirectCommand),
+		sizeof(GLuint),
+		&offset
+	));
+	if (commands == nullptr)
+	{
+		return false;
+	}
+
+	mCommandBuffer = buffer->GetBuffer();
+	for (Batch& batch : mBatches)
+	{
+		const std::size_t size = batch.mCommands.size() * sizeof(DrawElementsIndirectCommand);
+		memcpy(commands, batch.mCommands.data(), size);
+		batch.mOffset = offset;
+		commands += size;
+		offset += size;
+	}
+	return true;
+}
+
+void IndirectDrawList::SetInstanceMatrices(GLuint location, GLuint vectors, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	mInstanceLocation = location;
+	mInstanceVectors = vectors;
+	mInstanceBuffer = buffer;
+	mInstanceOffset = offset;
+	mInstanceStride = stride;
+}
+
+void IndirectDrawList::Submit(GLenum mode) const
+{
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+	for (const Batch& batch : mBatches)
+	{
+		if (batch.mProgram != 0)
+		{
+			glUseProgram(batch.mProgram);
+		}
+		glBindVertexArray(batch.mVertexArray);
+
+		// The offset moves every frame, so the VAO is pointed at it again every time.
+		PointInstanceMatrices(mInstanceLocation, mInstanceVectors, mInstanceOffset, mInstanceStride);
+
+		glMultiDrawElementsIndirect(
+			mode,
+			GL_UNSIGNED_INT,
+			reinterpret_cast<const void*>(batch.mOffset),
+			static_cast<GLsizei>(batch.mCommands.size()),
+			0
+		);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void IndirectDrawList::PointInstanceMatrices(GLuint location, GLuint vectors, GLintptr offset, GLsizei stride)
+{
+	// A mat4 attribute takes four locations, one per column, then any
+	// vectors after it one each.
+	for (GLuint column = 0; column < vectors; ++column)
+	{
+		glEnableVertexAttribArray(location + column);
+		glVertexAttribPointer(
+			location + column,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			stride,
+			reinterpret_cast<const void*>(offset + column * sizeof(GLfloat) * 4)
+		);
+		glVertexAttribDivisor(location + column, 1);
+	}
+}
+
+std::size_t IndirectDrawList::GetDrawCount() const
+{
+	std::size_t count = 0;
+	for (const Batch& batch : mBatches)
+	{
+		count += batch.mCommands.size();
+	}
+	return count;
+}
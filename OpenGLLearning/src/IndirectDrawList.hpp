@@ -0,0 +1,90 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "MeshBufferPool.hpp"
+#include "StreamingBuffer.hpp"
+
+/// <summary>
+/// The layout glMultiDrawElementsIndirect reads from GL_DRAW_INDIRECT_BUFFER.
+/// </summary>
+struct DrawElementsIndirectCommand {
+	GLuint	mCount;
+	GLuint	mInstanceCount;
+	GLuint	mFirstIndex;
+	GLint	mBaseVertex;
+	GLuint	mBaseInstance;
+};
+
+/// <summary>
+/// Collects a frame's draws and submits them with one
+/// glMultiDrawElementsIndirect per vertex array and program, instead of one
+/// glDrawElements per mesh.
+///
+/// GLSL 4.10 has no gl_DrawID, so every draw's index goes in its
+/// baseInstance instead. A mat4 attribute with a divisor of 1 then fetches
+/// that draw's matrix from the per-object data, see SetInstanceMatrices().
+/// Needs ARB_multi_draw_indirect and ARB_base_instance (both core in 4.3).
+/// </summary>
+class IndirectDrawList {
+public:
+	static bool IsSupported();
+
+	void Clear();
+	/// <summary>
+	/// Queues one mesh. 'drawIndex' ends up in baseInstance. Draws with a
+	/// 'program' are drawn with it, the others with whatever is in use.
+	/// </summary>
+	void Add(const MeshBufferPool::DrawRange& range, GLuint drawIndex, GLuint program = 0);
+
+	/// <summary>
+	/// Writes the queued commands into this frame's region of 'buffer'.
+	/// Call between its BeginFrame() and Commit(). Returns false if it's full.
+	/// </summary>
+	bool Write(StreamingBuffer* buffer);
+
+	/// <summary>
+	/// Where the instanced mat4 attribute at 'location' (and the three after
+	/// it) reads from: element i is 'stride' bytes after element i - 1.
+	/// 'vectors' counts the vec4 attributes per element, the matrix's four
+	/// included; any beyond them follow the matrix in memory and in locations.
+	/// </summary>
+	void SetInstanceMatrices(GLuint location, GLuint vectors, GLuint buffer, GLintptr offset, GLsizei stride);
+
+	/// <summary>
+	/// Issues the draws written by Write(). Leaves the last batch's program in use.
+	/// </summary>
+	void Submit(GLenum mode = GL_TRIANGLES) const;
+
+	/// <summary>
+	/// Points the mat4 at 'location' in the bound vertex array, and the
+	/// vec4s after it up to 'vectors' in all, at the bound GL_ARRAY_BUFFER,
+	/// advancing once per instance.
+	/// </summary>
+	static void PointInstanceMatrices(GLuint location, GLuint vectors, GLintptr offset, GLsizei stride);
+
+	std::size_t GetDrawCount() const;
+	/// <summary>
+	/// How many glMultiDrawElementsIndirect calls Submit() makes.
+	/// </summary>
+	std::size_t GetBatchCount() const { return mBatches.size(); }
+
+private:
+	// All draws that read from the same vertex array with the same program.
+	struct Batch {
+		GLuint										mVertexArray	= 0;
+		GLuint										mProgram		= 0;
+		std::vector<DrawElementsIndirectCommand>	mCommands;
+		GLintptr									mOffset			= 0;
+	};
+
+	std::vector<Batch>	mBatches;
+	GLuint				mCommandBuffer			= 0;
+	GLuint				mInstanceLocation		= 0;
+	GLuint				mInstanceVectors		= 4;
+	GLuint				mInstanceBuffer			= 0;
+	GLintptr			mInstanceOffset			= 0;
+	GLsizei				mInstanceStride			= 0;
+};
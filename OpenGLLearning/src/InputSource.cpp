@@ -0,0 +1,228 @@
+#include "InputSource.hpp"
+
+#include <SDL2/SDL.h>
+
+namespace {
+
+struct KeyBinding {
+	SDL_Scancode	mKey;
+	InputAction		mAction;
+};
+
+// Held every tick they're down.
+const KeyBinding HeldKeys[] = {
+	{ SDL_SCANCODE_UP,		InputAction::MoveForward },
+	{ SDL_SCANCODE_DOWN,	InputAction::MoveBackward },
+	{ SDL_SCANCODE_LEFT,	InputAction::MoveLeft },
+	{ SDL_SCANCODE_RIGHT,	InputAction::MoveRight },
+	{ SDL_SCANCODE_ESCAPE,	InputAction::Quit },
+};
+
+// Once per key press.
+const KeyBinding PressedKeys[] = {
+	{ SDL_SCANCODE_F1,		InputAction::Defragment },
+	{ SDL_SCANCODE_F2,		InputAction::ToggleIndirectDraws },
+	{ SDL_SCANCODE_F3,		InputAction::ToggleGpuCulling },
+	{ SDL_SCANCODE_F4,		InputAction::PrintFramePacing },
+	{ SDL_SCANCODE_F5,		InputAction::PrintGLStats },
+	{ SDL_SCANCODE_F6,		InputAction::ToggleDeferredShading },
+};
+
+struct FileHeader {
+	std::uint32_t	mMagic;
+	std::uint32_t	mVersion;
+	std::uint32_t	mFrameCount;
+};
+
+}
+
+InputSource::~InputSource()
+{
+	Finish();
+}
+
+void InputSource::SetMousePosition(int x, int y)
+{
+	mState.mMouseX = x;
+	mState.mMouseY = y;
+}
+
+bool InputSource::StartRecording(const char* path)
+{
+	Finish();
+	mFile = std::fopen(path, "wb");
+	if (mFile == nullptr)
+	{
+		return false;
+	}
+	mMode = Mode::Recording;
+	mFrames.clear();
+	mFramesBegun = 0;
+	mStart = std::chrono::steady_clock::now();
+	return true;
+}
+
+bool InputSource::StartPlayback(const char* path)
+{
+	Finish();
+	std::FILE* file = std::fopen(path, "rb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	// Recordings are raw structs, so they only play back on the same kind of
+	// machine that made them; good enough for comparing builds.
+	FileHeader header = {};
+	bool loaded = std::fread(&header, sizeof(header), 1, file) == 1
+		&& header.mMagic == Magic
+		&& header.mVersion == Version;
+	if (loaded)
+	{
+		mFrames.resize(header.mFrameCount);
+		loaded = std::fread(mFrames.data(), sizeof(Frame), mFrames.size(), file) == mFrames.size();
+	}
+	std::fclose(file);
+	if (!loaded)
+	{
+		mFrames.clear();
+		return false;
+	}
+
+	mMode = Mode::Playback;
+	mFramesBegun = 0;
+	mPoll = 0;
+	return true;
+}
+
+void InputSource::Finish()
+{
+	if (mFile != nullptr)
+	{
+		FileHeader header = {};
+		header.mMagic = Magic;
+		header.mVersion = Version;
+		header.mFrameCount = static_cast<std::uint32_t>(mFrames.size());
+		std::fwrite(&header, sizeof(header), 1, mFile);
+		std::fwrite(mFrames.data(), sizeof(Frame), mFrames.size(), mFile);
+		std::fclose(mFile);
+		mFile = nullptr;
+	}
+	mMode = Mode::Live;
+}
+
+int InputSource::BeginFrame(int ticks, float interpolation)
+{
+	++mFramesBegun;
+	mPoll = 0;
+
+	if (mMode == Mode::Playback)
+	{
+		if (IsPlaybackFinished())
+		{
+			mInterpolation = 1.0f;
+			return 0;
+		}
+		const Frame& frame = mFrames[mFramesBegun - 1];
+		mInterpolation = frame.mInterpolation;
+		return frame.mTicks;
+	}
+
+	mInterpolation = interpolation;
+	if (mMode == Mode::Recording)
+	{
+		Frame frame;
+		frame.mSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count();
+		frame.mTicks = ticks;
+		frame.mInterpolation = interpolation;
+		mFrames.push_back(frame);
+	}
+	return ticks;
+}
+
+const InputState& InputSource::Poll()
+{
+	if (mMode != Mode::Playback)
+	{
+		PollLive();
+		if (mMode == Mode::Recording && !mFrames.empty())
+		{
+			Frame& frame = mFrames.back();
+			// Anything past the last slot replaces it, it's the most recent.
+			const int slot = frame.mPollCount < MaxPollsPerFrame ? frame.mPollCount++ : MaxPollsPerFrame - 1;
+			frame.mPolls[slot] = mState;
+		}
+		return mState;
+	}
+
+	// Still drain the queue, and let closing the window end playback early.
+	bool closed = false;
+	SDL_Event e;
+	while (SDL_PollEvent(&e) != 0)
+	{
+		closed = closed || e.type == SDL_QUIT;
+	}
+
+	if (mFramesBegun > 0 && !IsPlaybackFinished())
+	{
+		const Frame& frame = mFrames[mFramesBegun - 1];
+		if (mPoll < frame.mPollCount)
+		{
+			mState = frame.mPolls[mPoll];
+		}
+		else
+		{
+			// Polled more often than when recording: nothing new happened.
+			mState.mPressed = 0;
+		}
+		++mPoll;
+	}
+	else
+	{
+		mState.mPressed = InputState::Bit(InputAction::Quit);
+	}
+	if (closed)
+	{
+		mState.mPressed |= InputState::Bit(InputAction::Quit);
+	}
+	return mState;
+}
+
+void InputSource::PollLive()
+{
+	mState.mPressed = 0;
+
+	SDL_Event e;
+	while (SDL_PollEvent(&e) != 0)
+	{
+		if (e.type == SDL_QUIT)
+		{
+			mState.mPressed |= InputState::Bit(InputAction::Quit);
+		}
+		else if (e.type == SDL_MOUSEMOTION)
+		{
+			mState.mMouseX += e.motion.xrel;
+			mState.mMouseY += e.motion.yrel;
+		}
+		else if (e.type == SDL_KEYDOWN)
+		{
+			for (const KeyBinding& binding : PressedKeys)
+			{
+				if (e.key.keysym.scancode == binding.mKey)
+				{
+					mState.mPressed |= InputState::Bit(binding.mAction);
+				}
+			}
+		}
+	}
+
+	const Uint8* keys = SDL_GetKeyboardState(NULL);
+	mState.mHeld = 0;
+	for (const KeyBinding& binding : HeldKeys)
+	{
+		if (keys[binding.mKey])
+		{
+			mState.mHeld |= InputState::Bit(binding.mAction);
+		}
+	}
+}
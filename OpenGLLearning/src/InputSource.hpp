@@ -0,0 +1,131 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/// <summary>
+/// Everything the app reacts to, independent of which key does it.
+/// </summary>
+enum class InputAction : std::uint32_t {
+	MoveForward,
+	MoveBackward,
+	MoveLeft,
+	MoveRight,
+	Defragment,
+	ToggleIndirectDraws,
+	ToggleGpuCulling,
+	PrintFramePacing,
+	PrintGLStats,
+	Quit,
+	// After Quit, so recordings made before it still play back.
+	ToggleDeferredShading,
+};
+
+/// <summary>
+/// The input as of one InputSource::Poll(). Plain data, so recordings are
+/// just arrays of these.
+/// </summary>
+struct InputState {
+	// Where relative mouse motion has added up to since the start.
+	std::int32_t	mMouseX		= 0;
+	std::int32_t	mMouseY		= 0;
+	// One bit per InputAction: keys down right now, and keys that went
+	// down since the last Poll().
+	std::uint32_t	mHeld		= 0;
+	std::uint32_t	mPressed	= 0;
+
+	bool IsHeld(InputAction action) const { return (mHeld & Bit(action)) != 0; }
+	bool WasPressed(InputAction action) const { return (mPressed & Bit(action)) != 0; }
+
+	static std::uint32_t Bit(InputAction action) { return 1u << static_cast<std::uint32_t>(action); }
+};
+
+/// <summary>
+/// Where the main loop gets its input from: SDL, optionally recorded to a
+/// file, or a recording played back.
+///
+/// A recording has, for every frame, when it started, how many simulation
+/// ticks it ran and how far it interpolated, and the input of every Poll()
+/// in it. Playing it back runs exactly those ticks with exactly that
+/// input, so every frame comes out the same no matter how fast the
+/// machine is, which is what makes runs comparable.
+///
+/// Every frame:
+///		int ticks = input.BeginFrame(scheduler.BeginFrame(), scheduler.GetInterpolation());
+///		const InputState& state = input.Poll();
+///		... simulate 'ticks', render at input.GetInterpolation() ...
+/// </summary>
+class InputSource {
+public:
+	enum class Mode {
+		Live,
+		Recording,
+		Playback,
+	};
+
+	/// <summary>
+	/// Polls per frame we keep, the first one and the late latched one.
+	/// </summary>
+	static constexpr int MaxPollsPerFrame = 2;
+
+	~InputSource();
+
+	void SetMousePosition(int x, int y);
+
+	/// <summary>
+	/// Records from now on, the file is written by Finish().
+	/// </summary>
+	bool StartRecording(const char* path);
+	bool StartPlayback(const char* path);
+
+	/// <summary>
+	/// Writes out the recording, if there is one.
+	/// </summary>
+	void Finish();
+
+	Mode GetMode() const { return mMode; }
+
+	/// <summary>
+	/// True once playback ran out of frames. Poll() reports Quit from then on.
+	/// </summary>
+	bool IsPlaybackFinished() const { return mMode == Mode::Playback && mFramesBegun > mFrames.size(); }
+
+	/// <summary>
+	/// Starts a frame. Takes the scheduler's ticks and interpolation and
+	/// returns the ticks to run, which are the recorded ones in playback.
+	/// </summary>
+	int BeginFrame(int ticks, float interpolation);
+	float GetInterpolation() const { return mInterpolation; }
+
+	/// <summary>
+	/// Handles every pending SDL event and returns the input now.
+	/// </summary>
+	const InputState& Poll();
+	const InputState& GetState() const { return mState; }
+
+private:
+	static constexpr std::uint32_t Magic = 0x54504e49;		// "INPT"
+	static constexpr std::uint32_t Version = 2;
+
+	struct Frame {
+		// Since the start of the recording.
+		double			mSeconds					= 0.0;
+		std::int32_t	mTicks						= 0;
+		float			mInterpolation				= 0.0f;
+		std::int32_t	mPollCount					= 0;
+		InputState		mPolls[MaxPollsPerFrame];
+	};
+
+	void PollLive();
+
+	Mode				mMode						= Mode::Live;
+	std::FILE*			mFile						= nullptr;
+	std::vector<Frame>	mFrames;
+	// BeginFrame() calls since recording or playback started.
+	std::size_t			mFramesBegun				= 0;
+	int					mPoll						= 0;
+	std::chrono::steady_clock::time_point	mStart;
+	float				mInterpolation				= 0.0f;
+	InputState			mState;
+};
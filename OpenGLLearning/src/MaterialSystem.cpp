@@ -0,0 +1,151 @@
+#include "MaterialSystem.hpp"
+
+#include <algorithm>
+
+static_assert(sizeof(MaterialSystem::Parameters) == 48, "Parameters has to match Material in the shaders (std140)");
+
+MaterialSystem::~MaterialSystem()
+{
+	Destroy();
+}
+
+bool MaterialSystem::Create(BuildProgramFunction buildProgram)
+{
+	mBuildProgram = buildProgram;
+	glGenBuffers(1, &mBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	// The whole array is always bound, so it's all allocated up front.
+	glBufferData(GL_UNIFORM_BUFFER, MaxMaterials * sizeof(Parameters), nullptr, GL_DYNAMIC_DRAW);
+	// An allocation that failed leaves the buffer empty, so ask the buffer
+	// rather than glGetError(), which could be holding someone else's error.
+	GLint allocatedSize = 0;
+	glGetBufferParameteriv(GL_UNIFORM_BUFFER, GL_BUFFER_SIZE, &allocatedSize);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	mDirtyBegin = mDirtyEnd = 0;
+	return mBuffer != 0 && allocatedSize == static_cast<GLint>(MaxMaterials * sizeof(Parameters));
+}
+
+void MaterialSystem::Destroy()
+{
+	for (const std::pair<std::uint32_t, GLuint>& permutation : mPermutations)
+	{
+		glDeleteProgram(permutation.second);
+	}
+	mPermutations.clear();
+	if (mBuffer != 0)
+	{
+		glDeleteBuffers(1, &mBuffer);
+		mBuffer = 0;
+	}
+	mParameters.clear();
+	mFeatures.clear();
+}
+
+MaterialSystem::Handle MaterialSystem::Add(std::uint32_t features, const Parameters& parameters)
+{
+	if (mParameters.size() == MaxMaterials)
+	{
+		return InvalidHandle;
+	}
+	const Handle material = static_cast<Handle>(mParameters.size());
+	mParameters.push_back(parameters);
+	mFeatures.push_back(features);
+	SetParameters(material, parameters);
+	return material;
+}
+
+void MaterialSystem::SetParameters(Handle material, const Parameters& parameters)
+{
+	mParameters[material] = parameters;
+	if (mDirtyBegin == mDirtyEnd)
+	{
+		mDirtyBegin = material;
+		mDirtyEnd = material + 1;
+	}
+	else
+	{
+		mDirtyBegin = std::min(mDirtyBegin, material);
+		mDirtyEnd = std::max(mDirtyEnd, material + 1);
+	}
+}
+
+GLuint MaterialSystem::GetProgram(Handle material, std::uint32_t pathFeatures)
+{
+	return GetPermutation(mFeatures[material] | pathFeatures);
+}
+
+GLuint MaterialSystem::GetPermutation(std::uint32_t features)
+{
+	for (const std::pair<std::uint32_t, GLuint>& permutation : mPermutations)
+	{
+		if (permutation.first == features)
+		{
+			return permutation.second;
+		}
+	}
+	const GLuint program = mBuildProgram(GetDefines(features));
+	AddPermutation(features, program);
+	return program;
+}
+
+void MaterialSystem::AddPermutation(std::uint32_t features, GLuint program)
+{
+	mPermutations.emplace_back(features, program);
+}
+
+std::string MaterialSystem::GetDefines(std::uint32_t features)
+{
+	std::string defines = "#define MAX_MATERIALS " + std::to_string(MaxMaterials) + "\n";
+	if (features & VertexColors)
+	{
+		defines += "#define VERTEX_COLORS\n";
+	}
+	if (features & Texture)
+	{
+		defines += "#define TEXTURE\n";
+	}
+	if (features & TextureArray)
+	{
+		defines += "#define TEXTURE_ARRAY\n";
+	}
+	if (features & Instanced)
+	{
+		defines += "#define INSTANCED\n";
+	}
+	if (features & Lit)
+	{
+		defines += "#define LIT\n";
+	}
+	if (features & GBuffer)
+	{
+		defines += "#define GBUFFER\n";
+	}
+	if (features & Shadowed)
+	{
+		defines += "#define SHADOWS\n";
+	}
+	if (features & DepthOnly)
+	{
+		defines += "#define DEPTH_ONLY\n";
+	}
+	if (features & Skinned)
+	{
+		defines += "#define SKINNED\n";
+	}
+	return defines;
+}
+
+void MaterialSystem::Flush(GLuint binding)
+{
+	if (mDirtyBegin != mDirtyEnd)
+	{
+		const GLsizeiptr size = (mDirtyEnd - mDirtyBegin) * sizeof(Parameters);
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, mDirtyBegin * sizeof(Parameters), size, &mParameters[mDirtyBegin]);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		mDirtyBegin = mDirtyEnd = 0;
+		++mUploadCount;
+		mUploadedBytes += static_cast<std::uint64_t>(size);
+	}
+	glBindBufferBase(GL_UNIFORM_BUFFER, binding, mBuffer);
+}
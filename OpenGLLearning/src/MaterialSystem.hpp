@@ -0,0 +1,144 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Materials: which shader permutation a draw uses, and the parameters it
+/// reads.
+///
+/// A permutation is a set of Features, each one a #define in front of the
+/// material shaders (see GetDefines()), compiled on first use and kept.
+/// Draws of materials with the same permutation share a program, so the
+/// indirect paths batch them together.
+///
+/// The parameters of every material live in one uniform block array
+/// (std140), Materials in vert.glsl and frag.glsl, which a draw indexes
+/// with the material index in its per-object data; nothing is set with
+/// glUniform*. SetParameters() only edits the CPU copy and widens the dirty
+/// range, and Flush() uploads just that range, once per frame. Parameters
+/// rarely change, so glBufferSubData is fine here rather than going through
+/// the StreamingBuffer.
+///
+/// Main thread only.
+/// </summary>
+class MaterialSystem {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = ~0u;
+
+	/// <summary>
+	/// The length of the uniform block array; 256 * 48 bytes stays under
+	/// the 16 KiB every GL 4.1 implementation allows a uniform block.
+	/// </summary>
+	static constexpr std::uint32_t MaxMaterials = 256;
+
+	/// <summary>
+	/// What a permutation does, one define each.
+	/// </summary>
+	enum Feature : std::uint32_t {
+		// Multiplies in the mesh's vertex colors.
+		VertexColors	= 1u << 0,
+		// Samples a sampler2D on unit 0.
+		Texture			= 1u << 1,
+		// Samples a sampler2DArray on unit 0, at the layer in the per-object data.
+		TextureArray	= 1u << 2,
+		// Per-object data comes as instanced attributes (the indirect paths)
+		// rather than the PerObject uniform block. Not a material's choice:
+		// the draw path adds it, see GetProgram().
+		Instanced		= 1u << 3,
+		// Shaded by the point lights of ClusteredLighting.
+		Lit				= 1u << 4,
+		// Writes DeferredShading's G-buffer instead of a color; Lit then
+		// only matters to the lighting pass. Added by the draw path, like
+		// Instanced.
+		GBuffer			= 1u << 5,
+		// Also lit by the sun, through CascadedShadowMaps. Only with Lit.
+		Shadowed		= 1u << 6,
+		// Writes depth and nothing else, for the shadow maps. Added by the
+		// draw path, on its own.
+		DepthOnly		= 1u << 7,
+		// Moved by joints, through AnimationSystem's palette; the mesh has
+		// joints and weights at attributes 8 and 9. Combines with the rest,
+		// DepthOnly too.
+		Skinned			= 1u << 8,
+	};
+
+	/// <summary>
+	/// Mirrors Material in the shaders (std140).
+	/// </summary>
+	struct Parameters {
+		// Multiplies the result.
+		glm::vec4		mBaseColor		= glm::vec4(1.0f);
+		// uv * xy + zw, before the atlas rectangle is applied.
+		glm::vec4		mUvScaleOffset	= glm::vec4(1.0f, 1.0f, 0.0f, 0.0f);
+		// x: roughness, for the lights' highlights. yzw unused.
+		glm::vec4		mSurface		= glm::vec4(0.5f, 0.0f, 0.0f, 0.0f);
+	};
+
+	/// <summary>
+	/// Compiles and links the material shaders with 'defines' (whole lines)
+	/// after their #version line. Returns the program, or 0.
+	/// </summary>
+	using BuildProgramFunction = GLuint(*)(const std::string& defines);
+
+	~MaterialSystem();
+
+	bool Create(BuildProgramFunction buildProgram);
+	/// <summary>
+	/// Deletes the buffer and every permutation's program.
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// InvalidHandle once there are MaxMaterials.
+	/// </summary>
+	Handle Add(std::uint32_t features, const Parameters& parameters);
+	void SetParameters(Handle material, const Parameters& parameters);
+	const Parameters& GetParameters(Handle material) const { return mParameters[material]; }
+	std::uint32_t GetFeatures(Handle material) const { return mFeatures[material]; }
+
+	/// <summary>
+	/// The program of the material's permutation, with 'pathFeatures'
+	/// (Instanced, GBuffer) added. Builds it if no one has yet.
+	/// </summary>
+	GLuint GetProgram(Handle material, std::uint32_t pathFeatures = 0);
+	GLuint GetPermutation(std::uint32_t features);
+	/// <summary>
+	/// Hands over the program for 'features', built elsewhere (say, on the
+	/// resource worker) from GetDefines(features). Destroy() deletes it.
+	/// </summary>
+	void AddPermutation(std::uint32_t features, GLuint program);
+	static std::string GetDefines(std::uint32_t features);
+
+	/// <summary>
+	/// Uploads the parameters changed since the last Flush(), and binds the
+	/// buffer to uniform block 'binding'.
+	/// </summary>
+	void Flush(GLuint binding);
+
+	std::size_t GetMaterialCount() const { return mParameters.size(); }
+	std::size_t GetPermutationCount() const { return mPermutations.size(); }
+	/// <summary>
+	/// How many Flush() calls uploaded something, and how much in all.
+	/// </summary>
+	std::uint64_t GetUploadCount() const { return mUploadCount; }
+	std::uint64_t GetUploadedBytes() const { return mUploadedBytes; }
+
+private:
+	BuildProgramFunction	mBuildProgram	= nullptr;
+	GLuint					mBuffer			= 0;
+	std::vector<Parameters>		mParameters;
+	std::vector<std::uint32_t>	mFeatures;
+	// Features to program; there are only ever a handful.
+	std::vector<std::pair<std::uint32_t, GLuint>>	mPermutations;
+	// Materials [mDirtyBegin, mDirtyEnd) changed since the last Flush().
+	std::uint32_t			mDirtyBegin		= 0;
+	std::uint32_t			mDirtyEnd		= 0;
+	std::uint64_t			mUploadCount	= 0;
+	std::uint64_t			mUploadedBytes	= 0;
+};
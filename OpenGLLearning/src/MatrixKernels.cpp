@@ -0,0 +1,202 @@
+#include "MatrixKernels.hpp"
+#include "MatrixKernelsISA.hpp"
+
+#include "CpuDispatch.hpp"
+
+#include <cstring>
+
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "kernels expect tightly packed vec3");
+static_assert(sizeof(glm::quat) == 4 * sizeof(float), "kernels expect tightly packed quat");
+static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "kernels expect tightly packed mat4");
+
+//------------------------------- Scalar reference -----------------------------------
+namespace {
+
+	void MultiplyScalar(const float* lhs, const float* rhs, float* out, std::size_t count)
+	{
+		float l[16];
+		std::memcpy(l, lhs, sizeof(l));
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float r[16];
+			std::memcpy(r, rhs + 16 * i, sizeof(r));
+			float* o = out + 16 * i;
+			for (int column = 0; column < 4; ++column)
+			{
+				for (int row = 0; row < 4; ++row)
+				{
+					o[4 * column + row] =
+						l[0 + row] * r[4 * column + 0] +
+						l[4 + row] * r[4 * column + 1] +
+						l[8 + row] * r[4 * column + 2] +
+						l[12 + row] * r[4 * column + 3];
+				}
+			}
+		}
+	}
+
+	void ComposeTRSScalar(const float* translations, const float* rotations, const float* scales, float* out, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* t = translations + 3 * i;
+			const float* q = rotations + 4 * i;
+			const float* s = scales + 3 * i;
+			const float x = q[0], y = q[1], z = q[2], w = q[3];
+			float* o = out + 16 * i;
+
+			o[0] = (1.0f - 2.0f * (y * y + z * z)) * s[0];
+			o[1] = (2.0f * (x * y + z * w)) * s[0];
+			o[2] = (2.0f * (x * z - y * w)) * s[0];
+			o[3] = 0.0f;
+
+			o[4] = (2.0f * (x * y - z * w)) * s[1];
+			o[5] = (1.0f - 2.0f * (x * x + z * z)) * s[1];
+			o[6] = (2.0f * (y * z + x * w)) * s[1];
+			o[7] = 0.0f;
+
+			o[8] = (2.0f * (x * z + y * w)) * s[2];
+			o[9] = (2.0f * (y * z - x * w)) * s[2];
+			o[10] = (1.0f - 2.0f * (x * x + y * y)) * s[2];
+			o[11] = 0.0f;
+
+			o[12] = t[0];
+			o[13] = t[1];
+			o[14] = t[2];
+			o[15] = 1.0f;
+		}
+	}
+
+	void NormalMatrixScalar(const float* models, float* out, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const glm::mat3 m(
+				models[16 * i + 0], models[16 * i + 1], models[16 * i + 2],
+				models[16 * i + 4], models[16 * i + 5], models[16 * i + 6],
+				models[16 * i + 8], models[16 * i + 9], models[16 * i + 10]);
+			// Columns of the cofactor matrix; dividing by the determinant gives the inverse-transpose.
+			const glm::vec3 c0 = glm::cross(m[1], m[2]);
+			const glm::vec3 c1 = glm::cross(m[2], m[0]);
+			const glm::vec3 c2 = glm::cross(m[0], m[1]);
+			const float invDet = 1.0f / glm::dot(m[0], c0);
+
+			const glm::mat4 result(
+				glm::vec4(c0 * invDet, 0.0f),
+				glm::vec4(c1 * invDet, 0.0f),
+				glm::vec4(c2 * invDet, 0.0f),
+				glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+			std::memcpy(out + 16 * i, &result[0][0], sizeof(result));
+		}
+	}
+
+	const MatrixKernelTable sScalarTable = { "Scalar", 1, MultiplyScalar, ComposeTRSScalar, NormalMatrixScalar };
+}
+
+const MatrixKernelTable* GetMatrixKernelsScalar()
+{
+	return &sScalarTable;
+}
+//------------------------------------------------------------------------------------
+
+namespace {
+
+	struct Dispatch {
+		const MatrixKernelTable* mWide		= nullptr;
+		// Handles whatever doesn't fill a whole batch of mWide.
+		const MatrixKernelTable* mNarrow	= nullptr;
+	};
+
+	Dispatch MakeDispatch()
+	{
+		const MatrixKernelTable* const candidates[] = {
+			GetMatrixKernelsScalar(),
+			GetMatrixKernelsSSE2(),
+			GetMatrixKernelsAVX2(),
+			GetMatrixKernelsAVX512(),
+		};
+		SimdLevel level = SimdLevel::Scalar;
+		Dispatch dispatch;
+		dispatch.mWide = CpuDispatch::Select(candidates, &level);
+		dispatch.mNarrow = dispatch.mWide;
+		if (dispatch.mWide->mBatchWidth > 1)
+		{
+			dispatch.mNarrow = (GetMatrixKernelsSSE2() && CpuDispatch::IsSupported(SimdLevel::SSE2))
+				? GetMatrixKernelsSSE2()
+				: GetMatrixKernelsScalar();
+		}
+		CpuDispatch::ReportActivePath("MatrixKernels", level);
+		return dispatch;
+	}
+
+	Dispatch& GetDispatch()
+	{
+		static Dispatch sDispatch = MakeDispatch();
+		return sDispatch;
+	}
+
+	std::size_t WholeBatches(const Dispatch& dispatch, std::size_t count)
+	{
+		return count - count % dispatch.mWide->mBatchWidth;
+	}
+}
+
+namespace MatrixKernels {
+
+	void MultiplyBatch(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* out, std::size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		const Dispatch& dispatch = GetDispatch();
+		const std::size_t head = WholeBatches(dispatch, count);
+		const float* l = &lhs[0][0];
+		dispatch.mWide->mMultiply(l, &rhs[0][0][0], &out[0][0][0], head);
+		if (head < count)
+		{
+			dispatch.mNarrow->mMultiply(l, &rhs[head][0][0], &out[head][0][0], count - head);
+		}
+	}
+
+	void ComposeTRSBatch(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, std::size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		const Dispatch& dispatch = GetDispatch();
+		const std::size_t head = WholeBatches(dispatch, count);
+		dispatch.mWide->mComposeTRS(&translations[0].x, &rotations[0].x, &scales[0].x, &out[0][0][0], head);
+		if (head < count)
+		{
+			dispatch.mNarrow->mComposeTRS(&translations[head].x, &rotations[head].x, &scales[head].x, &out[head][0][0], count - head);
+		}
+	}
+
+	void NormalMatrixBatch(const glm::mat4* models, glm::mat4* out, std::size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		const Dispatch& dispatch = GetDispatch();
+		const std::size_t head = WholeBatches(dispatch, count);
+		dispatch.mWide->mNormalMatrix(&models[0][0][0], &out[0][0][0], head);
+		if (head < count)
+		{
+			dispatch.mNarrow->mNormalMatrix(&models[head][0][0], &out[head][0][0], count - head);
+		}
+	}
+
+	const char* GetActivePathName()
+	{
+		return GetDispatch().mWide->mName;
+	}
+
+	void Reselect()
+	{
+		GetDispatch() = MakeDispatch();
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include <cstddef>
+
+/// <summary>
+/// Batch matrix math over whole arrays at once.
+///
+/// Each kernel has a scalar, SSE2, AVX2 and AVX-512 version; CpuDispatch
+/// picks the widest one the CPU supports the first time any kernel is called.
+/// All arrays may alias only when noted.
+/// </summary>
+namespace MatrixKernels {
+
+	/// <summary>
+	/// out[i] = lhs * rhs[i]. 'out' may alias 'rhs'.
+	/// </summary>
+	void MultiplyBatch(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* out, std::size_t count);
+
+	/// <summary>
+	/// out[i] = translate(t[i]) * mat4_cast(r[i]) * scale(s[i])
+	/// </summary>
+	void ComposeTRSBatch(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, std::size_t count);
+
+	/// <summary>
+	/// out[i] = mat4(inverseTranspose(mat3(models[i]))), for transforming normals.
+	/// 'out' may alias 'models'.
+	/// </summary>
+	void NormalMatrixBatch(const glm::mat4* models, glm::mat4* out, std::size_t count);
+
+	/// <summary>
+	/// Name of the kernel set in use, e.g. "AVX2".
+	/// </summary>
+	const char* GetActivePathName();
+
+	/// <summary>
+	/// Picks the kernel set again, e.g. after CpuDispatch::SetMaxLevel().
+	/// Mostly useful for benchmarking the paths against each other.
+	/// </summary>
+	void Reselect();
+}
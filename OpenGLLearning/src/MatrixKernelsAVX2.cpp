@@ -0,0 +1,156 @@
+#include "MatrixKernelsISA.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// MSVC takes /arch:AVX2 for this file from the project, GCC and Clang need it here.
+#if defined(__GNUC__)
+#pragma GCC target("avx2,fma")
+#endif
+#include <immintrin.h>
+
+namespace {
+
+	// Each 256-bit register holds the same column of two consecutive matrices.
+	inline void LoadColumnPairs(const float* m, __m256 columns[4])
+	{
+		const __m256 a01 = _mm256_loadu_ps(m + 0);
+		const __m256 a23 = _mm256_loadu_ps(m + 8);
+		const __m256 b01 = _mm256_loadu_ps(m + 16);
+		const __m256 b23 = _mm256_loadu_ps(m + 24);
+		columns[0] = _mm256_permute2f128_ps(a01, b01, 0x20);
+		columns[1] = _mm256_permute2f128_ps(a01, b01, 0x31);
+		columns[2] = _mm256_permute2f128_ps(a23, b23, 0x20);
+		columns[3] = _mm256_permute2f128_ps(a23, b23, 0x31);
+	}
+
+	inline void StoreColumnPairs(float* m, const __m256 columns[4])
+	{
+		_mm256_storeu_ps(m + 0, _mm256_permute2f128_ps(columns[0], columns[1], 0x20));
+		_mm256_storeu_ps(m + 8, _mm256_permute2f128_ps(columns[2], columns[3], 0x20));
+		_mm256_storeu_ps(m + 16, _mm256_permute2f128_ps(columns[0], columns[1], 0x31));
+		_mm256_storeu_ps(m + 24, _mm256_permute2f128_ps(columns[2], columns[3], 0x31));
+	}
+
+	void Multiply(const float* lhs, const float* rhs, float* out, std::size_t count)
+	{
+		// Every column of lhs, repeated in both halves.
+		const __m256 l0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 0));
+		const __m256 l1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+		const __m256 l2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+		const __m256 l3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* r = rhs + 16 * i;
+			float* o = out + 16 * i;
+			// Two result columns at a time.
+			for (int half = 0; half < 2; ++half)
+			{
+				const __m256 c = _mm256_loadu_ps(r + 8 * half);
+				__m256 acc = _mm256_mul_ps(l0, _mm256_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0)));
+				acc = _mm256_fmadd_ps(l1, _mm256_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)), acc);
+				acc = _mm256_fmadd_ps(l2, _mm256_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2)), acc);
+				acc = _mm256_fmadd_ps(l3, _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3)), acc);
+				_mm256_storeu_ps(o + 8 * half, acc);
+			}
+		}
+	}
+
+	void ComposeTRS(const float* translations, const float* rotations, const float* scales, float* out, std::size_t count)
+	{
+		// Same shuffles as the SSE2 version, two quaternions per register.
+		const __m256 base0 = _mm256_setr_ps(1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f);
+		const __m256 base1 = _mm256_setr_ps(0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+		const __m256 base2 = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+		const __m256 signA0 = _mm256_setr_ps(-2.0f, 2.0f, 2.0f, 0.0f, -2.0f, 2.0f, 2.0f, 0.0f);
+		const __m256 signB0 = _mm256_setr_ps(-2.0f, 2.0f, -2.0f, 0.0f, -2.0f, 2.0f, -2.0f, 0.0f);
+		const __m256 signA1 = _mm256_setr_ps(2.0f, -2.0f, 2.0f, 0.0f, 2.0f, -2.0f, 2.0f, 0.0f);
+		const __m256 signB1 = _mm256_setr_ps(-2.0f, -2.0f, 2.0f, 0.0f, -2.0f, -2.0f, 2.0f, 0.0f);
+		const __m256 signA2 = _mm256_setr_ps(2.0f, 2.0f, -2.0f, 0.0f, 2.0f, 2.0f, -2.0f, 0.0f);
+		const __m256 signB2 = _mm256_setr_ps(2.0f, -2.0f, -2.0f, 0.0f, 2.0f, -2.0f, -2.0f, 0.0f);
+
+		for (std::size_t i = 0; i < count; i += 2)
+		{
+			const __m256 q = _mm256_loadu_ps(rotations + 4 * i);
+			const float* t = translations + 3 * i;
+			const float* s = scales + 3 * i;
+
+			__m256 a = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 1, 1)));
+			__m256 b = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 2, 2)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)));
+			const __m256 c0 = _mm256_fmadd_ps(b, signB0, _mm256_fmadd_ps(a, signA0, base0));
+
+			a = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 0, 1)));
+			b = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)));
+			const __m256 c1 = _mm256_fmadd_ps(b, signB1, _mm256_fmadd_ps(a, signA1, base1));
+
+			a = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+			b = _mm256_mul_ps(_mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)), _mm256_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)));
+			const __m256 c2 = _mm256_fmadd_ps(b, signB2, _mm256_fmadd_ps(a, signA2, base2));
+
+			const __m256 columns[4] = {
+				_mm256_mul_ps(c0, _mm256_setr_ps(s[0], s[0], s[0], s[0], s[3], s[3], s[3], s[3])),
+				_mm256_mul_ps(c1, _mm256_setr_ps(s[1], s[1], s[1], s[1], s[4], s[4], s[4], s[4])),
+				_mm256_mul_ps(c2, _mm256_setr_ps(s[2], s[2], s[2], s[2], s[5], s[5], s[5], s[5])),
+				_mm256_setr_ps(t[0], t[1], t[2], 1.0f, t[3], t[4], t[5], 1.0f)
+			};
+			StoreColumnPairs(out + 16 * i, columns);
+		}
+	}
+
+	inline __m256 Cross(__m256 a, __m256 b)
+	{
+		const __m256 aYZX = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256 bYZX = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256 aZXY = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m256 bZXY = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+		return _mm256_fmsub_ps(aYZX, bZXY, _mm256_mul_ps(aZXY, bYZX));
+	}
+
+	void NormalMatrix(const float* models, float* out, std::size_t count)
+	{
+		const __m256 xyzMask = _mm256_castsi256_ps(_mm256_setr_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+		const __m256 lastColumn = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+		for (std::size_t i = 0; i < count; i += 2)
+		{
+			__m256 m[4];
+			LoadColumnPairs(models + 16 * i, m);
+			const __m256 m0 = _mm256_and_ps(m[0], xyzMask);
+			const __m256 m1 = _mm256_and_ps(m[1], xyzMask);
+			const __m256 m2 = _mm256_and_ps(m[2], xyzMask);
+
+			const __m256 c0 = Cross(m1, m2);
+			const __m256 c1 = Cross(m2, m0);
+			const __m256 c2 = Cross(m0, m1);
+
+			__m256 det = _mm256_mul_ps(m0, c0);
+			det = _mm256_add_ps(det, _mm256_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+			det = _mm256_add_ps(det, _mm256_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+			const __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+			const __m256 columns[4] = {
+				_mm256_mul_ps(c0, invDet),
+				_mm256_mul_ps(c1, invDet),
+				_mm256_mul_ps(c2, invDet),
+				lastColumn
+			};
+			StoreColumnPairs(out + 16 * i, columns);
+		}
+	}
+
+	const MatrixKernelTable sTable = { "AVX2", 2, Multiply, ComposeTRS, NormalMatrix };
+}
+
+const MatrixKernelTable* GetMatrixKernelsAVX2()
+{
+	return &sTable;
+}
+
+#else
+
+const MatrixKernelTable* GetMatrixKernelsAVX2()
+{
+	return nullptr;
+}
+
+#endif
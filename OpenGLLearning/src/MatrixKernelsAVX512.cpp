@@ -0,0 +1,170 @@
+#include "MatrixKernelsISA.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// MSVC takes /arch:AVX512 for this file from the project, GCC and Clang need it here.
+#if defined(__GNUC__)
+#pragma GCC target("avx512f")
+#endif
+#include <immintrin.h>
+
+namespace {
+
+	// Each 512-bit register holds the same column of four consecutive matrices.
+	// Swapping 128-bit blocks like this is its own inverse, so it's used for
+	// both loading and storing.
+	inline void TransposeBlocks(const __m512 in[4], __m512 out[4])
+	{
+		const __m512 t0 = _mm512_shuffle_f32x4(in[0], in[1], _MM_SHUFFLE(1, 0, 1, 0));
+		const __m512 t1 = _mm512_shuffle_f32x4(in[2], in[3], _MM_SHUFFLE(1, 0, 1, 0));
+		const __m512 t2 = _mm512_shuffle_f32x4(in[0], in[1], _MM_SHUFFLE(3, 2, 3, 2));
+		const __m512 t3 = _mm512_shuffle_f32x4(in[2], in[3], _MM_SHUFFLE(3, 2, 3, 2));
+		out[0] = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+		out[1] = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+		out[2] = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+		out[3] = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+
+	inline void StoreColumnQuads(float* m, const __m512 columns[4])
+	{
+		__m512 matrices[4];
+		TransposeBlocks(columns, matrices);
+		for (int j = 0; j < 4; ++j)
+		{
+			_mm512_storeu_ps(m + 16 * j, matrices[j]);
+		}
+	}
+
+	void Multiply(const float* lhs, const float* rhs, float* out, std::size_t count)
+	{
+		const __m512 l0 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 0));
+		const __m512 l1 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 4));
+		const __m512 l2 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 8));
+		const __m512 l3 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 12));
+
+		// One whole matrix per register, all four result columns at once.
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const __m512 r = _mm512_loadu_ps(rhs + 16 * i);
+			__m512 acc = _mm512_mul_ps(l0, _mm512_permute_ps(r, _MM_SHUFFLE(0, 0, 0, 0)));
+			acc = _mm512_fmadd_ps(l1, _mm512_permute_ps(r, _MM_SHUFFLE(1, 1, 1, 1)), acc);
+			acc = _mm512_fmadd_ps(l2, _mm512_permute_ps(r, _MM_SHUFFLE(2, 2, 2, 2)), acc);
+			acc = _mm512_fmadd_ps(l3, _mm512_permute_ps(r, _MM_SHUFFLE(3, 3, 3, 3)), acc);
+			_mm512_storeu_ps(out + 16 * i, acc);
+		}
+	}
+
+	void ComposeTRS(const float* translations, const float* rotations, const float* scales, float* out, std::size_t count)
+	{
+		// Same shuffles as the SSE2 version, four quaternions per register.
+		const __m512 base0 = _mm512_broadcast_f32x4(_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f));
+		const __m512 base1 = _mm512_broadcast_f32x4(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f));
+		const __m512 base2 = _mm512_broadcast_f32x4(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
+		const __m512 signA0 = _mm512_broadcast_f32x4(_mm_setr_ps(-2.0f, 2.0f, 2.0f, 0.0f));
+		const __m512 signB0 = _mm512_broadcast_f32x4(_mm_setr_ps(-2.0f, 2.0f, -2.0f, 0.0f));
+		const __m512 signA1 = _mm512_broadcast_f32x4(_mm_setr_ps(2.0f, -2.0f, 2.0f, 0.0f));
+		const __m512 signB1 = _mm512_broadcast_f32x4(_mm_setr_ps(-2.0f, -2.0f, 2.0f, 0.0f));
+		const __m512 signA2 = _mm512_broadcast_f32x4(_mm_setr_ps(2.0f, 2.0f, -2.0f, 0.0f));
+		const __m512 signB2 = _mm512_broadcast_f32x4(_mm_setr_ps(2.0f, -2.0f, -2.0f, 0.0f));
+		const __m512i scaleX = _mm512_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3, 6, 6, 6, 6, 9, 9, 9, 9);
+		const __m512i scaleY = _mm512_setr_epi32(1, 1, 1, 1, 4, 4, 4, 4, 7, 7, 7, 7, 10, 10, 10, 10);
+		const __m512i scaleZ = _mm512_setr_epi32(2, 2, 2, 2, 5, 5, 5, 5, 8, 8, 8, 8, 11, 11, 11, 11);
+		const __m512i translation = _mm512_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0);
+		const __m512 one = _mm512_set1_ps(1.0f);
+
+		for (std::size_t i = 0; i < count; i += 4)
+		{
+			const __m512 q = _mm512_loadu_ps(rotations + 4 * i);
+			const float* t = translations + 3 * i;
+			const float* s = scales + 3 * i;
+
+			__m512 a = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 1, 1)));
+			__m512 b = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 2, 2)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)));
+			const __m512 c0 = _mm512_fmadd_ps(b, signB0, _mm512_fmadd_ps(a, signA0, base0));
+
+			a = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 0, 1)));
+			b = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)));
+			const __m512 c1 = _mm512_fmadd_ps(b, signB1, _mm512_fmadd_ps(a, signA1, base1));
+
+			a = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+			b = _mm512_mul_ps(_mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)), _mm512_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)));
+			const __m512 c2 = _mm512_fmadd_ps(b, signB2, _mm512_fmadd_ps(a, signA2, base2));
+
+			// The 12 scale and translation floats of the four transforms, spread
+			// out so every 128-bit lane gets its own transform's values.
+			const __m512 s12 = _mm512_maskz_loadu_ps(0x0FFF, s);
+			const __m512 t12 = _mm512_maskz_loadu_ps(0x0FFF, t);
+			const __m512 columns[4] = {
+				_mm512_mul_ps(c0, _mm512_permutexvar_ps(scaleX, s12)),
+				_mm512_mul_ps(c1, _mm512_permutexvar_ps(scaleY, s12)),
+				_mm512_mul_ps(c2, _mm512_permutexvar_ps(scaleZ, s12)),
+				_mm512_mask_permutexvar_ps(one, 0x7777, translation, t12)
+			};
+			StoreColumnQuads(out + 16 * i, columns);
+		}
+	}
+
+	inline __m512 Cross(__m512 a, __m512 b)
+	{
+		const __m512 aYZX = _mm512_permute_ps(a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m512 bYZX = _mm512_permute_ps(b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m512 aZXY = _mm512_permute_ps(a, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m512 bZXY = _mm512_permute_ps(b, _MM_SHUFFLE(3, 1, 0, 2));
+		return _mm512_fmsub_ps(aYZX, bZXY, _mm512_mul_ps(aZXY, bYZX));
+	}
+
+	void NormalMatrix(const float* models, float* out, std::size_t count)
+	{
+		const __mmask16 xyzMask = 0x7777;
+		const __m512 lastColumn = _mm512_broadcast_f32x4(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+
+		for (std::size_t i = 0; i < count; i += 4)
+		{
+			const float* src = models + 16 * i;
+			const __m512 matrices[4] = {
+				_mm512_loadu_ps(src + 0),
+				_mm512_loadu_ps(src + 16),
+				_mm512_loadu_ps(src + 32),
+				_mm512_loadu_ps(src + 48)
+			};
+			__m512 m[4];
+			TransposeBlocks(matrices, m);
+			const __m512 m0 = _mm512_maskz_mov_ps(xyzMask, m[0]);
+			const __m512 m1 = _mm512_maskz_mov_ps(xyzMask, m[1]);
+			const __m512 m2 = _mm512_maskz_mov_ps(xyzMask, m[2]);
+
+			const __m512 c0 = Cross(m1, m2);
+			const __m512 c1 = Cross(m2, m0);
+			const __m512 c2 = Cross(m0, m1);
+
+			__m512 det = _mm512_mul_ps(m0, c0);
+			det = _mm512_add_ps(det, _mm512_permute_ps(det, _MM_SHUFFLE(2, 3, 0, 1)));
+			det = _mm512_add_ps(det, _mm512_permute_ps(det, _MM_SHUFFLE(1, 0, 3, 2)));
+			const __m512 invDet = _mm512_div_ps(_mm512_set1_ps(1.0f), det);
+
+			const __m512 columns[4] = {
+				_mm512_mul_ps(c0, invDet),
+				_mm512_mul_ps(c1, invDet),
+				_mm512_mul_ps(c2, invDet),
+				lastColumn
+			};
+			StoreColumnQuads(out + 16 * i, columns);
+		}
+	}
+
+	const MatrixKernelTable sTable = { "AVX-512", 4, Multiply, ComposeTRS, NormalMatrix };
+}
+
+const MatrixKernelTable* GetMatrixKernelsAVX512()
+{
+	return &sTable;
+}
+
+#else
+
+const MatrixKernelTable* GetMatrixKernelsAVX512()
+{
+	return nullptr;
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+
+/// <summary>
+/// Raw kernel entry points shared by MatrixKernels.cpp and the per-ISA
+/// translation units (MatrixKernelsSSE2.cpp, MatrixKernelsAVX2.cpp, ...).
+///
+/// Note: the per-ISA files are compiled with wider instruction sets than the
+/// rest of the program, so they must not include glm (or anything else with
+/// inline functions) -- the linker could otherwise keep the AVX copy of an
+/// inline function and call it on a machine that doesn't support it.
+/// That's why everything here is plain column-major floats.
+/// </summary>
+struct MatrixKernelTable {
+	const char*	mName;
+	/// <summary>
+	/// Kernels only accept counts that are a multiple of this; the caller
+	/// hands the remainder to a narrower table.
+	/// </summary>
+	std::size_t	mBatchWidth;
+
+	/// <summary>
+	/// out[i] = lhs * rhs[i]
+	/// </summary>
+	void (*mMultiply)(const float* lhs, const float* rhs, float* out, std::size_t count);
+	/// <summary>
+	/// out[i] = T(translations[i]) * R(rotations[i]) * S(scales[i])
+	/// translations and scales are packed vec3s, rotations are xyzw quaternions.
+	/// </summary>
+	void (*mComposeTRS)(const float* translations, const float* rotations, const float* scales, float* out, std::size_t count);
+	/// <summary>
+	/// out[i] = inverse(transpose(mat3(models[i]))), widened back to a mat4.
+	/// </summary>
+	void (*mNormalMatrix)(const float* models, float* out, std::size_t count);
+};
+
+// Each returns nullptr when the kernels weren't built for the target architecture.
+const MatrixKernelTable* GetMatrixKernelsScalar();
+const MatrixKernelTable* GetMatrixKernelsSSE2();
+const MatrixKernelTable* GetMatrixKernelsAVX2();
+const MatrixKernelTable* GetMatrixKernelsAVX512();
@@ -0,0 +1,138 @@
+#include "MatrixKernelsISA.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+// SSE2 is our baseline on x86, so glm's own SSE helpers are safe to use here.
+#define GLM_FORCE_SSE2
+#include "glm/detail/setup.hpp"
+#include "glm/simd/matrix.h"
+
+namespace {
+
+	void Multiply(const float* lhs, const float* rhs, float* out, std::size_t count)
+	{
+		const glm_vec4 l[4] = {
+			_mm_loadu_ps(lhs + 0),
+			_mm_loadu_ps(lhs + 4),
+			_mm_loadu_ps(lhs + 8),
+			_mm_loadu_ps(lhs + 12)
+		};
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* r = rhs + 16 * i;
+			const glm_vec4 in[4] = {
+				_mm_loadu_ps(r + 0),
+				_mm_loadu_ps(r + 4),
+				_mm_loadu_ps(r + 8),
+				_mm_loadu_ps(r + 12)
+			};
+			glm_vec4 result[4];
+			glm_mat4_mul(l, in, result);
+
+			float* o = out + 16 * i;
+			_mm_storeu_ps(o + 0, result[0]);
+			_mm_storeu_ps(o + 4, result[1]);
+			_mm_storeu_ps(o + 8, result[2]);
+			_mm_storeu_ps(o + 12, result[3]);
+		}
+	}
+
+	void ComposeTRS(const float* translations, const float* rotations, const float* scales, float* out, std::size_t count)
+	{
+		// Rotation columns are built as base + A*sA + B*sB where A and B are
+		// products of shuffled quaternion components (see MatrixKernels.cpp
+		// for the scalar version). The factor 2 is folded into the signs.
+		const __m128 base0 = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+		const __m128 base1 = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+		const __m128 base2 = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+		const __m128 signA0 = _mm_setr_ps(-2.0f, 2.0f, 2.0f, 0.0f);
+		const __m128 signB0 = _mm_setr_ps(-2.0f, 2.0f, -2.0f, 0.0f);
+		const __m128 signA1 = _mm_setr_ps(2.0f, -2.0f, 2.0f, 0.0f);
+		const __m128 signB1 = _mm_setr_ps(-2.0f, -2.0f, 2.0f, 0.0f);
+		const __m128 signA2 = _mm_setr_ps(2.0f, 2.0f, -2.0f, 0.0f);
+		const __m128 signB2 = _mm_setr_ps(2.0f, -2.0f, -2.0f, 0.0f);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const __m128 q = _mm_loadu_ps(rotations + 4 * i);
+			const float* t = translations + 3 * i;
+			const float* s = scales + 3 * i;
+
+			// (yy, xy, xz) and (zz, zw, yw)
+			__m128 a = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 1, 1)));
+			__m128 b = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 2, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)));
+			__m128 c0 = _mm_add_ps(base0, _mm_add_ps(_mm_mul_ps(a, signA0), _mm_mul_ps(b, signB0)));
+
+			// (xy, xx, yz) and (zw, zz, xw)
+			a = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 0, 1)));
+			b = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)));
+			__m128 c1 = _mm_add_ps(base1, _mm_add_ps(_mm_mul_ps(a, signA1), _mm_mul_ps(b, signB1)));
+
+			// (xz, yz, xx) and (yw, xw, yy)
+			a = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+			b = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)));
+			__m128 c2 = _mm_add_ps(base2, _mm_add_ps(_mm_mul_ps(a, signA2), _mm_mul_ps(b, signB2)));
+
+			float* o = out + 16 * i;
+			_mm_storeu_ps(o + 0, _mm_mul_ps(c0, _mm_set1_ps(s[0])));
+			_mm_storeu_ps(o + 4, _mm_mul_ps(c1, _mm_set1_ps(s[1])));
+			_mm_storeu_ps(o + 8, _mm_mul_ps(c2, _mm_set1_ps(s[2])));
+			_mm_storeu_ps(o + 12, _mm_setr_ps(t[0], t[1], t[2], 1.0f));
+		}
+	}
+
+	inline __m128 Cross(__m128 a, __m128 b)
+	{
+		const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 aZXY = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+		const __m128 bZXY = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+		return _mm_sub_ps(_mm_mul_ps(aYZX, bZXY), _mm_mul_ps(aZXY, bYZX));
+	}
+
+	void NormalMatrix(const float* models, float* out, std::size_t count)
+	{
+		const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* m = models + 16 * i;
+			const __m128 m0 = _mm_and_ps(_mm_loadu_ps(m + 0), xyzMask);
+			const __m128 m1 = _mm_and_ps(_mm_loadu_ps(m + 4), xyzMask);
+			const __m128 m2 = _mm_and_ps(_mm_loadu_ps(m + 8), xyzMask);
+
+			// The cofactor columns are the inverse-transpose up to 1/det.
+			const __m128 c0 = Cross(m1, m2);
+			const __m128 c1 = Cross(m2, m0);
+			const __m128 c2 = Cross(m0, m1);
+
+			__m128 det = _mm_mul_ps(m0, c0);
+			det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+			det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+			const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+			float* o = out + 16 * i;
+			_mm_storeu_ps(o + 0, _mm_mul_ps(c0, invDet));
+			_mm_storeu_ps(o + 4, _mm_mul_ps(c1, invDet));
+			_mm_storeu_ps(o + 8, _mm_mul_ps(c2, invDet));
+			_mm_storeu_ps(o + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+		}
+	}
+
+	const MatrixKernelTable sTable = { "SSE2", 1, Multiply, ComposeTRS, NormalMatrix };
+}
+
+const MatrixKernelTable* GetMatrixKernelsSSE2()
+{
+	return &sTable;
+}
+
+#else
+
+const MatrixKernelTable* GetMatrixKernelsSSE2()
+{
+	return nullptr;
+}
+
+#endif
@@ -0,0 +1,323 @@
+#include "MeshBufferPool.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+#include <limits>
+
+MeshBufferPool::Handle MeshBufferPool::Create(const VertexFormat& format, const void* vertices, std::uint32_t vertexCount, const GLuint* indices, std::uint32_t indexCount)
+{
+	const Handle handle = Allocate(format, vertexCount, indexCount);
+	if (handle == InvalidHandle)
+	{
+		return InvalidHandle;
+	}
+	const Allocation& allocation = mAllocations[handle];
+	const Arena& arena = mArenas[allocation.mArena];
+	const GLsizeiptr stride = arena.mFormat.mStride;
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mVertexBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, arena.mVertices.GetOffset(allocation.mVertices) * stride, vertexCount * stride, vertices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mIndexBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, arena.mIndices.GetOffset(allocation.mIndices) * sizeof(GLuint), indexCount * sizeof(GLuint), indices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	return handle;
+}
+
+MeshBufferPool::Handle MeshBufferPool::CreateFromBuffer(const VertexFormat& format, GLuint source, std::uint32_t vertexCount, std::uint32_t indexCount)
+{
+	const Handle handle = Allocate(format, vertexCount, indexCount);
+	if (handle == InvalidHandle)
+	{
+		return InvalidHandle;
+	}
+	const Allocation& allocation = mAllocations[handle];
+	const Arena& arena = mArenas[allocation.mArena];
+	const GLsizeiptr stride = arena.mFormat.mStride;
+	const GLsizeiptr vertexBytes = vertexCount * stride;
+
+	glBindBuffer(GL_COPY_READ_BUFFER, source);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mVertexBuffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+		0, arena.mVertices.GetOffset(allocation.mVertices) * stride, vertexBytes);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mIndexBuffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+		vertexBytes, arena.mIndices.GetOffset(allocation.mIndices) * sizeof(GLuint), indexCount * sizeof(GLuint));
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	return handle;
+}
+
+void MeshBufferPool::Destroy(Handle handle)
+{
+	Allocation& allocation = mAllocations[handle];
+	if (!allocation.mLive)
+	{
+		return;
+	}
+	Arena& arena = mArenas[allocation.mArena];
+	arena.mVertices.Free(allocation.mVertices);
+	arena.mIndices.Free(allocation.mIndices);
+	allocation.mLive = false;
+	mFreeHandles.push_back(handle);
+}
+
+MeshBufferPool::DrawRange MeshBufferPool::GetDrawRange(Handle handle) const
+{
+	const Allocation& allocation = mAllocations[handle];
+	const Arena& arena = mArenas[allocation.mArena];
+
+	DrawRange range;
+	range.mVertexArray = arena.mVertexArray;
+	range.mIndexCount = static_cast<GLsizei>(arena.mIndices.GetSize(allocation.mIndices));
+	range.mFirstIndex = arena.mIndices.GetOffset(allocation.mIndices);
+	range.mBaseVertex = static_cast<GLint>(arena.mVertices.GetOffset(allocation.mVertices));
+	return range;
+}
+
+void MeshBufferPool::Draw(Handle handle, GLenum mode) const
+{
+	Draw(GetDrawRange(handle), mode);
+}
+
+void MeshBufferPool::Draw(const DrawRange& range, GLenum mode)
+{
+	glBindVertexArray(range.mVertexArray);
+	glDrawElementsBaseVertex(
+		mode,
+		range.mIndexCount,
+		GL_UNSIGNED_INT,
+		reinterpret_cast<const void*>(static_cast<std::uintptr_t>(range.mFirstIndex) * sizeof(GLuint)),
+		range.mBaseVertex
+	);
+}
+
+void MeshBufferPool::Defragment()
+{
+	std::vector<RangeAllocator::Move> moves;
+	for (Arena& arena : mArenas)
+	{
+		arena.mVertices.Compact(&moves);
+		MoveRanges(arena.mVertexBuffer, moves, arena.mFormat.mStride);
+		arena.mIndices.Compact(&moves);
+		MoveRanges(arena.mIndexBuffer, moves, sizeof(GLuint));
+	}
+}
+
+void MeshBufferPool::PrintStats() const
+{
+	for (std::size_t i = 0; i < mArenas.size(); ++i)
+	{
+		const RangeAllocator::Stats vertices = mArenas[i].mVertices.GetStats();
+		const RangeAllocator::Stats indices = mArenas[i].mIndices.GetStats();
+		printf("Mesh arena %d (%d byte vertices): %u meshes\n",
+			static_cast<int>(i),
+			static_cast<int>(mArenas[i].mFormat.mStride),
+			vertices.mAllocationCount);
+		printf("  vertices %u / %u, %u free ranges, largest %u, fragmentation %.2f\n",
+			vertices.mUsed, vertices.mCapacity, vertices.mFreeRangeCount, vertices.mLargestFreeRange, vertices.mFragmentation);
+		printf("  indices  %u / %u, %u free ranges, largest %u, fragmentation %.2f\n",
+			indices.mUsed, indices.mCapacity, indices.mFreeRangeCount, indices.mLargestFreeRange, indices.mFragmentation);
+	}
+}
+
+void MeshBufferPool::DestroyAll()
+{
+	for (Arena& arena : mArenas)
+	{
+		glDeleteVertexArrays(1, &arena.mVertexArray);
+		glDeleteBuffers(1, &arena.mVertexBuffer);
+		glDeleteBuffers(1, &arena.mIndexBuffer);
+	}
+	mArenas.clear();
+	mAllocations.clear();
+	mFreeHandles.clear();
+}
+
+MeshBufferPool::Handle MeshBufferPool::Allocate(const VertexFormat& format, std::uint32_t vertexCount, std::uint32_t indexCount)
+{
+	const std::uint32_t arenaIndex = FindOrCreateArena(format);
+	Arena& arena = mArenas[arenaIndex];
+
+	Allocation allocation;
+	allocation.mArena = arenaIndex;
+	allocation.mLive = true;
+
+	bool grown = false;
+	allocation.mVertices = AllocateGrowing(&arena.mVertices, &arena.mVertexBuffer, arena.mFormat.mStride, vertexCount, &grown);
+	if (allocation.mVertices != RangeAllocator::InvalidHandle)
+	{
+		allocation.mIndices = AllocateGrowing(&arena.mIndices, &arena.mIndexBuffer, sizeof(GLuint), indexCount, &grown);
+	}
+	if (grown)
+	{
+		AttachBuffers(arena);
+	}
+	if (allocation.mIndices == RangeAllocator::InvalidHandle)
+	{
+		if (allocation.mVertices != RangeAllocator::InvalidHandle)
+		{
+			arena.mVertices.Free(allocation.mVertices);
+		}
+		return InvalidHandle;
+	}
+
+	Handle handle;
+	if (!mFreeHandles.empty())
+	{
+		handle = mFreeHandles.back();
+		mFreeHandles.pop_back();
+		mAllocations[handle] = allocation;
+	}
+	else
+	{
+		handle = static_cast<Handle>(mAllocations.size());
+		mAllocations.push_back(allocation);
+	}
+	return handle;
+}
+
+RangeAllocator::Handle MeshBufferPool::AllocateGrowing(RangeAllocator* allocator, GLuint* buffer, GLsizeiptr unitSize, std::uint32_t count, bool* grown)
+{
+	RangeAllocator::Handle range = allocator->Allocate(count);
+	// Requests are rounded up to a size class, so growing by 'count' may
+	// not be enough the first time; each growth at least adds half again.
+	while (range == RangeAllocator::InvalidHandle)
+	{
+		const std::uint32_t oldCapacity = allocator->GetCapacity();
+		const std::uint64_t capacity = static_cast<std::uint64_t>(oldCapacity) + std::max(count, oldCapacity / 2);
+		if (capacity > std::numeric_limits<std::uint32_t>::max()
+			|| static_cast<double>(capacity) * unitSize > static_cast<double>(std::numeric_limits<GLsizeiptr>::max()))
+		{
+			return RangeAllocator::InvalidHandle;
+		}
+		allocator->Grow(static_cast<std::uint32_t>(capacity));
+		GrowBuffer(buffer, oldCapacity * unitSize, allocator->GetCapacity() * unitSize);
+		*grown = true;
+		range = allocator->Allocate(count);
+	}
+	return range;
+}
+
+std::uint32_t MeshBufferPool::FindOrCreateArena(const VertexFormat& format)
+{
+	for (std::size_t i = 0; i < mArenas.size(); ++i)
+	{
+		if (mArenas[i].mFormat == format)
+		{
+			return static_cast<std::uint32_t>(i);
+		}
+	}
+
+	Arena arena;
+	arena.mFormat = format;
+	arena.mVertices.Reset(InitialVertexCapacity);
+	arena.mIndices.Reset(InitialIndexCapacity);
+
+	glGenBuffers(1, &arena.mVertexBuffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mVertexBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, InitialVertexCapacity * static_cast<GLsizeiptr>(format.mStride), nullptr, GL_STATIC_DRAW);
+
+	glGenBuffers(1, &arena.mIndexBuffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.mIndexBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, InitialIndexCapacity * sizeof(GLuint), nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	glGenVertexArrays(1, &arena.mVertexArray);
+	AttachBuffers(arena);
+
+	mArenas.push_back(std::move(arena));
+	return static_cast<std::uint32_t>(mArenas.size() - 1);
+}
+
+void MeshBufferPool::AttachBuffers(const Arena& arena)
+{
+	// The VAO remembers the buffer each attribute reads from, and the
+	// element buffer, so it has to be set up again whenever those change.
+	glBindVertexArray(arena.mVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, arena.mVertexBuffer);
+	for (const VertexAttribute& attribute : arena.mFormat.mAttributes)
+	{
+		glEnableVertexAttribArray(attribute.mIndex);
+		glVertexAttribPointer(
+			attribute.mIndex,
+			attribute.mComponents,
+			attribute.mType,
+			attribute.mNormalized,
+			arena.mFormat.mStride,
+			reinterpret_cast<const void*>(static_cast<std::uintptr_t>(attribute.mOffset))
+		);
+	}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, arena.mIndexBuffer);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void MeshBufferPool::GrowBuffer(GLuint* buffer, GLsizeiptr oldSize, GLsizeiptr newSize)
+{
+	GLuint grown = 0;
+	glGenBuffers(1, &grown);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, grown);
+	glBufferData(GL_COPY_WRITE_BUFFER, newSize, nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_READ_BUFFER, *buffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, oldSize);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	glDeleteBuffers(1, buffer);
+	*buffer = grown;
+}
+
+void MeshBufferPool::MoveRanges(GLuint buffer, const std::vector<RangeAllocator::Move>& moves, GLsizeiptr unitSize)
+{
+	if (moves.empty())
+	{
+		return;
+	}
+
+	// Ranges only move down, in address order, so each one lands on space
+	// that's already free. But a range may overlap where it came from, and
+	// glCopyBufferSubData can't copy overlapping ranges within one buffer,
+	// so those go through a scratch buffer.
+	GLsizeiptr scratchSize = 0;
+	for (const RangeAllocator::Move& move : moves)
+	{
+		if (move.mTo + move.mSize > move.mFrom)
+		{
+			scratchSize = std::max(scratchSize, static_cast<GLsizeiptr>(move.mSize) * unitSize);
+		}
+	}
+
+	GLuint scratch = 0;
+	if (scratchSize > 0)
+	{
+		glGenBuffers(1, &scratch);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, scratch);
+		glBufferData(GL_COPY_WRITE_BUFFER, scratchSize, nullptr, GL_STREAM_COPY);
+	}
+
+	for (const RangeAllocator::Move& move : moves)
+	{
+		const GLintptr from = move.mFrom * unitSize;
+		const GLintptr to = move.mTo * unitSize;
+		const GLsizeiptr size = move.mSize * unitSize;
+		if (move.mTo + move.mSize > move.mFrom)
+		{
+			glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, scratch);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, from, 0, size);
+			glBindBuffer(GL_COPY_READ_BUFFER, scratch);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, to, size);
+		}
+		else
+		{
+			glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, from, to, size);
+		}
+	}
+
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	glDeleteBuffers(1, &scratch);
+}
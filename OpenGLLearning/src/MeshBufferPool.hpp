@@ -0,0 +1,146 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "RangeAllocator.hpp"
+
+/// <summary>
+/// One vertex attribute, as passed to glVertexAttribPointer.
+/// </summary>
+struct VertexAttribute {
+	GLuint		mIndex			= 0;
+	GLint		mComponents		= 0;
+	GLenum		mType			= GL_FLOAT;
+	GLboolean	mNormalized		= GL_FALSE;
+	GLuint		mOffset			= 0;
+
+	bool operator==(const VertexAttribute& other) const
+	{
+		return mIndex == other.mIndex && mComponents == other.mComponents && mType == other.mType
+			&& mNormalized == other.mNormalized && mOffset == other.mOffset;
+	}
+};
+
+/// <summary>
+/// The layout of one interleaved vertex.
+/// </summary>
+struct VertexFormat {
+	GLsizei							mStride = 0;
+	std::vector<VertexAttribute>	mAttributes;
+
+	bool operator==(const VertexFormat& other) const
+	{
+		return mStride == other.mStride && mAttributes == other.mAttributes;
+	}
+};
+
+/// <summary>
+/// Packs the vertices and (32-bit) indices of many meshes into a few large
+/// GL buffers instead of a VAO, VBO and IBO per mesh.
+///
+/// There is one arena per vertex format: a vertex buffer, an index buffer
+/// and a VAO describing both. Meshes are ranges in those, handed out by a
+/// RangeAllocator, and are drawn with glDrawElementsBaseVertex, so their
+/// indices stay relative to their own first vertex and never need patching
+/// when the vertices move. Meshes that share a format therefore share a VAO,
+/// and drawing them back to back needs no rebinding at all.
+///
+/// Arenas grow (by copying on the GPU) when they run out of space, and
+/// Defragment() slides all meshes down so the free space is in one piece.
+/// </summary>
+class MeshBufferPool {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = 0xFFFFFFFFu;
+
+	/// <summary>
+	/// Where a mesh lives, i.e. the arguments of glDrawElementsBaseVertex.
+	/// Only valid until the next Create() or Defragment().
+	/// </summary>
+	struct DrawRange {
+		GLuint	mVertexArray	= 0;
+		GLsizei	mIndexCount		= 0;
+		GLuint	mFirstIndex		= 0;
+		GLint	mBaseVertex		= 0;
+	};
+
+	/// <summary>
+	/// Copies the mesh into the arena for 'format'; 'vertices' holds
+	/// vertexCount * format.mStride bytes. Returns InvalidHandle if the
+	/// arena can't grow to fit it.
+	/// </summary>
+	Handle Create(const VertexFormat& format, const void* vertices, std::uint32_t vertexCount, const GLuint* indices, std::uint32_t indexCount);
+
+	/// <summary>
+	/// Same, but the data is copied on the GPU from 'source', which holds the
+	/// vertices followed by the indices; e.g. a buffer the ResourceWorker filled
+	/// on its own thread. 'source' is left alone, deleting it is up to the caller.
+	/// </summary>
+	Handle CreateFromBuffer(const VertexFormat& format, GLuint source, std::uint32_t vertexCount, std::uint32_t indexCount);
+	void Destroy(Handle handle);
+
+	DrawRange GetDrawRange(Handle handle) const;
+
+	/// <summary>
+	/// Binds the mesh's arena and draws it. glDrawElementsBaseVertex needs GL 3.2.
+	/// </summary>
+	void Draw(Handle handle, GLenum mode = GL_TRIANGLES) const;
+	/// <summary>
+	/// Same, for a range that may only cover some of a mesh's indices, e.g. one
+	/// of its levels of detail.
+	/// </summary>
+	static void Draw(const DrawRange& range, GLenum mode = GL_TRIANGLES);
+
+	/// <summary>
+	/// Moves every mesh towards the start of its arena so all free space is
+	/// contiguous again. The copies are queued on the GPU like any other command.
+	/// </summary>
+	void Defragment();
+
+	/// <summary>
+	/// Capacity, usage and fragmentation of every arena's vertex and index space.
+	/// </summary>
+	void PrintStats() const;
+
+	/// <summary>
+	/// Deletes every arena and its GL objects; all handles become invalid.
+	/// </summary>
+	void DestroyAll();
+
+private:
+	static constexpr std::uint32_t InitialVertexCapacity	= 1u << 16;
+	static constexpr std::uint32_t InitialIndexCapacity		= 3u << 16;
+
+	struct Arena {
+		VertexFormat	mFormat;
+		GLuint			mVertexArray		= 0;
+		GLuint			mVertexBuffer		= 0;
+		GLuint			mIndexBuffer		= 0;
+		RangeAllocator	mVertices;
+		RangeAllocator	mIndices;
+	};
+
+	struct Allocation {
+		std::uint32_t			mArena			= 0;
+		RangeAllocator::Handle	mVertices		= RangeAllocator::InvalidHandle;
+		RangeAllocator::Handle	mIndices		= RangeAllocator::InvalidHandle;
+		bool					mLive			= false;
+	};
+
+	// Ranges for the mesh, growing the arena if needed, but nothing in them
+	// yet. InvalidHandle if the arena can't grow that far.
+	Handle Allocate(const VertexFormat& format, std::uint32_t vertexCount, std::uint32_t indexCount);
+	// A range of 'count' units of 'allocator', growing it and 'buffer' until
+	// one fits; sets 'grown' if the buffer was replaced.
+	static RangeAllocator::Handle AllocateGrowing(RangeAllocator* allocator, GLuint* buffer, GLsizeiptr unitSize, std::uint32_t count, bool* grown);
+	std::uint32_t FindOrCreateArena(const VertexFormat& format);
+	static void AttachBuffers(const Arena& arena);
+	static void GrowBuffer(GLuint* buffer, GLsizeiptr oldSize, GLsizeiptr newSize);
+	static void MoveRanges(GLuint buffer, const std::vector<RangeAllocator::Move>& moves, GLsizeiptr unitSize);
+
+	std::vector<Arena>			mArenas;
+	std::vector<Allocation>		mAllocations;
+	std::vector<Handle>			mFreeHandles;
+};
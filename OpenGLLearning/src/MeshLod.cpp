@@ -0,0 +1,400 @@
+#include "MeshLod.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+
+	/// <summary>
+	/// The symmetric 4x4 matrix of a sum of squared plane equations, so that
+	/// Evaluate(p) is the sum of the squared distances of p to every plane.
+	/// </summary>
+	struct Quadric {
+		double	mXX = 0.0, mXY = 0.0, mXZ = 0.0, mXW = 0.0;
+		double	mYY = 0.0, mYZ = 0.0, mYW = 0.0;
+		double	mZZ = 0.0, mZW = 0.0;
+		double	mWW = 0.0;
+
+		// The plane n.p + d = 0, with n unit length.
+		void AddPlane(const glm::dvec3& n, double d)
+		{
+			mXX += n.x * n.x; mXY += n.x * n.y; mXZ += n.x * n.z; mXW += n.x * d;
+			mYY += n.y * n.y; mYZ += n.y * n.z; mYW += n.y * d;
+			mZZ += n.z * n.z; mZW += n.z * d;
+			mWW += d * d;
+		}
+
+		Quadric& operator+=(const Quadric& other)
+		{
+			mXX += other.mXX; mXY += other.mXY; mXZ += other.mXZ; mXW += other.mXW;
+			mYY += other.mYY; mYZ += other.mYZ; mYW += other.mYW;
+			mZZ += other.mZZ; mZW += other.mZW;
+			mWW += other.mWW;
+			return *this;
+		}
+
+		double Evaluate(const glm::dvec3& p) const
+		{
+			const double result =
+				mXX * p.x * p.x + 2.0 * mXY * p.x * p.y + 2.0 * mXZ * p.x * p.z + 2.0 * mXW * p.x +
+				mYY * p.y * p.y + 2.0 * mYZ * p.y * p.z + 2.0 * mYW * p.y +
+				mZZ * p.z * p.z + 2.0 * mZW * p.z +
+				mWW;
+			// Rounding can take a sum of squares slightly below zero.
+			return std::max(result, 0.0);
+		}
+	};
+
+	struct Collapse {
+		std::uint32_t	mFrom;
+		std::uint32_t	mTo;
+		double			mCost;
+	};
+
+	glm::dvec3 Position(const float* vertices, std::uint32_t floatsPerVertex, std::uint32_t vertex)
+	{
+		const float* v = vertices + static_cast<std::size_t>(vertex) * floatsPerVertex;
+		return glm::dvec3(v[0], v[1], v[2]);
+	}
+
+	/// <summary>
+	/// Vertices that never move: those on an open border, and those sharing
+	/// their position with another vertex.
+	/// </summary>
+	std::vector<bool> FindLockedVertices(const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+		const std::uint32_t* indices, std::uint32_t indexCount)
+	{
+		// Vertices with the same position end up next to each other; the
+		// first of each run stands for the rest.
+		std::vector<std::uint32_t> order(vertexCount);
+		std::iota(order.begin(), order.end(), 0u);
+		auto less = [&](std::uint32_t a, std::uint32_t b) {
+			const float* pa = vertices + static_cast<std::size_t>(a) * floatsPerVertex;
+			const float* pb = vertices + static_cast<std::size_t>(b) * floatsPerVertex;
+			return std::lexicographical_compare(pa, pa + 3, pb, pb + 3);
+		};
+		std::sort(order.begin(), order.end(), less);
+
+		std::vector<bool> locked(vertexCount, false);
+		std::vector<std::uint32_t> representative(vertexCount);
+		for (std::uint32_t i = 0; i < vertexCount; )
+		{
+			std::uint32_t end = i + 1;
+			while (end < vertexCount && !less(order[i], order[end]))
+			{
+				++end;
+			}
+			for (std::uint32_t j = i; j < end; ++j)
+			{
+				representative[order[j]] = order[i];
+				locked[order[j]] = end - i > 1;
+			}
+			i = end;
+		}
+
+		// An edge only one triangle uses is on a border. Seams count as one
+		// edge, so they don't look like borders.
+		std::unordered_map<std::uint64_t, std::uint32_t> edgeUses;
+		edgeUses.reserve(indexCount);
+		for (std::uint32_t i = 0; i < indexCount; ++i)
+		{
+			const std::uint32_t a = representative[indices[i]];
+			const std::uint32_t b = representative[indices[i - i % 3 + (i + 1) % 3]];
+			++edgeUses[(static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b)];
+		}
+		std::vector<bool> borderRepresentative(vertexCount, false);
+		for (const auto& edge : edgeUses)
+		{
+			if (edge.second == 1)
+			{
+				borderRepresentative[static_cast<std::uint32_t>(edge.first >> 32)] = true;
+				borderRepresentative[static_cast<std::uint32_t>(edge.first)] = true;
+			}
+		}
+		for (std::uint32_t v = 0; v < vertexCount; ++v)
+		{
+			if (borderRepresentative[representative[v]])
+			{
+				locked[v] = true;
+			}
+		}
+		return locked;
+	}
+}
+
+std::vector<std::uint32_t> MeshLod::Simplify(
+	const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+	const std::uint32_t* indices, std::uint32_t indexCount,
+	std::uint32_t targetIndexCount, float attributeWeight, float* error)
+{
+	std::vector<std::uint32_t> triangles(indices, indices + indexCount);
+	double maxCost = 0.0;
+
+	const std::vector<bool> locked = FindLockedVertices(vertices, vertexCount, floatsPerVertex, indices, indexCount);
+
+	std::vector<Quadric> quadrics(vertexCount);
+	for (std::uint32_t i = 0; i < indexCount; i += 3)
+	{
+		const glm::dvec3 p0 = Position(vertices, floatsPerVertex, indices[i]);
+		const glm::dvec3 p1 = Position(vertices, floatsPerVertex, indices[i + 1]);
+		const glm::dvec3 p2 = Position(vertices, floatsPerVertex, indices[i + 2]);
+		const glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+		const double length = glm::length(normal);
+		if (length == 0.0)
+		{
+			continue;
+		}
+		Quadric plane;
+		plane.AddPlane(normal / length, -glm::dot(normal / length, p0));
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			quadrics[indices[i + corner]] += plane;
+		}
+	}
+
+	const double attributeWeight2 = static_cast<double>(attributeWeight) * attributeWeight;
+	auto attributeCost = [&](std::uint32_t a, std::uint32_t b) {
+		double cost = 0.0;
+		for (std::uint32_t i = 3; i < floatsPerVertex; ++i)
+		{
+			const double difference = vertices[static_cast<std::size_t>(a) * floatsPerVertex + i] - vertices[static_cast<std::size_t>(b) * floatsPerVertex + i];
+			cost += difference * difference;
+		}
+		return cost * attributeWeight2;
+	};
+
+	std::vector<std::uint32_t> adjacencyOffsets(vertexCount + 1);
+	std::vector<std::uint32_t> adjacency;
+	std::vector<Collapse> collapses;
+	std::vector<bool> touched(vertexCount);
+	std::vector<bool> dead;
+	std::vector<std::uint32_t> neighboursA;
+	std::vector<std::uint32_t> neighboursB;
+	std::vector<std::uint32_t> common;
+
+	// Each pass collapses the cheapest edges it can without two collapses
+	// sharing a vertex, so the adjacency it built stays good for the pass.
+	while (triangles.size() > targetIndexCount)
+	{
+		const std::uint32_t triangleCount = static_cast<std::uint32_t>(triangles.size() / 3);
+
+		std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0u);
+		for (std::uint32_t index : triangles)
+		{
+			++adjacencyOffsets[index + 1];
+		}
+		std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+		adjacency.resize(triangles.size());
+		{
+			std::vector<std::uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (std::uint32_t i = 0; i < triangles.size(); ++i)
+			{
+				adjacency[fill[triangles[i]]++] = i / 3;
+			}
+		}
+
+		// Every directed edge a->b of a triangle is the collapse of a onto b;
+		// the triangle next to it has b->a.
+		collapses.clear();
+		for (std::uint32_t i = 0; i < triangles.size(); ++i)
+		{
+			const std::uint32_t from = triangles[i];
+			const std::uint32_t to = triangles[i - i % 3 + (i + 1) % 3];
+			if (locked[from])
+			{
+				continue;
+			}
+			Quadric merged = quadrics[from];
+			merged += quadrics[to];
+			const double cost = merged.Evaluate(Position(vertices, floatsPerVertex, to)) + attributeCost(from, to);
+			collapses.push_back({ from, to, cost });
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.mCost < b.mCost; });
+
+		std::fill(touched.begin(), touched.end(), false);
+		dead.assign(triangleCount, false);
+		const std::uint32_t toRemove = triangleCount - targetIndexCount / 3;
+		std::uint32_t removed = 0;
+
+		for (const Collapse& collapse : collapses)
+		{
+			if (removed >= toRemove)
+			{
+				break;
+			}
+			const std::uint32_t a = collapse.mFrom;
+			const std::uint32_t b = collapse.mTo;
+			if (touched[a] || touched[b])
+			{
+				continue;
+			}
+
+			const glm::dvec3 pa = Position(vertices, floatsPerVertex, a);
+			const glm::dvec3 pb = Position(vertices, floatsPerVertex, b);
+
+			// Link condition: a and b may only have the third vertices of the
+			// triangles they share in common, or the surface pinches.
+			std::uint32_t shared = 0;
+			auto gatherNeighbours = [&](std::uint32_t vertex, std::vector<std::uint32_t>* result) {
+				result->clear();
+				for (std::uint32_t k = adjacencyOffsets[vertex]; k < adjacencyOffsets[vertex + 1]; ++k)
+				{
+					const std::uint32_t* t = &triangles[adjacency[k] * 3];
+					for (int corner = 0; corner < 3; ++corner)
+					{
+						if (t[corner] != a && t[corner] != b)
+						{
+							result->push_back(t[corner]);
+						}
+					}
+				}
+				std::sort(result->begin(), result->end());
+				result->erase(std::unique(result->begin(), result->end()), result->end());
+			};
+			for (std::uint32_t k = adjacencyOffsets[a]; k < adjacencyOffsets[a + 1]; ++k)
+			{
+				const std::uint32_t* t = &triangles[adjacency[k] * 3];
+				shared += (t[0] == b || t[1] == b || t[2] == b) ? 1 : 0;
+			}
+			gatherNeighbours(a, &neighboursA);
+			gatherNeighbours(b, &neighboursB);
+			common.clear();
+			std::set_intersection(neighboursA.begin(), neighboursA.end(), neighboursB.begin(), neighboursB.end(), std::back_inserter(common));
+			if (common.size() > shared)
+			{
+				continue;
+			}
+
+			// Moving a onto b must not flip or flatten a triangle that stays.
+			bool flips = false;
+			for (std::uint32_t k = adjacencyOffsets[a]; k < adjacencyOffsets[a + 1] && !flips; ++k)
+			{
+				const std::uint32_t* t = &triangles[adjacency[k] * 3];
+				if (t[0] == b || t[1] == b || t[2] == b)
+				{
+					continue;
+				}
+				const glm::dvec3 p0 = t[0] == a ? pa : Position(vertices, floatsPerVertex, t[0]);
+				const glm::dvec3 p1 = t[1] == a ? pa : Position(vertices, floatsPerVertex, t[1]);
+				const glm::dvec3 p2 = t[2] == a ? pa : Position(vertices, floatsPerVertex, t[2]);
+				const glm::dvec3 q0 = t[0] == a ? pb : p0;
+				const glm::dvec3 q1 = t[1] == a ? pb : p1;
+				const glm::dvec3 q2 = t[2] == a ? pb : p2;
+				const glm::dvec3 before = glm::cross(p1 - p0, p2 - p0);
+				const glm::dvec3 after = glm::cross(q1 - q0, q2 - q0);
+				flips = glm::dot(before, after) <= 1e-3 * glm::length(before) * glm::length(after)
+					|| glm::length(after) <= 1e-9 * glm::length(before);
+			}
+			if (flips)
+			{
+				continue;
+			}
+
+			for (std::uint32_t k = adjacencyOffsets[a]; k < adjacencyOffsets[a + 1]; ++k)
+			{
+				const std::uint32_t triangle = adjacency[k];
+				std::uint32_t* t = &triangles[triangle * 3];
+				if (t[0] == b || t[1] == b || t[2] == b)
+				{
+					dead[triangle] = true;
+					++removed;
+				}
+				for (int corner = 0; corner < 3; ++corner)
+				{
+					t[corner] = t[corner] == a ? b : t[corner];
+				}
+			}
+			quadrics[b] += quadrics[a];
+			touched[a] = touched[b] = true;
+			maxCost = std::max(maxCost, quadrics[b].Evaluate(pb));
+		}
+
+		if (removed == 0)
+		{
+			break;
+		}
+		std::uint32_t write = 0;
+		for (std::uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			if (!dead[triangle])
+			{
+				std::copy_n(&triangles[triangle * 3], 3, &triangles[write]);
+				write += 3;
+			}
+		}
+		triangles.resize(write);
+	}
+
+	// Every merged plane is within this distance, so no single one is further.
+	*error = static_cast<float>(std::sqrt(maxCost));
+	return triangles;
+}
+
+std::vector<MeshLod::Lod> MeshLod::BuildChain(
+	const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+	std::vector<std::uint32_t>* indices, const Settings& settings)
+{
+	const std::uint32_t indexCount = static_cast<std::uint32_t>(indices->size());
+	std::vector<Lod> lods(1);
+	lods[0].mIndexCount = indexCount;
+
+	// Every level is simplified from the original, so its error is measured
+	// against the original too rather than piling up level after level.
+	const std::vector<std::uint32_t> original(*indices);
+	while (static_cast<int>(lods.size()) < settings.mMaxLevels)
+	{
+		const std::uint32_t previous = lods.back().mIndexCount;
+		const std::uint32_t target = static_cast<std::uint32_t>(previous / 3 * settings.mReduction) * 3;
+		if (target / 3 < settings.mMinTriangles)
+		{
+			break;
+		}
+
+		float error = 0.0f;
+		const std::vector<std::uint32_t> level = Simplify(
+			vertices, vertexCount, floatsPerVertex, original.data(), indexCount,
+			target, settings.mAttributeWeight, &error);
+		// Not worth a level if the locked vertices kept it from losing at least a tenth.
+		if (level.size() > previous - previous / 10)
+		{
+			break;
+		}
+
+		Lod lod;
+		lod.mFirstIndex = static_cast<std::uint32_t>(indices->size());
+		lod.mIndexCount = static_cast<std::uint32_t>(level.size());
+		lod.mError = std::max(error, lods.back().mError);
+		indices->insert(indices->end(), level.begin(), level.end());
+		lods.push_back(lod);
+	}
+	return lods;
+}
+
+std::size_t MeshLod::Select(const std::vector<Lod>& lods, const glm::mat4& modelViewProjection,
+	const glm::vec4& boundingSphere, float viewportHeight, float pixelThreshold)
+{
+	// Clip space w is the distance along the view direction, and the
+	// length of the y row is how much a unit of model space scales by on
+	// its way to clip space y.
+	const glm::vec4 rowY(modelViewProjection[0][1], modelViewProjection[1][1], modelViewProjection[2][1], modelViewProjection[3][1]);
+	const glm::vec4 rowW(modelViewProjection[0][3], modelViewProjection[1][3], modelViewProjection[2][3], modelViewProjection[3][3]);
+	const float distance = glm::dot(glm::vec3(rowW), glm::vec3(boundingSphere)) + rowW.w
+		- boundingSphere.w * glm::length(glm::vec3(rowW));
+	if (distance <= 0.0f)
+	{
+		return 0;
+	}
+	const float pixelsPerUnit = glm::length(glm::vec3(rowY)) / distance * viewportHeight * 0.5f;
+
+	for (std::size_t i = lods.size(); i-- > 1; )
+	{
+		if (lods[i].mError * pixelsPerUnit <= pixelThreshold)
+		{
+			return i;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Levels of detail for a mesh: the same vertices, indexed by fewer and
+/// fewer triangles, and the pick of one of them per draw.
+///
+/// Simplify() collapses edges, cheapest first, where the cost is the
+/// quadric error of the collapse (Garland & Heckbert: the squared distance
+/// of the new position to the planes of every triangle merged into it)
+/// plus how much the other vertex attributes (colors, normals, texture
+/// coordinates) change. A vertex only ever moves onto one of its
+/// neighbours, so the vertex buffer is shared by all levels.
+///
+/// Vertices on an open border, and vertices that share their position with
+/// another one (attribute seams), never move, so holes don't open and seams
+/// don't tear. Collapses that would flip a triangle or make the surface
+/// non-manifold are skipped.
+///
+/// Vertices are 'floatsPerVertex' floats each: the position first, then
+/// any number of attributes.
+/// </summary>
+namespace MeshLod {
+	struct Lod {
+		// Where the level's indices start in the mesh's index data, and how many.
+		std::uint32_t	mFirstIndex		= 0;
+		std::uint32_t	mIndexCount		= 0;
+		// How far, at most, the surface strayed from the original, in model
+		// space. As the quadrics are unweighted sums this errs on the large side.
+		float			mError			= 0.0f;
+	};
+
+	struct Settings {
+		// Including the original.
+		int				mMaxLevels			= 4;
+		// Each level aims for this fraction of the previous one's triangles.
+		float			mReduction			= 0.5f;
+		// A unit of attribute change costs as much as this much distance.
+		float			mAttributeWeight	= 1.0f;
+		// No level gets smaller than this.
+		std::uint32_t	mMinTriangles		= 8;
+	};
+
+	/// <summary>
+	/// The triangles of 'indices' simplified down to at most
+	/// 'targetIndexCount' indices, or as close as the locked vertices allow.
+	/// Writes the error of the result to 'error'.
+	/// </summary>
+	std::vector<std::uint32_t> Simplify(
+		const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+		const std::uint32_t* indices, std::uint32_t indexCount,
+		std::uint32_t targetIndexCount, float attributeWeight, float* error);
+
+	/// <summary>
+	/// Appends the simplified levels of 'indices' to it and returns them all,
+	/// the original first. Stops early when a level wouldn't lose enough.
+	/// </summary>
+	std::vector<Lod> BuildChain(
+		const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+		std::vector<std::uint32_t>* indices, const Settings& settings = Settings());
+
+	/// <summary>
+	/// The coarsest level whose error, seen at the near side of
+	/// 'boundingSphere' through 'modelViewProjection', covers at most
+	/// 'pixelThreshold' pixels of a viewport 'viewportHeight' pixels high.
+	/// cull_comp.glsl does the same on the GPU.
+	/// </summary>
+	std::size_t Select(const std::vector<Lod>& lods, const glm::mat4& modelViewProjection,
+		const glm::vec4& boundingSphere, float viewportHeight, float pixelThreshold);
+}
@@ -0,0 +1,253 @@
+#include "Meshlets.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+	glm::vec3 Position(const float* vertices, std::uint32_t floatsPerVertex, std::uint32_t vertex)
+	{
+		const float* v = vertices + static_cast<std::size_t>(vertex) * floatsPerVertex;
+		return glm::vec3(v[0], v[1], v[2]);
+	}
+
+	/// <summary>
+	/// Bounding sphere and normal cone of the triangles in 'indices'.
+	/// </summary>
+	void ComputeBounds(const float* vertices, std::uint32_t floatsPerVertex,
+		const std::uint32_t* indices, std::uint32_t indexCount, Meshlets::Meshlet* meshlet)
+	{
+		glm::vec3 minimum = Position(vertices, floatsPerVertex, indices[0]);
+		glm::vec3 maximum = minimum;
+		glm::vec3 normalSum(0.0f);
+		for (std::uint32_t i = 0; i < indexCount; i += 3)
+		{
+			const glm::vec3 p0 = Position(vertices, floatsPerVertex, indices[i]);
+			const glm::vec3 p1 = Position(vertices, floatsPerVertex, indices[i + 1]);
+			const glm::vec3 p2 = Position(vertices, floatsPerVertex, indices[i + 2]);
+			minimum = glm::min(minimum, glm::min(p0, glm::min(p1, p2)));
+			maximum = glm::max(maximum, glm::max(p0, glm::max(p1, p2)));
+
+			const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+			const float length = glm::length(normal);
+			if (length > 0.0f)
+			{
+				normalSum += normal / length;
+			}
+		}
+
+		const glm::vec3 center = (minimum + maximum) * 0.5f;
+		float radius = 0.0f;
+		for (std::uint32_t i = 0; i < indexCount; ++i)
+		{
+			radius = std::max(radius, glm::length(Position(vertices, floatsPerVertex, indices[i]) - center));
+		}
+		meshlet->mBoundingSphere = glm::vec4(center, radius);
+
+		meshlet->mConeCutoff = 1.0f;
+		const float sumLength = glm::length(normalSum);
+		if (sumLength <= 0.0f)
+		{
+			return;
+		}
+		meshlet->mConeAxis = normalSum / sumLength;
+
+		float minimumDot = 1.0f;
+		for (std::uint32_t i = 0; i < indexCount; i += 3)
+		{
+			const glm::vec3 p0 = Position(vertices, floatsPerVertex, indices[i]);
+			const glm::vec3 normal = glm::cross(
+				Position(vertices, floatsPerVertex, indices[i + 1]) - p0,
+				Position(vertices, floatsPerVertex, indices[i + 2]) - p0);
+			const float length = glm::length(normal);
+			if (length > 0.0f)
+			{
+				minimumDot = std::min(minimumDot, glm::dot(meshlet->mConeAxis, normal / length));
+			}
+		}
+		// Past about 85 degrees the cone would hardly ever cull anything.
+		if (minimumDot > 0.1f)
+		{
+			meshlet->mConeCutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+		}
+	}
+}
+
+std::vector<Meshlets::Meshlet> Meshlets::Build(const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+	std::uint32_t* indices, std::uint32_t indexCount)
+{
+	const std::uint32_t triangleCount = indexCount / 3;
+	std::vector<Meshlet> meshlets;
+	if (triangleCount == 0)
+	{
+		return meshlets;
+	}
+
+	// The triangles around every vertex.
+	std::vector<std::uint32_t> adjacencyOffsets(vertexCount + 1, 0u);
+	for (std::uint32_t i = 0; i < indexCount; ++i)
+	{
+		++adjacencyOffsets[indices[i] + 1];
+	}
+	std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+	std::vector<std::uint32_t> adjacency(indexCount);
+	{
+		std::vector<std::uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (std::uint32_t i = 0; i < indexCount; ++i)
+		{
+			adjacency[fill[indices[i]]++] = i / 3;
+		}
+	}
+
+	const std::vector<std::uint32_t> source(indices, indices + indexCount);
+	std::vector<bool> emitted(triangleCount, false);
+	// Which meshlet last took the vertex, so it needn't be cleared in between.
+	std::vector<std::uint32_t> owner(vertexCount, ~0u);
+	std::vector<std::uint32_t> frontier;
+	std::uint32_t written = 0;
+	std::uint32_t nextSeed = 0;
+
+	while (written < indexCount)
+	{
+		const std::uint32_t id = static_cast<std::uint32_t>(meshlets.size());
+		Meshlet meshlet;
+		meshlet.mFirstIndex = written;
+		std::uint32_t meshletVertices = 0;
+		glm::vec3 positionSum(0.0f);
+		frontier.clear();
+
+		while (emitted[nextSeed])
+		{
+			++nextSeed;
+		}
+		std::uint32_t triangle = nextSeed;
+
+		while (true)
+		{
+			const std::uint32_t* t = &source[triangle * 3];
+			for (int corner = 0; corner < 3; ++corner)
+			{
+				if (owner[t[corner]] != id)
+				{
+					owner[t[corner]] = id;
+					++meshletVertices;
+					positionSum += Position(vertices, floatsPerVertex, t[corner]);
+					frontier.insert(frontier.end(),
+						adjacency.begin() + adjacencyOffsets[t[corner]],
+						adjacency.begin() + adjacencyOffsets[t[corner] + 1]);
+				}
+				indices[written++] = t[corner];
+			}
+			emitted[triangle] = true;
+			meshlet.mIndexCount += 3;
+			if (meshlet.mIndexCount / 3 == MaxTriangles)
+			{
+				break;
+			}
+
+			// Next, the neighbour that brings in the fewest new vertices and
+			// still fits; on a tie the one nearest the middle, so the meshlet
+			// grows round rather than in strips.
+			const glm::vec3 center = positionSum / static_cast<float>(meshletVertices);
+			std::uint32_t best = ~0u;
+			std::uint32_t bestNew = 4;
+			float bestDistance = 0.0f;
+			std::size_t keep = 0;
+			for (std::uint32_t candidate : frontier)
+			{
+				if (emitted[candidate])
+				{
+					continue;
+				}
+				frontier[keep++] = candidate;
+				const std::uint32_t* c = &source[candidate * 3];
+				const std::uint32_t added = (owner[c[0]] != id) + (owner[c[1]] != id) + (owner[c[2]] != id);
+				if (meshletVertices + added > MaxVertices || added > bestNew)
+				{
+					continue;
+				}
+				const glm::vec3 offset = Position(vertices, floatsPerVertex, c[0]) + Position(vertices, floatsPerVertex, c[1])
+					+ Position(vertices, floatsPerVertex, c[2]) - 3.0f * center;
+				const float distance = glm::dot(offset, offset);
+				if (added < bestNew || distance < bestDistance)
+				{
+					best = candidate;
+					bestNew = added;
+					bestDistance = distance;
+				}
+			}
+			frontier.resize(keep);
+			if (best == ~0u)
+			{
+				break;
+			}
+			triangle = best;
+		}
+
+		ComputeBounds(vertices, floatsPerVertex, indices + meshlet.mFirstIndex, meshlet.mIndexCount, &meshlet);
+		meshlets.push_back(meshlet);
+	}
+	return meshlets;
+}
+
+std::size_t Meshlets::Cull(const std::vector<Meshlet>& meshlets, const glm::mat4& modelViewProjection, bool cullBackFacing,
+	std::vector<Range>* visible)
+{
+	// The clip planes, in model space (Gribb & Hartmann), as in cull_comp.glsl.
+	const glm::mat4& m = modelViewProjection;
+	const glm::vec4 rowX(m[0][0], m[1][0], m[2][0], m[3][0]);
+	const glm::vec4 rowY(m[0][1], m[1][1], m[2][1], m[3][1]);
+	const glm::vec4 rowZ(m[0][2], m[1][2], m[2][2], m[3][2]);
+	const glm::vec4 rowW(m[0][3], m[1][3], m[2][3], m[3][3]);
+	glm::vec4 planes[6] = { rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowW + rowZ, rowW - rowZ };
+	for (glm::vec4& plane : planes)
+	{
+		plane /= glm::length(glm::vec3(plane));
+	}
+	const glm::vec3 eye = GetEyePosition(modelViewProjection);
+
+	visible->clear();
+	std::size_t count = 0;
+	for (const Meshlet& meshlet : meshlets)
+	{
+		const glm::vec3 center(meshlet.mBoundingSphere);
+		const float radius = meshlet.mBoundingSphere.w;
+
+		bool inside = true;
+		for (const glm::vec4& plane : planes)
+		{
+			inside = inside && glm::dot(glm::vec3(plane), center) + plane.w >= -radius;
+		}
+		if (!inside)
+		{
+			continue;
+		}
+
+		// Every triangle faces away if the whole sphere is behind the cone
+		// (the cone of normals widened by its own angle, seen from the eye).
+		const glm::vec3 toCenter = center - eye;
+		if (cullBackFacing && glm::dot(toCenter, meshlet.mConeAxis) >= meshlet.mConeCutoff * glm::length(toCenter) + radius)
+		{
+			continue;
+		}
+
+		++count;
+		if (!visible->empty() && visible->back().mFirstIndex + visible->back().mIndexCount == meshlet.mFirstIndex)
+		{
+			visible->back().mIndexCount += meshlet.mIndexCount;
+		}
+		else
+		{
+			visible->push_back({ meshlet.mFirstIndex, meshlet.mIndexCount });
+		}
+	}
+	return count;
+}
+
+glm::vec3 Meshlets::GetEyePosition(const glm::mat4& modelViewProjection)
+{
+	// The eye is the one point a perspective projection sends to x = y = w = 0.
+	const glm::vec4 eye = glm::inverse(modelViewProjection) * glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+	return glm::vec3(eye) / eye.w;
+}
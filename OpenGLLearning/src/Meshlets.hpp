@@ -0,0 +1,66 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Splits a mesh into meshlets, small clusters of triangles that are
+/// culled on their own, so a large mesh only draws the parts that face the
+/// camera and are inside the frustum.
+///
+/// Build() regroups the triangles of an index range so that every meshlet
+/// is a contiguous run of it, with at most MaxVertices distinct vertices
+/// and MaxTriangles triangles. It grows each meshlet from its seed through
+/// neighbouring triangles, so meshlets stay compact and their bounds tight.
+///
+/// Each meshlet gets a bounding sphere and a cone that holds every one of
+/// its triangle normals. When the camera sees the whole sphere from behind
+/// the cone, every triangle in it faces away. Cull() applies that and the
+/// frustum test, and returns the index ranges left, with neighbouring
+/// ranges merged.
+///
+/// Vertices are 'floatsPerVertex' floats each, the position first.
+/// </summary>
+namespace Meshlets {
+	static constexpr std::uint32_t MaxVertices		= 64;
+	static constexpr std::uint32_t MaxTriangles		= 124;
+
+	struct Meshlet {
+		// Where the meshlet's indices start in the mesh's index data, and how many.
+		std::uint32_t	mFirstIndex		= 0;
+		std::uint32_t	mIndexCount		= 0;
+		// Model space center and radius.
+		glm::vec4		mBoundingSphere{ 0.0f };
+		// The average normal, and the sine of the angle between it and the
+		// normal furthest from it. 1 when the normals are too far apart to cull.
+		glm::vec3		mConeAxis{ 0.0f, 0.0f, 1.0f };
+		float			mConeCutoff		= 1.0f;
+	};
+
+	struct Range {
+		std::uint32_t	mFirstIndex		= 0;
+		std::uint32_t	mIndexCount		= 0;
+	};
+
+	/// <summary>
+	/// Reorders 'indexCount' indices from 'indices' into meshlets and returns
+	/// them; their offsets are relative to 'indices'.
+	/// </summary>
+	std::vector<Meshlet> Build(const float* vertices, std::uint32_t vertexCount, std::uint32_t floatsPerVertex,
+		std::uint32_t* indices, std::uint32_t indexCount);
+
+	/// <summary>
+	/// Replaces 'visible' with the index ranges of the meshlets that are
+	/// inside the frustum of 'modelViewProjection' and, if 'cullBackFacing',
+	/// face the camera. Returns how many meshlets that was.
+	/// </summary>
+	std::size_t Cull(const std::vector<Meshlet>& meshlets, const glm::mat4& modelViewProjection, bool cullBackFacing,
+		std::vector<Range>* visible);
+
+	/// <summary>
+	/// Where the eye of a perspective 'modelViewProjection' is, in model space.
+	/// </summary>
+	glm::vec3 GetEyePosition(const glm::mat4& modelViewProjection);
+}
@@ -0,0 +1,409 @@
+#include "MipGenerator.hpp"
+
+#include "CpuDispatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MIP_GENERATOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	/// <summary>
+	/// The inner loops, one row at a time, so the per-level bookkeeping is
+	/// shared by the scalar and SSE2 versions.
+	/// </summary>
+	struct MipKernelTable {
+		const char* mName;
+		/// <summary>
+		/// out[x] = the rounded average of texels 2x and 2x + 1 of rows a and b, for x < outWidth.
+		/// </summary>
+		void (*mBoxRow)(const std::uint8_t* a, const std::uint8_t* b, std::uint8_t* out, std::uint32_t outWidth);
+		/// <summary>
+		/// out = row, as floats.
+		/// </summary>
+		void (*mWidenRow)(const std::uint8_t* row, float* out, std::uint32_t width);
+		/// <summary>
+		/// out[x] = sum over k of weights[x * taps + k] * row[indices[x * taps + k]], all RGBA floats.
+		/// </summary>
+		void (*mFilterRow)(const float* row, const std::uint32_t* indices, const float* weights, std::uint32_t taps,
+			float* out, std::uint32_t outWidth);
+		/// <summary>
+		/// out[x] = sum over k of weights[k] * rows[k][x], rounded and clamped to bytes.
+		/// </summary>
+		void (*mFilterColumns)(const float* const* rows, const float* weights, std::uint32_t taps,
+			std::uint8_t* out, std::uint32_t width);
+	};
+
+	//------------------------------- Scalar reference -----------------------------------
+
+	void BoxRowScalar(const std::uint8_t* a, const std::uint8_t* b, std::uint8_t* out, std::uint32_t outWidth)
+	{
+		for (std::uint32_t i = 0; i < outWidth * 4; ++i)
+		{
+			const std::uint32_t x = (i / 4) * 8 + i % 4;
+			out[i] = static_cast<std::uint8_t>((a[x] + a[x + 4] + b[x] + b[x + 4] + 2) >> 2);
+		}
+	}
+
+	void WidenRowScalar(const std::uint8_t* row, float* out, std::uint32_t width)
+	{
+		for (std::uint32_t i = 0; i < width * 4; ++i)
+		{
+			out[i] = static_cast<float>(row[i]);
+		}
+	}
+
+	void FilterRowScalar(const float* row, const std::uint32_t* indices, const float* weights, std::uint32_t taps,
+		float* out, std::uint32_t outWidth)
+	{
+		for (std::uint32_t x = 0; x < outWidth; ++x)
+		{
+			float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (std::uint32_t k = 0; k < taps; ++k)
+			{
+				const float* texel = row + indices[x * taps + k] * 4;
+				const float weight = weights[x * taps + k];
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					sum[channel] = sum[channel] + texel[channel] * weight;
+				}
+			}
+			std::copy(sum, sum + 4, out + x * 4);
+		}
+	}
+
+	void FilterColumnsScalar(const float* const* rows, const float* weights, std::uint32_t taps,
+		std::uint8_t* out, std::uint32_t width)
+	{
+		for (std::uint32_t i = 0; i < width * 4; ++i)
+		{
+			float sum = 0.0f;
+			for (std::uint32_t k = 0; k < taps; ++k)
+			{
+				sum = sum + rows[k][i] * weights[k];
+			}
+			// Round half to even, as cvtps2dq does.
+			out[i] = static_cast<std::uint8_t>(std::min(255.0f, std::max(0.0f, std::nearbyint(sum))));
+		}
+	}
+
+	const MipKernelTable* GetMipKernelsScalar()
+	{
+		static const MipKernelTable sTable = { "Scalar", BoxRowScalar, WidenRowScalar, FilterRowScalar, FilterColumnsScalar };
+		return &sTable;
+	}
+
+	//------------------------------- SSE2 -----------------------------------
+
+#if MIP_GENERATOR_SSE2
+	void BoxRowSSE2(const std::uint8_t* a, const std::uint8_t* b, std::uint8_t* out, std::uint32_t outWidth)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i two = _mm_set1_epi16(2);
+		std::uint32_t x = 0;
+		// 8 source texels of each row make 4 output texels.
+		for (; x + 4 <= outWidth; x += 4)
+		{
+			__m128i halves[2];
+			for (int half = 0; half < 2; ++half)
+			{
+				const __m128i rowA = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x * 8 + half * 16));
+				const __m128i rowB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x * 8 + half * 16));
+				// Texels 0-1 and 2-3 of the 4, widened to 16 bits and summed down the column.
+				const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(rowA, zero), _mm_unpacklo_epi8(rowB, zero));
+				const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(rowA, zero), _mm_unpackhi_epi8(rowB, zero));
+				// Then across: each pair's second texel onto its first.
+				const __m128i sumLow = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+				const __m128i sumHigh = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+				halves[half] = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sumLow, sumHigh), two), 2);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(halves[0], halves[1]));
+		}
+		BoxRowScalar(a + x * 8, b + x * 8, out + x * 4, outWidth - x);
+	}
+
+	void WidenRowSSE2(const std::uint8_t* row, float* out, std::uint32_t width)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		std::uint32_t i = 0;
+		for (; i + 16 <= width * 4; i += 16)
+		{
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+			const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+			const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+			_mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)));
+			_mm_storeu_ps(out + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)));
+			_mm_storeu_ps(out + i + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)));
+			_mm_storeu_ps(out + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)));
+		}
+		WidenRowScalar(row + i, out + i, width - i / 4);
+	}
+
+	void FilterRowSSE2(const float* row, const std::uint32_t* indices, const float* weights, std::uint32_t taps,
+		float* out, std::uint32_t outWidth)
+	{
+		for (std::uint32_t x = 0; x < outWidth; ++x)
+		{
+			__m128 sum = _mm_setzero_ps();
+			for (std::uint32_t k = 0; k < taps; ++k)
+			{
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(row + indices[x * taps + k] * 4), _mm_set1_ps(weights[x * taps + k])));
+			}
+			_mm_storeu_ps(out + x * 4, sum);
+		}
+	}
+
+	void FilterColumnsSSE2(const float* const* rows, const float* weights, std::uint32_t taps,
+		std::uint8_t* out, std::uint32_t width)
+	{
+		std::uint32_t i = 0;
+		// 4 texels at a time, so the packs fill a whole register.
+		for (; i + 16 <= width * 4; i += 16)
+		{
+			__m128 sums[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+			for (std::uint32_t k = 0; k < taps; ++k)
+			{
+				const __m128 weight = _mm_set1_ps(weights[k]);
+				for (int j = 0; j < 4; ++j)
+				{
+					sums[j] = _mm_add_ps(sums[j], _mm_mul_ps(_mm_loadu_ps(rows[k] + i + j * 4), weight));
+				}
+			}
+			// Saturating packs do the clamping.
+			const __m128i low = _mm_packs_epi32(_mm_cvtps_epi32(sums[0]), _mm_cvtps_epi32(sums[1]));
+			const __m128i high = _mm_packs_epi32(_mm_cvtps_epi32(sums[2]), _mm_cvtps_epi32(sums[3]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+		}
+		if (i < width * 4)
+		{
+			const float* rest[16];
+			for (std::uint32_t k = 0; k < taps; ++k)
+			{
+				rest[k] = rows[k] + i;
+			}
+			FilterColumnsScalar(rest, weights, taps, out + i, width - i / 4);
+		}
+	}
+
+	const MipKernelTable* GetMipKernelsSSE2()
+	{
+		static const MipKernelTable sTable = { "SSE2", BoxRowSSE2, WidenRowSSE2, FilterRowSSE2, FilterColumnsSSE2 };
+		return &sTable;
+	}
+#else
+	const MipKernelTable* GetMipKernelsSSE2()
+	{
+		return nullptr;
+	}
+#endif
+
+	const MipKernelTable* SelectKernels()
+	{
+		const MipKernelTable* const candidates[] = {
+			GetMipKernelsScalar(),
+			GetMipKernelsSSE2(),
+			nullptr,
+			nullptr,
+		};
+		SimdLevel level = SimdLevel::Scalar;
+		const MipKernelTable* table = CpuDispatch::Select(candidates, &level);
+		CpuDispatch::ReportActivePath("MipGenerator", level);
+		return table;
+	}
+
+	const MipKernelTable*& GetKernels()
+	{
+		static const MipKernelTable* sKernels = SelectKernels();
+		return sKernels;
+	}
+
+	//------------------------------------------------------------------------------------
+
+	// Taps reach this many output texels either side; the window's shape.
+	constexpr float KaiserRadius	= 3.0f;
+	constexpr float KaiserAlpha		= 4.0f;
+	// FilterColumnsSSE2() keeps its tail's row pointers on the stack.
+	constexpr std::uint32_t MaxTaps	= 16;
+
+	/// <summary>
+	/// The modified Bessel function of the first kind, order 0, by its series.
+	/// </summary>
+	double BesselI0(double x)
+	{
+		double sum = 1.0;
+		double term = 1.0;
+		for (int k = 1; k < 32; ++k)
+		{
+			term *= (x * 0.5 / k) * (x * 0.5 / k);
+			sum += term;
+		}
+		return sum;
+	}
+
+	/// <summary>
+	/// Which source texels each output texel of one axis reads, and with
+	/// what weight; 'taps' of each per output texel, clamped to the edge.
+	/// </summary>
+	struct AxisTaps {
+		std::uint32_t				mTaps	= 1;
+		std::vector<std::uint32_t>	mIndices;
+		std::vector<float>			mWeights;
+	};
+
+	AxisTaps MakeKaiserTaps(std::uint32_t sourceSize, std::uint32_t outSize)
+	{
+		AxisTaps axis;
+		if (sourceSize == outSize)
+		{
+			for (std::uint32_t x = 0; x < outSize; ++x)
+			{
+				axis.mIndices.push_back(x);
+				axis.mWeights.push_back(1.0f);
+			}
+			return axis;
+		}
+
+		const double scale = static_cast<double>(sourceSize) / outSize;
+		const double halfWidth = KaiserRadius * scale * 0.5;
+		axis.mTaps = std::min(MaxTaps, static_cast<std::uint32_t>(std::ceil(2.0 * halfWidth)) + 1);
+		const double normalization = 1.0 / BesselI0(KaiserAlpha);
+		for (std::uint32_t x = 0; x < outSize; ++x)
+		{
+			const double center = (x + 0.5) * scale - 0.5;
+			const std::int64_t first = static_cast<std::int64_t>(std::floor(center - halfWidth)) + 1;
+			double total = 0.0;
+			std::vector<double> weights(axis.mTaps, 0.0);
+			for (std::uint32_t k = 0; k < axis.mTaps; ++k)
+			{
+				// In output texels, where a sinc of half the source rate cuts
+				// off at the output's Nyquist frequency.
+				const double u = (static_cast<double>(first + k) - center) / (scale * 0.5);
+				if (std::abs(u) < KaiserRadius)
+				{
+					const double t = u / KaiserRadius;
+					const double sinc = (u == 0.0) ? 1.0 : std::sin(3.14159265358979 * u * 0.5) / (3.14159265358979 * u * 0.5);
+					weights[k] = sinc * BesselI0(KaiserAlpha * std::sqrt(1.0 - t * t)) * normalization;
+					total += weights[k];
+				}
+			}
+			for (std::uint32_t k = 0; k < axis.mTaps; ++k)
+			{
+				const std::int64_t index = std::min<std::int64_t>(std::max<std::int64_t>(first + k, 0), sourceSize - 1);
+				axis.mIndices.push_back(static_cast<std::uint32_t>(index));
+				axis.mWeights.push_back(static_cast<float>(weights[k] / total));
+			}
+		}
+		return axis;
+	}
+
+	void DownsampleBox(const MipKernelTable& kernels, const ImageLoader::Level& source, ImageLoader::Level* out)
+	{
+		const std::size_t sourceStride = static_cast<std::size_t>(source.mWidth) * 4;
+		// A 1 texel wide image gets its column averaged with itself.
+		std::vector<std::uint8_t> widened;
+		const std::uint8_t* pixels = source.mPixels.data();
+		std::size_t stride = sourceStride;
+		if (source.mWidth == 1)
+		{
+			widened.resize(static_cast<std::size_t>(source.mHeight) * 8);
+			for (std::uint32_t y = 0; y < source.mHeight; ++y)
+			{
+				std::copy(pixels + y * 4, pixels + y * 4 + 4, &widened[y * 8]);
+				std::copy(pixels + y * 4, pixels + y * 4 + 4, &widened[y * 8 + 4]);
+			}
+			pixels = widened.data();
+			stride = 8;
+		}
+
+		for (std::uint32_t y = 0; y < out->mHeight; ++y)
+		{
+			const std::uint8_t* a = pixels + std::min(2 * y, source.mHeight - 1) * stride;
+			const std::uint8_t* b = pixels + std::min(2 * y + 1, source.mHeight - 1) * stride;
+			kernels.mBoxRow(a, b, &out->mPixels[static_cast<std::size_t>(y) * out->mWidth * 4], out->mWidth);
+		}
+	}
+
+	void DownsampleKaiser(const MipKernelTable& kernels, const ImageLoader::Level& source, ImageLoader::Level* out)
+	{
+		const AxisTaps horizontal = MakeKaiserTaps(source.mWidth, out->mWidth);
+		const AxisTaps vertical = MakeKaiserTaps(source.mHeight, out->mHeight);
+
+		// Across every source row first, then down the columns of that.
+		std::vector<float> rows(static_cast<std::size_t>(source.mHeight) * out->mWidth * 4);
+		std::vector<float> sourceRow(static_cast<std::size_t>(source.mWidth) * 4);
+		for (std::uint32_t y = 0; y < source.mHeight; ++y)
+		{
+			kernels.mWidenRow(&source.mPixels[static_cast<std::size_t>(y) * source.mWidth * 4], sourceRow.data(), source.mWidth);
+			kernels.mFilterRow(sourceRow.data(),
+				horizontal.mIndices.data(), horizontal.mWeights.data(), horizontal.mTaps,
+				&rows[static_cast<std::size_t>(y) * out->mWidth * 4], out->mWidth);
+		}
+
+		const float* taps[MaxTaps];
+		for (std::uint32_t y = 0; y < out->mHeight; ++y)
+		{
+			for (std::uint32_t k = 0; k < vertical.mTaps; ++k)
+			{
+				taps[k] = &rows[static_cast<std::size_t>(vertical.mIndices[y * vertical.mTaps + k]) * out->mWidth * 4];
+			}
+			kernels.mFilterColumns(taps, &vertical.mWeights[y * vertical.mTaps], vertical.mTaps,
+				&out->mPixels[static_cast<std::size_t>(y) * out->mWidth * 4], out->mWidth);
+		}
+	}
+}
+
+ImageLoader::Level MipGenerator::Downsample(const ImageLoader::Level& source, Filter filter)
+{
+	ImageLoader::Level out;
+	out.mWidth = std::max(1u, source.mWidth / 2);
+	out.mHeight = std::max(1u, source.mHeight / 2);
+	out.mPixels.resize(static_cast<std::size_t>(out.mWidth) * out.mHeight * 4);
+
+	const MipKernelTable& kernels = *GetKernels();
+	if (filter == Filter::Box)
+	{
+		DownsampleBox(kernels, source, &out);
+	}
+	else
+	{
+		DownsampleKaiser(kernels, source, &out);
+	}
+	return out;
+}
+
+void MipGenerator::BuildChain(ImageLoader::Image* image, Filter filter)
+{
+	const std::uint32_t levelCount = GetLevelCount(image->mLevels[0].mWidth, image->mLevels[0].mHeight);
+	while (image->mLevels.size() < levelCount)
+	{
+		ImageLoader::Level next = Downsample(image->mLevels.back(), filter);
+		image->mLevels.push_back(std::move(next));
+	}
+}
+
+std::uint32_t MipGenerator::GetLevelCount(std::uint32_t width, std::uint32_t height)
+{
+	std::uint32_t levels = 1;
+	while (width > 1 || height > 1)
+	{
+		width = std::max(1u, width / 2);
+		height = std::max(1u, height / 2);
+		++levels;
+	}
+	return levels;
+}
+
+const char* MipGenerator::GetActivePathName()
+{
+	return GetKernels()->mName;
+}
+
+void MipGenerator::Reselect()
+{
+	GetKernels() = SelectKernels();
+}
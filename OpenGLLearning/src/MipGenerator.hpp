@@ -0,0 +1,48 @@
+#pragma once
+#include "ImageLoader.hpp"
+
+#include <cstdint>
+
+/// <summary>
+/// Builds mip chains of 8 bit RGBA images on the CPU, so the levels are
+/// ready before the texture ever reaches the GPU and can be streamed in
+/// one at a time (glGenerateMipmap needs the full level resident first).
+///
+/// Each level halves the one before it, rounding down, to 1x1. Two filters:
+///		Box		the average of each 2x2 block. Exact, and the fastest; with
+///				odd sizes the last row or column is dropped.
+///		Kaiser	a Kaiser windowed sinc over 6x6 texels, separable. Sharper
+///				and with less aliasing, for detailed textures.
+/// Both run on SSE2 when the CPU has it (see CpuDispatch), and the box
+/// filter gives the same bytes either way. Values are filtered as stored,
+/// i.e. as linear, which is how the app's textures are sampled.
+/// </summary>
+namespace MipGenerator {
+	enum class Filter {
+		Box,
+		Kaiser,
+	};
+
+	/// <summary>
+	/// The next level of 'source': max(1, width / 2) by max(1, height / 2).
+	/// </summary>
+	ImageLoader::Level Downsample(const ImageLoader::Level& source, Filter filter);
+
+	/// <summary>
+	/// Adds the missing levels to 'image', each made from the one before it.
+	/// Levels already there (from a KTX2 file) are kept.
+	/// </summary>
+	void BuildChain(ImageLoader::Image* image, Filter filter);
+
+	/// <summary>
+	/// How many levels a full chain of a width x height image has.
+	/// </summary>
+	std::uint32_t GetLevelCount(std::uint32_t width, std::uint32_t height);
+
+	const char* GetActivePathName();
+
+	/// <summary>
+	/// Picks the scalar or SSE2 path again, e.g. after CpuDispatch::SetMaxLevel().
+	/// </summary>
+	void Reselect();
+}
@@ -0,0 +1,153 @@
+#include "ParticleSimulation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// A block of slots for one thread at a time.
+constexpr std::uint32_t SlotsPerBlock = 16384;
+
+}
+
+ParticleSimulation::ParticleSimulation()
+{
+}
+
+ParticleSimulation::ParticleSimulation(const Settings& settings)
+	: mSettings(settings)
+{
+}
+
+ParticleSimulation::Handle ParticleSimulation::AddEmitter(const Emitter& emitter)
+{
+	// Room for a whole ring of the longest lived particles, so a slot is
+	// only emitted into again once what was there died.
+	const float longest = emitter.mLifetime * (1.0f + LifetimeVariation);
+	const std::uint32_t slots = static_cast<std::uint32_t>(std::ceil(std::max(emitter.mRate, 0.0f) * longest)) + 1;
+	if (mEmitters.size() >= MaxEmitters || slots > mSettings.mMaxParticles - mUsedSlots)
+	{
+		return InvalidHandle;
+	}
+	const Handle handle = static_cast<Handle>(mEmitters.size());
+	mEmitters.push_back(emitter);
+	mFirstSlots.push_back(mUsedSlots);
+	mSlotCounts.push_back(slots);
+	mCarry.push_back(0.0f);
+	mCursors.push_back(0);
+	mEmissions.push_back(Emission());
+	mUsedSlots += slots;
+	return handle;
+}
+
+void ParticleSimulation::SetEmitter(Handle emitter, const Emitter& parameters)
+{
+	Emitter& target = mEmitters[emitter];
+	target = parameters;
+	const float longest = target.mLifetime * (1.0f + LifetimeVariation);
+	if (longest > 0.0f)
+	{
+		target.mRate = std::min(target.mRate, static_cast<float>(mSlotCounts[emitter] - 1) / longest);
+	}
+}
+
+void ParticleSimulation::Advance(float seconds)
+{
+	++mStep;
+	for (std::size_t i = 0; i < mEmitters.size(); ++i)
+	{
+		mCarry[i] += std::max(mEmitters[i].mRate, 0.0f) * seconds;
+		const std::uint32_t count = std::min(static_cast<std::uint32_t>(mCarry[i]), mSlotCounts[i]);
+		mCarry[i] -= static_cast<float>(count);
+		mEmissions[i].mCursor = mCursors[i];
+		mEmissions[i].mCount = count;
+		mCursors[i] = (mCursors[i] + count) % mSlotCounts[i];
+	}
+}
+
+void ParticleSimulation::Step(float seconds, std::vector<Particle>* particles)
+{
+	Advance(seconds);
+	if (particles->size() < mUsedSlots)
+	{
+		particles->resize(mUsedSlots);
+	}
+
+	const std::uint32_t blocks = (mUsedSlots + SlotsPerBlock - 1) / SlotsPerBlock;
+	std::atomic<std::uint32_t> nextBlock(0);
+	const auto work = [&]() {
+		for (std::uint32_t block = nextBlock++; block < blocks; block = nextBlock++)
+		{
+			Simulate(seconds, particles->data(), block * SlotsPerBlock, std::min(mUsedSlots, (block + 1) * SlotsPerBlock));
+		}
+	};
+	unsigned threads = mSettings.mThreads;
+	if (threads == 0)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::max(1u, std::min(threads, blocks));
+	std::vector<std::thread> helpers;
+	for (unsigned i = 1; i < threads; ++i)
+	{
+		helpers.emplace_back(work);
+	}
+	work();
+	for (std::thread& helper : helpers)
+	{
+		helper.join();
+	}
+}
+
+void ParticleSimulation::Simulate(float seconds, Particle* particles, std::uint32_t begin, std::uint32_t end) const
+{
+	// Written to match particle_update_vert.glsl operation for operation.
+	const float keep = std::max(1.0f - mSettings.mDrag * seconds, 0.0f);
+	const glm::vec3 gravity = mSettings.mGravity * seconds;
+	const std::uint32_t stepHash = Hash(mStep);
+	std::size_t emitter = 0;
+	for (std::uint32_t slot = begin; slot < end; ++slot)
+	{
+		while (slot >= mFirstSlots[emitter] + mSlotCounts[emitter])
+		{
+			++emitter;
+		}
+		Particle& particle = particles[slot];
+		const Emitter& source = mEmitters[emitter];
+		const Emission& emission = mEmissions[emitter];
+		const std::uint32_t ring = (slot - mFirstSlots[emitter] + mSlotCounts[emitter] - emission.mCursor) % mSlotCounts[emitter];
+		if (ring < emission.mCount)
+		{
+			std::uint32_t state = Hash(slot ^ stepHash);
+			float random[4];
+			for (float& value : random)
+			{
+				state = Hash(state);
+				value = static_cast<float>(state >> 8) * (1.0f / 16777216.0f);
+			}
+			const glm::vec3 jitter = glm::vec3(random[0], random[1], random[2]) * 2.0f - 1.0f;
+			particle.mPositionAge = glm::vec4(source.mPosition, 0.0f);
+			particle.mVelocityLifetime = glm::vec4(source.mVelocity + jitter * source.mSpread,
+				source.mLifetime * (1.0f - LifetimeVariation + 2.0f * LifetimeVariation * random[3]));
+		}
+		else if (particle.mPositionAge.w < particle.mVelocityLifetime.w)
+		{
+			glm::vec3 velocity = (glm::vec3(particle.mVelocityLifetime) + gravity) * keep;
+			particle.mPositionAge = glm::vec4(glm::vec3(particle.mPositionAge) + velocity * seconds, particle.mPositionAge.w + seconds);
+			particle.mVelocityLifetime = glm::vec4(velocity, particle.mVelocityLifetime.w);
+		}
+	}
+}
+
+std::uint32_t ParticleSimulation::Hash(std::uint32_t x)
+{
+	// lowbias32 (Chris Wellons): cheap, and good enough to look random.
+	x ^= x >> 16;
+	x *= 0x7feb352du;
+	x ^= x >> 15;
+	x *= 0x846ca68bu;
+	x ^= x >> 16;
+	return x;
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// The CPU side of the particles: the emitters, which particles each step
+/// emits, and a reference Step() that simulates them all on the CPU.
+/// ParticleSystem runs the same step on the GPU (particle_update_vert.glsl);
+/// both have to change together.
+///
+/// Every emitter owns a fixed range of slots, enough for its rate times
+/// the longest lifetime, and emits into them as a ring: a step's new
+/// particles replace the oldest ones, which have died by then. Which slots
+/// a step emits into is decided here, once, from the emitters' rates, so
+/// the GPU never has to count or compact anything, and the CPU and GPU
+/// steps stay in lockstep. A new particle's velocity and lifetime come
+/// from a hash of its slot and the step number, not from a random state.
+///
+/// No GL: runs anywhere, for --bench-particles and to validate the GPU.
+/// </summary>
+class ParticleSimulation {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = ~0u;
+	static constexpr std::uint32_t MaxEmitters = 8;
+	// New particles live their emitter's mLifetime times 1 - x to 1 + x.
+	static constexpr float LifetimeVariation = 0.25f;
+
+	/// <summary>
+	/// One particle, as the GPU stores it (two vec4 attributes).
+	/// </summary>
+	struct Particle {
+		// World space position, and seconds since it was emitted.
+		glm::vec4			mPositionAge		= glm::vec4(0.0f);
+		// World space velocity, and the age it dies at; dead from the start.
+		glm::vec4			mVelocityLifetime	= glm::vec4(0.0f);
+	};
+
+	struct Emitter {
+		glm::vec3			mPosition			= glm::vec3(0.0f);
+		// Particles per second.
+		float				mRate				= 100.0f;
+		// Every particle's velocity starts at this plus up to mSpread along each axis.
+		glm::vec3			mVelocity			= glm::vec3(0.0f, 1.0f, 0.0f);
+		float				mSpread				= 0.5f;
+		// Seconds, on average.
+		float				mLifetime			= 2.0f;
+		// Half the width of a particle's billboard, in world units.
+		float				mSize				= 0.02f;
+		// Alpha fades out with age.
+		glm::vec4			mColor				= glm::vec4(1.0f);
+	};
+
+	struct Settings {
+		// Slots in all; AddEmitter() fails past it.
+		std::uint32_t		mMaxParticles		= 1u << 17;
+		glm::vec3			mGravity			= glm::vec3(0.0f, -2.0f, 0.0f);
+		// Velocity lost per second, as a fraction.
+		float				mDrag				= 0.2f;
+		// Threads for Step(), this one included; 0 is one per core.
+		unsigned			mThreads			= 1;
+	};
+
+	/// <summary>
+	/// What a step emits per emitter: 'mCount' slots of its range, from
+	/// 'mCursor' on, wrapping around.
+	/// </summary>
+	struct Emission {
+		std::uint32_t		mCursor				= 0;
+		std::uint32_t		mCount				= 0;
+	};
+
+	ParticleSimulation();
+	explicit ParticleSimulation(const Settings& settings);
+
+	/// <summary>
+	/// Reserves slots for the emitter at its rate, for good. InvalidHandle
+	/// once there are MaxEmitters, or no room.
+	/// </summary>
+	Handle AddEmitter(const Emitter& emitter);
+	/// <summary>
+	/// Changes it from the next step on; the rate is kept to what its slots allow.
+	/// </summary>
+	void SetEmitter(Handle emitter, const Emitter& parameters);
+	const Emitter& GetEmitter(Handle emitter) const { return mEmitters[emitter]; }
+	std::uint32_t GetEmitterCount() const { return static_cast<std::uint32_t>(mEmitters.size()); }
+	std::uint32_t GetFirstSlot(Handle emitter) const { return mFirstSlots[emitter]; }
+	std::uint32_t GetSlotCount(Handle emitter) const { return mSlotCounts[emitter]; }
+	/// <summary>
+	/// Slots taken by all the emitters, from 0: how many particles to
+	/// simulate and draw.
+	/// </summary>
+	std::uint32_t GetUsedSlots() const { return mUsedSlots; }
+	const Settings& GetSettings() const { return mSettings; }
+
+	/// <summary>
+	/// Decides what the next step, 'seconds' long, emits. The GPU path
+	/// calls this and then simulates; Step() does both on the CPU.
+	/// </summary>
+	void Advance(float seconds);
+	/// <summary>
+	/// The step number and emissions Advance() last decided.
+	/// </summary>
+	std::uint32_t GetStep() const { return mStep; }
+	const Emission& GetEmission(Handle emitter) const { return mEmissions[emitter]; }
+
+	/// <summary>
+	/// The reference: Advance(), then one step of every particle in
+	/// 'particles' (GetUsedSlots() of them at least).
+	/// </summary>
+	void Step(float seconds, std::vector<Particle>* particles);
+
+	/// <summary>
+	/// The hash both sides draw a new particle's randomness from.
+	/// </summary>
+	static std::uint32_t Hash(std::uint32_t x);
+
+private:
+	// Slots [begin, end) of one step, on the CPU.
+	void Simulate(float seconds, Particle* particles, std::uint32_t begin, std::uint32_t end) const;
+
+	Settings				mSettings;
+	std::vector<Emitter>	mEmitters;
+	std::vector<std::uint32_t>	mFirstSlots;
+	std::vector<std::uint32_t>	mSlotCounts;
+	// Fractions of a particle not emitted yet, per emitter.
+	std::vector<float>		mCarry;
+	// Where each emitter's next emission starts.
+	std::vector<std::uint32_t>	mCursors;
+	std::vector<Emission>	mEmissions;
+	std::uint32_t			mUsedSlots		= 0;
+	std::uint32_t			mStep			= 0;
+};
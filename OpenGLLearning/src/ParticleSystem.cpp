@@ -0,0 +1,197 @@
+#include "ParticleSystem.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+// Mirrors the Particles block in particle_update_vert.glsl and
+// particle_vert.glsl (std140).
+struct EmitterBlock {
+	// xyz, and the billboard's half width (w).
+	glm::vec4	mPositionSize;
+	// xyz, and the spread (w).
+	glm::vec4	mVelocitySpread;
+	glm::vec4	mColor;
+	// The average lifetime (x), and how far off it a particle may be (y).
+	glm::vec4	mLifetime;
+	// The first slot, the slot count, and this step's emission: cursor, count.
+	glm::uvec4	mSlots;
+};
+
+struct ParticlesBlock {
+	glm::mat4	mView;
+	glm::mat4	mProjection;
+	// Gravity times the step's seconds (xyz), and the seconds (w).
+	glm::vec4	mGravitySeconds;
+	// How much velocity drag leaves this step (x).
+	glm::vec4	mDrag;
+	// The step's hash (x), and how many emitters there are (y).
+	glm::uvec4	mStep;
+	EmitterBlock	mEmitters[ParticleSimulation::MaxEmitters];
+};
+
+}
+
+const char* const ParticleSystem::FeedbackVaryings[FeedbackVaryingCount] = { "tf_positionAge", "tf_velocityLifetime" };
+
+ParticleSystem::~ParticleSystem()
+{
+	Destroy();
+}
+
+bool ParticleSystem::Create(GLuint updateProgram, GLuint renderProgram, GLuint binding, const ParticleSimulation::Settings& settings)
+{
+	mSimulation = ParticleSimulation(settings);
+	mUpdateProgram = updateProgram;
+	mRenderProgram = renderProgram;
+	mBinding = binding;
+
+	const std::vector<ParticleSimulation::Particle> dead(settings.mMaxParticles);
+	const GLsizei stride = sizeof(ParticleSimulation::Particle);
+	glGenBuffers(2, mBuffers);
+	glGenVertexArrays(2, mUpdateArrays);
+	glGenVertexArrays(2, mDrawArrays);
+	for (int i = 0; i < 2; ++i)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, mBuffers[i]);
+		glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(dead.size() * sizeof(dead[0])), dead.data(), GL_DYNAMIC_COPY);
+		for (const GLuint vertexArray : { mUpdateArrays[i], mDrawArrays[i] })
+		{
+			glBindVertexArray(vertexArray);
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+			glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offsetof(ParticleSimulation::Particle, mPositionAge)));
+			glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offsetof(ParticleSimulation::Particle, mVelocityLifetime)));
+			const GLuint divisor = (vertexArray == mDrawArrays[i]) ? 1 : 0;
+			glVertexAttribDivisor(0, divisor);
+			glVertexAttribDivisor(1, divisor);
+		}
+	}
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	mCurrent = 0;
+
+	glGenBuffers(1, &mBlockBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(ParticlesBlock), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	if (glGetError() != GL_NO_ERROR)
+	{
+		Destroy();
+		return false;
+	}
+	return true;
+}
+
+void ParticleSystem::Destroy()
+{
+	mStepTimer.Destroy();
+	if (mBlockBuffer != 0)
+	{
+		glDeleteBuffers(2, mBuffers);
+		glDeleteVertexArrays(2, mUpdateArrays);
+		glDeleteVertexArrays(2, mDrawArrays);
+		glDeleteBuffers(1, &mBlockBuffer);
+		glDeleteProgram(mUpdateProgram);
+		glDeleteProgram(mRenderProgram);
+	}
+	for (int i = 0; i < 2; ++i)
+	{
+		mBuffers[i] = mUpdateArrays[i] = mDrawArrays[i] = 0;
+	}
+	mBlockBuffer = mUpdateProgram = mRenderProgram = 0;
+}
+
+void ParticleSystem::Step(float seconds)
+{
+	mSimulation.Advance(seconds);
+	const GLsizei count = static_cast<GLsizei>(mSimulation.GetUsedSlots());
+	if (count == 0)
+	{
+		return;
+	}
+	Upload(seconds);
+
+	++mStepCount;
+
+	const int target = 1 - mCurrent;
+	mStepTimer.Begin();
+	glUseProgram(mUpdateProgram);
+	glBindVertexArray(mUpdateArrays[mCurrent]);
+	glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, mBuffers[target]);
+	glEnable(GL_RASTERIZER_DISCARD);
+	glBeginTransformFeedback(GL_POINTS);
+	glDrawArrays(GL_POINTS, 0, count);
+	glEndTransformFeedback();
+	glDisable(GL_RASTERIZER_DISCARD);
+	glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+	glBindVertexArray(0);
+	glUseProgram(0);
+	mStepTimer.End();
+	mCurrent = target;
+}
+
+void ParticleSystem::Draw(const glm::mat4& view, const glm::mat4& projection)
+{
+	const GLsizei count = static_cast<GLsizei>(mSimulation.GetUsedSlots());
+	if (count == 0)
+	{
+		return;
+	}
+	mView = view;
+	mProjection = projection;
+	Upload(0.0f);
+
+	// Additive: the sum doesn't care which particle came first.
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_ONE, GL_ONE);
+	glUseProgram(mRenderProgram);
+	glBindVertexArray(mDrawArrays[mCurrent]);
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+	glBindVertexArray(0);
+	glUseProgram(0);
+	glDisable(GL_BLEND);
+}
+
+void ParticleSystem::ReadBack(std::vector<ParticleSimulation::Particle>* particles) const
+{
+	particles->resize(mSimulation.GetUsedSlots());
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffers[mCurrent]);
+	glGetBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(particles->size() * sizeof(ParticleSimulation::Particle)), particles->data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+double ParticleSystem::GetAverageStepMilliseconds()
+{
+	return mStepTimer.GetAverageMilliseconds();
+}
+
+void ParticleSystem::Upload(float seconds)
+{
+	const ParticleSimulation::Settings& settings = mSimulation.GetSettings();
+	ParticlesBlock block = {};
+	block.mView = mView;
+	block.mProjection = mProjection;
+	// Worked out here once, exactly as ParticleSimulation does, so both
+	// sides start each particle's step from the same numbers.
+	block.mGravitySeconds = glm::vec4(settings.mGravity * seconds, seconds);
+	block.mDrag = glm::vec4(std::max(1.0f - settings.mDrag * seconds, 0.0f), 0.0f, 0.0f, 0.0f);
+	block.mStep = glm::uvec4(ParticleSimulation::Hash(mSimulation.GetStep()), mSimulation.GetEmitterCount(), 0u, 0u);
+	for (ParticleSimulation::Handle i = 0; i < mSimulation.GetEmitterCount(); ++i)
+	{
+		const ParticleSimulation::Emitter& emitter = mSimulation.GetEmitter(i);
+		const ParticleSimulation::Emission& emission = mSimulation.GetEmission(i);
+		EmitterBlock& target = block.mEmitters[i];
+		target.mPositionSize = glm::vec4(emitter.mPosition, emitter.mSize);
+		target.mVelocitySpread = glm::vec4(emitter.mVelocity, emitter.mSpread);
+		target.mColor = emitter.mColor;
+		target.mLifetime = glm::vec4(emitter.mLifetime, ParticleSimulation::LifetimeVariation, 0.0f, 0.0f);
+		target.mSlots = glm::uvec4(mSimulation.GetFirstSlot(i), mSimulation.GetSlotCount(i), emission.mCursor, emission.mCount);
+	}
+	glBindBuffer(GL_UNIFORM_BUFFER, mBlockBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(block), &block);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	glBindBufferBase(GL_UNIFORM_BUFFER, mBinding, mBlockBuffer);
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "GpuTimer.hpp"
+#include "ParticleSimulation.hpp"
+
+/// <summary>
+/// Particles simulated on the GPU with transform feedback, which GL 4.1
+/// has (compute shaders it doesn't): every step draws the particles as
+/// points through particle_update_vert.glsl with the rasterizer off, and
+/// captures what it writes into the other of two buffers. The two swap
+/// after every step, so nothing ever comes back to the CPU.
+///
+/// The emitters and what each step emits come from a ParticleSimulation
+/// (GetSimulation()), whose Step() is the CPU reference of the shader.
+///
+/// Draw() renders each particle as a camera facing quad, one instance each,
+/// straight from the buffer the last step wrote. They're blended additively,
+/// which doesn't depend on the order they're drawn in, so there's nothing
+/// to sort.
+/// </summary>
+class ParticleSystem {
+public:
+	/// <summary>
+	/// What the update program captures, in order, interleaved into one
+	/// buffer. glTransformFeedbackVaryings() needs them before linking.
+	/// </summary>
+	static constexpr GLsizei FeedbackVaryingCount = 2;
+	static const char* const FeedbackVaryings[FeedbackVaryingCount];
+
+	~ParticleSystem();
+
+	/// <summary>
+	/// Takes the update program, particle_update_vert.glsl linked with
+	/// FeedbackVaryings, and the render program, particle_vert.glsl and
+	/// particle_frag.glsl, and deletes them in Destroy(). Both read the
+	/// Particles block from uniform block 'binding'. Makes room for
+	/// settings.mMaxParticles particles, all dead.
+	/// </summary>
+	bool Create(GLuint updateProgram, GLuint renderProgram, GLuint binding, const ParticleSimulation::Settings& settings);
+	void Destroy();
+	bool IsCreated() const { return mBlockBuffer != 0; }
+
+	/// <summary>
+	/// Add emitters through this, before the first Step().
+	/// </summary>
+	ParticleSimulation& GetSimulation() { return mSimulation; }
+
+	/// <summary>
+	/// Emits and moves every particle 'seconds' on, on the GPU. Timed.
+	/// </summary>
+	void Step(float seconds);
+	/// <summary>
+	/// Draws the living particles into the bound framebuffer, as seen
+	/// through 'view' and 'projection'.
+	/// </summary>
+	void Draw(const glm::mat4& view, const glm::mat4& projection);
+
+	/// <summary>
+	/// Copies the particles back from the GPU, GetUsedSlots() of them. Waits
+	/// for the GPU; for validating, not for every frame.
+	/// </summary>
+	void ReadBack(std::vector<ParticleSimulation::Particle>* particles) const;
+
+	/// <summary>
+	/// Steps since Create(), and their average GPU time. Waits for the ones
+	/// still outstanding.
+	/// </summary>
+	std::uint64_t GetStepCount() const { return mStepCount; }
+	double GetAverageStepMilliseconds();
+
+private:
+	// Writes the Particles block for the simulation's current step.
+	void Upload(float seconds);
+
+	ParticleSimulation		mSimulation;
+	GLuint					mUpdateProgram	= 0;
+	GLuint					mRenderProgram	= 0;
+	GLuint					mBinding		= 0;
+	GLuint					mBlockBuffer	= 0;
+	// Ping-pong: mBuffers[mCurrent] has the latest step, the other one
+	// gets the next. Per buffer, a vertex array to update from (one
+	// particle a vertex) and one to draw from (one particle an instance).
+	GLuint					mBuffers[2]		= {};
+	GLuint					mUpdateArrays[2]	= {};
+	GLuint					mDrawArrays[2]	= {};
+	int						mCurrent		= 0;
+	glm::mat4				mView			= glm::mat4(1.0f);
+	glm::mat4				mProjection		= glm::mat4(1.0f);
+
+	std::uint64_t			mStepCount		= 0;
+	GpuTimer				mStepTimer;
+};
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// Steps the linear congruential generator in 'state' (Numerical Recipes'
+/// constants) and returns its top 24 bits. For test scenes and benchmark
+/// data: the same seed gives the same numbers everywhere.
+/// </summary>
+inline std::uint32_t NextRandomBits(std::uint32_t& state)
+{
+	state = state * 1664525u + 1013904223u;
+	return state >> 8;
+}
+
+/// <summary>
+/// The next number from 'state', 0 to 1 (exclusive).
+/// </summary>
+inline float NextRandom(std::uint32_t& state)
+{
+	return static_cast<float>(NextRandomBits(state)) / 16777216.0f;
+}
@@ -0,0 +1,355 @@
+#include "RangeAllocator.hpp"
+
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+	// Index of the highest / lowest set bit, 'bits' must not be 0.
+	inline int HighestBit(std::uint32_t bits)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, bits);
+		return static_cast<int>(index);
+#else
+		return 31 - __builtin_clz(bits);
+#endif
+	}
+
+	inline int LowestBit(std::uint32_t bits)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, bits);
+		return static_cast<int>(index);
+#else
+		return __builtin_ctz(bits);
+#endif
+	}
+}
+
+void RangeAllocator::Classify(std::uint32_t size, int* fl, int* sl)
+{
+	// Sizes below SubdivisionCount all go in class 0, one bucket per size.
+	// Above that, class n + 1 covers [2^(n + bits), 2^(n + bits + 1)).
+	if (size < SubdivisionCount)
+	{
+		*fl = 0;
+		*sl = static_cast<int>(size);
+		return;
+	}
+	const int log2 = HighestBit(size);
+	*fl = log2 - SubdivisionBits + 1;
+	*sl = static_cast<int>((size >> (log2 - SubdivisionBits)) - SubdivisionCount);
+}
+
+void RangeAllocator::Reset(std::uint32_t capacity)
+{
+	mNodes.clear();
+	mRecycledNodes.clear();
+	mFirst = mLast = None;
+	mCapacity = 0;
+	mUsed = 0;
+	mAllocationCount = 0;
+	mClassBitmap = 0;
+	for (int fl = 0; fl < ClassCount; ++fl)
+	{
+		mSubdivisionBitmaps[fl] = 0;
+		for (int sl = 0; sl < SubdivisionCount; ++sl)
+		{
+			mFreeLists[fl][sl] = None;
+		}
+	}
+	Grow(capacity);
+}
+
+std::uint32_t RangeAllocator::NewNode()
+{
+	if (!mRecycledNodes.empty())
+	{
+		const std::uint32_t node = mRecycledNodes.back();
+		mRecycledNodes.pop_back();
+		mNodes[node] = Node();
+		return node;
+	}
+	mNodes.emplace_back();
+	return static_cast<std::uint32_t>(mNodes.size() - 1);
+}
+
+void RangeAllocator::InsertFree(std::uint32_t node)
+{
+	int fl, sl;
+	Classify(mNodes[node].mSize, &fl, &sl);
+	std::uint32_t& head = mFreeLists[fl][sl];
+	mNodes[node].mUsed = false;
+	mNodes[node].mPreviousFree = None;
+	mNodes[node].mNextFree = head;
+	if (head != None)
+	{
+		mNodes[head].mPreviousFree = node;
+	}
+	head = node;
+	mClassBitmap |= 1u << fl;
+	mSubdivisionBitmaps[fl] |= 1u << sl;
+}
+
+void RangeAllocator::RemoveFree(std::uint32_t node)
+{
+	Node& n = mNodes[node];
+	if (n.mPreviousFree != None)
+	{
+		mNodes[n.mPreviousFree].mNextFree = n.mNextFree;
+	}
+	else
+	{
+		int fl, sl;
+		Classify(n.mSize, &fl, &sl);
+		mFreeLists[fl][sl] = n.mNextFree;
+		if (n.mNextFree == None)
+		{
+			mSubdivisionBitmaps[fl] &= ~(1u << sl);
+			if (mSubdivisionBitmaps[fl] == 0)
+			{
+				mClassBitmap &= ~(1u << fl);
+			}
+		}
+	}
+	if (n.mNextFree != None)
+	{
+		mNodes[n.mNextFree].mPreviousFree = n.mPreviousFree;
+	}
+	n.mPreviousFree = n.mNextFree = None;
+}
+
+std::uint32_t RangeAllocator::FindFree(std::uint32_t size) const
+{
+	// Round up to the next bucket boundary, so anything in the bucket we
+	// find is big enough without walking its list.
+	if (size >= SubdivisionCount)
+	{
+		const std::uint32_t roundUp = (1u << (HighestBit(size) - SubdivisionBits)) - 1;
+		if (size > 0xFFFFFFFFu - roundUp)
+		{
+			return None;
+		}
+		size += roundUp;
+	}
+
+	int fl, sl;
+	Classify(size, &fl, &sl);
+	std::uint32_t bitmap = mSubdivisionBitmaps[fl] & (~0u << sl);
+	if (bitmap == 0)
+	{
+		const std::uint32_t classes = fl + 1 < 32 ? mClassBitmap & (~0u << (fl + 1)) : 0;
+		if (classes == 0)
+		{
+			return None;
+		}
+		fl = LowestBit(classes);
+		bitmap = mSubdivisionBitmaps[fl];
+	}
+	return mFreeLists[fl][LowestBit(bitmap)];
+}
+
+RangeAllocator::Handle RangeAllocator::Allocate(std::uint32_t size)
+{
+	assert(size > 0);
+	const std::uint32_t node = FindFree(size);
+	if (node == None)
+	{
+		return InvalidHandle;
+	}
+	RemoveFree(node);
+
+	// Give the tail back as a new free range.
+	if (mNodes[node].mSize > size)
+	{
+		const std::uint32_t rest = NewNode();
+		Node& n = mNodes[node];
+		Node& r = mNodes[rest];
+		r.mOffset = n.mOffset + size;
+		r.mSize = n.mSize - size;
+		r.mPrevious = node;
+		r.mNext = n.mNext;
+		if (n.mNext != None)
+		{
+			mNodes[n.mNext].mPrevious = rest;
+		}
+		else
+		{
+			mLast = rest;
+		}
+		n.mNext = rest;
+		n.mSize = size;
+		InsertFree(rest);
+	}
+
+	mNodes[node].mUsed = true;
+	mUsed += size;
+	++mAllocationCount;
+	return node;
+}
+
+void RangeAllocator::Free(Handle handle)
+{
+	std::uint32_t node = handle;
+	assert(mNodes[node].mUsed);
+	mUsed -= mNodes[node].mSize;
+	--mAllocationCount;
+
+	// Swallow free neighbours on both sides.
+	const std::uint32_t next = mNodes[node].mNext;
+	if (next != None && !mNodes[next].mUsed)
+	{
+		RemoveFree(next);
+		mNodes[node].mSize += mNodes[next].mSize;
+		mNodes[node].mNext = mNodes[next].mNext;
+		if (mNodes[next].mNext != None)
+		{
+			mNodes[mNodes[next].mNext].mPrevious = node;
+		}
+		else
+		{
+			mLast = node;
+		}
+		mRecycledNodes.push_back(next);
+	}
+
+	const std::uint32_t previous = mNodes[node].mPrevious;
+	if (previous != None && !mNodes[previous].mUsed)
+	{
+		RemoveFree(previous);
+		mNodes[previous].mSize += mNodes[node].mSize;
+		mNodes[previous].mNext = mNodes[node].mNext;
+		if (mNodes[node].mNext != None)
+		{
+			mNodes[mNodes[node].mNext].mPrevious = previous;
+		}
+		else
+		{
+			mLast = previous;
+		}
+		mRecycledNodes.push_back(node);
+		node = previous;
+	}
+
+	InsertFree(node);
+}
+
+void RangeAllocator::Grow(std::uint32_t capacity)
+{
+	assert(capacity >= mCapacity);
+	if (capacity == mCapacity)
+	{
+		return;
+	}
+	const std::uint32_t extra = capacity - mCapacity;
+	mCapacity = capacity;
+
+	if (mLast != None && !mNodes[mLast].mUsed)
+	{
+		RemoveFree(mLast);
+		mNodes[mLast].mSize += extra;
+		InsertFree(mLast);
+		return;
+	}
+
+	const std::uint32_t node = NewNode();
+	mNodes[node].mOffset = capacity - extra;
+	mNodes[node].mSize = extra;
+	mNodes[node].mPrevious = mLast;
+	if (mLast != None)
+	{
+		mNodes[mLast].mNext = node;
+	}
+	else
+	{
+		mFirst = node;
+	}
+	mLast = node;
+	InsertFree(node);
+}
+
+void RangeAllocator::Compact(std::vector<Move>* moves)
+{
+	moves->clear();
+
+	// Walk the ranges in address order, keep the used ones packed and drop
+	// the free ones; handles are node indices, so used nodes stay put.
+	std::uint32_t head = 0;
+	std::uint32_t previous = None;
+	std::uint32_t node = mFirst;
+	mFirst = None;
+	while (node != None)
+	{
+		const std::uint32_t next = mNodes[node].mNext;
+		Node& n = mNodes[node];
+		if (n.mUsed)
+		{
+			if (n.mOffset != head)
+			{
+				moves->push_back({ n.mOffset, head, n.mSize });
+				n.mOffset = head;
+			}
+			head += n.mSize;
+			n.mPrevious = previous;
+			if (previous != None)
+			{
+				mNodes[previous].mNext = node;
+			}
+			else
+			{
+				mFirst = node;
+			}
+			previous = node;
+		}
+		else
+		{
+			RemoveFree(node);
+			mRecycledNodes.push_back(node);
+		}
+		node = next;
+	}
+
+	if (previous != None)
+	{
+		mNodes[previous].mNext = None;
+	}
+	mLast = previous;
+
+	// Everything after the last allocation is one free range again.
+	const std::uint32_t capacity = mCapacity;
+	mCapacity = head;
+	Grow(capacity);
+}
+
+RangeAllocator::Stats RangeAllocator::GetStats() const
+{
+	Stats stats;
+	stats.mCapacity = mCapacity;
+	stats.mUsed = mUsed;
+	stats.mAllocationCount = mAllocationCount;
+
+	for (std::uint32_t node = mFirst; node != None; node = mNodes[node].mNext)
+	{
+		if (!mNodes[node].mUsed)
+		{
+			++stats.mFreeRangeCount;
+			if (mNodes[node].mSize > stats.mLargestFreeRange)
+			{
+				stats.mLargestFreeRange = mNodes[node].mSize;
+			}
+		}
+	}
+
+	const std::uint32_t free = mCapacity - mUsed;
+	if (free > 0)
+	{
+		stats.mFragmentation = 1.0f - static_cast<float>(stats.mLargestFreeRange) / free;
+	}
+	return stats;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Hands out ranges of an abstract address space, e.g. the vertices or
+/// indices of a GPU buffer. Nothing is stored here but offsets and sizes.
+///
+/// This is a TLSF (two-level segregated fit) allocator: free ranges are
+/// kept in buckets by size class, a power of two split into SubdivisionCount
+/// linear steps, with a bitmap per level so finding a big enough range and
+/// freeing one (merging it with free neighbours) are both O(1).
+///
+/// Handles stay valid across Grow() and Compact(); only offsets change.
+/// </summary>
+class RangeAllocator {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = 0xFFFFFFFFu;
+
+	struct Stats {
+		std::uint32_t mCapacity			= 0;
+		std::uint32_t mUsed				= 0;
+		std::uint32_t mAllocationCount	= 0;
+		std::uint32_t mFreeRangeCount	= 0;
+		std::uint32_t mLargestFreeRange	= 0;
+		/// <summary>
+		/// 1 - largest free range / total free space: 0 when all free space
+		/// is in one piece, close to 1 when it's scattered in small holes.
+		/// </summary>
+		float mFragmentation			= 0.0f;
+	};
+
+	/// <summary>
+	/// A range that Compact() moved, for the caller to copy the data along.
+	/// </summary>
+	struct Move {
+		std::uint32_t mFrom;
+		std::uint32_t mTo;
+		std::uint32_t mSize;
+	};
+
+	void Reset(std::uint32_t capacity);
+
+	/// <summary>
+	/// Returns InvalidHandle if there is no free range of 'size' (> 0).
+	/// </summary>
+	Handle Allocate(std::uint32_t size);
+	void Free(Handle handle);
+
+	std::uint32_t GetOffset(Handle handle) const { return mNodes[handle].mOffset; }
+	std::uint32_t GetSize(Handle handle) const { return mNodes[handle].mSize; }
+	std::uint32_t GetCapacity() const { return mCapacity; }
+
+	/// <summary>
+	/// Adds free space at the end. 'capacity' may not be smaller than now.
+	/// </summary>
+	void Grow(std::uint32_t capacity);
+
+	/// <summary>
+	/// Slides every allocation towards offset 0, in address order, so all
+	/// free space ends up in one range at the end. 'moves' receives the
+	/// ranges that moved, ordered by address; a move may overlap its source.
+	/// </summary>
+	void Compact(std::vector<Move>* moves);
+
+	Stats GetStats() const;
+
+private:
+	static constexpr int SubdivisionBits	= 4;
+	static constexpr int SubdivisionCount	= 1 << SubdivisionBits;
+	static constexpr int ClassCount			= 32 - SubdivisionBits + 1;
+	static constexpr std::uint32_t None		= 0xFFFFFFFFu;
+
+	struct Node {
+		std::uint32_t mOffset		= 0;
+		std::uint32_t mSize			= 0;
+		// Neighbours in address order.
+		std::uint32_t mPrevious		= None;
+		std::uint32_t mNext			= None;
+		// Neighbours in the free list of the node's bucket, only while free.
+		std::uint32_t mPreviousFree	= None;
+		std::uint32_t mNextFree		= None;
+		bool mUsed					= false;
+	};
+
+	static void Classify(std::uint32_t size, int* fl, int* sl);
+
+	std::uint32_t NewNode();
+	void InsertFree(std::uint32_t node);
+	void RemoveFree(std::uint32_t node);
+	std::uint32_t FindFree(std::uint32_t size) const;
+
+	std::vector<Node>			mNodes;
+	std::vector<std::uint32_t>	mRecycledNodes;
+	std::uint32_t				mFirst							= None;
+	std::uint32_t				mLast							= None;
+	std::uint32_t				mCapacity						= 0;
+	std::uint32_t				mUsed							= 0;
+	std::uint32_t				mAllocationCount				= 0;
+	std::uint32_t				mClassBitmap					= 0;
+	std::uint32_t				mSubdivisionBitmaps[ClassCount]	= {};
+	std::uint32_t				mFreeLists[ClassCount][SubdivisionCount];
+};
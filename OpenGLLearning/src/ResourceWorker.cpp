@@ -0,0 +1,167 @@
+#include "ResourceWorker.hpp"
+#include "GLTrace.hpp"
+
+#include <stdio.h>
+#include <memory>
+
+bool ResourceWorker::Start(SDL_Window* window)
+{
+	// Creating a context makes it current, so put the main one back after.
+	SDL_GLContext mainContext = SDL_GL_GetCurrentContext();
+	SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+	mContext = SDL_GL_CreateContext(window);
+	SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+	SDL_GL_MakeCurrent(window, mainContext);
+	if (mContext == nullptr)
+	{
+		printf("Resource worker: no shared context (%s), creating resources on the main thread.\n", SDL_GetError());
+		return false;
+	}
+
+	// Run() makes it current on the worker thread; a context can only be
+	// current on one thread at a time, which is why it was released above.
+	mStopping = false;
+	mThread = std::thread(&ResourceWorker::Run, this, window);
+	printf("Resource worker: creating resources on a thread with a shared context.\n");
+	return true;
+}
+
+void ResourceWorker::Stop()
+{
+	if (!mThread.joinable())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mWake.notify_one();
+	mThread.join();
+
+	SDL_GL_DeleteContext(mContext);
+	mContext = nullptr;
+}
+
+ResourceWorker::Ticket ResourceWorker::Submit(Job job)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	Ticket ticket;
+	if (!mFreeTickets.empty())
+	{
+		ticket = mFreeTickets.back();
+		mFreeTickets.pop_back();
+		mResults[ticket] = Result();
+	}
+	else
+	{
+		ticket = static_cast<Ticket>(mResults.size());
+		mResults.emplace_back();
+	}
+
+	if (!mThread.joinable())
+	{
+		// Same context, so the result is usable right away, no fence needed.
+		lock.unlock();
+		const GLuint name = job();
+		lock.lock();
+		mResults[ticket].mName = name;
+		mResults[ticket].mDone = true;
+		return ticket;
+	}
+
+	mJobs.emplace_back(ticket, std::move(job));
+	lock.unlock();
+	mWake.notify_one();
+	return ticket;
+}
+
+ResourceWorker::Ticket ResourceWorker::CreateBuffer(const void* data, GLsizeiptr size, GLenum usage)
+{
+	std::shared_ptr<std::vector<char>> copy = std::make_shared<std::vector<char>>(
+		static_cast<const char*>(data), static_cast<const char*>(data) + size);
+	return Submit([copy, usage]() {
+		GLuint buffer = 0;
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(copy->size()), copy->data(), usage);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		return buffer;
+	});
+}
+
+ResourceWorker::Ticket ResourceWorker::CreateTexture2D(GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	const std::size_t size = GLTrace::TexImageSize(width, height, format, type);
+	std::shared_ptr<std::vector<char>> copy = std::make_shared<std::vector<char>>(
+		static_cast<const char*>(pixels), static_cast<const char*>(pixels) + size);
+	return Submit([copy, internalFormat, width, height, format, type]() {
+		GLuint texture = 0;
+		glGenTextures(1, &texture);
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, copy->data());
+		glGenerateMipmap(GL_TEXTURE_2D);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		return texture;
+	});
+}
+
+bool ResourceWorker::IsReady(Ticket ticket)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	const Result& result = mResults[ticket];
+	return result.mDone
+		&& (result.mFence == nullptr || glClientWaitSync(result.mFence, 0, 0) != GL_TIMEOUT_EXPIRED);
+}
+
+GLuint ResourceWorker::Take(Ticket ticket)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mFinished.wait(lock, [&]() { return mResults[ticket].mDone; });
+
+	const Result result = mResults[ticket];
+	mFreeTickets.push_back(ticket);
+	lock.unlock();
+
+	// The worker flushed after the fence, so the GPU gets to it; the main
+	// context only has to not run ahead of it, the CPU needn't wait.
+	if (result.mFence != nullptr)
+	{
+		glWaitSync(result.mFence, 0, GL_TIMEOUT_IGNORED);
+		glDeleteSync(result.mFence);
+	}
+	return result.mName;
+}
+
+void ResourceWorker::Run(SDL_Window* window)
+{
+	SDL_GL_MakeCurrent(window, mContext);
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (true)
+	{
+		mWake.wait(lock, [&]() { return mStopping || !mJobs.empty(); });
+		if (mJobs.empty())
+		{
+			break;
+		}
+		std::pair<Ticket, Job> job = std::move(mJobs.front());
+		mJobs.pop_front();
+		lock.unlock();
+
+		const GLuint name = job.second();
+		const GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+
+		lock.lock();
+		mResults[job.first].mName = name;
+		mResults[job.first].mFence = fence;
+		mResults[job.first].mDone = true;
+		mFinished.notify_all();
+	}
+	lock.unlock();
+
+	SDL_GL_MakeCurrent(window, nullptr);
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <glad/glad.h>
+#include <SDL2/SDL.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Creates GL objects on a thread of its own, so compiling shaders and
+/// copying data into the driver doesn't hold up the render thread.
+///
+/// The thread has its own context, created with
+/// SDL_GL_SHARE_WITH_CURRENT_CONTEXT, so the buffers, textures and programs
+/// it makes are visible to the main context too. Every job ends with a
+/// fence, and before the main thread touches the result Take() makes the
+/// main context wait on it, which is what GL asks for when an object was
+/// changed in another context.
+///
+/// Vertex arrays and framebuffers aren't shared between contexts, so jobs
+/// can't make those; the main thread builds them around what the jobs
+/// return (MeshBufferPool::CreateFromBuffer() does that for meshes).
+///
+/// Until Start() succeeds jobs simply run on the calling thread, so
+/// callers don't need a second path. GLCapture and GLStats only expect GL
+/// calls from one thread, so don't start the worker while they're on.
+/// </summary>
+class ResourceWorker {
+public:
+	using Ticket = std::uint32_t;
+	static constexpr Ticket InvalidTicket = 0xFFFFFFFFu;
+	/// <summary>
+	/// Runs with the worker's context current; returns the name of what it made.
+	/// </summary>
+	using Job = std::function<GLuint()>;
+
+	/// <summary>
+	/// Call on the main thread, with the main context current.
+	/// </summary>
+	bool Start(SDL_Window* window);
+
+	/// <summary>
+	/// Finishes the queued jobs and deletes the worker's context. Results
+	/// not taken yet stay valid.
+	/// </summary>
+	void Stop();
+
+	bool IsThreaded() const { return mThread.joinable(); }
+
+	Ticket Submit(Job job);
+
+	/// <summary>
+	/// A buffer holding a copy of 'size' bytes of 'data'. The copy happens
+	/// now, so 'data' may go away as soon as this returns.
+	/// </summary>
+	Ticket CreateBuffer(const void* data, GLsizeiptr size, GLenum usage = GL_STATIC_DRAW);
+
+	/// <summary>
+	/// A mipmapped 2D texture, pixels as for glTexImage2D with rows aligned
+	/// to 4 bytes. Copied now, like CreateBuffer().
+	/// </summary>
+	Ticket CreateTexture2D(GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels);
+
+	/// <summary>
+	/// Whether Take() would return without waiting. Main thread only.
+	/// </summary>
+	bool IsReady(Ticket ticket);
+
+	/// <summary>
+	/// Waits for the job if needed and returns its result, ready to use in
+	/// the main context. Main thread only, and once per ticket.
+	/// </summary>
+	GLuint Take(Ticket ticket);
+
+private:
+	struct Result {
+		GLuint	mName		= 0;
+		// Signaled once the worker's commands for the job are done.
+		GLsync	mFence		= nullptr;
+		bool	mDone		= false;
+	};
+
+	void Run(SDL_Window* window);
+
+	SDL_GLContext							mContext		= nullptr;
+	std::thread								mThread;
+	std::mutex								mMutex;
+	// New jobs, or Stop().
+	std::condition_variable					mWake;
+	// A job finished.
+	std::condition_variable					mFinished;
+	std::deque<std::pair<Ticket, Job>>		mJobs;
+	bool									mStopping		= false;
+
+	// Indexed by ticket; taken tickets are reused.
+	std::vector<Result>						mResults;
+	std::vector<Ticket>						mFreeTickets;
+};
@@ -0,0 +1,180 @@
+#include "SkinnedModel.hpp"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr float Pi = 3.14159265f;
+
+}
+
+SkinnedModel SkinnedModel::MakeTestCharacter(std::uint32_t jointCount)
+{
+	SkinnedModel model;
+	jointCount = std::max(1u, std::min(jointCount, 255u));
+	const float height = 1.0f;
+	const float segment = height / jointCount;
+
+	// A chain up the y axis, a joint at the bottom of every segment.
+	Skeleton& skeleton = model.mSkeleton;
+	for (std::uint32_t joint = 0; joint < jointCount; ++joint)
+	{
+		skeleton.mParents.push_back(joint == 0 ? Skeleton::NoParent : static_cast<std::int32_t>(joint) - 1);
+		JointPose pose;
+		pose.mTranslation = glm::vec3(0.0f, joint == 0 ? 0.0f : segment, 0.0f);
+		skeleton.mBindPoses.push_back(pose);
+		skeleton.mInverseBindMatrices.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -segment * joint, 0.0f)));
+		skeleton.mNames.push_back("segment" + std::to_string(joint));
+	}
+
+	// Rings of the tube, two per segment, and a tip on top.
+	const std::uint32_t sides = 8;
+	const std::uint32_t rings = jointCount * 2 + 1;
+	const glm::vec3 baseColor(0.35f, 0.1f, 0.55f);
+	const glm::vec3 tipColor(0.95f, 0.35f, 0.45f);
+	for (std::uint32_t ring = 0; ring <= rings; ++ring)
+	{
+		const bool tip = ring == rings;
+		const float along = static_cast<float>(std::min(ring, rings - 1)) / (rings - 1);
+		const float y = tip ? height + segment * 0.5f : along * height;
+		const float radius = 0.08f * (1.0f - 0.7f * along);
+
+		// Half way up a segment only its joint moves the ring; towards
+		// either end it blends into the neighbour's.
+		const float position = std::min(y / segment - 0.5f, static_cast<float>(jointCount - 1));
+		const std::uint32_t lower = static_cast<std::uint32_t>(std::max(0.0f, std::floor(position)));
+		const std::uint32_t upper = std::min(lower + 1, jointCount - 1);
+		const float blend = std::min(std::max(position - lower, 0.0f), 1.0f);
+		const float weights[4] = { 1.0f - blend, blend, 0.0f, 0.0f };
+
+		SkinnedVertex vertex;
+		vertex.mColor = glm::mix(baseColor, tipColor, along);
+		vertex.mJoints[0] = static_cast<std::uint8_t>(lower);
+		vertex.mJoints[1] = static_cast<std::uint8_t>(upper);
+		QuantizeWeights(weights, vertex.mWeights);
+		for (std::uint32_t side = 0; side < (tip ? 1u : sides); ++side)
+		{
+			const float angle = 2.0f * Pi * side / sides;
+			vertex.mPosition = tip ? glm::vec3(0.0f, y, 0.0f) : glm::vec3(radius * std::cos(angle), y, radius * std::sin(angle));
+			model.mVertices.push_back(vertex);
+		}
+	}
+	for (std::uint32_t ring = 0; ring + 1 < rings; ++ring)
+	{
+		for (std::uint32_t side = 0; side < sides; ++side)
+		{
+			const std::uint32_t a = ring * sides + side;
+			const std::uint32_t b = ring * sides + (side + 1) % sides;
+			model.mIndices.insert(model.mIndices.end(), { a, b + sides, b, a, a + sides, b + sides });
+		}
+	}
+	const std::uint32_t tipVertex = rings * sides;
+	for (std::uint32_t side = 0; side < sides; ++side)
+	{
+		const std::uint32_t first = (rings - 1) * sides;
+		model.mIndices.insert(model.mIndices.end(), { first + side, tipVertex, first + (side + 1) % sides });
+	}
+
+	// Every joint sways a little more than the one below it, and a little
+	// later, so a wave runs up the chain. Two seconds, looping.
+	RawClip clip;
+	clip.mName = "sway";
+	clip.mFramesPerSecond = 30.0f;
+	clip.mFrameCount = 61;
+	clip.mJointCount = jointCount;
+	for (std::uint32_t frame = 0; frame < clip.mFrameCount; ++frame)
+	{
+		const float phase = 2.0f * Pi * frame / (clip.mFrameCount - 1);
+		for (std::uint32_t joint = 0; joint < jointCount; ++joint)
+		{
+			JointPose pose = skeleton.mBindPoses[joint];
+			const float amplitude = 0.12f + 0.18f * joint / jointCount;
+			const float lag = 0.6f * joint;
+			pose.mRotation = glm::angleAxis(amplitude * std::sin(phase - lag), glm::vec3(0.0f, 0.0f, 1.0f))
+				* glm::angleAxis(0.5f * amplitude * std::cos(phase - lag), glm::vec3(1.0f, 0.0f, 0.0f));
+			clip.mPoses.push_back(pose);
+		}
+	}
+	model.mClips.push_back(clip);
+	return model;
+}
+
+void SkinnedModel::QuantizeWeights(const float weights[4], std::uint8_t bytes[4])
+{
+	float sum = 0.0f;
+	for (int i = 0; i < 4; ++i)
+	{
+		sum += std::max(weights[i], 0.0f);
+	}
+	if (sum <= 0.0f)
+	{
+		bytes[0] = 255;
+		bytes[1] = bytes[2] = bytes[3] = 0;
+		return;
+	}
+	// Round down, then hand what's left to the ones that lost the most.
+	float remainders[4];
+	int total = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		const float scaled = std::max(weights[i], 0.0f) / sum * 255.0f;
+		bytes[i] = static_cast<std::uint8_t>(std::floor(scaled));
+		remainders[i] = scaled - bytes[i];
+		total += bytes[i];
+	}
+	int order[4] = { 0, 1, 2, 3 };
+	std::sort(order, order + 4, [&remainders](int a, int b) { return remainders[a] > remainders[b]; });
+	for (int i = 0; total < 255; ++i, ++total)
+	{
+		++bytes[order[i % 4]];
+	}
+}
+
+glm::vec4 SkinnedModel::ComputeBoundingSphere() const
+{
+	if (mVertices.empty())
+	{
+		return glm::vec4(0.0f);
+	}
+	// The sphere around the bounding box of every pose, as MeshCreate() does.
+	glm::vec3 boundsMin(INFINITY);
+	glm::vec3 boundsMax(-INFINITY);
+	std::vector<glm::mat4> skinning(mSkeleton.GetJointCount());
+	const auto addPose = [&](const JointPose* poses) {
+		mSkeleton.GetSkinningMatrices(poses, skinning.data());
+		for (const SkinnedVertex& vertex : mVertices)
+		{
+			glm::mat4 blended(0.0f);
+			for (int i = 0; i < 4; ++i)
+			{
+				blended += skinning[vertex.mJoints[i]] * (vertex.mWeights[i] / 255.0f);
+			}
+			const glm::vec3 position(blended * glm::vec4(vertex.mPosition, 1.0f));
+			boundsMin = glm::min(boundsMin, position);
+			boundsMax = glm::max(boundsMax, position);
+		}
+	};
+	addPose(mSkeleton.mBindPoses.data());
+	for (const RawClip& clip : mClips)
+	{
+		for (std::uint32_t frame = 0; frame < clip.mFrameCount; ++frame)
+		{
+			addPose(&clip.mPoses[frame * clip.mJointCount]);
+		}
+	}
+	return glm::vec4((boundsMin + boundsMax) * 0.5f, glm::length(boundsMax - boundsMin) * 0.5f);
+}
+
+std::vector<float> SkinnedModel::GetPositionsAndColors() const
+{
+	std::vector<float> floats;
+	floats.reserve(mVertices.size() * 6);
+	for (const SkinnedVertex& vertex : mVertices)
+	{
+		floats.insert(floats.end(), { vertex.mPosition.x, vertex.mPosition.y, vertex.mPosition.z, vertex.mColor.r, vertex.mColor.g, vertex.mColor.b });
+	}
+	return floats;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "AnimationClip.hpp"
+
+/// <summary>
+/// A vertex bound to up to four joints, as the GPU reads it (32 bytes).
+/// </summary>
+struct SkinnedVertex {
+	glm::vec3			mPosition		= glm::vec3(0.0f);
+	glm::vec3			mColor			= glm::vec3(1.0f);
+	std::uint8_t		mJoints[4]		= {};
+	// How much each joint moves the vertex, out of 255; they add up to 255.
+	std::uint8_t		mWeights[4]		= { 255, 0, 0, 0 };
+};
+
+/// <summary>
+/// A mesh with the skeleton it is bound to and the clips that move it, as
+/// GltfLoader reads them or MakeTestCharacter() makes them.
+/// </summary>
+struct SkinnedModel {
+	Skeleton					mSkeleton;
+	std::vector<SkinnedVertex>	mVertices;
+	std::vector<std::uint32_t>	mIndices;
+	std::vector<RawClip>		mClips;
+
+	/// <summary>
+	/// A tapering tube standing on the origin, one unit tall, bent by a chain
+	/// of 'jointCount' joints, and a two second clip that sways it like a
+	/// tentacle: something to animate without an asset.
+	/// </summary>
+	static SkinnedModel MakeTestCharacter(std::uint32_t jointCount);
+
+	/// <summary>
+	/// Four weights that add up to 1 (or are scaled to), in bytes that add
+	/// up to 255 exactly.
+	/// </summary>
+	static void QuantizeWeights(const float weights[4], std::uint8_t bytes[4]);
+
+	/// <summary>
+	/// Model space center (xyz) and radius (w) enclosing every vertex in
+	/// every frame of every clip, and in the bind pose, for culling.
+	/// </summary>
+	glm::vec4 ComputeBoundingSphere() const;
+
+	/// <summary>
+	/// The vertices' positions and colors, 6 floats each, for MeshLod.
+	/// </summary>
+	std::vector<float> GetPositionsAndColors() const;
+};
@@ -0,0 +1,173 @@
+#include "StreamingBuffer.hpp"
+
+#include <stdio.h>
+
+#include "GLStats.hpp"
+
+// We map through GL_COPY_WRITE_BUFFER so we never disturb the array or
+// element bindings (the element binding is part of the current VAO).
+static const GLenum kMapTarget = GL_COPY_WRITE_BUFFER;
+
+bool StreamingBuffer::Create(GLsizeiptr bytesPerFrame)
+{
+	mRegionSize = bytesPerFrame;
+	const GLsizeiptr totalSize = mRegionSize * FrameCount;
+
+	glGenBuffers(1, &mBuffer);
+	glBindBuffer(kMapTarget, mBuffer);
+
+	if (GLAD_GL_ARB_buffer_storage)
+	{
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(kMapTarget, totalSize, nullptr, flags);
+		mPersistentPointer = static_cast<char*>(glMapBufferRange(kMapTarget, 0, totalSize, flags));
+
+		if (mPersistentPointer == nullptr)
+		{
+			// Immutable storage can't be respecified, start over with a fresh buffer.
+			glDeleteBuffers(1, &mBuffer);
+			glGenBuffers(1, &mBuffer);
+			glBindBuffer(kMapTarget, mBuffer);
+		}
+	}
+
+	if (mPersistentPointer == nullptr)
+	{
+		glBufferData(kMapTarget, totalSize, nullptr, GL_STREAM_DRAW);
+	}
+
+	// Ask the buffer whether it got its storage, glGetError() could be
+	// holding an error from before we were called.
+	GLint64 allocatedSize = 0;
+	glGetBufferParameteri64v(kMapTarget, GL_BUFFER_SIZE, &allocatedSize);
+	glBindBuffer(kMapTarget, 0);
+
+	printf("Streaming buffer: %d x %d bytes, %s\n",
+		FrameCount,
+		static_cast<int>(mRegionSize),
+		IsPersistent() ? "persistent coherent mapping" : "unsynchronized mapping + fences");
+	return mBuffer != 0 && allocatedSize == static_cast<GLint64>(totalSize);
+}
+
+void StreamingBuffer::Destroy()
+{
+	for (GLsync& fence : mFences)
+	{
+		if (fence)
+		{
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	if (mPersistentPointer || mMappedPointer)
+	{
+		glBindBuffer(kMapTarget, mBuffer);
+		glUnmapBuffer(kMapTarget);
+		glBindBuffer(kMapTarget, 0);
+		mPersistentPointer = nullptr;
+		mMappedPointer = nullptr;
+	}
+
+	glDeleteBuffers(1, &mBuffer);
+	mBuffer = 0;
+}
+
+void StreamingBuffer::BeginFrame()
+{
+	mRegion = (mRegion + 1) % FrameCount;
+	mHead = 0;
+
+	// Wait until the GPU is done with what we wrote here FrameCount frames ago.
+	GLsync& fence = mFences[mRegion];
+	if (fence)
+	{
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			++mStallCount;
+			do
+			{
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			} while (result == GL_TIMEOUT_EXPIRED);
+		}
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	if (!IsPersistent())
+	{
+		// The fence already told us the GPU is done, so the driver doesn't need to sync again.
+		glBindBuffer(kMapTarget, mBuffer);
+		mMappedPointer = static_cast<char*>(glMapBufferRange(
+			kMapTarget,
+			mRegion * mRegionSize,
+			mRegionSize,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT
+		));
+		glBindBuffer(kMapTarget, 0);
+	}
+}
+
+void* StreamingBuffer::Allocate(GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset)
+{
+	char* region = IsPersistent() ? mPersistentPointer + mRegion * mRegionSize : mMappedPointer;
+	if (region == nullptr)
+	{
+		return nullptr;
+	}
+
+	const GLsizeiptr start = (mHead + alignment - 1) / alignment * alignment;
+	if (start + size > mRegionSize)
+	{
+		return nullptr;
+	}
+
+	mHead = start + size;
+	*offset = mRegion * mRegionSize + start;
+	return region + start;
+}
+
+void StreamingBuffer::Commit()
+{
+	if (mMappedPointer == nullptr)
+	{
+		// Persistently mapped: the writes are already visible, and no GL
+		// call would tell the stats about them.
+		GLStats::CountUpload(mHead);
+		return;
+	}
+
+	// A buffer can't be used for drawing while it's (non-persistently) mapped.
+	glBindBuffer(kMapTarget, mBuffer);
+	if (mHead > 0)
+	{
+		glFlushMappedBufferRange(kMapTarget, 0, mHead);
+	}
+	glUnmapBuffer(kMapTarget);
+	glBindBuffer(kMapTarget, 0);
+	mMappedPointer = nullptr;
+}
+
+void StreamingBuffer::EndFrame()
+{
+	mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+GLsizeiptr StreamingBuffer::GetUniformAlignment()
+{
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	return alignment > 0 ? alignment : 256;
+}
+
+GLsizeiptr StreamingBuffer::GetStorageAlignment()
+{
+	if (!GLAD_GL_ARB_shader_storage_buffer_object)
+	{
+		return 1;
+	}
+	GLint alignment = 0;
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	return alignment > 0 ? alignment : 256;
+}
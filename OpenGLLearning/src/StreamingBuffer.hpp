@@ -0,0 +1,67 @@
+#pragma once
+#include <glad/glad.h>
+
+/// <summary>
+/// A ring of per-frame regions in one GL buffer, for data we rewrite every
+/// frame (per-object uniforms, instance matrices, dynamic vertices).
+///
+/// With GL_ARB_buffer_storage the whole buffer is mapped once, persistently
+/// and coherently, and we write straight into it. On plain 4.1 each frame's
+/// region is mapped with GL_MAP_UNSYNCHRONIZED_BIT instead. Either way a
+/// fence per region tells us when the GPU is done reading it, so the driver
+/// never has to copy or stall behind our back.
+///
+/// Usage, every frame:
+///		BeginFrame();		// waits if the GPU still reads this region
+///		Allocate(...);		// write through the returned pointers
+///		Commit();			// before any draw reads the data
+///		... draws ...
+///		EndFrame();			// after the last draw that reads the data
+/// </summary>
+class StreamingBuffer {
+public:
+	/// <summary>
+	/// Regions in the ring: one being written, up to two in flight on the GPU.
+	/// </summary>
+	static constexpr int FrameCount = 3;
+
+	bool Create(GLsizeiptr bytesPerFrame);
+	void Destroy();
+
+	void BeginFrame();
+	/// <summary>
+	/// Reserves 'size' bytes in this frame's region. 'offset' receives the
+	/// position in GetBuffer() to bind or draw from. Returns nullptr if the
+	/// region is full.
+	/// </summary>
+	void* Allocate(GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset);
+	void Commit();
+	void EndFrame();
+
+	GLuint GetBuffer() const { return mBuffer; }
+	bool IsPersistent() const { return mPersistentPointer != nullptr; }
+	/// <summary>
+	/// How often BeginFrame() had to wait for the GPU.
+	/// </summary>
+	unsigned int GetStallCount() const { return mStallCount; }
+
+	/// <summary>
+	/// GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, for Allocate() calls that end up in glBindBufferRange.
+	/// </summary>
+	static GLsizeiptr GetUniformAlignment();
+	/// <summary>
+	/// GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, or 1 without storage buffers.
+	/// </summary>
+	static GLsizeiptr GetStorageAlignment();
+
+private:
+	GLuint		mBuffer						= 0;
+	GLsizeiptr	mRegionSize					= 0;
+	int			mRegion						= 0;
+	GLsizeiptr	mHead						= 0;
+	char*		mPersistentPointer			= nullptr;
+	// The current region, mapped only between BeginFrame() and Commit() on the fallback path.
+	char*		mMappedPointer				= nullptr;
+	GLsync		mFences[FrameCount]			= {};
+	unsigned int mStallCount				= 0;
+};
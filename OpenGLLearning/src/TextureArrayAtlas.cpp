@@ -0,0 +1,146 @@
+#include "TextureArrayAtlas.hpp"
+
+#include "MipGenerator.hpp"
+
+#include <algorithm>
+
+namespace {
+
+	std::uint32_t RoundUp(std::uint32_t value, std::uint32_t multiple)
+	{
+		return (value + multiple - 1) / multiple * multiple;
+	}
+}
+
+TextureArrayAtlas::~TextureArrayAtlas()
+{
+	Destroy();
+}
+
+bool TextureArrayAtlas::Create(const Settings& settings)
+{
+	mSettings = settings;
+	mSettings.mLevelCount = std::max(1u, std::min(settings.mLevelCount, MipGenerator::GetLevelCount(settings.mLayerSize, settings.mLayerSize)));
+	const GLsizei size = static_cast<GLsizei>(mSettings.mLayerSize);
+	const GLsizei layers = static_cast<GLsizei>(mSettings.mLayerCount);
+	const GLsizei levels = static_cast<GLsizei>(mSettings.mLevelCount);
+
+	glGenTextures(1, &mTexture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, mTexture);
+	// Same as TextureBackends::GetGL(): immutable storage where we have it.
+	if (GLAD_GL_ARB_texture_storage)
+	{
+		glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, GL_RGBA8, size, size, layers);
+	}
+	else
+	{
+		for (GLsizei level = 0; level < levels; ++level)
+		{
+			glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, size >> level, size >> level, layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		}
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+	}
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, (levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	mLayers.clear();
+	return glGetError() == GL_NO_ERROR;
+}
+
+void TextureArrayAtlas::Destroy()
+{
+	if (mTexture != 0)
+	{
+		glDeleteTextures(1, &mTexture);
+		mTexture = 0;
+	}
+	mLayers.clear();
+}
+
+bool TextureArrayAtlas::Add(const ImageLoader::Level& image, Entry* entry)
+{
+	// Levels halve exactly if rectangles are multiples of the last level's
+	// texel, which is also the gutter.
+	const std::uint32_t gutter = 1u << (mSettings.mLevelCount - 1);
+	ImageLoader::Level source = image;
+	while (RoundUp(source.mWidth + 2 * gutter, gutter) > mSettings.mLayerSize
+		|| RoundUp(source.mHeight + 2 * gutter, gutter) > mSettings.mLayerSize)
+	{
+		source = MipGenerator::Downsample(source, MipGenerator::Filter::Box);
+	}
+	const std::uint32_t width = RoundUp(source.mWidth + 2 * gutter, gutter);
+	const std::uint32_t height = RoundUp(source.mHeight + 2 * gutter, gutter);
+
+	AtlasPacker::Rect rect;
+	std::uint32_t layer = 0;
+	while (layer < mLayers.size() && !mLayers[layer].Insert(width, height, &rect))
+	{
+		++layer;
+	}
+	if (layer == mLayers.size())
+	{
+		if (layer == mSettings.mLayerCount)
+		{
+			return false;
+		}
+		mLayers.emplace_back();
+		mLayers.back().Create(mSettings.mLayerSize, mSettings.mLayerSize);
+		mLayers.back().Insert(width, height, &rect);
+	}
+
+	// The gutter repeats the edge, and so does whatever rounding up added.
+	ImageLoader::Level padded;
+	padded.mWidth = width;
+	padded.mHeight = height;
+	padded.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+	for (std::uint32_t y = 0; y < height; ++y)
+	{
+		const std::uint32_t sourceY = std::min(source.mHeight - 1, (y > gutter) ? y - gutter : 0);
+		for (std::uint32_t x = 0; x < width; ++x)
+		{
+			const std::uint32_t sourceX = std::min(source.mWidth - 1, (x > gutter) ? x - gutter : 0);
+			std::copy_n(&source.mPixels[(static_cast<std::size_t>(sourceY) * source.mWidth + sourceX) * 4], 4,
+				&padded.mPixels[(static_cast<std::size_t>(y) * width + x) * 4]);
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, mTexture);
+	for (std::uint32_t level = 0; level < mSettings.mLevelCount; ++level)
+	{
+		if (level > 0)
+		{
+			padded = MipGenerator::Downsample(padded, MipGenerator::Filter::Box);
+		}
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLint>(level),
+			static_cast<GLint>(rect.mX >> level), static_cast<GLint>(rect.mY >> level), static_cast<GLint>(layer),
+			static_cast<GLsizei>(padded.mWidth), static_cast<GLsizei>(padded.mHeight), 1,
+			GL_RGBA, GL_UNSIGNED_BYTE, padded.mPixels.data());
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	const float size = static_cast<float>(mSettings.mLayerSize);
+	entry->mRect = glm::vec4(
+		(rect.mX + gutter) / size,
+		(rect.mY + gutter) / size,
+		source.mWidth / size,
+		source.mHeight / size);
+	entry->mLayer = layer;
+	return true;
+}
+
+float TextureArrayAtlas::GetOccupancy() const
+{
+	float sum = 0.0f;
+	for (const AtlasPacker& layer : mLayers)
+	{
+		sum += layer.GetOccupancy();
+	}
+	return mLayers.empty() ? 0.0f : sum / static_cast<float>(mLayers.size());
+}
+
+std::uint32_t TextureArrayAtlas::GetUsedLayers() const
+{
+	return static_cast<std::uint32_t>(mLayers.size());
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "AtlasPacker.hpp"
+#include "ImageLoader.hpp"
+
+#include <glad/glad.h>
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Many small textures in one GL_TEXTURE_2D_ARRAY, so meshes with
+/// different textures still draw in one call: each texture is a rectangle
+/// of some layer, and what a draw needs to find its own is that layer and
+/// the rectangle's place in UV space, which go in its per-object data.
+///
+/// Every layer has an AtlasPacker. A texture goes in the first layer with
+/// room, surrounded by a gutter of its own edge texels so filtering
+/// doesn't reach its neighbours. The array has a few mips, which Add()
+/// makes on the CPU per texture: rectangles are aligned so each level
+/// halves exactly, and the gutter is wide enough to still be a texel at
+/// the last level. Textures larger than a layer are halved until they fit.
+///
+/// Storage is allocated for every layer up front. Main thread only.
+/// </summary>
+class TextureArrayAtlas {
+public:
+	struct Settings {
+		std::uint32_t		mLayerSize		= 1024;
+		std::uint32_t		mLayerCount		= 4;
+		// Levels of the array, the first being full size; sets the gutter,
+		// which is 2^(mLevelCount - 1) texels.
+		std::uint32_t		mLevelCount		= 4;
+	};
+
+	/// <summary>
+	/// Where a texture ended up: UV (x, y) = mRect.xy + uv * mRect.zw.
+	/// </summary>
+	struct Entry {
+		glm::vec4			mRect			= glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+		std::uint32_t		mLayer			= 0;
+	};
+
+	~TextureArrayAtlas();
+
+	bool Create(const Settings& settings);
+	void Destroy();
+
+	/// <summary>
+	/// Packs and uploads an 8 bit RGBA image, rows bottom to top. False if
+	/// no layer has room left.
+	/// </summary>
+	bool Add(const ImageLoader::Level& image, Entry* entry);
+
+	GLuint GetTexture() const { return mTexture; }
+	/// <summary>
+	/// The average occupancy of the layers in use, gutters included.
+	/// </summary>
+	float GetOccupancy() const;
+	std::uint32_t GetUsedLayers() const;
+
+private:
+	Settings					mSettings;
+	GLuint						mTexture		= 0;
+	std::vector<AtlasPacker>	mLayers;
+};
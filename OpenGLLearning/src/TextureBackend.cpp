@@ -0,0 +1,143 @@
+#include "TextureBackend.hpp"
+
+#include "BlockCompressor.hpp"
+
+#include <unordered_map>
+
+namespace {
+
+	//------------------------------- GL -----------------------------------
+
+	GLuint CreateGL(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei levels)
+	{
+		GLuint texture = 0;
+		glGenTextures(1, &texture);
+		glBindTexture(GL_TEXTURE_2D, texture);
+		// Our glad only goes up to 4.1, where this is still an extension.
+		if (GLAD_GL_ARB_texture_storage)
+		{
+			glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+		}
+		else
+		{
+			for (GLsizei level = 0; level < levels; ++level)
+			{
+				if (internalFormat == GL_RGBA8)
+				{
+					glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+				}
+				else
+				{
+					// The size has to be right even without data.
+					const std::size_t size = BlockCompressor::GetLevelBytes(internalFormat, width, height);
+					glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, width, height, 0, static_cast<GLsizei>(size), nullptr);
+				}
+				width = (width > 1) ? width / 2 : 1;
+				height = (height > 1) ? height / 2 : 1;
+			}
+			// Immutable storage gets this implicitly; without it the texture
+			// would be incomplete until every level down to 1x1 existed.
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		return texture;
+	}
+
+	void UploadGL(GLuint texture, GLint level, GLsizei width, GLsizei height, const void* pixels)
+	{
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	void UploadCompressedGL(GLuint texture, GLint level, GLenum internalFormat, GLsizei width, GLsizei height,
+		GLsizei size, const void* blocks)
+	{
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, internalFormat, size, blocks);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	void DestroyGL(GLuint texture)
+	{
+		glDeleteTextures(1, &texture);
+	}
+
+	//------------------------------- Stub -----------------------------------
+
+	struct StubState {
+		std::unordered_map<GLuint, std::size_t>	mSizes;
+		GLuint									mNextName		= 1;
+		std::size_t								mAllocated		= 0;
+		std::size_t								mUploads		= 0;
+	};
+
+	StubState& GetStubState()
+	{
+		static StubState sState;
+		return sState;
+	}
+
+	GLuint CreateStub(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei levels)
+	{
+		StubState& state = GetStubState();
+		std::size_t size = 0;
+		for (GLsizei level = 0; level < levels; ++level)
+		{
+			size += BlockCompressor::GetLevelBytes(internalFormat, width, height);
+			width = (width > 1) ? width / 2 : 1;
+			height = (height > 1) ? height / 2 : 1;
+		}
+		state.mSizes[state.mNextName] = size;
+		state.mAllocated += size;
+		return state.mNextName++;
+	}
+
+	void UploadStub(GLuint, GLint, GLsizei, GLsizei, const void*)
+	{
+		++GetStubState().mUploads;
+	}
+
+	void UploadCompressedStub(GLuint, GLint, GLenum, GLsizei, GLsizei, GLsizei, const void*)
+	{
+		++GetStubState().mUploads;
+	}
+
+	void DestroyStub(GLuint texture)
+	{
+		StubState& state = GetStubState();
+		auto found = state.mSizes.find(texture);
+		if (found != state.mSizes.end())
+		{
+			state.mAllocated -= found->second;
+			state.mSizes.erase(found);
+		}
+	}
+}
+
+namespace TextureBackends {
+
+	const TextureBackend* GetGL()
+	{
+		static const TextureBackend sBackend = { "OpenGL", CreateGL, UploadGL, UploadCompressedGL, DestroyGL };
+		return &sBackend;
+	}
+
+	const TextureBackend* GetStub()
+	{
+		static const TextureBackend sBackend = { "Stub", CreateStub, UploadStub, UploadCompressedStub, DestroyStub };
+		return &sBackend;
+	}
+
+	std::size_t GetStubAllocatedBytes()
+	{
+		return GetStubState().mAllocated;
+	}
+
+	std::size_t GetStubUploadCount()
+	{
+		return GetStubState().mUploads;
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <glad/glad.h>
+
+#include <cstddef>
+
+/// <summary>
+/// The few texture calls TextureManager makes, as a table so the manager
+/// can run against the real driver or against a stub that only keeps
+/// count. The stub needs no context at all, which is how --bench-textures
+/// exercises streaming on machines without a GPU.
+///
+/// Every texture has immutable storage for 'levels' mips from width x
+/// height down, as glTexStorage2D makes it, in GL_RGBA8 or one of the
+/// block compressed formats BlockCompressor makes.
+/// </summary>
+struct TextureBackend {
+	const char*	mName;
+	GLuint	(*mCreate)(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei levels);
+	/// <summary>
+	/// Replaces a whole GL_RGBA8 level; rows are tightly packed, bottom to top.
+	/// </summary>
+	void	(*mUpload)(GLuint texture, GLint level, GLsizei width, GLsizei height, const void* pixels);
+	/// <summary>
+	/// Replaces a whole compressed level with 'size' bytes of blocks.
+	/// </summary>
+	void	(*mUploadCompressed)(GLuint texture, GLint level, GLenum internalFormat, GLsizei width, GLsizei height,
+				GLsizei size, const void* blocks);
+	void	(*mDestroy)(GLuint texture);
+};
+
+namespace TextureBackends {
+	/// <summary>
+	/// glTexStorage2D where the context has ARB_texture_storage (core
+	/// since 4.2), otherwise glTexImage2D (glCompressedTexImage2D) per
+	/// level with the level range clamped, which behaves the same. Main
+	/// thread only.
+	/// </summary>
+	const TextureBackend* GetGL();
+
+	const TextureBackend* GetStub();
+
+	/// <summary>
+	/// What the stub's live textures would take on a GPU, and how many uploads it took.
+	/// </summary>
+	std::size_t GetStubAllocatedBytes();
+	std::size_t GetStubUploadCount();
+}
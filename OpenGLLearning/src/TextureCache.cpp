@@ -0,0 +1,121 @@
+#include "TextureCache.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+	const char		Magic[8]	= { 'O', 'G', 'L', 'B', 'C', 'N', '\r', '\n' };
+	constexpr std::uint32_t	Version		= 1;
+
+	struct Header {
+		char			mMagic[8];
+		std::uint32_t	mVersion;
+		std::uint32_t	mBlockFormat;
+		std::uint64_t	mSourceHash;
+		std::uint32_t	mSettings;
+		std::uint32_t	mLevelCount;
+	};
+
+	struct LevelHeader {
+		std::uint32_t	mWidth;
+		std::uint32_t	mHeight;
+		std::uint32_t	mSize;
+	};
+}
+
+std::string TextureCache::GetPath(const char* source, BlockCompressor::Format format)
+{
+	std::string path = std::string(source) + "." + BlockCompressor::GetName(format);
+	for (std::size_t i = path.size() - 3; i < path.size(); ++i)
+	{
+		path[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(path[i])));
+	}
+	return path;
+}
+
+std::uint64_t TextureCache::Hash(const std::uint8_t* data, std::size_t size)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		hash = (hash ^ data[i]) * 1099511628211ull;
+	}
+	return hash;
+}
+
+bool TextureCache::Read(const char* path, const Key& key, ImageLoader::Image* image)
+{
+	std::FILE* file = std::fopen(path, "rb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	Header header;
+	bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+		&& std::memcmp(header.mMagic, Magic, sizeof(Magic)) == 0
+		&& header.mVersion == Version
+		&& header.mBlockFormat == key.mBlockFormat
+		&& header.mSourceHash == key.mSourceHash
+		&& header.mSettings == key.mSettings
+		&& header.mLevelCount > 0 && header.mLevelCount <= 32;
+
+	ImageLoader::Image result;
+	for (std::uint32_t i = 0; ok && i < header.mLevelCount; ++i)
+	{
+		LevelHeader levelHeader;
+		ok = std::fread(&levelHeader, sizeof(levelHeader), 1, file) == 1
+			&& levelHeader.mSize == BlockCompressor::GetLevelBytes(key.mBlockFormat, levelHeader.mWidth, levelHeader.mHeight);
+		if (ok)
+		{
+			ImageLoader::Level level;
+			level.mWidth = levelHeader.mWidth;
+			level.mHeight = levelHeader.mHeight;
+			level.mPixels.resize(levelHeader.mSize);
+			ok = std::fread(level.mPixels.data(), 1, level.mPixels.size(), file) == level.mPixels.size();
+			result.mLevels.push_back(std::move(level));
+		}
+	}
+	std::fclose(file);
+	if (ok)
+	{
+		result.mBlockFormat = key.mBlockFormat;
+		*image = std::move(result);
+	}
+	return ok;
+}
+
+bool TextureCache::Write(const char* path, const Key& key, const ImageLoader::Image& image)
+{
+	const std::string temporary = std::string(path) + ".tmp";
+	std::FILE* file = std::fopen(temporary.c_str(), "wb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	Header header = {};
+	std::memcpy(header.mMagic, Magic, sizeof(Magic));
+	header.mVersion = Version;
+	header.mBlockFormat = key.mBlockFormat;
+	header.mSourceHash = key.mSourceHash;
+	header.mSettings = key.mSettings;
+	header.mLevelCount = static_cast<std::uint32_t>(image.mLevels.size());
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+	for (const ImageLoader::Level& level : image.mLevels)
+	{
+		const LevelHeader levelHeader = { level.mWidth, level.mHeight, static_cast<std::uint32_t>(level.mPixels.size()) };
+		ok = ok && std::fwrite(&levelHeader, sizeof(levelHeader), 1, file) == 1
+			&& std::fwrite(level.mPixels.data(), 1, level.mPixels.size(), file) == level.mPixels.size();
+	}
+	ok = (std::fclose(file) == 0) && ok;
+
+	// rename() won't replace a file on Windows.
+	std::remove(path);
+	if (!ok || std::rename(temporary.c_str(), path) != 0)
+	{
+		std::remove(temporary.c_str());
+		return false;
+	}
+	return true;
+}
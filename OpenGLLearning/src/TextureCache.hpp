@@ -0,0 +1,45 @@
+#pragma once
+#include "BlockCompressor.hpp"
+#include "ImageLoader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// Files of block compressed mip chains, so a texture goes through
+/// BlockCompressor once rather than on every start. The file sits next to
+/// its source, named after it and the format ("wall.png.bc7"), and holds
+///		header	magic, version, and the Key it was made for
+///		levels	width, height, byte count and the blocks, finest first
+/// so the levels go to glCompressedTexImage2D as they are read. A file
+/// made from other bytes or with other settings is stale, and is simply
+/// written again.
+/// </summary>
+namespace TextureCache {
+	struct Key {
+		// Of the source file's bytes, see Hash().
+		std::uint64_t	mSourceHash		= 0;
+		// GL internal format of the blocks.
+		std::uint32_t	mBlockFormat	= 0;
+		// Anything else that changes the result: quality, mip filter.
+		std::uint32_t	mSettings		= 0;
+	};
+
+	std::string GetPath(const char* source, BlockCompressor::Format format);
+
+	/// <summary>
+	/// 64 bit FNV-1a.
+	/// </summary>
+	std::uint64_t Hash(const std::uint8_t* data, std::size_t size);
+
+	/// <summary>
+	/// False if there's no file, it's damaged, or it was made for another key.
+	/// </summary>
+	bool Read(const char* path, const Key& key, ImageLoader::Image* image);
+
+	/// <summary>
+	/// Writes through a temporary file, so a reader never sees half of one.
+	/// </summary>
+	bool Write(const char* path, const Key& key, const ImageLoader::Image& image);
+}
@@ -0,0 +1,362 @@
+#include "TextureManager.hpp"
+#include "TextureCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+
+TextureManager::~TextureManager()
+{
+	Destroy();
+}
+
+void TextureManager::Create(const TextureBackend* backend, const Settings& settings)
+{
+	mBackend = backend;
+	mSettings = settings;
+	mStopping = false;
+	mCacheHits = 0;
+	mCacheWrites = 0;
+	for (unsigned i = 0; i < std::max(1u, settings.mWorkerThreads); ++i)
+	{
+		mWorkers.emplace_back(&TextureManager::Run, this);
+	}
+}
+
+void TextureManager::Destroy()
+{
+	if (mWorkers.empty())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mWake.notify_all();
+	for (std::thread& worker : mWorkers)
+	{
+		worker.join();
+	}
+	mWorkers.clear();
+	mJobs.clear();
+	mFinished.clear();
+	mPending = 0;
+
+	for (Texture& texture : mTextures)
+	{
+		if (texture.mName != 0)
+		{
+			mBackend->mDestroy(texture.mName);
+		}
+	}
+	mTextures.clear();
+	mStats = Stats();
+}
+
+TextureManager::Handle TextureManager::Load(const char* path)
+{
+	const std::string file(path);
+	const Settings settings = mSettings;
+	return Submit([this, file, settings](ImageLoader::Image* image, std::string* error) {
+		std::vector<std::uint8_t> data;
+		if (!ImageLoader::ReadFile(file.c_str(), &data, error))
+		{
+			return false;
+		}
+
+		// The cache is only worth it for what compression costs.
+		std::string cachePath;
+		TextureCache::Key key;
+		if (settings.mCompress && settings.mUseCacheFiles)
+		{
+			cachePath = TextureCache::GetPath(file.c_str(), settings.mFormat);
+			key.mSourceHash = TextureCache::Hash(data.data(), data.size());
+			key.mBlockFormat = BlockCompressor::GetGLFormat(settings.mFormat);
+			key.mSettings = (static_cast<std::uint32_t>(settings.mQuality) << 8) | static_cast<std::uint32_t>(settings.mFilter);
+			if (TextureCache::Read(cachePath.c_str(), key, image))
+			{
+				++mCacheHits;
+				return true;
+			}
+		}
+
+		if (!ImageLoader::Decode(data.data(), data.size(), image, error))
+		{
+			*error = file + ": " + *error;
+			return false;
+		}
+		MipGenerator::BuildChain(image, settings.mFilter);
+		if (settings.mCompress)
+		{
+			BlockCompressor::CompressImage(image, settings.mFormat, settings.mQuality, settings.mCompressThreads);
+			if (!cachePath.empty())
+			{
+				if (TextureCache::Write(cachePath.c_str(), key, *image))
+				{
+					++mCacheWrites;
+				}
+				else
+				{
+					printf("Texture cache: can't write %s\n", cachePath.c_str());
+				}
+			}
+		}
+		return true;
+	});
+}
+
+TextureManager::Handle TextureManager::CreateFromPixels(std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels)
+{
+	ImageLoader::Level level;
+	level.mWidth = width;
+	level.mHeight = height;
+	level.mPixels.assign(pixels, pixels + static_cast<std::size_t>(width) * height * 4);
+	const Settings settings = mSettings;
+	// std::function wants copyable captures, hence the copy per call.
+	return Submit([level, settings](ImageLoader::Image* image, std::string*) {
+		image->mLevels.push_back(level);
+		MipGenerator::BuildChain(image, settings.mFilter);
+		if (settings.mCompress)
+		{
+			BlockCompressor::CompressImage(image, settings.mFormat, settings.mQuality, settings.mCompressThreads);
+		}
+		return true;
+	});
+}
+
+void TextureManager::RequestLevel(Handle handle, float level)
+{
+	Texture& texture = mTextures[handle];
+	const bool fresh = !texture.mRequested || texture.mRequestUpdate != mUpdateCount;
+	texture.mRequestedLevel = fresh ? level : std::min(texture.mRequestedLevel, level);
+	texture.mRequestUpdate = mUpdateCount;
+	texture.mRequested = true;
+}
+
+float TextureManager::GetDesiredLevel(std::uint32_t width, std::uint32_t height, float screenPixels)
+{
+	const float texels = static_cast<float>(std::max(width, height));
+	return std::max(0.0f, std::log2(texels / std::max(screenPixels, 1.0f)));
+}
+
+void TextureManager::Update()
+{
+	mStats.mUploadedBytes = 0;
+	mStats.mEvictions = 0;
+	mStats.mStreamIns = 0;
+
+	// Finished loads start out with only their tail resident.
+	std::vector<Finished> finished;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		finished.swap(mFinished);
+	}
+	for (Finished& result : finished)
+	{
+		if (!result.mSucceeded)
+		{
+			printf("Texture %u: %s\n", result.mHandle, result.mError.c_str());
+			continue;
+		}
+		Texture& texture = mTextures[result.mHandle];
+		texture.mImage = std::move(result.mImage);
+		const std::vector<ImageLoader::Level>& levels = texture.mImage.mLevels;
+		texture.mTailLevel = static_cast<std::uint32_t>(levels.size() - 1);
+		for (std::uint32_t level = 0; level < levels.size(); ++level)
+		{
+			if (std::max(levels[level].mWidth, levels[level].mHeight) <= mSettings.mTailSize)
+			{
+				texture.mTailLevel = level;
+				break;
+			}
+		}
+		MakeResident(&texture, texture.mTailLevel);
+		texture.mReady = true;
+		mStats.mTailBytes += texture.mResidentBytes;
+	}
+
+	// What everyone wants, finest first; recent requests win ties.
+	std::vector<std::pair<std::uint32_t, Handle>> wanted;
+	for (Handle handle = 0; handle < mTextures.size(); ++handle)
+	{
+		const Texture& texture = mTextures[handle];
+		if (!texture.mReady)
+		{
+			continue;
+		}
+		std::uint32_t level = texture.mTailLevel;
+		if (texture.mRequested && mUpdateCount - texture.mRequestUpdate <= mSettings.mKeepUpdates)
+		{
+			level = std::min(level, static_cast<std::uint32_t>(std::max(0.0f, std::floor(texture.mRequestedLevel))));
+		}
+		wanted.emplace_back(level, handle);
+	}
+	std::stable_sort(wanted.begin(), wanted.end(), [&](const std::pair<std::uint32_t, Handle>& a, const std::pair<std::uint32_t, Handle>& b) {
+		if (a.first != b.first)
+		{
+			return a.first < b.first;
+		}
+		return mTextures[a.second].mRequestUpdate > mTextures[b.second].mRequestUpdate;
+	});
+
+	// Hand out what the tails leave of the budget; whoever doesn't get
+	// their level gets the finest one that still fits.
+	std::size_t remaining = (mSettings.mBudgetBytes > mStats.mTailBytes) ? mSettings.mBudgetBytes - mStats.mTailBytes : 0;
+	std::vector<std::uint32_t> targets(mTextures.size(), 0);
+	for (const std::pair<std::uint32_t, Handle>& entry : wanted)
+	{
+		const Texture& texture = mTextures[entry.second];
+		const std::size_t tailBytes = GetChainBytes(texture, texture.mTailLevel);
+		std::uint32_t level = entry.first;
+		while (level < texture.mTailLevel && GetChainBytes(texture, level) - tailBytes > remaining)
+		{
+			++level;
+		}
+		remaining -= GetChainBytes(texture, level) - tailBytes;
+		targets[entry.second] = level;
+	}
+
+	// Evict first, so the memory is free before anything streams in.
+	for (const std::pair<std::uint32_t, Handle>& entry : wanted)
+	{
+		Texture& texture = mTextures[entry.second];
+		if (targets[entry.second] > texture.mResidentLevel)
+		{
+			MakeResident(&texture, targets[entry.second]);
+			++mStats.mEvictions;
+		}
+	}
+	for (const std::pair<std::uint32_t, Handle>& entry : wanted)
+	{
+		Texture& texture = mTextures[entry.second];
+		const std::uint32_t target = targets[entry.second];
+		if (target >= texture.mResidentLevel)
+		{
+			continue;
+		}
+		// All the way if the allowance covers it, else a level at a time.
+		const std::size_t allowance = (mStats.mUploadedBytes < mSettings.mUploadBytesPerUpdate)
+			? mSettings.mUploadBytesPerUpdate - mStats.mUploadedBytes : 0;
+		std::uint32_t level = target;
+		if (GetChainBytes(texture, level) > allowance)
+		{
+			level = texture.mResidentLevel - 1;
+		}
+		if (GetChainBytes(texture, level) > allowance && mStats.mUploadedBytes > 0)
+		{
+			continue;
+		}
+		MakeResident(&texture, level);
+		++mStats.mStreamIns;
+	}
+
+	mStats.mCacheHits = mCacheHits;
+	mStats.mCacheWrites = mCacheWrites;
+	mStats.mResidentBytes = 0;
+	for (const Texture& texture : mTextures)
+	{
+		mStats.mResidentBytes += texture.mResidentBytes;
+	}
+	++mUpdateCount;
+}
+
+void TextureManager::WaitForLoads()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mDone.wait(lock, [&]() { return mPending == 0; });
+}
+
+std::uint32_t TextureManager::GetWidth(Handle handle) const
+{
+	const ImageLoader::Image& image = mTextures[handle].mImage;
+	return image.mLevels.empty() ? 0 : image.mLevels[0].mWidth;
+}
+
+std::uint32_t TextureManager::GetHeight(Handle handle) const
+{
+	const ImageLoader::Image& image = mTextures[handle].mImage;
+	return image.mLevels.empty() ? 0 : image.mLevels[0].mHeight;
+}
+
+TextureManager::Handle TextureManager::Submit(Job job)
+{
+	const Handle handle = static_cast<Handle>(mTextures.size());
+	mTextures.emplace_back();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mJobs.emplace_back(handle, std::move(job));
+		++mPending;
+	}
+	mWake.notify_one();
+	return handle;
+}
+
+void TextureManager::Run()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (true)
+	{
+		mWake.wait(lock, [&]() { return mStopping || !mJobs.empty(); });
+		if (mStopping)
+		{
+			break;
+		}
+		std::pair<Handle, Job> job = std::move(mJobs.front());
+		mJobs.pop_front();
+		lock.unlock();
+
+		Finished result;
+		result.mHandle = job.first;
+		result.mSucceeded = job.second(&result.mImage, &result.mError);
+
+		lock.lock();
+		mFinished.push_back(std::move(result));
+		--mPending;
+		mDone.notify_all();
+	}
+}
+
+std::size_t TextureManager::GetChainBytes(const Texture& texture, std::uint32_t level) const
+{
+	std::size_t bytes = 0;
+	for (std::size_t i = level; i < texture.mImage.mLevels.size(); ++i)
+	{
+		bytes += texture.mImage.mLevels[i].mPixels.size();
+	}
+	return bytes;
+}
+
+void TextureManager::MakeResident(Texture* texture, std::uint32_t level)
+{
+	const std::vector<ImageLoader::Level>& levels = texture->mImage.mLevels;
+	const GLenum format = (texture->mImage.mBlockFormat != 0) ? texture->mImage.mBlockFormat : GL_RGBA8;
+	const GLuint name = mBackend->mCreate(format,
+		static_cast<GLsizei>(levels[level].mWidth),
+		static_cast<GLsizei>(levels[level].mHeight),
+		static_cast<GLsizei>(levels.size() - level));
+	for (std::size_t i = level; i < levels.size(); ++i)
+	{
+		const GLsizei width = static_cast<GLsizei>(levels[i].mWidth);
+		const GLsizei height = static_cast<GLsizei>(levels[i].mHeight);
+		if (format == GL_RGBA8)
+		{
+			mBackend->mUpload(name, static_cast<GLint>(i - level), width, height, levels[i].mPixels.data());
+		}
+		else
+		{
+			mBackend->mUploadCompressed(name, static_cast<GLint>(i - level), format, width, height,
+				static_cast<GLsizei>(levels[i].mPixels.size()), levels[i].mPixels.data());
+		}
+	}
+	if (texture->mName != 0)
+	{
+		mBackend->mDestroy(texture->mName);
+	}
+
+	const std::size_t bytes = GetChainBytes(*texture, level);
+	mStats.mUploadedBytes += bytes;
+	texture->mName = name;
+	texture->mResidentLevel = level;
+	texture->mResidentBytes = bytes;
+}
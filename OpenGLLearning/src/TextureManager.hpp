@@ -0,0 +1,190 @@
+#pragma once
+#include "BlockCompressor.hpp"
+#include "ImageLoader.hpp"
+#include "MipGenerator.hpp"
+#include "TextureBackend.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Owns every texture: loads them, builds their mips, and decides which
+/// mips are on the GPU.
+///
+/// Decoding and mip generation run on worker threads of our own; Update()
+/// then creates the texture on the main thread. Every level stays in
+/// memory on the CPU, so levels can come and go on the GPU without
+/// touching the disk again.
+///
+/// Residency: the small levels of every texture (the mip tail, see
+/// Settings::mTailSize) are always on the GPU. Above that, each frame
+/// users say how fine a level they need (RequestLevel(), usually from
+/// GetDesiredLevel() and the size on screen), and Update() hands out the
+/// budget, finest demand first. Textures over their share lose levels at
+/// once; textures under it stream their levels in, within a per-Update
+/// upload allowance so a burst of demand doesn't stall a frame.
+///
+/// Storage is immutable, so changing what's resident means new storage
+/// holding exactly the resident levels, refilled from the CPU copy; the
+/// resident level is level 0 of the GL texture, which needs no shader
+/// changes. GL has no partial residency short of sparse textures (4.4).
+///
+/// With Settings::mCompress, the workers also block compress every level
+/// (see BlockCompressor) and the GPU gets the blocks. Loaded files then
+/// keep their compressed chain in a cache file next to them (see
+/// TextureCache), so later runs skip decoding and compressing alike.
+///
+/// Every call but the worker's own is main thread only.
+/// </summary>
+class TextureManager {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = 0xFFFFFFFFu;
+
+	struct Settings {
+		// What all the textures together may take on the GPU. The tails are
+		// always resident, even if they alone don't fit.
+		std::size_t				mBudgetBytes			= 64u * 1024u * 1024u;
+		// Levels no larger than this on their larger side are the tail.
+		std::uint32_t			mTailSize				= 64;
+		// How much streaming in may upload per Update(); at least one level
+		// always goes, however big.
+		std::size_t				mUploadBytesPerUpdate	= 4u * 1024u * 1024u;
+		// How many Update()s a request lasts, so textures that drop out of
+		// view for a moment don't lose their levels.
+		std::uint32_t			mKeepUpdates			= 60;
+		MipGenerator::Filter	mFilter					= MipGenerator::Filter::Kaiser;
+		unsigned				mWorkerThreads			= 2;
+		// Block compress as textures load, each one's blocks shared among
+		// mCompressThreads threads (0: one per core). Check the context
+		// can sample the format first.
+		bool						mCompress			= false;
+		BlockCompressor::Format		mFormat				= BlockCompressor::Format::BC7;
+		BlockCompressor::Quality	mQuality			= BlockCompressor::Quality::Normal;
+		unsigned					mCompressThreads	= 0;
+		bool						mUseCacheFiles		= true;
+	};
+
+	struct Stats {
+		std::size_t				mResidentBytes			= 0;
+		std::size_t				mTailBytes				= 0;
+		// During the last Update(), evictions included: they refill the
+		// smaller storage too.
+		std::size_t				mUploadedBytes			= 0;
+		std::uint32_t			mEvictions				= 0;
+		std::uint32_t			mStreamIns				= 0;
+		// Since Create(): loads read from a cache file, and cache files written.
+		std::uint32_t			mCacheHits				= 0;
+		std::uint32_t			mCacheWrites			= 0;
+	};
+
+	~TextureManager();
+
+	void Create(const TextureBackend* backend, const Settings& settings);
+	void Destroy();
+
+	/// <summary>
+	/// Starts loading the image at 'path'. Until it's done, and if it
+	/// fails, GetTexture() returns 0.
+	/// </summary>
+	Handle Load(const char* path);
+	/// <summary>
+	/// A texture from 8 bit RGBA pixels, rows bottom to top. Copied now.
+	/// </summary>
+	Handle CreateFromPixels(std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels);
+
+	/// <summary>
+	/// Asks for 'level' (0 is full size) or finer to be resident. Several
+	/// requests in one frame keep the finest.
+	/// </summary>
+	void RequestLevel(Handle handle, float level);
+
+	/// <summary>
+	/// The level at which one texel covers about one pixel, for a
+	/// width x height texture whose larger side spans 'screenPixels'.
+	/// </summary>
+	static float GetDesiredLevel(std::uint32_t width, std::uint32_t height, float screenPixels);
+
+	/// <summary>
+	/// Once per frame: takes in finished loads, then evicts and streams.
+	/// </summary>
+	void Update();
+
+	/// <summary>
+	/// Blocks until every load so far has been decoded; the next Update() creates them.
+	/// </summary>
+	void WaitForLoads();
+
+	GLuint GetTexture(Handle handle) const { return mTextures[handle].mName; }
+	/// <summary>
+	/// The finest level on the GPU, 0 until loaded.
+	/// </summary>
+	std::uint32_t GetResidentLevel(Handle handle) const { return mTextures[handle].mResidentLevel; }
+	std::uint32_t GetLevelCount(Handle handle) const { return static_cast<std::uint32_t>(mTextures[handle].mImage.mLevels.size()); }
+	std::uint32_t GetWidth(Handle handle) const;
+	std::uint32_t GetHeight(Handle handle) const;
+	const Stats& GetStats() const { return mStats; }
+
+private:
+	using Job = std::function<bool(ImageLoader::Image*, std::string*)>;
+
+	struct Texture {
+		ImageLoader::Image	mImage;
+		GLuint				mName				= 0;
+		bool				mReady				= false;
+		std::uint32_t		mResidentLevel		= 0;
+		std::uint32_t		mTailLevel			= 0;
+		std::size_t			mResidentBytes		= 0;
+		// The finest level asked for, and in which Update() it last was.
+		float				mRequestedLevel		= 0.0f;
+		std::uint64_t		mRequestUpdate		= 0;
+		bool				mRequested			= false;
+	};
+
+	struct Finished {
+		Handle				mHandle;
+		ImageLoader::Image	mImage;
+		bool				mSucceeded;
+		std::string			mError;
+	};
+
+	Handle Submit(Job job);
+	void Run();
+
+	/// <summary>
+	/// Bytes of levels 'level' and smaller.
+	/// </summary>
+	std::size_t GetChainBytes(const Texture& texture, std::uint32_t level) const;
+	/// <summary>
+	/// Replaces the texture's storage with one holding levels 'level' and smaller.
+	/// </summary>
+	void MakeResident(Texture* texture, std::uint32_t level);
+
+	const TextureBackend*			mBackend		= nullptr;
+	Settings						mSettings;
+	std::vector<Texture>			mTextures;
+	std::uint64_t					mUpdateCount	= 0;
+	Stats							mStats;
+
+	std::vector<std::thread>		mWorkers;
+	std::mutex						mMutex;
+	// New jobs, or Destroy().
+	std::condition_variable			mWake;
+	// A job finished.
+	std::condition_variable			mDone;
+	std::deque<std::pair<Handle, Job>>	mJobs;
+	std::vector<Finished>			mFinished;
+	std::size_t						mPending		= 0;
+	bool							mStopping		= false;
+	// The workers count these; Update() copies them to mStats.
+	std::atomic<std::uint32_t>		mCacheHits		{ 0 };
+	std::atomic<std::uint32_t>		mCacheWrites	{ 0 };
+};
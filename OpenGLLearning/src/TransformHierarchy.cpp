@@ -0,0 +1,184 @@
+#include "TransformHierarchy.hpp"
+#include "MatrixKernels.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+TransformHierarchy::Handle TransformHierarchy::Create(Handle parent)
+{
+	// Parents must already exist, which keeps the arrays topologically sorted.
+	assert(parent == InvalidHandle || parent < mParents.size());
+
+	Handle handle = static_cast<Handle>(mParents.size());
+	mTranslations.push_back(glm::vec3(0.0f));
+	mRotations.push_back(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+	mScales.push_back(glm::vec3(1.0f));
+	mParents.push_back(parent);
+	mDirty.push_back(0);
+	mWorldMatrices.push_back(glm::mat4(1.0f));
+	mPreviousTranslations.push_back(glm::vec3(0.0f));
+	mPreviousRotations.push_back(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+	mPreviousScales.push_back(glm::vec3(1.0f));
+	mMoving.push_back(0);
+	MarkDirty(handle);
+	return handle;
+}
+
+void TransformHierarchy::SetTranslation(Handle handle, const glm::vec3& translation)
+{
+	mTranslations[handle] = translation;
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::SetRotation(Handle handle, const glm::quat& rotation)
+{
+	mRotations[handle] = rotation;
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::SetScale(Handle handle, const glm::vec3& scale)
+{
+	mScales[handle] = scale;
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::Translate(Handle handle, const glm::vec3& offset)
+{
+	// M * T(offset) moves the origin along the already rotated and scaled axes.
+	mTranslations[handle] += mRotations[handle] * (mScales[handle] * offset);
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::Rotate(Handle handle, float angleRadians, const glm::vec3& axis)
+{
+	mRotations[handle] = glm::normalize(mRotations[handle] * glm::angleAxis(angleRadians, glm::normalize(axis)));
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::Scale(Handle handle, const glm::vec3& scale)
+{
+	mScales[handle] *= scale;
+	MarkDirty(handle);
+}
+
+void TransformHierarchy::BeginTick()
+{
+	const std::size_t count = mParents.size();
+
+	// Nodes that didn't move already have their current state saved, so only
+	// the ones that did (and the ones created since) need copying. What moved
+	// was drawn somewhere in between, so it needs one more update to land
+	// exactly where it is now.
+	if (mAnyMoving)
+	{
+		for (std::size_t i = 0; i < mTickStartCount; ++i)
+		{
+			if (mMoving[i])
+			{
+				mPreviousTranslations[i] = mTranslations[i];
+				mPreviousRotations[i] = mRotations[i];
+				mPreviousScales[i] = mScales[i];
+				mMoving[i] = 0;
+				mDirty[i] = 1;
+				mAnyDirty = true;
+			}
+		}
+		mAnyMoving = false;
+	}
+	for (std::size_t i = mTickStartCount; i < count; ++i)
+	{
+		mPreviousTranslations[i] = mTranslations[i];
+		mPreviousRotations[i] = mRotations[i];
+		mPreviousScales[i] = mScales[i];
+	}
+	mTickStartCount = count;
+}
+
+void TransformHierarchy::Update(float alpha)
+{
+	if (!mAnyDirty && !mAnyMoving)
+	{
+		return;
+	}
+
+	const std::size_t count = mParents.size();
+
+	// Moving nodes are somewhere else for every alpha.
+	if (mAnyMoving)
+	{
+		for (std::size_t i = 0; i < mTickStartCount; ++i)
+		{
+			mDirty[i] |= mMoving[i];
+		}
+	}
+
+	// Parents come first, so one pass pushes the flags all the way down.
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Handle parent = mParents[i];
+		if (parent != InvalidHandle && mDirty[parent])
+		{
+			mDirty[i] = 1;
+		}
+	}
+
+	// Build T * R * S for each run of dirty nodes in one batch.
+	for (std::size_t begin = 0; begin < count;)
+	{
+		if (!mDirty[begin])
+		{
+			++begin;
+			continue;
+		}
+		std::size_t end = begin + 1;
+		while (end < count && mDirty[end])
+		{
+			++end;
+		}
+		if (!mAnyMoving || alpha >= 1.0f)
+		{
+			MatrixKernels::ComposeTRSBatch(
+				&mTranslations[begin], &mRotations[begin], &mScales[begin],
+				&mWorldMatrices[begin], end - begin);
+			begin = end;
+			continue;
+		}
+
+		const std::size_t runLength = end - begin;
+		mBlendedTranslations.resize(runLength);
+		mBlendedRotations.resize(runLength);
+		mBlendedScales.resize(runLength);
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			if (i < mTickStartCount && mMoving[i])
+			{
+				mBlendedTranslations[i - begin] = glm::mix(mPreviousTranslations[i], mTranslations[i], alpha);
+				mBlendedRotations[i - begin] = glm::slerp(mPreviousRotations[i], mRotations[i], alpha);
+				mBlendedScales[i - begin] = glm::mix(mPreviousScales[i], mScales[i], alpha);
+			}
+			else
+			{
+				mBlendedTranslations[i - begin] = mTranslations[i];
+				mBlendedRotations[i - begin] = mRotations[i];
+				mBlendedScales[i - begin] = mScales[i];
+			}
+		}
+		MatrixKernels::ComposeTRSBatch(
+			mBlendedTranslations.data(), mBlendedRotations.data(), mBlendedScales.data(),
+			&mWorldMatrices[begin], runLength);
+		begin = end;
+	}
+
+	// Then bring the local matrices into world space, parents are already final.
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Handle parent = mParents[i];
+		if (mDirty[i] && parent != InvalidHandle)
+		{
+			mWorldMatrices[i] = mWorldMatrices[parent] * mWorldMatrices[i];
+		}
+	}
+
+	std::fill(mDirty.begin(), mDirty.end(), static_cast<std::uint8_t>(0));
+	mAnyDirty = false;
+}
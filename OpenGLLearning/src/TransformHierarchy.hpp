@@ -0,0 +1,103 @@
+#pragma once
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Data-oriented storage for every transform in the scene.
+///
+/// Local translation, rotation and scale live in separate (SoA) arrays,
+/// indexed by a handle. A node may only be parented to a node that already
+/// exists, so parents always sit at a lower index than their children and
+/// the arrays stay in topological order. Update() is then a single linear
+/// sweep that only recomputes dirty nodes (and everything below them), and
+/// leaves a contiguous array of world matrices that can be uploaded as-is.
+///
+/// With a fixed simulation tick, BeginTick() keeps the local transforms as
+/// they were before the tick, and Update(alpha) then renders any point in
+/// between. Only nodes that moved during the last tick are blended.
+/// </summary>
+class TransformHierarchy {
+public:
+	using Handle = std::uint32_t;
+	static constexpr Handle InvalidHandle = 0xFFFFFFFFu;
+
+	/// <summary>
+	/// Creates an identity transform, optionally as a child of 'parent'.
+	/// </summary>
+	Handle Create(Handle parent = InvalidHandle);
+
+	void SetTranslation(Handle handle, const glm::vec3& translation);
+	void SetRotation(Handle handle, const glm::quat& rotation);
+	void SetScale(Handle handle, const glm::vec3& scale);
+
+	/// <summary>
+	/// Compound the local transform in place, the same way glm::translate,
+	/// glm::rotate and glm::scale post-multiply a matrix.
+	/// Note: TRS can't represent shear, so a rotation applied after a
+	/// non-uniform scale is kept as rotation-then-scale.
+	/// </summary>
+	void Translate(Handle handle, const glm::vec3& offset);
+	void Rotate(Handle handle, float angleRadians, const glm::vec3& axis);
+	void Scale(Handle handle, const glm::vec3& scale);
+
+	const glm::vec3& GetTranslation(Handle handle) const { return mTranslations[handle]; }
+	const glm::quat& GetRotation(Handle handle) const { return mRotations[handle]; }
+	const glm::vec3& GetScale(Handle handle) const { return mScales[handle]; }
+	Handle GetParent(Handle handle) const { return mParents[handle]; }
+
+	/// <summary>
+	/// Call before every simulation tick: what's set now is where
+	/// Update(alpha) blends from.
+	/// </summary>
+	void BeginTick();
+
+	/// <summary>
+	/// Recomputes the world matrix of every dirty node and its descendants,
+	/// 'alpha' of the way from the start of the last tick to now.
+	/// </summary>
+	void Update(float alpha = 1.0f);
+
+	const glm::mat4& GetWorldMatrix(Handle handle) const { return mWorldMatrices[handle]; }
+	/// <summary>
+	/// Contiguous world matrices, indexed by handle. Only valid after Update().
+	/// </summary>
+	const glm::mat4* GetWorldMatrices() const { return mWorldMatrices.data(); }
+	std::size_t Size() const { return mParents.size(); }
+
+private:
+	void MarkDirty(Handle handle)
+	{
+		mDirty[handle] = 1;
+		mAnyDirty = true;
+		// Nodes created during this tick have nothing to blend from.
+		if (handle < mTickStartCount)
+		{
+			mMoving[handle] = 1;
+			mAnyMoving = true;
+		}
+	}
+
+	std::vector<glm::vec3>		mTranslations;
+	std::vector<glm::quat>		mRotations;
+	std::vector<glm::vec3>		mScales;
+	std::vector<Handle>			mParents;
+	std::vector<std::uint8_t>	mDirty;
+	std::vector<glm::mat4>		mWorldMatrices;
+	bool						mAnyDirty = false;
+
+	// The local transforms at the last BeginTick(), and who changed since.
+	std::vector<glm::vec3>		mPreviousTranslations;
+	std::vector<glm::quat>		mPreviousRotations;
+	std::vector<glm::vec3>		mPreviousScales;
+	std::vector<std::uint8_t>	mMoving;
+	std::size_t					mTickStartCount = 0;
+	bool						mAnyMoving = false;
+
+	// Blended local transforms of one run of nodes, for Update(alpha).
+	std::vector<glm::vec3>		mBlendedTranslations;
+	std::vector<glm::quat>		mBlendedRotations;
+	std::vector<glm::vec3>		mBlendedScales;
+};
@@ -787,6 +787,45 @@ static const char *exts = NULL;
 static int num_exts_i = 0;
 static char **exts_i = NULL;
 
+/* Open-addressed set of indices into exts_i, keyed by an FNV-1a hash of the
+ * name, so has_ext() doesn't strcmp its way through every extension for each
+ * of the several hundred flags it's asked about. */
+static int *exts_hash = NULL;
+static unsigned int exts_hash_mask = 0;
+
+static unsigned int hash_ext(const char *ext) {
+    unsigned int hash = 2166136261u;
+    while(*ext != '\0') {
+        hash = (hash ^ (unsigned char)*ext++) * 16777619u;
+    }
+    return hash;
+}
+
+static void hash_exts(void) {
+    int index;
+    unsigned int size = 16;
+    while(size < (unsigned int)num_exts_i * 2) {
+        size *= 2;
+    }
+
+    exts_hash = (int*)malloc(size * sizeof *exts_hash);
+    if(exts_hash == NULL) {
+        return;
+    }
+    exts_hash_mask = size - 1;
+    memset(exts_hash, -1, size * sizeof *exts_hash);
+
+    for(index = 0; index < num_exts_i; index++) {
+        unsigned int slot;
+        if(exts_i[index] == NULL) continue;
+        slot = hash_ext(exts_i[index]) & exts_hash_mask;
+        while(exts_hash[slot] != -1) {
+            slot = (slot + 1) & exts_hash_mask;
+        }
+        exts_hash[slot] = index;
+    }
+}
+
 static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
@@ -816,12 +855,15 @@ static int get_exts(void) {
             }
             exts_i[index] = local_str;
         }
+        hash_exts();
     }
 #endif
     return 1;
 }
 
 static void free_exts(void) {
+    free((void *)exts_hash);
+    exts_hash = NULL;
     if (exts_i != NULL) {
         int index;
         for(index = 0; index < num_exts_i; index++) {
@@ -861,6 +903,16 @@ static int has_ext(const char *ext) {
     } else {
         int index;
         if(exts_i == NULL) return 0;
+        if(exts_hash != NULL) {
+            unsigned int slot = hash_ext(ext) & exts_hash_mask;
+            while((index = exts_hash[slot]) != -1) {
+                if(strcmp(exts_i[index], ext) == 0) {
+                    return 1;
+                }
+                slot = (slot + 1) & exts_hash_mask;
+            }
+            return 0;
+        }
         for(index = 0; index < num_exts_i; index++) {
             const char *e = exts_i[index];
 
@@ -9192,3 +9244,2795 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+static GLADloadproc lazy_load = NULL;
+
+static void* lazy_resolve(const char *name) {
+    void* proc = lazy_load(name);
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s is not available\n", name);
+        abort();
+    }
+    return proc;
+}
+
+/* A trampoline swaps itself out of glad_<name> only if it's still there, so
+ * it doesn't undo a wrapper installed over it in the meantime; a wrapper that
+ * saved the trampoline keeps going through it, at the cost of one branch.
+ * Two threads resolving the same function at once just store the same
+ * pointer twice. */
+#define GLAD_LAZY(ret, name, pfn, params, args) \
+    static ret APIENTRY glad_lazy_##name params { \
+        static pfn proc = NULL; \
+        if(proc == NULL) proc = (pfn)lazy_resolve(#name); \
+        if(glad_##name == glad_lazy_##name) glad_##name = proc; \
+        return proc args; \
+    }
+#define GLAD_LAZY_VOID(name, pfn, params, args) \
+    static void APIENTRY glad_lazy_##name params { \
+        static pfn proc = NULL; \
+        if(proc == NULL) proc = (pfn)lazy_resolve(#name); \
+        if(glad_##name == glad_lazy_##name) glad_##name = proc; \
+        proc args; \
+    }
+
+/* Trampolines: each one resolves its function the first time it is called. */
+GLAD_LAZY_VOID(glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_LAZY_VOID(glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_LAZY_VOID(glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_LAZY_VOID(glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_LAZY_VOID(glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_LAZY_VOID(glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_LAZY_VOID(glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_LAZY_VOID(glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_LAZY_VOID(glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_LAZY_VOID(glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_LAZY_VOID(glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_LAZY_VOID(glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_LAZY_VOID(glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_LAZY_VOID(glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_LAZY_VOID(glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_LAZY_VOID(glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_LAZY(GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_LAZY_VOID(glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_LAZY_VOID(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_LAZY(const GLubyte *, glGetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+GLAD_LAZY_VOID(glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_LAZY_VOID(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_LAZY(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_LAZY_VOID(glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_LAZY_VOID(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_LAZY_VOID(glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_LAZY_VOID(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_LAZY_VOID(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_LAZY_VOID(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_LAZY_VOID(glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_LAZY(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_LAZY_VOID(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_LAZY_VOID(glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_LAZY_VOID(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_LAZY_VOID(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_LAZY_VOID(glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_LAZY_VOID(glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_LAZY(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_LAZY_VOID(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_LAZY_VOID(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_LAZY_VOID(glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_LAZY_VOID(glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_LAZY(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_LAZY_VOID(glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_LAZY(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_LAZY_VOID(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_LAZY_VOID(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_LAZY(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_LAZY_VOID(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_LAZY_VOID(glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_LAZY_VOID(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_LAZY_VOID(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_LAZY_VOID(glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_LAZY_VOID(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_LAZY_VOID(glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_LAZY_VOID(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_LAZY_VOID(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_LAZY_VOID(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_LAZY_VOID(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_LAZY_VOID(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_LAZY_VOID(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_LAZY(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_LAZY(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_LAZY(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_LAZY_VOID(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_LAZY_VOID(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_LAZY_VOID(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_LAZY_VOID(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_LAZY_VOID(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_LAZY_VOID(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_LAZY_VOID(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_LAZY_VOID(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_LAZY_VOID(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_LAZY_VOID(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_LAZY_VOID(glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_LAZY_VOID(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_LAZY(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_LAZY_VOID(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_LAZY_VOID(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_LAZY_VOID(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_LAZY_VOID(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_LAZY_VOID(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_LAZY(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_LAZY(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_VOID(glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_LAZY_VOID(glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_LAZY_VOID(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_LAZY_VOID(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_LAZY_VOID(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_LAZY_VOID(glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_LAZY_VOID(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_LAZY(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_LAZY(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_LAZY_VOID(glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_LAZY_VOID(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_LAZY_VOID(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glMinSampleShading, PFNGLMINSAMPLESHADINGPROC, (GLfloat value), (value))
+GLAD_LAZY_VOID(glBlendEquationi, PFNGLBLENDEQUATIONIPROC, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_LAZY_VOID(glBlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glBlendFunci, PFNGLBLENDFUNCIPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_LAZY_VOID(glBlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_LAZY_VOID(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect), (mode, indirect))
+GLAD_LAZY_VOID(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+GLAD_LAZY_VOID(glUniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x))
+GLAD_LAZY_VOID(glUniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+GLAD_LAZY_VOID(glUniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+GLAD_LAZY_VOID(glUniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+GLAD_LAZY_VOID(glUniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glGetUniformdv, PFNGLGETUNIFORMDVPROC, (GLuint program, GLint location, GLdouble *params), (program, location, params))
+GLAD_LAZY(GLint, glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_LAZY(GLuint, glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_LAZY_VOID(glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values))
+GLAD_LAZY_VOID(glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_LAZY_VOID(glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_LAZY_VOID(glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices))
+GLAD_LAZY_VOID(glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params))
+GLAD_LAZY_VOID(glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values))
+GLAD_LAZY_VOID(glPatchParameteri, PFNGLPATCHPARAMETERIPROC, (GLenum pname, GLint value), (pname, value))
+GLAD_LAZY_VOID(glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC, (GLenum pname, const GLfloat *values), (pname, values))
+GLAD_LAZY_VOID(glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY(GLboolean, glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id))
+GLAD_LAZY_VOID(glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC, (GLenum mode, GLuint id), (mode, id))
+GLAD_LAZY_VOID(glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+GLAD_LAZY_VOID(glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC, (GLenum target, GLuint index, GLuint id), (target, index, id))
+GLAD_LAZY_VOID(glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GLAD_LAZY_VOID(glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), ())
+GLAD_LAZY_VOID(glShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GLAD_LAZY_VOID(glDepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f))
+GLAD_LAZY_VOID(glClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d))
+GLAD_LAZY_VOID(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_LAZY_VOID(glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GLAD_LAZY_VOID(glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC, (GLuint pipeline, GLuint program), (pipeline, program))
+GLAD_LAZY(GLuint, glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GLAD_LAZY_VOID(glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_VOID(glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GLAD_LAZY_VOID(glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_LAZY(GLboolean, glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_VOID(glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GLAD_LAZY_VOID(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GLAD_LAZY_VOID(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GLAD_LAZY_VOID(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GLAD_LAZY_VOID(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_LAZY_VOID(glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_LAZY_VOID(glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glViewportArrayv, PFNGLVIEWPORTARRAYVPROC, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v))
+GLAD_LAZY_VOID(glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+GLAD_LAZY_VOID(glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glScissorArrayv, PFNGLSCISSORARRAYVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GLAD_LAZY_VOID(glScissorIndexed, PFNGLSCISSORINDEXEDPROC, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+GLAD_LAZY_VOID(glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_LAZY_VOID(glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_LAZY_VOID(glGetFloati_v, PFNGLGETFLOATI_VPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GLAD_LAZY_VOID(glGetDoublei_v, PFNGLGETDOUBLEI_VPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GLAD_LAZY_VOID(glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC, (GLbitfield barriers), (barriers))
+GLAD_LAZY_VOID(glPrimitiveBoundingBoxARB, PFNGLPRIMITIVEBOUNDINGBOXARBPROC, (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW), (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW))
+GLAD_LAZY_VOID(glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+GLAD_LAZY(GLuint64, glGetTextureHandleARB, PFNGLGETTEXTUREHANDLEARBPROC, (GLuint texture), (texture))
+GLAD_LAZY(GLuint64, glGetTextureSamplerHandleARB, PFNGLGETTEXTURESAMPLERHANDLEARBPROC, (GLuint texture, GLuint sampler), (texture, sampler))
+GLAD_LAZY_VOID(glMakeTextureHandleResidentARB, PFNGLMAKETEXTUREHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_LAZY_VOID(glMakeTextureHandleNonResidentARB, PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_LAZY(GLuint64, glGetImageHandleARB, PFNGLGETIMAGEHANDLEARBPROC, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format))
+GLAD_LAZY_VOID(glMakeImageHandleResidentARB, PFNGLMAKEIMAGEHANDLERESIDENTARBPROC, (GLuint64 handle, GLenum access), (handle, access))
+GLAD_LAZY_VOID(glMakeImageHandleNonResidentARB, PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_LAZY_VOID(glUniformHandleui64ARB, PFNGLUNIFORMHANDLEUI64ARBPROC, (GLint location, GLuint64 value), (location, value))
+GLAD_LAZY_VOID(glUniformHandleui64vARB, PFNGLUNIFORMHANDLEUI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glProgramUniformHandleui64ARB, PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+GLAD_LAZY_VOID(glProgramUniformHandleui64vARB, PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values))
+GLAD_LAZY(GLboolean, glIsTextureHandleResidentARB, PFNGLISTEXTUREHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_LAZY(GLboolean, glIsImageHandleResidentARB, PFNGLISIMAGEHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_LAZY_VOID(glVertexAttribL1ui64ARB, PFNGLVERTEXATTRIBL1UI64ARBPROC, (GLuint index, GLuint64EXT x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribL1ui64vARB, PFNGLVERTEXATTRIBL1UI64VARBPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_LAZY_VOID(glGetVertexAttribLui64vARB, PFNGLGETVERTEXATTRIBLUI64VARBPROC, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params))
+GLAD_LAZY_VOID(glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GLAD_LAZY(GLsync, glCreateSyncFromCLeventARB, PFNGLCREATESYNCFROMCLEVENTARBPROC, (struct _cl_context *context, struct _cl_event *event, GLbitfield flags), (context, event, flags))
+GLAD_LAZY_VOID(glClearBufferData, PFNGLCLEARBUFFERDATAPROC, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data))
+GLAD_LAZY_VOID(glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data))
+GLAD_LAZY_VOID(glClearTexImage, PFNGLCLEARTEXIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data))
+GLAD_LAZY_VOID(glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+GLAD_LAZY_VOID(glClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth))
+GLAD_LAZY_VOID(glClampColorARB, PFNGLCLAMPCOLORARBPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GLAD_LAZY_VOID(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC, (GLintptr indirect), (indirect))
+GLAD_LAZY_VOID(glDispatchComputeGroupSizeARB, PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z), (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z))
+GLAD_LAZY_VOID(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GLAD_LAZY_VOID(glDebugMessageControlARB, PFNGLDEBUGMESSAGECONTROLARBPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_LAZY_VOID(glDebugMessageInsertARB, PFNGLDEBUGMESSAGEINSERTARBPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_LAZY_VOID(glDebugMessageCallbackARB, PFNGLDEBUGMESSAGECALLBACKARBPROC, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam))
+GLAD_LAZY(GLuint, glGetDebugMessageLogARB, PFNGLGETDEBUGMESSAGELOGARBPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_LAZY_VOID(glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+GLAD_LAZY_VOID(glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+GLAD_LAZY_VOID(glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param))
+GLAD_LAZY_VOID(glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param))
+GLAD_LAZY_VOID(glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param))
+GLAD_LAZY_VOID(glCreateBuffers, PFNGLCREATEBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GLAD_LAZY_VOID(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GLAD_LAZY_VOID(glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GLAD_LAZY_VOID(glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GLAD_LAZY_VOID(glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GLAD_LAZY(void *, glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_LAZY(void *, glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GLAD_LAZY(GLboolean, glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_LAZY_VOID(glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GLAD_LAZY_VOID(glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GLAD_LAZY_VOID(glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GLAD_LAZY_VOID(glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GLAD_LAZY_VOID(glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GLAD_LAZY_VOID(glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+GLAD_LAZY_VOID(glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GLAD_LAZY_VOID(glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, (GLuint framebuffer, GLenum src), (framebuffer, src))
+GLAD_LAZY_VOID(glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments))
+GLAD_LAZY_VOID(glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+GLAD_LAZY_VOID(glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+GLAD_LAZY_VOID(glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY(GLenum, glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GLAD_LAZY_VOID(glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param))
+GLAD_LAZY_VOID(glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GLAD_LAZY_VOID(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GLAD_LAZY_VOID(glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GLAD_LAZY_VOID(glCreateTextures, PFNGLCREATETEXTURESPROC, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures))
+GLAD_LAZY_VOID(glTextureBuffer, PFNGLTEXTUREBUFFERPROC, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+GLAD_LAZY_VOID(glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+GLAD_LAZY_VOID(glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+GLAD_LAZY_VOID(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+GLAD_LAZY_VOID(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+GLAD_LAZY_VOID(glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+GLAD_LAZY_VOID(glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param))
+GLAD_LAZY_VOID(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC, (GLuint texture), (texture))
+GLAD_LAZY_VOID(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC, (GLuint unit, GLuint texture), (unit, texture))
+GLAD_LAZY_VOID(glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels))
+GLAD_LAZY_VOID(glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels))
+GLAD_LAZY_VOID(glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params))
+GLAD_LAZY_VOID(glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_LAZY_VOID(glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_LAZY_VOID(glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_LAZY_VOID(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+GLAD_LAZY_VOID(glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GLAD_LAZY_VOID(glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+GLAD_LAZY_VOID(glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GLAD_LAZY_VOID(glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GLAD_LAZY_VOID(glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GLAD_LAZY_VOID(glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GLAD_LAZY_VOID(glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param))
+GLAD_LAZY_VOID(glCreateSamplers, PFNGLCREATESAMPLERSPROC, (GLsizei n, GLuint *samplers), (n, samplers))
+GLAD_LAZY_VOID(glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_LAZY_VOID(glCreateQueries, PFNGLCREATEQUERIESPROC, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids))
+GLAD_LAZY_VOID(glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_LAZY_VOID(glDrawBuffersARB, PFNGLDRAWBUFFERSARBPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(glBlendEquationiARB, PFNGLBLENDEQUATIONIARBPROC, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_LAZY_VOID(glBlendEquationSeparateiARB, PFNGLBLENDEQUATIONSEPARATEIARBPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glBlendFunciARB, PFNGLBLENDFUNCIARBPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_LAZY_VOID(glBlendFuncSeparateiARB, PFNGLBLENDFUNCSEPARATEIARBPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_LAZY_VOID(glDrawArraysInstancedARB, PFNGLDRAWARRAYSINSTANCEDARBPROC, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount))
+GLAD_LAZY_VOID(glDrawElementsInstancedARB, PFNGLDRAWELEMENTSINSTANCEDARBPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GLAD_LAZY_VOID(glProgramStringARB, PFNGLPROGRAMSTRINGARBPROC, (GLenum target, GLenum format, GLsizei len, const void *string), (target, format, len, string))
+GLAD_LAZY_VOID(glBindProgramARB, PFNGLBINDPROGRAMARBPROC, (GLenum target, GLuint program), (target, program))
+GLAD_LAZY_VOID(glDeleteProgramsARB, PFNGLDELETEPROGRAMSARBPROC, (GLsizei n, const GLuint *programs), (n, programs))
+GLAD_LAZY_VOID(glGenProgramsARB, PFNGLGENPROGRAMSARBPROC, (GLsizei n, GLuint *programs), (n, programs))
+GLAD_LAZY_VOID(glProgramEnvParameter4dARB, PFNGLPROGRAMENVPARAMETER4DARBPROC, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GLAD_LAZY_VOID(glProgramEnvParameter4dvARB, PFNGLPROGRAMENVPARAMETER4DVARBPROC, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GLAD_LAZY_VOID(glProgramEnvParameter4fARB, PFNGLPROGRAMENVPARAMETER4FARBPROC, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GLAD_LAZY_VOID(glProgramEnvParameter4fvARB, PFNGLPROGRAMENVPARAMETER4FVARBPROC, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GLAD_LAZY_VOID(glProgramLocalParameter4dARB, PFNGLPROGRAMLOCALPARAMETER4DARBPROC, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GLAD_LAZY_VOID(glProgramLocalParameter4dvARB, PFNGLPROGRAMLOCALPARAMETER4DVARBPROC, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GLAD_LAZY_VOID(glProgramLocalParameter4fARB, PFNGLPROGRAMLOCALPARAMETER4FARBPROC, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GLAD_LAZY_VOID(glProgramLocalParameter4fvARB, PFNGLPROGRAMLOCALPARAMETER4FVARBPROC, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GLAD_LAZY_VOID(glGetProgramEnvParameterdvARB, PFNGLGETPROGRAMENVPARAMETERDVARBPROC, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GLAD_LAZY_VOID(glGetProgramEnvParameterfvARB, PFNGLGETPROGRAMENVPARAMETERFVARBPROC, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GLAD_LAZY_VOID(glGetProgramLocalParameterdvARB, PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GLAD_LAZY_VOID(glGetProgramLocalParameterfvARB, PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GLAD_LAZY_VOID(glGetProgramivARB, PFNGLGETPROGRAMIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetProgramStringARB, PFNGLGETPROGRAMSTRINGARBPROC, (GLenum target, GLenum pname, void *string), (target, pname, string))
+GLAD_LAZY(GLboolean, glIsProgramARB, PFNGLISPROGRAMARBPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glProgramParameteriARB, PFNGLPROGRAMPARAMETERIARBPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(glFramebufferTextureARB, PFNGLFRAMEBUFFERTEXTUREARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(glFramebufferTextureLayerARB, PFNGLFRAMEBUFFERTEXTURELAYERARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY_VOID(glFramebufferTextureFaceARB, PFNGLFRAMEBUFFERTEXTUREFACEARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face))
+GLAD_LAZY_VOID(glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+GLAD_LAZY_VOID(glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+GLAD_LAZY_VOID(glSpecializeShaderARB, PFNGLSPECIALIZESHADERARBPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GLAD_LAZY_VOID(glUniform1i64ARB, PFNGLUNIFORM1I64ARBPROC, (GLint location, GLint64 x), (location, x))
+GLAD_LAZY_VOID(glUniform2i64ARB, PFNGLUNIFORM2I64ARBPROC, (GLint location, GLint64 x, GLint64 y), (location, x, y))
+GLAD_LAZY_VOID(glUniform3i64ARB, PFNGLUNIFORM3I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z), (location, x, y, z))
+GLAD_LAZY_VOID(glUniform4i64ARB, PFNGLUNIFORM4I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (location, x, y, z, w))
+GLAD_LAZY_VOID(glUniform1i64vARB, PFNGLUNIFORM1I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2i64vARB, PFNGLUNIFORM2I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3i64vARB, PFNGLUNIFORM3I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4i64vARB, PFNGLUNIFORM4I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1ui64ARB, PFNGLUNIFORM1UI64ARBPROC, (GLint location, GLuint64 x), (location, x))
+GLAD_LAZY_VOID(glUniform2ui64ARB, PFNGLUNIFORM2UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y), (location, x, y))
+GLAD_LAZY_VOID(glUniform3ui64ARB, PFNGLUNIFORM3UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (location, x, y, z))
+GLAD_LAZY_VOID(glUniform4ui64ARB, PFNGLUNIFORM4UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (location, x, y, z, w))
+GLAD_LAZY_VOID(glUniform1ui64vARB, PFNGLUNIFORM1UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2ui64vARB, PFNGLUNIFORM2UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3ui64vARB, PFNGLUNIFORM3UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4ui64vARB, PFNGLUNIFORM4UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_LAZY_VOID(glGetUniformi64vARB, PFNGLGETUNIFORMI64VARBPROC, (GLuint program, GLint location, GLint64 *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformui64vARB, PFNGLGETUNIFORMUI64VARBPROC, (GLuint program, GLint location, GLuint64 *params), (program, location, params))
+GLAD_LAZY_VOID(glGetnUniformi64vARB, PFNGLGETNUNIFORMI64VARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLint64 *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformui64vARB, PFNGLGETNUNIFORMUI64VARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint64 *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glProgramUniform1i64ARB, PFNGLPROGRAMUNIFORM1I64ARBPROC, (GLuint program, GLint location, GLint64 x), (program, location, x))
+GLAD_LAZY_VOID(glProgramUniform2i64ARB, PFNGLPROGRAMUNIFORM2I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y), (program, location, x, y))
+GLAD_LAZY_VOID(glProgramUniform3i64ARB, PFNGLPROGRAMUNIFORM3I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z), (program, location, x, y, z))
+GLAD_LAZY_VOID(glProgramUniform4i64ARB, PFNGLPROGRAMUNIFORM4I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (program, location, x, y, z, w))
+GLAD_LAZY_VOID(glProgramUniform1i64vARB, PFNGLPROGRAMUNIFORM1I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2i64vARB, PFNGLPROGRAMUNIFORM2I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3i64vARB, PFNGLPROGRAMUNIFORM3I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4i64vARB, PFNGLPROGRAMUNIFORM4I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform1ui64ARB, PFNGLPROGRAMUNIFORM1UI64ARBPROC, (GLuint program, GLint location, GLuint64 x), (program, location, x))
+GLAD_LAZY_VOID(glProgramUniform2ui64ARB, PFNGLPROGRAMUNIFORM2UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y), (program, location, x, y))
+GLAD_LAZY_VOID(glProgramUniform3ui64ARB, PFNGLPROGRAMUNIFORM3UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (program, location, x, y, z))
+GLAD_LAZY_VOID(glProgramUniform4ui64ARB, PFNGLPROGRAMUNIFORM4UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (program, location, x, y, z, w))
+GLAD_LAZY_VOID(glProgramUniform1ui64vARB, PFNGLPROGRAMUNIFORM1UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform2ui64vARB, PFNGLPROGRAMUNIFORM2UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform3ui64vARB, PFNGLPROGRAMUNIFORM3UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glProgramUniform4ui64vARB, PFNGLPROGRAMUNIFORM4UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_LAZY_VOID(glColorTable, PFNGLCOLORTABLEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalformat, width, format, type, table))
+GLAD_LAZY_VOID(glColorTableParameterfv, PFNGLCOLORTABLEPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glColorTableParameteriv, PFNGLCOLORTABLEPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glCopyColorTable, PFNGLCOPYCOLORTABLEPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_LAZY_VOID(glGetColorTable, PFNGLGETCOLORTABLEPROC, (GLenum target, GLenum format, GLenum type, void *table), (target, format, type, table))
+GLAD_LAZY_VOID(glGetColorTableParameterfv, PFNGLGETCOLORTABLEPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetColorTableParameteriv, PFNGLGETCOLORTABLEPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glColorSubTable, PFNGLCOLORSUBTABLEPROC, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data), (target, start, count, format, type, data))
+GLAD_LAZY_VOID(glCopyColorSubTable, PFNGLCOPYCOLORSUBTABLEPROC, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width))
+GLAD_LAZY_VOID(glConvolutionFilter1D, PFNGLCONVOLUTIONFILTER1DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image), (target, internalformat, width, format, type, image))
+GLAD_LAZY_VOID(glConvolutionFilter2D, PFNGLCONVOLUTIONFILTER2DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image), (target, internalformat, width, height, format, type, image))
+GLAD_LAZY_VOID(glConvolutionParameterf, PFNGLCONVOLUTIONPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat params), (target, pname, params))
+GLAD_LAZY_VOID(glConvolutionParameterfv, PFNGLCONVOLUTIONPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glConvolutionParameteri, PFNGLCONVOLUTIONPARAMETERIPROC, (GLenum target, GLenum pname, GLint params), (target, pname, params))
+GLAD_LAZY_VOID(glConvolutionParameteriv, PFNGLCONVOLUTIONPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glCopyConvolutionFilter1D, PFNGLCOPYCONVOLUTIONFILTER1DPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_LAZY_VOID(glCopyConvolutionFilter2D, PFNGLCOPYCONVOLUTIONFILTER2DPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height))
+GLAD_LAZY_VOID(glGetConvolutionFilter, PFNGLGETCONVOLUTIONFILTERPROC, (GLenum target, GLenum format, GLenum type, void *image), (target, format, type, image))
+GLAD_LAZY_VOID(glGetConvolutionParameterfv, PFNGLGETCONVOLUTIONPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetConvolutionParameteriv, PFNGLGETCONVOLUTIONPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetSeparableFilter, PFNGLGETSEPARABLEFILTERPROC, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span), (target, format, type, row, column, span))
+GLAD_LAZY_VOID(glSeparableFilter2D, PFNGLSEPARABLEFILTER2DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column), (target, internalformat, width, height, format, type, row, column))
+GLAD_LAZY_VOID(glGetHistogram, PFNGLGETHISTOGRAMPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_LAZY_VOID(glGetHistogramParameterfv, PFNGLGETHISTOGRAMPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetHistogramParameteriv, PFNGLGETHISTOGRAMPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetMinmax, PFNGLGETMINMAXPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_LAZY_VOID(glGetMinmaxParameterfv, PFNGLGETMINMAXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetMinmaxParameteriv, PFNGLGETMINMAXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glHistogram, PFNGLHISTOGRAMPROC, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink))
+GLAD_LAZY_VOID(glMinmax, PFNGLMINMAXPROC, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink))
+GLAD_LAZY_VOID(glResetHistogram, PFNGLRESETHISTOGRAMPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glResetMinmax, PFNGLRESETMINMAXPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glMultiDrawArraysIndirectCountARB, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GLAD_LAZY_VOID(glMultiDrawElementsIndirectCountARB, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GLAD_LAZY_VOID(glVertexAttribDivisorARB, PFNGLVERTEXATTRIBDIVISORARBPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(glGetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params))
+GLAD_LAZY_VOID(glGetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params))
+GLAD_LAZY_VOID(glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+GLAD_LAZY_VOID(glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC, (GLuint texture, GLint level), (texture, level))
+GLAD_LAZY_VOID(glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_LAZY_VOID(glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GLAD_LAZY_VOID(glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GLAD_LAZY_VOID(glCurrentPaletteMatrixARB, PFNGLCURRENTPALETTEMATRIXARBPROC, (GLint index), (index))
+GLAD_LAZY_VOID(glMatrixIndexubvARB, PFNGLMATRIXINDEXUBVARBPROC, (GLint size, const GLubyte *indices), (size, indices))
+GLAD_LAZY_VOID(glMatrixIndexusvARB, PFNGLMATRIXINDEXUSVARBPROC, (GLint size, const GLushort *indices), (size, indices))
+GLAD_LAZY_VOID(glMatrixIndexuivARB, PFNGLMATRIXINDEXUIVARBPROC, (GLint size, const GLuint *indices), (size, indices))
+GLAD_LAZY_VOID(glMatrixIndexPointerARB, PFNGLMATRIXINDEXPOINTERARBPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+GLAD_LAZY_VOID(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+GLAD_LAZY_VOID(glBindTextures, PFNGLBINDTEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_LAZY_VOID(glBindSamplers, PFNGLBINDSAMPLERSPROC, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+GLAD_LAZY_VOID(glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_LAZY_VOID(glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+GLAD_LAZY_VOID(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+GLAD_LAZY_VOID(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+GLAD_LAZY_VOID(glSampleCoverageARB, PFNGLSAMPLECOVERAGEARBPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(glActiveTextureARB, PFNGLACTIVETEXTUREARBPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glClientActiveTextureARB, PFNGLCLIENTACTIVETEXTUREARBPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glMultiTexCoord1dARB, PFNGLMULTITEXCOORD1DARBPROC, (GLenum target, GLdouble s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1dvARB, PFNGLMULTITEXCOORD1DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1fARB, PFNGLMULTITEXCOORD1FARBPROC, (GLenum target, GLfloat s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1fvARB, PFNGLMULTITEXCOORD1FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1iARB, PFNGLMULTITEXCOORD1IARBPROC, (GLenum target, GLint s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1ivARB, PFNGLMULTITEXCOORD1IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord1sARB, PFNGLMULTITEXCOORD1SARBPROC, (GLenum target, GLshort s), (target, s))
+GLAD_LAZY_VOID(glMultiTexCoord1svARB, PFNGLMULTITEXCOORD1SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2dARB, PFNGLMULTITEXCOORD2DARBPROC, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2dvARB, PFNGLMULTITEXCOORD2DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2fARB, PFNGLMULTITEXCOORD2FARBPROC, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2fvARB, PFNGLMULTITEXCOORD2FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2iARB, PFNGLMULTITEXCOORD2IARBPROC, (GLenum target, GLint s, GLint t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2ivARB, PFNGLMULTITEXCOORD2IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord2sARB, PFNGLMULTITEXCOORD2SARBPROC, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GLAD_LAZY_VOID(glMultiTexCoord2svARB, PFNGLMULTITEXCOORD2SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3dARB, PFNGLMULTITEXCOORD3DARBPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3dvARB, PFNGLMULTITEXCOORD3DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3fARB, PFNGLMULTITEXCOORD3FARBPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3fvARB, PFNGLMULTITEXCOORD3FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3iARB, PFNGLMULTITEXCOORD3IARBPROC, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3ivARB, PFNGLMULTITEXCOORD3IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord3sARB, PFNGLMULTITEXCOORD3SARBPROC, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GLAD_LAZY_VOID(glMultiTexCoord3svARB, PFNGLMULTITEXCOORD3SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4dARB, PFNGLMULTITEXCOORD4DARBPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4dvARB, PFNGLMULTITEXCOORD4DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4fARB, PFNGLMULTITEXCOORD4FARBPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4fvARB, PFNGLMULTITEXCOORD4FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4iARB, PFNGLMULTITEXCOORD4IARBPROC, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4ivARB, PFNGLMULTITEXCOORD4IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_LAZY_VOID(glMultiTexCoord4sARB, PFNGLMULTITEXCOORD4SARBPROC, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GLAD_LAZY_VOID(glMultiTexCoord4svARB, PFNGLMULTITEXCOORD4SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_LAZY_VOID(glGenQueriesARB, PFNGLGENQUERIESARBPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteQueriesARB, PFNGLDELETEQUERIESARBPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY(GLboolean, glIsQueryARB, PFNGLISQUERYARBPROC, (GLuint id), (id))
+GLAD_LAZY_VOID(glBeginQueryARB, PFNGLBEGINQUERYARBPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glEndQueryARB, PFNGLENDQUERYARBPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetQueryivARB, PFNGLGETQUERYIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectivARB, PFNGLGETQUERYOBJECTIVARBPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectuivARB, PFNGLGETQUERYOBJECTUIVARBPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(glMaxShaderCompilerThreadsARB, PFNGLMAXSHADERCOMPILERTHREADSARBPROC, (GLuint count), (count))
+GLAD_LAZY_VOID(glPointParameterfARB, PFNGLPOINTPARAMETERFARBPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPointParameterfvARB, PFNGLPOINTPARAMETERFVARBPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glPolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GLAD_LAZY_VOID(glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params))
+GLAD_LAZY(GLuint, glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY_VOID(glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name))
+GLAD_LAZY_VOID(glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params))
+GLAD_LAZY(GLint, glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY(GLint, glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_LAZY(GLenum, glGetGraphicsResetStatusARB, PFNGLGETGRAPHICSRESETSTATUSARBPROC, (void), ())
+GLAD_LAZY_VOID(glGetnTexImageARB, PFNGLGETNTEXIMAGEARBPROC, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img), (target, level, format, type, bufSize, img))
+GLAD_LAZY_VOID(glReadnPixelsARB, PFNGLREADNPIXELSARBPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_LAZY_VOID(glGetnCompressedTexImageARB, PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC, (GLenum target, GLint lod, GLsizei bufSize, void *img), (target, lod, bufSize, img))
+GLAD_LAZY_VOID(glGetnUniformfvARB, PFNGLGETNUNIFORMFVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformivARB, PFNGLGETNUNIFORMIVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformuivARB, PFNGLGETNUNIFORMUIVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnUniformdvARB, PFNGLGETNUNIFORMDVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GLAD_LAZY_VOID(glGetnMapdvARB, PFNGLGETNMAPDVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnMapfvARB, PFNGLGETNMAPFVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnMapivARB, PFNGLGETNMAPIVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GLAD_LAZY_VOID(glGetnPixelMapfvARB, PFNGLGETNPIXELMAPFVARBPROC, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPixelMapuivARB, PFNGLGETNPIXELMAPUIVARBPROC, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPixelMapusvARB, PFNGLGETNPIXELMAPUSVARBPROC, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GLAD_LAZY_VOID(glGetnPolygonStippleARB, PFNGLGETNPOLYGONSTIPPLEARBPROC, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GLAD_LAZY_VOID(glGetnColorTableARB, PFNGLGETNCOLORTABLEARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GLAD_LAZY_VOID(glGetnConvolutionFilterARB, PFNGLGETNCONVOLUTIONFILTERARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GLAD_LAZY_VOID(glGetnSeparableFilterARB, PFNGLGETNSEPARABLEFILTERARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GLAD_LAZY_VOID(glGetnHistogramARB, PFNGLGETNHISTOGRAMARBPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_LAZY_VOID(glGetnMinmaxARB, PFNGLGETNMINMAXARBPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_LAZY_VOID(glFramebufferSampleLocationsfvARB, PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v))
+GLAD_LAZY_VOID(glNamedFramebufferSampleLocationsfvARB, PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v))
+GLAD_LAZY_VOID(glEvaluateDepthValuesARB, PFNGLEVALUATEDEPTHVALUESARBPROC, (void), ())
+GLAD_LAZY_VOID(glMinSampleShadingARB, PFNGLMINSAMPLESHADINGARBPROC, (GLfloat value), (value))
+GLAD_LAZY_VOID(glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params))
+GLAD_LAZY_VOID(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+GLAD_LAZY_VOID(glMemoryBarrier, PFNGLMEMORYBARRIERPROC, (GLbitfield barriers), (barriers))
+GLAD_LAZY_VOID(glDeleteObjectARB, PFNGLDELETEOBJECTARBPROC, (GLhandleARB obj), (obj))
+GLAD_LAZY(GLhandleARB, glGetHandleARB, PFNGLGETHANDLEARBPROC, (GLenum pname), (pname))
+GLAD_LAZY_VOID(glDetachObjectARB, PFNGLDETACHOBJECTARBPROC, (GLhandleARB containerObj, GLhandleARB attachedObj), (containerObj, attachedObj))
+GLAD_LAZY(GLhandleARB, glCreateShaderObjectARB, PFNGLCREATESHADEROBJECTARBPROC, (GLenum shaderType), (shaderType))
+GLAD_LAZY_VOID(glShaderSourceARB, PFNGLSHADERSOURCEARBPROC, (GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length), (shaderObj, count, string, length))
+GLAD_LAZY_VOID(glCompileShaderARB, PFNGLCOMPILESHADERARBPROC, (GLhandleARB shaderObj), (shaderObj))
+GLAD_LAZY(GLhandleARB, glCreateProgramObjectARB, PFNGLCREATEPROGRAMOBJECTARBPROC, (void), ())
+GLAD_LAZY_VOID(glAttachObjectARB, PFNGLATTACHOBJECTARBPROC, (GLhandleARB containerObj, GLhandleARB obj), (containerObj, obj))
+GLAD_LAZY_VOID(glLinkProgramARB, PFNGLLINKPROGRAMARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_LAZY_VOID(glUseProgramObjectARB, PFNGLUSEPROGRAMOBJECTARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_LAZY_VOID(glValidateProgramARB, PFNGLVALIDATEPROGRAMARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_LAZY_VOID(glUniform1fARB, PFNGLUNIFORM1FARBPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2fARB, PFNGLUNIFORM2FARBPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3fARB, PFNGLUNIFORM3FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4fARB, PFNGLUNIFORM4FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1iARB, PFNGLUNIFORM1IARBPROC, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2iARB, PFNGLUNIFORM2IARBPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3iARB, PFNGLUNIFORM3IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4iARB, PFNGLUNIFORM4IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1fvARB, PFNGLUNIFORM1FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2fvARB, PFNGLUNIFORM2FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3fvARB, PFNGLUNIFORM3FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4fvARB, PFNGLUNIFORM4FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1ivARB, PFNGLUNIFORM1IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2ivARB, PFNGLUNIFORM2IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3ivARB, PFNGLUNIFORM3IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4ivARB, PFNGLUNIFORM4IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformMatrix2fvARB, PFNGLUNIFORMMATRIX2FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3fvARB, PFNGLUNIFORMMATRIX3FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4fvARB, PFNGLUNIFORMMATRIX4FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glGetObjectParameterfvARB, PFNGLGETOBJECTPARAMETERFVARBPROC, (GLhandleARB obj, GLenum pname, GLfloat *params), (obj, pname, params))
+GLAD_LAZY_VOID(glGetObjectParameterivARB, PFNGLGETOBJECTPARAMETERIVARBPROC, (GLhandleARB obj, GLenum pname, GLint *params), (obj, pname, params))
+GLAD_LAZY_VOID(glGetInfoLogARB, PFNGLGETINFOLOGARBPROC, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog), (obj, maxLength, length, infoLog))
+GLAD_LAZY_VOID(glGetAttachedObjectsARB, PFNGLGETATTACHEDOBJECTSARBPROC, (GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj), (containerObj, maxCount, count, obj))
+GLAD_LAZY(GLint, glGetUniformLocationARB, PFNGLGETUNIFORMLOCATIONARBPROC, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GLAD_LAZY_VOID(glGetActiveUniformARB, PFNGLGETACTIVEUNIFORMARBPROC, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GLAD_LAZY_VOID(glGetUniformfvARB, PFNGLGETUNIFORMFVARBPROC, (GLhandleARB programObj, GLint location, GLfloat *params), (programObj, location, params))
+GLAD_LAZY_VOID(glGetUniformivARB, PFNGLGETUNIFORMIVARBPROC, (GLhandleARB programObj, GLint location, GLint *params), (programObj, location, params))
+GLAD_LAZY_VOID(glGetShaderSourceARB, PFNGLGETSHADERSOURCEARBPROC, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source), (obj, maxLength, length, source))
+GLAD_LAZY_VOID(glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+GLAD_LAZY_VOID(glNamedStringARB, PFNGLNAMEDSTRINGARBPROC, (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string), (type, namelen, name, stringlen, string))
+GLAD_LAZY_VOID(glDeleteNamedStringARB, PFNGLDELETENAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name), (namelen, name))
+GLAD_LAZY_VOID(glCompileShaderIncludeARB, PFNGLCOMPILESHADERINCLUDEARBPROC, (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length), (shader, count, path, length))
+GLAD_LAZY(GLboolean, glIsNamedStringARB, PFNGLISNAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name), (namelen, name))
+GLAD_LAZY_VOID(glGetNamedStringARB, PFNGLGETNAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string), (namelen, name, bufSize, stringlen, string))
+GLAD_LAZY_VOID(glGetNamedStringivARB, PFNGLGETNAMEDSTRINGIVARBPROC, (GLint namelen, const GLchar *name, GLenum pname, GLint *params), (namelen, name, pname, params))
+GLAD_LAZY_VOID(glBufferPageCommitmentARB, PFNGLBUFFERPAGECOMMITMENTARBPROC, (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit), (target, offset, size, commit))
+GLAD_LAZY_VOID(glNamedBufferPageCommitmentEXT, PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GLAD_LAZY_VOID(glNamedBufferPageCommitmentARB, PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GLAD_LAZY_VOID(glTexPageCommitmentARB, PFNGLTEXPAGECOMMITMENTARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (target, level, xoffset, yoffset, zoffset, width, height, depth, commit))
+GLAD_LAZY_VOID(glTextureBarrier, PFNGLTEXTUREBARRIERPROC, (void), ())
+GLAD_LAZY_VOID(glTexBufferARB, PFNGLTEXBUFFERARBPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(glTexBufferRange, PFNGLTEXBUFFERRANGEPROC, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+GLAD_LAZY_VOID(glCompressedTexImage3DARB, PFNGLCOMPRESSEDTEXIMAGE3DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage2DARB, PFNGLCOMPRESSEDTEXIMAGE2DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage1DARB, PFNGLCOMPRESSEDTEXIMAGE1DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage3DARB, PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage2DARB, PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage1DARB, PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glGetCompressedTexImageARB, PFNGLGETCOMPRESSEDTEXIMAGEARBPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(glTexStorage1D, PFNGLTEXSTORAGE1DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GLAD_LAZY_VOID(glTexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GLAD_LAZY_VOID(glTexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GLAD_LAZY_VOID(glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glTextureView, PFNGLTEXTUREVIEWPROC, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+GLAD_LAZY_VOID(glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+GLAD_LAZY_VOID(glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+GLAD_LAZY_VOID(glLoadTransposeMatrixfARB, PFNGLLOADTRANSPOSEMATRIXFARBPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glLoadTransposeMatrixdARB, PFNGLLOADTRANSPOSEMATRIXDARBPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixfARB, PFNGLMULTTRANSPOSEMATRIXFARBPROC, (const GLfloat *m), (m))
+GLAD_LAZY_VOID(glMultTransposeMatrixdARB, PFNGLMULTTRANSPOSEMATRIXDARBPROC, (const GLdouble *m), (m))
+GLAD_LAZY_VOID(glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+GLAD_LAZY_VOID(glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_LAZY_VOID(glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+GLAD_LAZY_VOID(glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+GLAD_LAZY_VOID(glWeightbvARB, PFNGLWEIGHTBVARBPROC, (GLint size, const GLbyte *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightsvARB, PFNGLWEIGHTSVARBPROC, (GLint size, const GLshort *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightivARB, PFNGLWEIGHTIVARBPROC, (GLint size, const GLint *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightfvARB, PFNGLWEIGHTFVARBPROC, (GLint size, const GLfloat *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightdvARB, PFNGLWEIGHTDVARBPROC, (GLint size, const GLdouble *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightubvARB, PFNGLWEIGHTUBVARBPROC, (GLint size, const GLubyte *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightusvARB, PFNGLWEIGHTUSVARBPROC, (GLint size, const GLushort *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightuivARB, PFNGLWEIGHTUIVARBPROC, (GLint size, const GLuint *weights), (size, weights))
+GLAD_LAZY_VOID(glWeightPointerARB, PFNGLWEIGHTPOINTERARBPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_LAZY_VOID(glVertexBlendARB, PFNGLVERTEXBLENDARBPROC, (GLint count), (count))
+GLAD_LAZY_VOID(glBindBufferARB, PFNGLBINDBUFFERARBPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(glDeleteBuffersARB, PFNGLDELETEBUFFERSARBPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glGenBuffersARB, PFNGLGENBUFFERSARBPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY(GLboolean, glIsBufferARB, PFNGLISBUFFERARBPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glBufferDataARB, PFNGLBUFFERDATAARBPROC, (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(glBufferSubDataARB, PFNGLBUFFERSUBDATAARBPROC, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glGetBufferSubDataARB, PFNGLGETBUFFERSUBDATAARBPROC, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data), (target, offset, size, data))
+GLAD_LAZY(void *, glMapBufferARB, PFNGLMAPBUFFERARBPROC, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY(GLboolean, glUnmapBufferARB, PFNGLUNMAPBUFFERARBPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetBufferParameterivARB, PFNGLGETBUFFERPARAMETERIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferPointervARB, PFNGLGETBUFFERPOINTERVARBPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(glVertexAttrib1dARB, PFNGLVERTEXATTRIB1DARBPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1dvARB, PFNGLVERTEXATTRIB1DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1fARB, PFNGLVERTEXATTRIB1FARBPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1fvARB, PFNGLVERTEXATTRIB1FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1sARB, PFNGLVERTEXATTRIB1SARBPROC, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1svARB, PFNGLVERTEXATTRIB1SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2dARB, PFNGLVERTEXATTRIB2DARBPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2dvARB, PFNGLVERTEXATTRIB2DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2fARB, PFNGLVERTEXATTRIB2FARBPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2fvARB, PFNGLVERTEXATTRIB2FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2sARB, PFNGLVERTEXATTRIB2SARBPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2svARB, PFNGLVERTEXATTRIB2SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3dARB, PFNGLVERTEXATTRIB3DARBPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3dvARB, PFNGLVERTEXATTRIB3DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3fARB, PFNGLVERTEXATTRIB3FARBPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3fvARB, PFNGLVERTEXATTRIB3FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3sARB, PFNGLVERTEXATTRIB3SARBPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3svARB, PFNGLVERTEXATTRIB3SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NbvARB, PFNGLVERTEXATTRIB4NBVARBPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NivARB, PFNGLVERTEXATTRIB4NIVARBPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NsvARB, PFNGLVERTEXATTRIB4NSVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NubARB, PFNGLVERTEXATTRIB4NUBARBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4NubvARB, PFNGLVERTEXATTRIB4NUBVARBPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NuivARB, PFNGLVERTEXATTRIB4NUIVARBPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4NusvARB, PFNGLVERTEXATTRIB4NUSVARBPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4bvARB, PFNGLVERTEXATTRIB4BVARBPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4dARB, PFNGLVERTEXATTRIB4DARBPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4dvARB, PFNGLVERTEXATTRIB4DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4fARB, PFNGLVERTEXATTRIB4FARBPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4fvARB, PFNGLVERTEXATTRIB4FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ivARB, PFNGLVERTEXATTRIB4IVARBPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4sARB, PFNGLVERTEXATTRIB4SARBPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4svARB, PFNGLVERTEXATTRIB4SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ubvARB, PFNGLVERTEXATTRIB4UBVARBPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4uivARB, PFNGLVERTEXATTRIB4UIVARBPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4usvARB, PFNGLVERTEXATTRIB4USVARBPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribPointerARB, PFNGLVERTEXATTRIBPOINTERARBPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(glEnableVertexAttribArrayARB, PFNGLENABLEVERTEXATTRIBARRAYARBPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glDisableVertexAttribArrayARB, PFNGLDISABLEVERTEXATTRIBARRAYARBPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glGetVertexAttribdvARB, PFNGLGETVERTEXATTRIBDVARBPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribfvARB, PFNGLGETVERTEXATTRIBFVARBPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribivARB, PFNGLGETVERTEXATTRIBIVARBPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribPointervARB, PFNGLGETVERTEXATTRIBPOINTERVARBPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY_VOID(glBindAttribLocationARB, PFNGLBINDATTRIBLOCATIONARBPROC, (GLhandleARB programObj, GLuint index, const GLcharARB *name), (programObj, index, name))
+GLAD_LAZY_VOID(glGetActiveAttribARB, PFNGLGETACTIVEATTRIBARBPROC, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GLAD_LAZY(GLint, glGetAttribLocationARB, PFNGLGETATTRIBLOCATIONARBPROC, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GLAD_LAZY_VOID(glDepthRangeArraydvNV, PFNGLDEPTHRANGEARRAYDVNVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_LAZY_VOID(glDepthRangeIndexeddNV, PFNGLDEPTHRANGEINDEXEDDNVPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_LAZY_VOID(glWindowPos2dARB, PFNGLWINDOWPOS2DARBPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2dvARB, PFNGLWINDOWPOS2DVARBPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos2fARB, PFNGLWINDOWPOS2FARBPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2fvARB, PFNGLWINDOWPOS2FVARBPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos2iARB, PFNGLWINDOWPOS2IARBPROC, (GLint x, GLint y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2ivARB, PFNGLWINDOWPOS2IVARBPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos2sARB, PFNGLWINDOWPOS2SARBPROC, (GLshort x, GLshort y), (x, y))
+GLAD_LAZY_VOID(glWindowPos2svARB, PFNGLWINDOWPOS2SVARBPROC, (const GLshort *v), (v))
+GLAD_LAZY_VOID(glWindowPos3dARB, PFNGLWINDOWPOS3DARBPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3dvARB, PFNGLWINDOWPOS3DVARBPROC, (const GLdouble *v), (v))
+GLAD_LAZY_VOID(glWindowPos3fARB, PFNGLWINDOWPOS3FARBPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3fvARB, PFNGLWINDOWPOS3FVARBPROC, (const GLfloat *v), (v))
+GLAD_LAZY_VOID(glWindowPos3iARB, PFNGLWINDOWPOS3IARBPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3ivARB, PFNGLWINDOWPOS3IVARBPROC, (const GLint *v), (v))
+GLAD_LAZY_VOID(glWindowPos3sARB, PFNGLWINDOWPOS3SARBPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_LAZY_VOID(glWindowPos3svARB, PFNGLWINDOWPOS3SVARBPROC, (const GLshort *v), (v))
+
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetString = glad_lazy_glGetString;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+	glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = glad_lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+	glad_glUniform1d = glad_lazy_glUniform1d;
+	glad_glUniform2d = glad_lazy_glUniform2d;
+	glad_glUniform3d = glad_lazy_glUniform3d;
+	glad_glUniform4d = glad_lazy_glUniform4d;
+	glad_glUniform1dv = glad_lazy_glUniform1dv;
+	glad_glUniform2dv = glad_lazy_glUniform2dv;
+	glad_glUniform3dv = glad_lazy_glUniform3dv;
+	glad_glUniform4dv = glad_lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+	glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = glad_lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = glad_lazy_glDepthRangef;
+	glad_glClearDepthf = glad_lazy_glClearDepthf;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+	glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+	glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+	glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+	glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+}
+static void lazy_GL_ARB_ES2_compatibility(void) {
+	if(!GLAD_GL_ARB_ES2_compatibility) return;
+	glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = glad_lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = glad_lazy_glDepthRangef;
+	glad_glClearDepthf = glad_lazy_glClearDepthf;
+}
+static void lazy_GL_ARB_ES3_1_compatibility(void) {
+	if(!GLAD_GL_ARB_ES3_1_compatibility) return;
+	glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+}
+static void lazy_GL_ARB_ES3_2_compatibility(void) {
+	if(!GLAD_GL_ARB_ES3_2_compatibility) return;
+	glad_glPrimitiveBoundingBoxARB = glad_lazy_glPrimitiveBoundingBoxARB;
+}
+static void lazy_GL_ARB_base_instance(void) {
+	if(!GLAD_GL_ARB_base_instance) return;
+	glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+}
+static void lazy_GL_ARB_bindless_texture(void) {
+	if(!GLAD_GL_ARB_bindless_texture) return;
+	glad_glGetTextureHandleARB = glad_lazy_glGetTextureHandleARB;
+	glad_glGetTextureSamplerHandleARB = glad_lazy_glGetTextureSamplerHandleARB;
+	glad_glMakeTextureHandleResidentARB = glad_lazy_glMakeTextureHandleResidentARB;
+	glad_glMakeTextureHandleNonResidentARB = glad_lazy_glMakeTextureHandleNonResidentARB;
+	glad_glGetImageHandleARB = glad_lazy_glGetImageHandleARB;
+	glad_glMakeImageHandleResidentARB = glad_lazy_glMakeImageHandleResidentARB;
+	glad_glMakeImageHandleNonResidentARB = glad_lazy_glMakeImageHandleNonResidentARB;
+	glad_glUniformHandleui64ARB = glad_lazy_glUniformHandleui64ARB;
+	glad_glUniformHandleui64vARB = glad_lazy_glUniformHandleui64vARB;
+	glad_glProgramUniformHandleui64ARB = glad_lazy_glProgramUniformHandleui64ARB;
+	glad_glProgramUniformHandleui64vARB = glad_lazy_glProgramUniformHandleui64vARB;
+	glad_glIsTextureHandleResidentARB = glad_lazy_glIsTextureHandleResidentARB;
+	glad_glIsImageHandleResidentARB = glad_lazy_glIsImageHandleResidentARB;
+	glad_glVertexAttribL1ui64ARB = glad_lazy_glVertexAttribL1ui64ARB;
+	glad_glVertexAttribL1ui64vARB = glad_lazy_glVertexAttribL1ui64vARB;
+	glad_glGetVertexAttribLui64vARB = glad_lazy_glGetVertexAttribLui64vARB;
+}
+static void lazy_GL_ARB_blend_func_extended(void) {
+	if(!GLAD_GL_ARB_blend_func_extended) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+static void lazy_GL_ARB_cl_event(void) {
+	if(!GLAD_GL_ARB_cl_event) return;
+	glad_glCreateSyncFromCLeventARB = glad_lazy_glCreateSyncFromCLeventARB;
+}
+static void lazy_GL_ARB_clear_buffer_object(void) {
+	if(!GLAD_GL_ARB_clear_buffer_object) return;
+	glad_glClearBufferData = glad_lazy_glClearBufferData;
+	glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+}
+static void lazy_GL_ARB_clear_texture(void) {
+	if(!GLAD_GL_ARB_clear_texture) return;
+	glad_glClearTexImage = glad_lazy_glClearTexImage;
+	glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+}
+static void lazy_GL_ARB_clip_control(void) {
+	if(!GLAD_GL_ARB_clip_control) return;
+	glad_glClipControl = glad_lazy_glClipControl;
+}
+static void lazy_GL_ARB_color_buffer_float(void) {
+	if(!GLAD_GL_ARB_color_buffer_float) return;
+	glad_glClampColorARB = glad_lazy_glClampColorARB;
+}
+static void lazy_GL_ARB_compute_shader(void) {
+	if(!GLAD_GL_ARB_compute_shader) return;
+	glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+}
+static void lazy_GL_ARB_compute_variable_group_size(void) {
+	if(!GLAD_GL_ARB_compute_variable_group_size) return;
+	glad_glDispatchComputeGroupSizeARB = glad_lazy_glDispatchComputeGroupSizeARB;
+}
+static void lazy_GL_ARB_copy_buffer(void) {
+	if(!GLAD_GL_ARB_copy_buffer) return;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+}
+static void lazy_GL_ARB_copy_image(void) {
+	if(!GLAD_GL_ARB_copy_image) return;
+	glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+}
+static void lazy_GL_ARB_debug_output(void) {
+	if(!GLAD_GL_ARB_debug_output) return;
+	glad_glDebugMessageControlARB = glad_lazy_glDebugMessageControlARB;
+	glad_glDebugMessageInsertARB = glad_lazy_glDebugMessageInsertARB;
+	glad_glDebugMessageCallbackARB = glad_lazy_glDebugMessageCallbackARB;
+	glad_glGetDebugMessageLogARB = glad_lazy_glGetDebugMessageLogARB;
+}
+static void lazy_GL_ARB_direct_state_access(void) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = glad_lazy_glCreateTextures;
+	glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+	glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+	glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+	glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+	glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = glad_lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+}
+static void lazy_GL_ARB_draw_buffers(void) {
+	if(!GLAD_GL_ARB_draw_buffers) return;
+	glad_glDrawBuffersARB = glad_lazy_glDrawBuffersARB;
+}
+static void lazy_GL_ARB_draw_buffers_blend(void) {
+	if(!GLAD_GL_ARB_draw_buffers_blend) return;
+	glad_glBlendEquationiARB = glad_lazy_glBlendEquationiARB;
+	glad_glBlendEquationSeparateiARB = glad_lazy_glBlendEquationSeparateiARB;
+	glad_glBlendFunciARB = glad_lazy_glBlendFunciARB;
+	glad_glBlendFuncSeparateiARB = glad_lazy_glBlendFuncSeparateiARB;
+}
+static void lazy_GL_ARB_draw_elements_base_vertex(void) {
+	if(!GLAD_GL_ARB_draw_elements_base_vertex) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+}
+static void lazy_GL_ARB_draw_indirect(void) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+}
+static void lazy_GL_ARB_draw_instanced(void) {
+	if(!GLAD_GL_ARB_draw_instanced) return;
+	glad_glDrawArraysInstancedARB = glad_lazy_glDrawArraysInstancedARB;
+	glad_glDrawElementsInstancedARB = glad_lazy_glDrawElementsInstancedARB;
+}
+static void lazy_GL_ARB_fragment_program(void) {
+	if(!GLAD_GL_ARB_fragment_program) return;
+	glad_glProgramStringARB = glad_lazy_glProgramStringARB;
+	glad_glBindProgramARB = glad_lazy_glBindProgramARB;
+	glad_glDeleteProgramsARB = glad_lazy_glDeleteProgramsARB;
+	glad_glGenProgramsARB = glad_lazy_glGenProgramsARB;
+	glad_glProgramEnvParameter4dARB = glad_lazy_glProgramEnvParameter4dARB;
+	glad_glProgramEnvParameter4dvARB = glad_lazy_glProgramEnvParameter4dvARB;
+	glad_glProgramEnvParameter4fARB = glad_lazy_glProgramEnvParameter4fARB;
+	glad_glProgramEnvParameter4fvARB = glad_lazy_glProgramEnvParameter4fvARB;
+	glad_glProgramLocalParameter4dARB = glad_lazy_glProgramLocalParameter4dARB;
+	glad_glProgramLocalParameter4dvARB = glad_lazy_glProgramLocalParameter4dvARB;
+	glad_glProgramLocalParameter4fARB = glad_lazy_glProgramLocalParameter4fARB;
+	glad_glProgramLocalParameter4fvARB = glad_lazy_glProgramLocalParameter4fvARB;
+	glad_glGetProgramEnvParameterdvARB = glad_lazy_glGetProgramEnvParameterdvARB;
+	glad_glGetProgramEnvParameterfvARB = glad_lazy_glGetProgramEnvParameterfvARB;
+	glad_glGetProgramLocalParameterdvARB = glad_lazy_glGetProgramLocalParameterdvARB;
+	glad_glGetProgramLocalParameterfvARB = glad_lazy_glGetProgramLocalParameterfvARB;
+	glad_glGetProgramivARB = glad_lazy_glGetProgramivARB;
+	glad_glGetProgramStringARB = glad_lazy_glGetProgramStringARB;
+	glad_glIsProgramARB = glad_lazy_glIsProgramARB;
+}
+static void lazy_GL_ARB_framebuffer_no_attachments(void) {
+	if(!GLAD_GL_ARB_framebuffer_no_attachments) return;
+	glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+}
+static void lazy_GL_ARB_framebuffer_object(void) {
+	if(!GLAD_GL_ARB_framebuffer_object) return;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+}
+static void lazy_GL_ARB_geometry_shader4(void) {
+	if(!GLAD_GL_ARB_geometry_shader4) return;
+	glad_glProgramParameteriARB = glad_lazy_glProgramParameteriARB;
+	glad_glFramebufferTextureARB = glad_lazy_glFramebufferTextureARB;
+	glad_glFramebufferTextureLayerARB = glad_lazy_glFramebufferTextureLayerARB;
+	glad_glFramebufferTextureFaceARB = glad_lazy_glFramebufferTextureFaceARB;
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_ARB_get_texture_sub_image(void) {
+	if(!GLAD_GL_ARB_get_texture_sub_image) return;
+	glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+}
+static void lazy_GL_ARB_gl_spirv(void) {
+	if(!GLAD_GL_ARB_gl_spirv) return;
+	glad_glSpecializeShaderARB = glad_lazy_glSpecializeShaderARB;
+}
+static void lazy_GL_ARB_gpu_shader_fp64(void) {
+	if(!GLAD_GL_ARB_gpu_shader_fp64) return;
+	glad_glUniform1d = glad_lazy_glUniform1d;
+	glad_glUniform2d = glad_lazy_glUniform2d;
+	glad_glUniform3d = glad_lazy_glUniform3d;
+	glad_glUniform4d = glad_lazy_glUniform4d;
+	glad_glUniform1dv = glad_lazy_glUniform1dv;
+	glad_glUniform2dv = glad_lazy_glUniform2dv;
+	glad_glUniform3dv = glad_lazy_glUniform3dv;
+	glad_glUniform4dv = glad_lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+}
+static void lazy_GL_ARB_gpu_shader_int64(void) {
+	if(!GLAD_GL_ARB_gpu_shader_int64) return;
+	glad_glUniform1i64ARB = glad_lazy_glUniform1i64ARB;
+	glad_glUniform2i64ARB = glad_lazy_glUniform2i64ARB;
+	glad_glUniform3i64ARB = glad_lazy_glUniform3i64ARB;
+	glad_glUniform4i64ARB = glad_lazy_glUniform4i64ARB;
+	glad_glUniform1i64vARB = glad_lazy_glUniform1i64vARB;
+	glad_glUniform2i64vARB = glad_lazy_glUniform2i64vARB;
+	glad_glUniform3i64vARB = glad_lazy_glUniform3i64vARB;
+	glad_glUniform4i64vARB = glad_lazy_glUniform4i64vARB;
+	glad_glUniform1ui64ARB = glad_lazy_glUniform1ui64ARB;
+	glad_glUniform2ui64ARB = glad_lazy_glUniform2ui64ARB;
+	glad_glUniform3ui64ARB = glad_lazy_glUniform3ui64ARB;
+	glad_glUniform4ui64ARB = glad_lazy_glUniform4ui64ARB;
+	glad_glUniform1ui64vARB = glad_lazy_glUniform1ui64vARB;
+	glad_glUniform2ui64vARB = glad_lazy_glUniform2ui64vARB;
+	glad_glUniform3ui64vARB = glad_lazy_glUniform3ui64vARB;
+	glad_glUniform4ui64vARB = glad_lazy_glUniform4ui64vARB;
+	glad_glGetUniformi64vARB = glad_lazy_glGetUniformi64vARB;
+	glad_glGetUniformui64vARB = glad_lazy_glGetUniformui64vARB;
+	glad_glGetnUniformi64vARB = glad_lazy_glGetnUniformi64vARB;
+	glad_glGetnUniformui64vARB = glad_lazy_glGetnUniformui64vARB;
+	glad_glProgramUniform1i64ARB = glad_lazy_glProgramUniform1i64ARB;
+	glad_glProgramUniform2i64ARB = glad_lazy_glProgramUniform2i64ARB;
+	glad_glProgramUniform3i64ARB = glad_lazy_glProgramUniform3i64ARB;
+	glad_glProgramUniform4i64ARB = glad_lazy_glProgramUniform4i64ARB;
+	glad_glProgramUniform1i64vARB = glad_lazy_glProgramUniform1i64vARB;
+	glad_glProgramUniform2i64vARB = glad_lazy_glProgramUniform2i64vARB;
+	glad_glProgramUniform3i64vARB = glad_lazy_glProgramUniform3i64vARB;
+	glad_glProgramUniform4i64vARB = glad_lazy_glProgramUniform4i64vARB;
+	glad_glProgramUniform1ui64ARB = glad_lazy_glProgramUniform1ui64ARB;
+	glad_glProgramUniform2ui64ARB = glad_lazy_glProgramUniform2ui64ARB;
+	glad_glProgramUniform3ui64ARB = glad_lazy_glProgramUniform3ui64ARB;
+	glad_glProgramUniform4ui64ARB = glad_lazy_glProgramUniform4ui64ARB;
+	glad_glProgramUniform1ui64vARB = glad_lazy_glProgramUniform1ui64vARB;
+	glad_glProgramUniform2ui64vARB = glad_lazy_glProgramUniform2ui64vARB;
+	glad_glProgramUniform3ui64vARB = glad_lazy_glProgramUniform3ui64vARB;
+	glad_glProgramUniform4ui64vARB = glad_lazy_glProgramUniform4ui64vARB;
+}
+static void lazy_GL_ARB_imaging(void) {
+	if(!GLAD_GL_ARB_imaging) return;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+	glad_glColorTable = glad_lazy_glColorTable;
+	glad_glColorTableParameterfv = glad_lazy_glColorTableParameterfv;
+	glad_glColorTableParameteriv = glad_lazy_glColorTableParameteriv;
+	glad_glCopyColorTable = glad_lazy_glCopyColorTable;
+	glad_glGetColorTable = glad_lazy_glGetColorTable;
+	glad_glGetColorTableParameterfv = glad_lazy_glGetColorTableParameterfv;
+	glad_glGetColorTableParameteriv = glad_lazy_glGetColorTableParameteriv;
+	glad_glColorSubTable = glad_lazy_glColorSubTable;
+	glad_glCopyColorSubTable = glad_lazy_glCopyColorSubTable;
+	glad_glConvolutionFilter1D = glad_lazy_glConvolutionFilter1D;
+	glad_glConvolutionFilter2D = glad_lazy_glConvolutionFilter2D;
+	glad_glConvolutionParameterf = glad_lazy_glConvolutionParameterf;
+	glad_glConvolutionParameterfv = glad_lazy_glConvolutionParameterfv;
+	glad_glConvolutionParameteri = glad_lazy_glConvolutionParameteri;
+	glad_glConvolutionParameteriv = glad_lazy_glConvolutionParameteriv;
+	glad_glCopyConvolutionFilter1D = glad_lazy_glCopyConvolutionFilter1D;
+	glad_glCopyConvolutionFilter2D = glad_lazy_glCopyConvolutionFilter2D;
+	glad_glGetConvolutionFilter = glad_lazy_glGetConvolutionFilter;
+	glad_glGetConvolutionParameterfv = glad_lazy_glGetConvolutionParameterfv;
+	glad_glGetConvolutionParameteriv = glad_lazy_glGetConvolutionParameteriv;
+	glad_glGetSeparableFilter = glad_lazy_glGetSeparableFilter;
+	glad_glSeparableFilter2D = glad_lazy_glSeparableFilter2D;
+	glad_glGetHistogram = glad_lazy_glGetHistogram;
+	glad_glGetHistogramParameterfv = glad_lazy_glGetHistogramParameterfv;
+	glad_glGetHistogramParameteriv = glad_lazy_glGetHistogramParameteriv;
+	glad_glGetMinmax = glad_lazy_glGetMinmax;
+	glad_glGetMinmaxParameterfv = glad_lazy_glGetMinmaxParameterfv;
+	glad_glGetMinmaxParameteriv = glad_lazy_glGetMinmaxParameteriv;
+	glad_glHistogram = glad_lazy_glHistogram;
+	glad_glMinmax = glad_lazy_glMinmax;
+	glad_glResetHistogram = glad_lazy_glResetHistogram;
+	glad_glResetMinmax = glad_lazy_glResetMinmax;
+}
+static void lazy_GL_ARB_indirect_parameters(void) {
+	if(!GLAD_GL_ARB_indirect_parameters) return;
+	glad_glMultiDrawArraysIndirectCountARB = glad_lazy_glMultiDrawArraysIndirectCountARB;
+	glad_glMultiDrawElementsIndirectCountARB = glad_lazy_glMultiDrawElementsIndirectCountARB;
+}
+static void lazy_GL_ARB_instanced_arrays(void) {
+	if(!GLAD_GL_ARB_instanced_arrays) return;
+	glad_glVertexAttribDivisorARB = glad_lazy_glVertexAttribDivisorARB;
+}
+static void lazy_GL_ARB_internalformat_query(void) {
+	if(!GLAD_GL_ARB_internalformat_query) return;
+	glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+}
+static void lazy_GL_ARB_internalformat_query2(void) {
+	if(!GLAD_GL_ARB_internalformat_query2) return;
+	glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+}
+static void lazy_GL_ARB_invalidate_subdata(void) {
+	if(!GLAD_GL_ARB_invalidate_subdata) return;
+	glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+}
+static void lazy_GL_ARB_map_buffer_range(void) {
+	if(!GLAD_GL_ARB_map_buffer_range) return;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+}
+static void lazy_GL_ARB_matrix_palette(void) {
+	if(!GLAD_GL_ARB_matrix_palette) return;
+	glad_glCurrentPaletteMatrixARB = glad_lazy_glCurrentPaletteMatrixARB;
+	glad_glMatrixIndexubvARB = glad_lazy_glMatrixIndexubvARB;
+	glad_glMatrixIndexusvARB = glad_lazy_glMatrixIndexusvARB;
+	glad_glMatrixIndexuivARB = glad_lazy_glMatrixIndexuivARB;
+	glad_glMatrixIndexPointerARB = glad_lazy_glMatrixIndexPointerARB;
+}
+static void lazy_GL_ARB_multi_bind(void) {
+	if(!GLAD_GL_ARB_multi_bind) return;
+	glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+	glad_glBindTextures = glad_lazy_glBindTextures;
+	glad_glBindSamplers = glad_lazy_glBindSamplers;
+	glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+}
+static void lazy_GL_ARB_multi_draw_indirect(void) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+}
+static void lazy_GL_ARB_multisample(void) {
+	if(!GLAD_GL_ARB_multisample) return;
+	glad_glSampleCoverageARB = glad_lazy_glSampleCoverageARB;
+}
+static void lazy_GL_ARB_multitexture(void) {
+	if(!GLAD_GL_ARB_multitexture) return;
+	glad_glActiveTextureARB = glad_lazy_glActiveTextureARB;
+	glad_glClientActiveTextureARB = glad_lazy_glClientActiveTextureARB;
+	glad_glMultiTexCoord1dARB = glad_lazy_glMultiTexCoord1dARB;
+	glad_glMultiTexCoord1dvARB = glad_lazy_glMultiTexCoord1dvARB;
+	glad_glMultiTexCoord1fARB = glad_lazy_glMultiTexCoord1fARB;
+	glad_glMultiTexCoord1fvARB = glad_lazy_glMultiTexCoord1fvARB;
+	glad_glMultiTexCoord1iARB = glad_lazy_glMultiTexCoord1iARB;
+	glad_glMultiTexCoord1ivARB = glad_lazy_glMultiTexCoord1ivARB;
+	glad_glMultiTexCoord1sARB = glad_lazy_glMultiTexCoord1sARB;
+	glad_glMultiTexCoord1svARB = glad_lazy_glMultiTexCoord1svARB;
+	glad_glMultiTexCoord2dARB = glad_lazy_glMultiTexCoord2dARB;
+	glad_glMultiTexCoord2dvARB = glad_lazy_glMultiTexCoord2dvARB;
+	glad_glMultiTexCoord2fARB = glad_lazy_glMultiTexCoord2fARB;
+	glad_glMultiTexCoord2fvARB = glad_lazy_glMultiTexCoord2fvARB;
+	glad_glMultiTexCoord2iARB = glad_lazy_glMultiTexCoord2iARB;
+	glad_glMultiTexCoord2ivARB = glad_lazy_glMultiTexCoord2ivARB;
+	glad_glMultiTexCoord2sARB = glad_lazy_glMultiTexCoord2sARB;
+	glad_glMultiTexCoord2svARB = glad_lazy_glMultiTexCoord2svARB;
+	glad_glMultiTexCoord3dARB = glad_lazy_glMultiTexCoord3dARB;
+	glad_glMultiTexCoord3dvARB = glad_lazy_glMultiTexCoord3dvARB;
+	glad_glMultiTexCoord3fARB = glad_lazy_glMultiTexCoord3fARB;
+	glad_glMultiTexCoord3fvARB = glad_lazy_glMultiTexCoord3fvARB;
+	glad_glMultiTexCoord3iARB = glad_lazy_glMultiTexCoord3iARB;
+	glad_glMultiTexCoord3ivARB = glad_lazy_glMultiTexCoord3ivARB;
+	glad_glMultiTexCoord3sARB = glad_lazy_glMultiTexCoord3sARB;
+	glad_glMultiTexCoord3svARB = glad_lazy_glMultiTexCoord3svARB;
+	glad_glMultiTexCoord4dARB = glad_lazy_glMultiTexCoord4dARB;
+	glad_glMultiTexCoord4dvARB = glad_lazy_glMultiTexCoord4dvARB;
+	glad_glMultiTexCoord4fARB = glad_lazy_glMultiTexCoord4fARB;
+	glad_glMultiTexCoord4fvARB = glad_lazy_glMultiTexCoord4fvARB;
+	glad_glMultiTexCoord4iARB = glad_lazy_glMultiTexCoord4iARB;
+	glad_glMultiTexCoord4ivARB = glad_lazy_glMultiTexCoord4ivARB;
+	glad_glMultiTexCoord4sARB = glad_lazy_glMultiTexCoord4sARB;
+	glad_glMultiTexCoord4svARB = glad_lazy_glMultiTexCoord4svARB;
+}
+static void lazy_GL_ARB_occlusion_query(void) {
+	if(!GLAD_GL_ARB_occlusion_query) return;
+	glad_glGenQueriesARB = glad_lazy_glGenQueriesARB;
+	glad_glDeleteQueriesARB = glad_lazy_glDeleteQueriesARB;
+	glad_glIsQueryARB = glad_lazy_glIsQueryARB;
+	glad_glBeginQueryARB = glad_lazy_glBeginQueryARB;
+	glad_glEndQueryARB = glad_lazy_glEndQueryARB;
+	glad_glGetQueryivARB = glad_lazy_glGetQueryivARB;
+	glad_glGetQueryObjectivARB = glad_lazy_glGetQueryObjectivARB;
+	glad_glGetQueryObjectuivARB = glad_lazy_glGetQueryObjectuivARB;
+}
+static void lazy_GL_ARB_parallel_shader_compile(void) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = glad_lazy_glMaxShaderCompilerThreadsARB;
+}
+static void lazy_GL_ARB_point_parameters(void) {
+	if(!GLAD_GL_ARB_point_parameters) return;
+	glad_glPointParameterfARB = glad_lazy_glPointParameterfARB;
+	glad_glPointParameterfvARB = glad_lazy_glPointParameterfvARB;
+}
+static void lazy_GL_ARB_polygon_offset_clamp(void) {
+	if(!GLAD_GL_ARB_polygon_offset_clamp) return;
+	glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+}
+static void lazy_GL_ARB_program_interface_query(void) {
+	if(!GLAD_GL_ARB_program_interface_query) return;
+	glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+}
+static void lazy_GL_ARB_provoking_vertex(void) {
+	if(!GLAD_GL_ARB_provoking_vertex) return;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+}
+static void lazy_GL_ARB_robustness(void) {
+	if(!GLAD_GL_ARB_robustness) return;
+	glad_glGetGraphicsResetStatusARB = glad_lazy_glGetGraphicsResetStatusARB;
+	glad_glGetnTexImageARB = glad_lazy_glGetnTexImageARB;
+	glad_glReadnPixelsARB = glad_lazy_glReadnPixelsARB;
+	glad_glGetnCompressedTexImageARB = glad_lazy_glGetnCompressedTexImageARB;
+	glad_glGetnUniformfvARB = glad_lazy_glGetnUniformfvARB;
+	glad_glGetnUniformivARB = glad_lazy_glGetnUniformivARB;
+	glad_glGetnUniformuivARB = glad_lazy_glGetnUniformuivARB;
+	glad_glGetnUniformdvARB = glad_lazy_glGetnUniformdvARB;
+	glad_glGetnMapdvARB = glad_lazy_glGetnMapdvARB;
+	glad_glGetnMapfvARB = glad_lazy_glGetnMapfvARB;
+	glad_glGetnMapivARB = glad_lazy_glGetnMapivARB;
+	glad_glGetnPixelMapfvARB = glad_lazy_glGetnPixelMapfvARB;
+	glad_glGetnPixelMapuivARB = glad_lazy_glGetnPixelMapuivARB;
+	glad_glGetnPixelMapusvARB = glad_lazy_glGetnPixelMapusvARB;
+	glad_glGetnPolygonStippleARB = glad_lazy_glGetnPolygonStippleARB;
+	glad_glGetnColorTableARB = glad_lazy_glGetnColorTableARB;
+	glad_glGetnConvolutionFilterARB = glad_lazy_glGetnConvolutionFilterARB;
+	glad_glGetnSeparableFilterARB = glad_lazy_glGetnSeparableFilterARB;
+	glad_glGetnHistogramARB = glad_lazy_glGetnHistogramARB;
+	glad_glGetnMinmaxARB = glad_lazy_glGetnMinmaxARB;
+}
+static void lazy_GL_ARB_sample_locations(void) {
+	if(!GLAD_GL_ARB_sample_locations) return;
+	glad_glFramebufferSampleLocationsfvARB = glad_lazy_glFramebufferSampleLocationsfvARB;
+	glad_glNamedFramebufferSampleLocationsfvARB = glad_lazy_glNamedFramebufferSampleLocationsfvARB;
+	glad_glEvaluateDepthValuesARB = glad_lazy_glEvaluateDepthValuesARB;
+}
+static void lazy_GL_ARB_sample_shading(void) {
+	if(!GLAD_GL_ARB_sample_shading) return;
+	glad_glMinSampleShadingARB = glad_lazy_glMinSampleShadingARB;
+}
+static void lazy_GL_ARB_sampler_objects(void) {
+	if(!GLAD_GL_ARB_sampler_objects) return;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+}
+static void lazy_GL_ARB_separate_shader_objects(void) {
+	if(!GLAD_GL_ARB_separate_shader_objects) return;
+	glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+}
+static void lazy_GL_ARB_shader_atomic_counters(void) {
+	if(!GLAD_GL_ARB_shader_atomic_counters) return;
+	glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+}
+static void lazy_GL_ARB_shader_image_load_store(void) {
+	if(!GLAD_GL_ARB_shader_image_load_store) return;
+	glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+	glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+}
+static void lazy_GL_ARB_shader_objects(void) {
+	if(!GLAD_GL_ARB_shader_objects) return;
+	glad_glDeleteObjectARB = glad_lazy_glDeleteObjectARB;
+	glad_glGetHandleARB = glad_lazy_glGetHandleARB;
+	glad_glDetachObjectARB = glad_lazy_glDetachObjectARB;
+	glad_glCreateShaderObjectARB = glad_lazy_glCreateShaderObjectARB;
+	glad_glShaderSourceARB = glad_lazy_glShaderSourceARB;
+	glad_glCompileShaderARB = glad_lazy_glCompileShaderARB;
+	glad_glCreateProgramObjectARB = glad_lazy_glCreateProgramObjectARB;
+	glad_glAttachObjectARB = glad_lazy_glAttachObjectARB;
+	glad_glLinkProgramARB = glad_lazy_glLinkProgramARB;
+	glad_glUseProgramObjectARB = glad_lazy_glUseProgramObjectARB;
+	glad_glValidateProgramARB = glad_lazy_glValidateProgramARB;
+	glad_glUniform1fARB = glad_lazy_glUniform1fARB;
+	glad_glUniform2fARB = glad_lazy_glUniform2fARB;
+	glad_glUniform3fARB = glad_lazy_glUniform3fARB;
+	glad_glUniform4fARB = glad_lazy_glUniform4fARB;
+	glad_glUniform1iARB = glad_lazy_glUniform1iARB;
+	glad_glUniform2iARB = glad_lazy_glUniform2iARB;
+	glad_glUniform3iARB = glad_lazy_glUniform3iARB;
+	glad_glUniform4iARB = glad_lazy_glUniform4iARB;
+	glad_glUniform1fvARB = glad_lazy_glUniform1fvARB;
+	glad_glUniform2fvARB = glad_lazy_glUniform2fvARB;
+	glad_glUniform3fvARB = glad_lazy_glUniform3fvARB;
+	glad_glUniform4fvARB = glad_lazy_glUniform4fvARB;
+	glad_glUniform1ivARB = glad_lazy_glUniform1ivARB;
+	glad_glUniform2ivARB = glad_lazy_glUniform2ivARB;
+	glad_glUniform3ivARB = glad_lazy_glUniform3ivARB;
+	glad_glUniform4ivARB = glad_lazy_glUniform4ivARB;
+	glad_glUniformMatrix2fvARB = glad_lazy_glUniformMatrix2fvARB;
+	glad_glUniformMatrix3fvARB = glad_lazy_glUniformMatrix3fvARB;
+	glad_glUniformMatrix4fvARB = glad_lazy_glUniformMatrix4fvARB;
+	glad_glGetObjectParameterfvARB = glad_lazy_glGetObjectParameterfvARB;
+	glad_glGetObjectParameterivARB = glad_lazy_glGetObjectParameterivARB;
+	glad_glGetInfoLogARB = glad_lazy_glGetInfoLogARB;
+	glad_glGetAttachedObjectsARB = glad_lazy_glGetAttachedObjectsARB;
+	glad_glGetUniformLocationARB = glad_lazy_glGetUniformLocationARB;
+	glad_glGetActiveUniformARB = glad_lazy_glGetActiveUniformARB;
+	glad_glGetUniformfvARB = glad_lazy_glGetUniformfvARB;
+	glad_glGetUniformivARB = glad_lazy_glGetUniformivARB;
+	glad_glGetShaderSourceARB = glad_lazy_glGetShaderSourceARB;
+}
+static void lazy_GL_ARB_shader_storage_buffer_object(void) {
+	if(!GLAD_GL_ARB_shader_storage_buffer_object) return;
+	glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+}
+static void lazy_GL_ARB_shader_subroutine(void) {
+	if(!GLAD_GL_ARB_shader_subroutine) return;
+	glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+}
+static void lazy_GL_ARB_shading_language_include(void) {
+	if(!GLAD_GL_ARB_shading_language_include) return;
+	glad_glNamedStringARB = glad_lazy_glNamedStringARB;
+	glad_glDeleteNamedStringARB = glad_lazy_glDeleteNamedStringARB;
+	glad_glCompileShaderIncludeARB = glad_lazy_glCompileShaderIncludeARB;
+	glad_glIsNamedStringARB = glad_lazy_glIsNamedStringARB;
+	glad_glGetNamedStringARB = glad_lazy_glGetNamedStringARB;
+	glad_glGetNamedStringivARB = glad_lazy_glGetNamedStringivARB;
+}
+static void lazy_GL_ARB_sparse_buffer(void) {
+	if(!GLAD_GL_ARB_sparse_buffer) return;
+	glad_glBufferPageCommitmentARB = glad_lazy_glBufferPageCommitmentARB;
+	glad_glNamedBufferPageCommitmentEXT = glad_lazy_glNamedBufferPageCommitmentEXT;
+	glad_glNamedBufferPageCommitmentARB = glad_lazy_glNamedBufferPageCommitmentARB;
+}
+static void lazy_GL_ARB_sparse_texture(void) {
+	if(!GLAD_GL_ARB_sparse_texture) return;
+	glad_glTexPageCommitmentARB = glad_lazy_glTexPageCommitmentARB;
+}
+static void lazy_GL_ARB_sync(void) {
+	if(!GLAD_GL_ARB_sync) return;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+}
+static void lazy_GL_ARB_tessellation_shader(void) {
+	if(!GLAD_GL_ARB_tessellation_shader) return;
+	glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+	glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+}
+static void lazy_GL_ARB_texture_barrier(void) {
+	if(!GLAD_GL_ARB_texture_barrier) return;
+	glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+}
+static void lazy_GL_ARB_texture_buffer_object(void) {
+	if(!GLAD_GL_ARB_texture_buffer_object) return;
+	glad_glTexBufferARB = glad_lazy_glTexBufferARB;
+}
+static void lazy_GL_ARB_texture_buffer_range(void) {
+	if(!GLAD_GL_ARB_texture_buffer_range) return;
+	glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+}
+static void lazy_GL_ARB_texture_compression(void) {
+	if(!GLAD_GL_ARB_texture_compression) return;
+	glad_glCompressedTexImage3DARB = glad_lazy_glCompressedTexImage3DARB;
+	glad_glCompressedTexImage2DARB = glad_lazy_glCompressedTexImage2DARB;
+	glad_glCompressedTexImage1DARB = glad_lazy_glCompressedTexImage1DARB;
+	glad_glCompressedTexSubImage3DARB = glad_lazy_glCompressedTexSubImage3DARB;
+	glad_glCompressedTexSubImage2DARB = glad_lazy_glCompressedTexSubImage2DARB;
+	glad_glCompressedTexSubImage1DARB = glad_lazy_glCompressedTexSubImage1DARB;
+	glad_glGetCompressedTexImageARB = glad_lazy_glGetCompressedTexImageARB;
+}
+static void lazy_GL_ARB_texture_multisample(void) {
+	if(!GLAD_GL_ARB_texture_multisample) return;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_ARB_texture_storage(void) {
+	if(!GLAD_GL_ARB_texture_storage) return;
+	glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+	glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+	glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+}
+static void lazy_GL_ARB_texture_storage_multisample(void) {
+	if(!GLAD_GL_ARB_texture_storage_multisample) return;
+	glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+}
+static void lazy_GL_ARB_texture_view(void) {
+	if(!GLAD_GL_ARB_texture_view) return;
+	glad_glTextureView = glad_lazy_glTextureView;
+}
+static void lazy_GL_ARB_timer_query(void) {
+	if(!GLAD_GL_ARB_timer_query) return;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+}
+static void lazy_GL_ARB_transform_feedback2(void) {
+	if(!GLAD_GL_ARB_transform_feedback2) return;
+	glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+}
+static void lazy_GL_ARB_transform_feedback3(void) {
+	if(!GLAD_GL_ARB_transform_feedback3) return;
+	glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_ARB_transform_feedback_instanced(void) {
+	if(!GLAD_GL_ARB_transform_feedback_instanced) return;
+	glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_ARB_transpose_matrix(void) {
+	if(!GLAD_GL_ARB_transpose_matrix) return;
+	glad_glLoadTransposeMatrixfARB = glad_lazy_glLoadTransposeMatrixfARB;
+	glad_glLoadTransposeMatrixdARB = glad_lazy_glLoadTransposeMatrixdARB;
+	glad_glMultTransposeMatrixfARB = glad_lazy_glMultTransposeMatrixfARB;
+	glad_glMultTransposeMatrixdARB = glad_lazy_glMultTransposeMatrixdARB;
+}
+static void lazy_GL_ARB_uniform_buffer_object(void) {
+	if(!GLAD_GL_ARB_uniform_buffer_object) return;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_ARB_vertex_array_object(void) {
+	if(!GLAD_GL_ARB_vertex_array_object) return;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_ARB_vertex_attrib_64bit(void) {
+	if(!GLAD_GL_ARB_vertex_attrib_64bit) return;
+	glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+}
+static void lazy_GL_ARB_vertex_attrib_binding(void) {
+	if(!GLAD_GL_ARB_vertex_attrib_binding) return;
+	glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+}
+static void lazy_GL_ARB_vertex_blend(void) {
+	if(!GLAD_GL_ARB_vertex_blend) return;
+	glad_glWeightbvARB = glad_lazy_glWeightbvARB;
+	glad_glWeightsvARB = glad_lazy_glWeightsvARB;
+	glad_glWeightivARB = glad_lazy_glWeightivARB;
+	glad_glWeightfvARB = glad_lazy_glWeightfvARB;
+	glad_glWeightdvARB = glad_lazy_glWeightdvARB;
+	glad_glWeightubvARB = glad_lazy_glWeightubvARB;
+	glad_glWeightusvARB = glad_lazy_glWeightusvARB;
+	glad_glWeightuivARB = glad_lazy_glWeightuivARB;
+	glad_glWeightPointerARB = glad_lazy_glWeightPointerARB;
+	glad_glVertexBlendARB = glad_lazy_glVertexBlendARB;
+}
+static void lazy_GL_ARB_vertex_buffer_object(void) {
+	if(!GLAD_GL_ARB_vertex_buffer_object) return;
+	glad_glBindBufferARB = glad_lazy_glBindBufferARB;
+	glad_glDeleteBuffersARB = glad_lazy_glDeleteBuffersARB;
+	glad_glGenBuffersARB = glad_lazy_glGenBuffersARB;
+	glad_glIsBufferARB = glad_lazy_glIsBufferARB;
+	glad_glBufferDataARB = glad_lazy_glBufferDataARB;
+	glad_glBufferSubDataARB = glad_lazy_glBufferSubDataARB;
+	glad_glGetBufferSubDataARB = glad_lazy_glGetBufferSubDataARB;
+	glad_glMapBufferARB = glad_lazy_glMapBufferARB;
+	glad_glUnmapBufferARB = glad_lazy_glUnmapBufferARB;
+	glad_glGetBufferParameterivARB = glad_lazy_glGetBufferParameterivARB;
+	glad_glGetBufferPointervARB = glad_lazy_glGetBufferPointervARB;
+}
+static void lazy_GL_ARB_vertex_program(void) {
+	if(!GLAD_GL_ARB_vertex_program) return;
+	glad_glVertexAttrib1dARB = glad_lazy_glVertexAttrib1dARB;
+	glad_glVertexAttrib1dvARB = glad_lazy_glVertexAttrib1dvARB;
+	glad_glVertexAttrib1fARB = glad_lazy_glVertexAttrib1fARB;
+	glad_glVertexAttrib1fvARB = glad_lazy_glVertexAttrib1fvARB;
+	glad_glVertexAttrib1sARB = glad_lazy_glVertexAttrib1sARB;
+	glad_glVertexAttrib1svARB = glad_lazy_glVertexAttrib1svARB;
+	glad_glVertexAttrib2dARB = glad_lazy_glVertexAttrib2dARB;
+	glad_glVertexAttrib2dvARB = glad_lazy_glVertexAttrib2dvARB;
+	glad_glVertexAttrib2fARB = glad_lazy_glVertexAttrib2fARB;
+	glad_glVertexAttrib2fvARB = glad_lazy_glVertexAttrib2fvARB;
+	glad_glVertexAttrib2sARB = glad_lazy_glVertexAttrib2sARB;
+	glad_glVertexAttrib2svARB = glad_lazy_glVertexAttrib2svARB;
+	glad_glVertexAttrib3dARB = glad_lazy_glVertexAttrib3dARB;
+	glad_glVertexAttrib3dvARB = glad_lazy_glVertexAttrib3dvARB;
+	glad_glVertexAttrib3fARB = glad_lazy_glVertexAttrib3fARB;
+	glad_glVertexAttrib3fvARB = glad_lazy_glVertexAttrib3fvARB;
+	glad_glVertexAttrib3sARB = glad_lazy_glVertexAttrib3sARB;
+	glad_glVertexAttrib3svARB = glad_lazy_glVertexAttrib3svARB;
+	glad_glVertexAttrib4NbvARB = glad_lazy_glVertexAttrib4NbvARB;
+	glad_glVertexAttrib4NivARB = glad_lazy_glVertexAttrib4NivARB;
+	glad_glVertexAttrib4NsvARB = glad_lazy_glVertexAttrib4NsvARB;
+	glad_glVertexAttrib4NubARB = glad_lazy_glVertexAttrib4NubARB;
+	glad_glVertexAttrib4NubvARB = glad_lazy_glVertexAttrib4NubvARB;
+	glad_glVertexAttrib4NuivARB = glad_lazy_glVertexAttrib4NuivARB;
+	glad_glVertexAttrib4NusvARB = glad_lazy_glVertexAttrib4NusvARB;
+	glad_glVertexAttrib4bvARB = glad_lazy_glVertexAttrib4bvARB;
+	glad_glVertexAttrib4dARB = glad_lazy_glVertexAttrib4dARB;
+	glad_glVertexAttrib4dvARB = glad_lazy_glVertexAttrib4dvARB;
+	glad_glVertexAttrib4fARB = glad_lazy_glVertexAttrib4fARB;
+	glad_glVertexAttrib4fvARB = glad_lazy_glVertexAttrib4fvARB;
+	glad_glVertexAttrib4ivARB = glad_lazy_glVertexAttrib4ivARB;
+	glad_glVertexAttrib4sARB = glad_lazy_glVertexAttrib4sARB;
+	glad_glVertexAttrib4svARB = glad_lazy_glVertexAttrib4svARB;
+	glad_glVertexAttrib4ubvARB = glad_lazy_glVertexAttrib4ubvARB;
+	glad_glVertexAttrib4uivARB = glad_lazy_glVertexAttrib4uivARB;
+	glad_glVertexAttrib4usvARB = glad_lazy_glVertexAttrib4usvARB;
+	glad_glVertexAttribPointerARB = glad_lazy_glVertexAttribPointerARB;
+	glad_glEnableVertexAttribArrayARB = glad_lazy_glEnableVertexAttribArrayARB;
+	glad_glDisableVertexAttribArrayARB = glad_lazy_glDisableVertexAttribArrayARB;
+	glad_glProgramStringARB = glad_lazy_glProgramStringARB;
+	glad_glBindProgramARB = glad_lazy_glBindProgramARB;
+	glad_glDeleteProgramsARB = glad_lazy_glDeleteProgramsARB;
+	glad_glGenProgramsARB = glad_lazy_glGenProgramsARB;
+	glad_glProgramEnvParameter4dARB = glad_lazy_glProgramEnvParameter4dARB;
+	glad_glProgramEnvParameter4dvARB = glad_lazy_glProgramEnvParameter4dvARB;
+	glad_glProgramEnvParameter4fARB = glad_lazy_glProgramEnvParameter4fARB;
+	glad_glProgramEnvParameter4fvARB = glad_lazy_glProgramEnvParameter4fvARB;
+	glad_glProgramLocalParameter4dARB = glad_lazy_glProgramLocalParameter4dARB;
+	glad_glProgramLocalParameter4dvARB = glad_lazy_glProgramLocalParameter4dvARB;
+	glad_glProgramLocalParameter4fARB = glad_lazy_glProgramLocalParameter4fARB;
+	glad_glProgramLocalParameter4fvARB = glad_lazy_glProgramLocalParameter4fvARB;
+	glad_glGetProgramEnvParameterdvARB = glad_lazy_glGetProgramEnvParameterdvARB;
+	glad_glGetProgramEnvParameterfvARB = glad_lazy_glGetProgramEnvParameterfvARB;
+	glad_glGetProgramLocalParameterdvARB = glad_lazy_glGetProgramLocalParameterdvARB;
+	glad_glGetProgramLocalParameterfvARB = glad_lazy_glGetProgramLocalParameterfvARB;
+	glad_glGetProgramivARB = glad_lazy_glGetProgramivARB;
+	glad_glGetProgramStringARB = glad_lazy_glGetProgramStringARB;
+	glad_glGetVertexAttribdvARB = glad_lazy_glGetVertexAttribdvARB;
+	glad_glGetVertexAttribfvARB = glad_lazy_glGetVertexAttribfvARB;
+	glad_glGetVertexAttribivARB = glad_lazy_glGetVertexAttribivARB;
+	glad_glGetVertexAttribPointervARB = glad_lazy_glGetVertexAttribPointervARB;
+	glad_glIsProgramARB = glad_lazy_glIsProgramARB;
+}
+static void lazy_GL_ARB_vertex_shader(void) {
+	if(!GLAD_GL_ARB_vertex_shader) return;
+	glad_glVertexAttrib1fARB = glad_lazy_glVertexAttrib1fARB;
+	glad_glVertexAttrib1sARB = glad_lazy_glVertexAttrib1sARB;
+	glad_glVertexAttrib1dARB = glad_lazy_glVertexAttrib1dARB;
+	glad_glVertexAttrib2fARB = glad_lazy_glVertexAttrib2fARB;
+	glad_glVertexAttrib2sARB = glad_lazy_glVertexAttrib2sARB;
+	glad_glVertexAttrib2dARB = glad_lazy_glVertexAttrib2dARB;
+	glad_glVertexAttrib3fARB = glad_lazy_glVertexAttrib3fARB;
+	glad_glVertexAttrib3sARB = glad_lazy_glVertexAttrib3sARB;
+	glad_glVertexAttrib3dARB = glad_lazy_glVertexAttrib3dARB;
+	glad_glVertexAttrib4fARB = glad_lazy_glVertexAttrib4fARB;
+	glad_glVertexAttrib4sARB = glad_lazy_glVertexAttrib4sARB;
+	glad_glVertexAttrib4dARB = glad_lazy_glVertexAttrib4dARB;
+	glad_glVertexAttrib4NubARB = glad_lazy_glVertexAttrib4NubARB;
+	glad_glVertexAttrib1fvARB = glad_lazy_glVertexAttrib1fvARB;
+	glad_glVertexAttrib1svARB = glad_lazy_glVertexAttrib1svARB;
+	glad_glVertexAttrib1dvARB = glad_lazy_glVertexAttrib1dvARB;
+	glad_glVertexAttrib2fvARB = glad_lazy_glVertexAttrib2fvARB;
+	glad_glVertexAttrib2svARB = glad_lazy_glVertexAttrib2svARB;
+	glad_glVertexAttrib2dvARB = glad_lazy_glVertexAttrib2dvARB;
+	glad_glVertexAttrib3fvARB = glad_lazy_glVertexAttrib3fvARB;
+	glad_glVertexAttrib3svARB = glad_lazy_glVertexAttrib3svARB;
+	glad_glVertexAttrib3dvARB = glad_lazy_glVertexAttrib3dvARB;
+	glad_glVertexAttrib4fvARB = glad_lazy_glVertexAttrib4fvARB;
+	glad_glVertexAttrib4svARB = glad_lazy_glVertexAttrib4svARB;
+	glad_glVertexAttrib4dvARB = glad_lazy_glVertexAttrib4dvARB;
+	glad_glVertexAttrib4ivARB = glad_lazy_glVertexAttrib4ivARB;
+	glad_glVertexAttrib4bvARB = glad_lazy_glVertexAttrib4bvARB;
+	glad_glVertexAttrib4ubvARB = glad_lazy_glVertexAttrib4ubvARB;
+	glad_glVertexAttrib4usvARB = glad_lazy_glVertexAttrib4usvARB;
+	glad_glVertexAttrib4uivARB = glad_lazy_glVertexAttrib4uivARB;
+	glad_glVertexAttrib4NbvARB = glad_lazy_glVertexAttrib4NbvARB;
+	glad_glVertexAttrib4NsvARB = glad_lazy_glVertexAttrib4NsvARB;
+	glad_glVertexAttrib4NivARB = glad_lazy_glVertexAttrib4NivARB;
+	glad_glVertexAttrib4NubvARB = glad_lazy_glVertexAttrib4NubvARB;
+	glad_glVertexAttrib4NusvARB = glad_lazy_glVertexAttrib4NusvARB;
+	glad_glVertexAttrib4NuivARB = glad_lazy_glVertexAttrib4NuivARB;
+	glad_glVertexAttribPointerARB = glad_lazy_glVertexAttribPointerARB;
+	glad_glEnableVertexAttribArrayARB = glad_lazy_glEnableVertexAttribArrayARB;
+	glad_glDisableVertexAttribArrayARB = glad_lazy_glDisableVertexAttribArrayARB;
+	glad_glBindAttribLocationARB = glad_lazy_glBindAttribLocationARB;
+	glad_glGetActiveAttribARB = glad_lazy_glGetActiveAttribARB;
+	glad_glGetAttribLocationARB = glad_lazy_glGetAttribLocationARB;
+	glad_glGetVertexAttribdvARB = glad_lazy_glGetVertexAttribdvARB;
+	glad_glGetVertexAttribfvARB = glad_lazy_glGetVertexAttribfvARB;
+	glad_glGetVertexAttribivARB = glad_lazy_glGetVertexAttribivARB;
+	glad_glGetVertexAttribPointervARB = glad_lazy_glGetVertexAttribPointervARB;
+}
+static void lazy_GL_ARB_vertex_type_2_10_10_10_rev(void) {
+	if(!GLAD_GL_ARB_vertex_type_2_10_10_10_rev) return;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_ARB_viewport_array(void) {
+	if(!GLAD_GL_ARB_viewport_array) return;
+	glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+	glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+	glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+	glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+	glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+	glad_glDepthRangeArraydvNV = glad_lazy_glDepthRangeArraydvNV;
+	glad_glDepthRangeIndexeddNV = glad_lazy_glDepthRangeIndexeddNV;
+}
+static void lazy_GL_ARB_window_pos(void) {
+	if(!GLAD_GL_ARB_window_pos) return;
+	glad_glWindowPos2dARB = glad_lazy_glWindowPos2dARB;
+	glad_glWindowPos2dvARB = glad_lazy_glWindowPos2dvARB;
+	glad_glWindowPos2fARB = glad_lazy_glWindowPos2fARB;
+	glad_glWindowPos2fvARB = glad_lazy_glWindowPos2fvARB;
+	glad_glWindowPos2iARB = glad_lazy_glWindowPos2iARB;
+	glad_glWindowPos2ivARB = glad_lazy_glWindowPos2ivARB;
+	glad_glWindowPos2sARB = glad_lazy_glWindowPos2sARB;
+	glad_glWindowPos2svARB = glad_lazy_glWindowPos2svARB;
+	glad_glWindowPos3dARB = glad_lazy_glWindowPos3dARB;
+	glad_glWindowPos3dvARB = glad_lazy_glWindowPos3dvARB;
+	glad_glWindowPos3fARB = glad_lazy_glWindowPos3fARB;
+	glad_glWindowPos3fvARB = glad_lazy_glWindowPos3fvARB;
+	glad_glWindowPos3iARB = glad_lazy_glWindowPos3iARB;
+	glad_glWindowPos3ivARB = glad_lazy_glWindowPos3ivARB;
+	glad_glWindowPos3sARB = glad_lazy_glWindowPos3sARB;
+	glad_glWindowPos3svARB = glad_lazy_glWindowPos3svARB;
+}
+
+#undef GLAD_LAZY
+#undef GLAD_LAZY_VOID
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	lazy_load = load;
+	glad_glGetString = glad_lazy_glGetString;
+	if(load("glGetString") == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_ES2_compatibility();
+	lazy_GL_ARB_ES3_1_compatibility();
+	lazy_GL_ARB_ES3_2_compatibility();
+	lazy_GL_ARB_base_instance();
+	lazy_GL_ARB_bindless_texture();
+	lazy_GL_ARB_blend_func_extended();
+	lazy_GL_ARB_buffer_storage();
+	lazy_GL_ARB_cl_event();
+	lazy_GL_ARB_clear_buffer_object();
+	lazy_GL_ARB_clear_texture();
+	lazy_GL_ARB_clip_control();
+	lazy_GL_ARB_color_buffer_float();
+	lazy_GL_ARB_compute_shader();
+	lazy_GL_ARB_compute_variable_group_size();
+	lazy_GL_ARB_copy_buffer();
+	lazy_GL_ARB_copy_image();
+	lazy_GL_ARB_debug_output();
+	lazy_GL_ARB_direct_state_access();
+	lazy_GL_ARB_draw_buffers();
+	lazy_GL_ARB_draw_buffers_blend();
+	lazy_GL_ARB_draw_elements_base_vertex();
+	lazy_GL_ARB_draw_indirect();
+	lazy_GL_ARB_draw_instanced();
+	lazy_GL_ARB_fragment_program();
+	lazy_GL_ARB_framebuffer_no_attachments();
+	lazy_GL_ARB_framebuffer_object();
+	lazy_GL_ARB_geometry_shader4();
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_ARB_get_texture_sub_image();
+	lazy_GL_ARB_gl_spirv();
+	lazy_GL_ARB_gpu_shader_fp64();
+	lazy_GL_ARB_gpu_shader_int64();
+	lazy_GL_ARB_imaging();
+	lazy_GL_ARB_indirect_parameters();
+	lazy_GL_ARB_instanced_arrays();
+	lazy_GL_ARB_internalformat_query();
+	lazy_GL_ARB_internalformat_query2();
+	lazy_GL_ARB_invalidate_subdata();
+	lazy_GL_ARB_map_buffer_range();
+	lazy_GL_ARB_matrix_palette();
+	lazy_GL_ARB_multi_bind();
+	lazy_GL_ARB_multi_draw_indirect();
+	lazy_GL_ARB_multisample();
+	lazy_GL_ARB_multitexture();
+	lazy_GL_ARB_occlusion_query();
+	lazy_GL_ARB_parallel_shader_compile();
+	lazy_GL_ARB_point_parameters();
+	lazy_GL_ARB_polygon_offset_clamp();
+	lazy_GL_ARB_program_interface_query();
+	lazy_GL_ARB_provoking_vertex();
+	lazy_GL_ARB_robustness();
+	lazy_GL_ARB_sample_locations();
+	lazy_GL_ARB_sample_shading();
+	lazy_GL_ARB_sampler_objects();
+	lazy_GL_ARB_separate_shader_objects();
+	lazy_GL_ARB_shader_atomic_counters();
+	lazy_GL_ARB_shader_image_load_store();
+	lazy_GL_ARB_shader_objects();
+	lazy_GL_ARB_shader_storage_buffer_object();
+	lazy_GL_ARB_shader_subroutine();
+	lazy_GL_ARB_shading_language_include();
+	lazy_GL_ARB_sparse_buffer();
+	lazy_GL_ARB_sparse_texture();
+	lazy_GL_ARB_sync();
+	lazy_GL_ARB_tessellation_shader();
+	lazy_GL_ARB_texture_barrier();
+	lazy_GL_ARB_texture_buffer_object();
+	lazy_GL_ARB_texture_buffer_range();
+	lazy_GL_ARB_texture_compression();
+	lazy_GL_ARB_texture_multisample();
+	lazy_GL_ARB_texture_storage();
+	lazy_GL_ARB_texture_storage_multisample();
+	lazy_GL_ARB_texture_view();
+	lazy_GL_ARB_timer_query();
+	lazy_GL_ARB_transform_feedback2();
+	lazy_GL_ARB_transform_feedback3();
+	lazy_GL_ARB_transform_feedback_instanced();
+	lazy_GL_ARB_transpose_matrix();
+	lazy_GL_ARB_uniform_buffer_object();
+	lazy_GL_ARB_vertex_array_object();
+	lazy_GL_ARB_vertex_attrib_64bit();
+	lazy_GL_ARB_vertex_attrib_binding();
+	lazy_GL_ARB_vertex_blend();
+	lazy_GL_ARB_vertex_buffer_object();
+	lazy_GL_ARB_vertex_program();
+	lazy_GL_ARB_vertex_shader();
+	lazy_GL_ARB_vertex_type_2_10_10_10_rev();
+	lazy_GL_ARB_viewport_array();
+	lazy_GL_ARB_window_pos();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
@@ -12,9 +12,44 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
 
 // Our libraries
 #include "Camera.hpp"
+#include "CameraPath.hpp"
+#include "InputSource.hpp"
+#include "TransformHierarchy.hpp"
+#include "MatrixKernels.hpp"
+#include "Benchmarks.hpp"
+#include "CpuDispatch.hpp"
+#include "StreamingBuffer.hpp"
+#include "MeshBufferPool.hpp"
+#include "MeshLod.hpp"
+#include "Meshlets.hpp"
+#include "IndirectDrawList.hpp"
+#include "GpuCulling.hpp"
+#include "FrameScheduler.hpp"
+#include "FramePacer.hpp"
+#include "GLCapture.hpp"
+#include "GLReplay.hpp"
+#include "GLStats.hpp"
+#include "ResourceWorker.hpp"
+#include "TextureManager.hpp"
+#include "TextureArrayAtlas.hpp"
+#include "MaterialSystem.hpp"
+#include "ClusteredLighting.hpp"
+#include "DeferredShading.hpp"
+#include "CascadedShadowMaps.hpp"
+#include "ParticleSystem.hpp"
+#include "BlockCompressor.hpp"
+#include "AnimationSystem.hpp"
+#include "GltfLoader.hpp"
+#include "SkinnedModel.hpp"
+#include "Random.hpp"
 
 //--------------------------- Error Handling Routines --------------------------------
 /// <summary>
@@ -55,6 +90,58 @@ static bool GLCheckErrorStatus(const char* function, int line) {
 #define GLCheck(x) GLClearAllErrors(); x; GLCheckErrorStatus(#x, __LINE__);
 //------------------------------------------------------------------------------------
 
+/// <summary>
+/// Uniform block binding points, shared by every shader.
+/// </summary>
+enum UniformBlockBinding {
+	PerObjectBinding = 0,
+	MaterialsBinding = 1,
+	LightingBinding = 2,
+	ShadowsBinding = 3,
+	ParticlesBinding = 4,
+};
+
+/// <summary>
+/// Texture units, shared by every shader.
+/// </summary>
+enum TextureUnit {
+	SceneTextureUnit = 0,
+	// ClusteredLighting::TextureUnitCount of them.
+	FirstLightingUnit = 1,
+	// DeferredShading::TextureUnitCount of them, the G-buffer.
+	FirstGBufferUnit = FirstLightingUnit + ClusteredLighting::TextureUnitCount,
+	// The cascades' depth texture array.
+	ShadowMapUnit = FirstGBufferUnit + DeferredShading::TextureUnitCount,
+	// AnimationSystem's skinning matrices, a texture buffer.
+	SkinPaletteUnit = ShadowMapUnit + 1,
+};
+
+/// <summary>
+/// Vertex attributes beyond the ones in each mesh's VertexFormat.
+/// </summary>
+enum VertexAttributeLocation {
+	// mat4, so this takes 2 to 5; the rest of PerObjectData follows at 6 and 7
+	InstanceMatrixLocation = 2,
+	InstanceVectorCount = sizeof(glm::mat4) / sizeof(glm::vec4) + 2,
+	// SkinnedVertex's joints and weights, past the instanced ones.
+	JointsLocation = 8,
+	WeightsLocation = 9,
+};
+
+/// <summary>
+/// One object's block of this frame's per-object data: the PerObject
+/// uniform block (std140) in vert.glsl, or its instanced attributes with
+/// INSTANCED. The culling shader only reads the matrix.
+/// </summary>
+struct PerObjectData {
+	glm::mat4	mModelViewProjection;
+	// Where the object's texture is in App::mAtlas, see TextureArrayAtlas::Entry.
+	glm::vec4	mAtlasRect;
+	// The atlas layer (x), the object's material (y) and, when it's skinned,
+	// its first joint in the skin palette (z), as floats.
+	glm::vec4	mObjectIndices;
+};
+
 struct App {
 	//Screen Dimensions
 	int				mScreenHeight					= 480;
@@ -63,33 +150,236 @@ struct App {
 	SDL_GLContext	mOpenGLContext					= nullptr;
 	// Main loop flag
 	bool			mQuit							= false;
-	//program object for our shader
-	GLuint			mGraphicsPipelineShaderProgram	= 0;
+	// Resolve every GL function up front instead of on first use, to compare startup times.
+	bool			mEagerGLLoading					= false;
+	/// <summary>
+	/// Every material and the shader permutations they use. Indexed by
+	/// transform, each object's material, for its per-object data.
+	/// </summary>
+	MaterialSystem	mMaterials;
+	std::vector<MaterialSystem::Handle>	mObjectMaterials;
+	// --pulse-material fades the second mesh's material in and out, to show off partial updates.
+	bool			mPulseMaterial					= false;
+	float			mPulseSeconds					= 0.0f;
+	/// <summary>
+	/// With --lights, point lights circling the meshes, shaded through
+	/// clusters. Time spent assigning them, for the report at exit.
+	/// </summary>
+	ClusteredLighting	mLighting;
+	std::vector<ClusteredLighting::PointLight>	mLights;
+	double			mLightAssignMilliseconds		= 0.0;
+	int				mLightAssignCount				= 0;
+	/// <summary>
+	/// The opaque pass writes a G-buffer that one full screen pass lights,
+	/// rather than lighting as it draws. F6 switches, --deferred starts so.
+	/// </summary>
+	DeferredShading	mDeferred;
+	bool			mUseDeferred					= false;
+	/// <summary>
+	/// With --compare-render-paths, every frame is drawn both ways, timed
+	/// on the GPU, and the two pictures compared; see DrawSceneCompared().
+	/// </summary>
+	bool			mCompareRenderPaths				= false;
+	GLuint			mRenderPathQueries[2]			= {};
+	double			mRenderPathGpuMilliseconds[2]	= {};
+	double			mRenderPathFinishMilliseconds[2]	= {};
+	int				mComparedFrames					= 0;
+	int				mMaxPixelDifference				= 0;
+	std::uint64_t	mDifferentPixels				= 0;
+	/// <summary>
+	/// With --shadows, a sun lights the scene as well, shadowed through
+	/// cascaded shadow maps. One caster per scene mesh, rebuilt every frame,
+	/// and where this frame's per-object blocks for the cascades' draws
+	/// start in mFrameData.
+	/// </summary>
+	CascadedShadowMaps	mShadows;
+	bool			mUseShadows						= false;
+	std::vector<CascadedShadowMaps::Caster>	mShadowCasters;
+	GLintptr		mShadowObjectOffset				= 0;
 	/// <summary>
 	/// A single global camera.
 	/// </summary>
 	Camera			mCamera;
+	/// <summary>
+	/// The camera before the last simulation tick, we render in between the two.
+	/// </summary>
+	Camera			mPreviousCamera;
+	/// <summary>
+	/// Where input comes from: SDL, or a recording played back.
+	/// </summary>
+	InputSource		mInput;
+	/// <summary>
+	/// A scripted flythrough, when --camera-path gave one, and how far along it we are.
+	/// </summary>
+	CameraPath		mCameraPath;
+	float			mCameraPathSeconds				= 0.0f;
+	/// <summary>
+	/// Milliseconds per frame, kept for scripted runs.
+	/// </summary>
+	std::vector<double>	mFrameTimes;
+	/// <summary>
+	/// Runs the simulation at a fixed tick rate, independent of the frame rate.
+	/// </summary>
+	FrameScheduler	mScheduler;
+	/// <summary>
+	/// Keeps the GPU at most a few frames behind, and measures input latency.
+	/// </summary>
+	FramePacer		mPacer;
+	/// <summary>
+	/// Every transform in the scene, stored contiguously.
+	/// </summary>
+	TransformHierarchy	mTransforms;
+	/// <summary>
+	/// projection * view * world for every transform, indexed like mTransforms.
+	/// </summary>
+	std::vector<glm::mat4>	mModelViewProjections;
+	/// <summary>
+	/// Everything we rewrite every frame, written straight into GPU-visible memory.
+	/// </summary>
+	StreamingBuffer	mFrameData;
+	/// <summary>
+	/// Where this frame's per-object blocks start in mFrameData, and the distance between them.
+	/// </summary>
+	GLintptr		mPerObjectOffset				= 0;
+	GLsizeiptr		mPerObjectStride				= 0;
+	/// <summary>
+	/// Vertex and index data of every mesh, packed into a few shared buffers.
+	/// </summary>
+	MeshBufferPool	mMeshBuffers;
+	/// <summary>
+	/// This frame's opaque draws, when we submit them with multi-draw indirect.
+	/// </summary>
+	IndirectDrawList	mOpaqueDraws;
+	bool			mUseIndirectDraws				= false;
+	// The same draws with the GBuffer permutations, when deferred shading needs them.
+	IndirectDrawList	mGBufferDraws;
+	/// <summary>
+	/// Every opaque draw, culled by a compute shader that writes the indirect
+	/// commands itself. Takes precedence over mOpaqueDraws when enabled.
+	/// With deferred shading it also culls against the G-buffer's depth of
+	/// the frame before. With --validate-culling every cull is read back and
+	/// checked against the CPU's, into mCullingValidation.
+	/// </summary>
+	GpuCulling		mGpuCulling;
+	bool			mUseGpuCulling					= false;
+	bool			mValidateCulling				= false;
+	GpuCulling::Validation	mCullingValidation;
+	/// <summary>
+	/// How many pixels a mesh's level of detail may be off by on screen; 0 always draws full detail.
+	/// </summary>
+	float			mLodPixelThreshold				= 1.0f;
+	/// <summary>
+	/// Whether meshes drawn at full detail skip their meshlets that are
+	/// off screen or face away. mVisibleMeshlets and mVisibleMeshletRanges
+	/// are scratch space for it.
+	/// </summary>
+	bool			mUseMeshletCulling				= true;
+	std::vector<MeshBufferPool::DrawRange>	mVisibleMeshlets;
+	std::vector<Meshlets::Range>			mVisibleMeshletRanges;
+	/// <summary>
+	/// Compiles shaders and uploads meshes on a thread of its own, with a shared context.
+	/// </summary>
+	ResourceWorker	mResources;
+	/// <summary>
+	/// Every texture, streamed within mTextureSettings.mBudgetBytes. The
+	/// scene has one texture, or just the 1x1 white one without --texture.
+	/// </summary>
+	TextureManager	mTextures;
+	TextureManager::Settings	mTextureSettings;
+	TextureManager::Handle		mWhiteTexture		= TextureManager::InvalidHandle;
+	TextureManager::Handle		mSceneTexture		= TextureManager::InvalidHandle;
+	/// <summary>
+	/// With --atlas, every mesh has a texture of its own, all of them in one
+	/// texture array, so the indirect paths still draw them in one call.
+	/// Indexed by transform, like the per-object data it goes into.
+	/// </summary>
+	TextureArrayAtlas	mAtlas;
+	bool			mUseAtlas						= false;
+	std::vector<TextureArrayAtlas::Entry>	mAtlasEntries;
+	/// <summary>
+	/// With --particles, two fountains simulated on the GPU, a step per tick.
+	/// With --validate-particles, mParticleReference runs the same steps on
+	/// the CPU into mReferenceParticles, timed, for comparing at exit.
+	/// </summary>
+	ParticleSystem	mParticles;
+	std::uint32_t	mParticleBudget					= 0;
+	bool			mValidateParticles				= false;
+	ParticleSimulation	mParticleReference;
+	std::vector<ParticleSimulation::Particle>	mReferenceParticles;
+	double			mReferenceMilliseconds			= 0.0;
+	/// <summary>
+	/// With --characters, that many copies of one skinned model standing on
+	/// the ground, posed by mAnimation and skinned in the vertex shader. The
+	/// model is --character's glTF file, or SkinnedModel's test character,
+	/// and its clips are compressed into mCharacterClips. Indexed by
+	/// transform, each object's first joint in the palette. Time spent
+	/// posing them, for the report at exit.
+	/// </summary>
+	AnimationSystem	mAnimation;
+	std::uint32_t	mCharacterCount					= 0;
+	SkinnedModel	mCharacterModel;
+	std::vector<AnimationClip>	mCharacterClips;
+	std::vector<std::uint32_t>	mObjectFirstJoints;
+	double			mAnimationMilliseconds			= 0.0;
+	int				mAnimationUpdateCount			= 0;
 };
 
+/// <summary>
+/// A mesh only refers to its transform, the data itself lives in App::mTransforms.
+/// </summary>
 struct Transform {
-	glm::mat4 mModelMatrix{ glm::mat4(1.0f) };
+	TransformHierarchy::Handle mHandle{ TransformHierarchy::InvalidHandle };
 };
 
 struct Mesh3D {
-	//VAO
-	GLuint mVertexArrayObject	= 0;
-	//VBO
-	GLuint mVertexBufferObject	= 0;
-	//IBO or EBO
-	//this is used to store the array of indices that we want to draw from, when we do indexed drawing.
-	GLuint mIndexBufferObject	= 0;
+	/// <summary>
+	/// Our vertices and indices (IBO i.e. EBO), as ranges in App::mMeshBuffers.
+	/// The VAO, VBO and IBO are shared with every mesh of the same vertex format.
+	/// </summary>
+	MeshBufferPool::Handle mGeometry = MeshBufferPool::InvalidHandle;
+	/// <summary>
+	/// Levels of detail, as ranges of mGeometry's indices; the first is the full mesh.
+	/// </summary>
+	std::vector<MeshLod::Lod> mLods;
+	/// <summary>
+	/// The first level of detail, split into clusters that are culled on their own.
+	/// </summary>
+	std::vector<Meshlets::Meshlet> mMeshlets;
+	/// <summary>
+	/// GL_CULL_FACE is off, so both sides of every triangle show unless this is set;
+	/// meshlets only get rejected for facing away when it is.
+	/// </summary>
+	bool mBackFaceCulled		= false;
+	/// <summary>
+	/// Never moves once placed, so shadow maps it alone is in can be kept.
+	/// </summary>
+	bool mStatic				= false;
+	/// <summary>
+	/// mGeometry is a copy of another mesh's, which owns and deletes it.
+	/// </summary>
+	bool mSharedGeometry		= false;
 
 	/// <summary>
-	///This is the graphic pipeline used for this mesh.
+	/// What this mesh is drawn with: the material's permutation and parameters.
 	/// </summary>
-	GLuint mPipeline			= 0;
+	MaterialSystem::Handle mMaterial = MaterialSystem::InvalidHandle;
+
+	/// <summary>
+	/// Between MeshCreate() and MeshFinishCreate(): our vertices then indices,
+	/// being uploaded by App::mResources, and what describes them.
+	/// </summary>
+	struct PendingGeometry {
+		ResourceWorker::Ticket	mUpload			= ResourceWorker::InvalidTicket;
+		VertexFormat			mFormat;
+		std::uint32_t			mVertexCount	= 0;
+		std::uint32_t			mIndexCount		= 0;
+	} mPendingGeometry;
 
 	Transform mTransform;
+	/// <summary>
+	/// Model space center (xyz) and radius (w) enclosing every vertex, for culling.
+	/// </summary>
+	glm::vec4 mBoundingSphere{ 0.0f };
 	float mURotate				= 0.0f;
 	float mUScale				= 0.5f;
 };
@@ -98,6 +388,12 @@ struct Mesh3D {
 App gApp; //Global application
 Mesh3D gMesh1;
 Mesh3D gMesh2;
+// Under the meshes with --shadows, for them to fall on.
+Mesh3D gGround;
+// With --characters, on the ground, furthest first; they all share the first one's geometry.
+std::vector<Mesh3D> gCharacters;
+// Every mesh in the scene, in the order they're drawn.
+std::vector<Mesh3D*> gSceneMeshes;
 
 GLuint CompileShader(GLuint type, const std::string& source)
 {
@@ -111,6 +407,10 @@ GLuint CompileShader(GLuint type, const std::string& source)
 	{
 		shaderObject = glCreateShader(GL_FRAGMENT_SHADER);
 	}
+	else if (type == GL_COMPUTE_SHADER)
+	{
+		shaderObject = glCreateShader(GL_COMPUTE_SHADER);
+	}
 
 	const char* src = source.c_str();
 	glShaderSource(shaderObject, 1, &src, nullptr);
@@ -134,6 +434,10 @@ GLuint CompileShader(GLuint type, const std::string& source)
 		{
 			std::cout << "ERROR: GL_FRAGMENT_SHADER compiliation failed!\n" << errorMessages << "\n";
 		}
+		else if (type == GL_COMPUTE_SHADER)
+		{
+			std::cout << "ERROR: GL_COMPUTE_SHADER compiliation failed!\n" << errorMessages << "\n";
+		}
 		delete[] errorMessages;
 		glDeleteShader(shaderObject);
 		return 0;
@@ -160,6 +464,190 @@ std::string LoadShaderAsString(const std::string& filename)
 	return result;
 }
 
+/// <summary>
+/// Puts 'defines' right after the #version line, which has to come first.
+/// </summary>
+std::string InsertDefines(const std::string& source, const std::string& defines)
+{
+	const std::size_t lineEnd = source.find('\n');
+	if (defines.empty() || lineEnd == std::string::npos)
+	{
+		return source;
+	}
+	return source.substr(0, lineEnd + 1) + defines + source.substr(lineEnd + 1);
+}
+
+/// <summary>
+/// Points a linked program's uniform blocks and samplers at the binding
+/// points and texture units every shader shares.
+/// </summary>
+void BindSharedSlots(GLuint program)
+{
+	// GLSL 4.10 can't set block bindings in the shader itself.
+	const GLuint perObjectIndex = glGetUniformBlockIndex(program, "PerObject");
+	if (perObjectIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program, perObjectIndex, PerObjectBinding);
+	}
+	const GLuint materialsIndex = glGetUniformBlockIndex(program, "Materials");
+	if (materialsIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program, materialsIndex, MaterialsBinding);
+	}
+	const GLuint lightingIndex = glGetUniformBlockIndex(program, "Lighting");
+	if (lightingIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program, lightingIndex, LightingBinding);
+	}
+	const GLuint shadowsIndex = glGetUniformBlockIndex(program, "Shadows");
+	if (shadowsIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program, shadowsIndex, ShadowsBinding);
+	}
+	const GLuint particlesIndex = glGetUniformBlockIndex(program, "Particles");
+	if (particlesIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program, particlesIndex, ParticlesBinding);
+	}
+	// Nor sampler units; these are set once, here.
+	const char* const lightingSamplers[ClusteredLighting::TextureUnitCount] = { "u_LightData", "u_ClusterLights", "u_LightIndices" };
+	for (GLuint i = 0; i < ClusteredLighting::TextureUnitCount; ++i)
+	{
+		const GLint location = glGetUniformLocation(program, lightingSamplers[i]);
+		if (location >= 0)
+		{
+			glProgramUniform1i(program, location, static_cast<GLint>(FirstLightingUnit + i));
+		}
+	}
+	const GLint shadowMapLocation = glGetUniformLocation(program, "u_ShadowMap");
+	if (shadowMapLocation >= 0)
+	{
+		glProgramUniform1i(program, shadowMapLocation, static_cast<GLint>(ShadowMapUnit));
+	}
+	const GLint skinPaletteLocation = glGetUniformLocation(program, "u_SkinPalette");
+	if (skinPaletteLocation >= 0)
+	{
+		glProgramUniform1i(program, skinPaletteLocation, static_cast<GLint>(SkinPaletteUnit));
+	}
+}
+
+/// <summary>
+/// Compiles and links a vertex and a fragment shader into a program.
+/// </summary>
+/// <param name="vertexShaderFile"></param>
+/// <param name="fragmentShaderFile"></param>
+/// <param name="defines">#define lines for both, see MaterialSystem::GetDefines()</param>
+/// <param name="fragmentChunkFile">shared code the fragment shader needs, put after the defines</param>
+/// <returns></returns>
+GLuint CreateGraphicsPipeline(const std::string& vertexShaderFile, const std::string& fragmentShaderFile, const std::string& defines = std::string(),
+	const std::string& fragmentChunkFile = std::string())
+{
+	//create shader program
+	const std::string vertexShaderSource = InsertDefines(LoadShaderAsString(vertexShaderFile), defines);
+	const std::string fragmentChunk = fragmentChunkFile.empty() ? std::string() : LoadShaderAsString(fragmentChunkFile);
+	const std::string fragmentShaderSource = InsertDefines(LoadShaderAsString(fragmentShaderFile), defines + fragmentChunk);
+
+	GLuint programObject = glCreateProgram();
+
+	GLuint myVertexShader = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
+	GLuint myFragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+	glAttachShader(programObject, myVertexShader);
+	glAttachShader(programObject, myFragmentShader);
+	glLinkProgram(programObject);
+	BindSharedSlots(programObject);
+
+	// validate our program
+	glValidateProgram(programObject);
+
+	// delete the individual shaders once we are done
+	glDetachShader(programObject, myVertexShader);
+	glDetachShader(programObject, myFragmentShader);
+
+	glDeleteShader(myVertexShader);
+	glDeleteShader(myFragmentShader);
+
+	return programObject;
+}
+
+/// <summary>
+/// Compiles and links a compute shader into a program of its own.
+/// Needs GL 4.3 (ARB_compute_shader).
+/// </summary>
+/// <param name="computeShaderFile"></param>
+/// <returns>0 if it didn't compile or link</returns>
+GLuint CreateComputePipeline(const std::string& computeShaderFile)
+{
+	const std::string computeShaderSource = LoadShaderAsString(computeShaderFile);
+
+	GLuint myComputeShader = CompileShader(GL_COMPUTE_SHADER, computeShaderSource);
+	if (myComputeShader == 0)
+	{
+		return 0;
+	}
+
+	GLuint programObject = glCreateProgram();
+	glAttachShader(programObject, myComputeShader);
+	glLinkProgram(programObject);
+
+	glDetachShader(programObject, myComputeShader);
+	glDeleteShader(myComputeShader);
+
+	// Dispatching a program that didn't link does nothing, and silently.
+	int result;
+	glGetProgramiv(programObject, GL_LINK_STATUS, &result);
+	if (result == GL_FALSE)
+	{
+		int length;
+		glGetProgramiv(programObject, GL_INFO_LOG_LENGTH, &length);
+		char* errorMessages = new char[length];
+		glGetProgramInfoLog(programObject, length, &length, errorMessages);
+		std::cout << "ERROR: compute program link failed!\n" << errorMessages << "\n";
+		delete[] errorMessages;
+		glDeleteProgram(programObject);
+		return 0;
+	}
+
+	return programObject;
+}
+
+/// <summary>
+/// Compiles a vertex shader alone and links it for transform feedback,
+/// capturing 'varyings' interleaved into one buffer. GL 4.1 has no compute
+/// shaders; this is how it runs a kernel over a buffer.
+/// </summary>
+/// <param name="vertexShaderFile"></param>
+/// <param name="varyings"></param>
+/// <param name="varyingCount"></param>
+/// <returns></returns>
+GLuint CreateTransformFeedbackPipeline(const std::string& vertexShaderFile, const char* const* varyings, GLsizei varyingCount)
+{
+	const std::string vertexShaderSource = LoadShaderAsString(vertexShaderFile);
+
+	GLuint programObject = glCreateProgram();
+
+	GLuint myVertexShader = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
+	glAttachShader(programObject, myVertexShader);
+	// Only takes effect at the next link.
+	glTransformFeedbackVaryings(programObject, varyingCount, varyings, GL_INTERLEAVED_ATTRIBS);
+	glLinkProgram(programObject);
+	BindSharedSlots(programObject);
+
+	glDetachShader(programObject, myVertexShader);
+	glDeleteShader(myVertexShader);
+
+	return programObject;
+}
+
+/// <summary>
+/// Builds one permutation of the material shaders, for App::mMaterials.
+/// </summary>
+/// <param name="defines">from MaterialSystem::GetDefines()</param>
+/// <returns></returns>
+GLuint CreateMaterialPipeline(const std::string& defines)
+{
+	return CreateGraphicsPipeline(".\\shaders\\vert.glsl", ".\\shaders\\frag.glsl", defines, ".\\shaders\\lighting.glsl");
+}
+
 /// <summary>
 /// Initialization: Setup the graphics program
 /// </summary>
@@ -195,6 +683,8 @@ void InitializeProgram(App* app)
 		exit(1);
 	}
 
+	using Clock = std::chrono::steady_clock;
+	const Clock::time_point contextStart = Clock::now();
 	app->mOpenGLContext = SDL_GL_CreateContext(app->mGraphicsApplicationWindow);
 
 	if (nullptr == app->mOpenGLContext)
@@ -203,213 +693,1537 @@ void InitializeProgram(App* app)
 		exit(1);
 	}
 
-	if (!gladLoadGLLoader(SDL_GL_GetProcAddress))
+	// Lazily, only the functions we call get looked up, when we first call them.
+	const Clock::time_point loaderStart = Clock::now();
+	const int loaded = app->mEagerGLLoading
+		? gladLoadGLLoader(SDL_GL_GetProcAddress)
+		: gladLoadGLLoaderLazy(SDL_GL_GetProcAddress);
+	if (!loaded)
 	{
 		printf("glad was not initialized\n");
 		exit(1);
 	}
+	const Clock::time_point loaderEnd = Clock::now();
+	printf("OpenGL context: %.2f ms, %s function loading: %.2f ms\n",
+		std::chrono::duration<double, std::milli>(loaderStart - contextStart).count(),
+		app->mEagerGLLoading ? "eager" : "lazy",
+		std::chrono::duration<double, std::milli>(loaderEnd - loaderStart).count());
 
 	printf("Vendor: %s\n", glGetString(GL_VENDOR));
 	printf("Renderer: %s\n", glGetString(GL_RENDERER));
 	printf("Version: %s\n", glGetString(GL_VERSION));
 	printf("Shading Language: %s\n", glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+	// Pick the SIMD paths up front so the report shows what will actually run.
+	MatrixKernels::Reselect();
+	CpuDispatch::PrintReport();
 }
 
 /// <summary>
 /// vertex specification: Setup our geometry
 /// </summary>
 /// <param name="mesh"></param>
-void MeshCreate(Mesh3D* mesh)
+/// <param name="subdivisions">Cells along each side. With more than one
+/// the quad is a grid that looks the same, but has enough triangles for
+/// levels of detail and meshlets.</param>
+void MeshCreate(Mesh3D* mesh, int subdivisions = 1)
 {
-	//lives on CPU
-	const std::vector<GLfloat> vertexData
-	{
-		// 0 - vertex
-	   -0.5f, -0.5f, 0.0f, //left vertex position
-		1.0f,  0.0f, 0.0f, //color
-		// 1 - vertex
-		0.5f, -0.5f, 0.0f, //right vertex position
-		0.0f,  1.0f, 0.0f, //color
-		// 2 - vertex
-	   -0.5f,  0.5f, 0.0f, //top-left vertext position
-		0.0f,  0.0f, 1.0f, //color
-		// 3 - vertex
-		0.5f,  0.5f, 0.0f, //top-right vertex position
-		0.0f,  0.0f, 1.0f, //color
-	};
-
-	//we start setting things up on the GPU
-	glGenVertexArrays(1, &mesh->mVertexArrayObject);
-	glBindVertexArray(mesh->mVertexArrayObject);
-
-	glGenBuffers(1, &mesh->mVertexBufferObject);
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->mVertexBufferObject);
-	glBufferData(
-		GL_ARRAY_BUFFER,
-		vertexData.size() * sizeof(GLfloat),
-		vertexData.data(),
-		GL_STATIC_DRAW
-	);
+	mesh->mTransform.mHandle = gApp.mTransforms.Create();
 
-	const std::vector<GLuint> indexBufferData{ 2,0,1, 3,2,1 };
+	//lives on CPU
+	// The corners: red bottom-left, green bottom-right, blue on top. Each
+	// half of the quad blends its three corners, so a grid vertex gets the
+	// color the half it's in would have there.
+	const glm::vec3 red(1.0f, 0.0f, 0.0f);
+	const glm::vec3 green(0.0f, 1.0f, 0.0f);
+	const glm::vec3 blue(0.0f, 0.0f, 1.0f);
+	std::vector<GLfloat> vertexData;
+	vertexData.reserve((subdivisions + 1) * (subdivisions + 1) * 6);
+	for (int row = 0; row <= subdivisions; ++row)
+	{
+		for (int column = 0; column <= subdivisions; ++column)
+		{
+			const float u = static_cast<float>(column) / subdivisions;
+			const float v = static_cast<float>(row) / subdivisions;
+			const glm::vec3 color = (column + row <= subdivisions)
+				? red * (1.0f - u - v) + green * u + blue * v
+				: blue + (green - blue) * (1.0f - v);
+			vertexData.insert(vertexData.end(), { u - 0.5f, v - 0.5f, 0.0f, color.r, color.g, color.b });
+		}
+	}
 
-	//setup the index (element) buffer object (IBO i.e. EBO)
-	glGenBuffers(1, &mesh->mIndexBufferObject);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->mIndexBufferObject);
+	// Every cell is split top-left to bottom-right like the whole quad, so
+	// no triangle straddles the two halves.
+	std::vector<GLuint> indexBufferData;
+	indexBufferData.reserve(subdivisions * subdivisions * 6);
+	for (int row = 0; row < subdivisions; ++row)
+	{
+		for (int column = 0; column < subdivisions; ++column)
+		{
+			const GLuint bottomLeft = row * (subdivisions + 1) + column;
+			const GLuint bottomRight = bottomLeft + 1;
+			const GLuint topLeft = bottomLeft + subdivisions + 1;
+			const GLuint topRight = topLeft + 1;
+			indexBufferData.insert(indexBufferData.end(), { topLeft, bottomLeft, bottomRight, topRight, topLeft, bottomRight });
+		}
+	}
 
-	//populate our index buffer
-	glBufferData(
-		GL_ELEMENT_ARRAY_BUFFER,
-		indexBufferData.size() * sizeof(GLuint),
-		indexBufferData.data(),
-		GL_STATIC_DRAW
-	);
+	// linking up the attributes: position, then r,g,b
+	VertexFormat format;
+	format.mStride = sizeof(GLfloat) * 6;
+	format.mAttributes = {
+		{ 0, 3, GL_FLOAT, GL_FALSE, 0 },
+		{ 1, 3, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 3 },
+	};
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(
-		0,
-		3,
-		GL_FLOAT,
-		false,
-		sizeof(GLfloat) * 6,//stribe
-		(void*)0
-	);
+	// The sphere around the bounding box is good enough for culling.
+	glm::vec3 boundsMin(vertexData[0], vertexData[1], vertexData[2]);
+	glm::vec3 boundsMax = boundsMin;
+	for (std::size_t i = 0; i < vertexData.size(); i += 6)
+	{
+		const glm::vec3 position(vertexData[i], vertexData[i + 1], vertexData[i + 2]);
+		boundsMin = glm::min(boundsMin, position);
+		boundsMax = glm::max(boundsMax, position);
+	}
+	mesh->mBoundingSphere = glm::vec4((boundsMin + boundsMax) * 0.5f, glm::length(boundsMax - boundsMin) * 0.5f);
+
+	// Simpler versions of the mesh go after its own indices.
+	mesh->mLods = MeshLod::BuildChain(vertexData.data(), static_cast<std::uint32_t>(vertexData.size() / 6), 6, &indexBufferData);
+	// The full detail indices get regrouped into meshlets; the other levels don't change.
+	mesh->mMeshlets = Meshlets::Build(vertexData.data(), static_cast<std::uint32_t>(vertexData.size() / 6), 6,
+		indexBufferData.data(), mesh->mLods[0].mIndexCount);
+
+	//we start setting things up on the GPU, off the main thread: both go in
+	//one buffer, which MeshFinishCreate() copies into the mesh arena
+	std::vector<char> geometry(vertexData.size() * sizeof(GLfloat) + indexBufferData.size() * sizeof(GLuint));
+	memcpy(geometry.data(), vertexData.data(), vertexData.size() * sizeof(GLfloat));
+	memcpy(geometry.data() + vertexData.size() * sizeof(GLfloat), indexBufferData.data(), indexBufferData.size() * sizeof(GLuint));
+
+	mesh->mPendingGeometry.mUpload = gApp.mResources.CreateBuffer(geometry.data(), static_cast<GLsizeiptr>(geometry.size()));
+	mesh->mPendingGeometry.mFormat = format;
+	mesh->mPendingGeometry.mVertexCount = static_cast<std::uint32_t>(vertexData.size() / 6);
+	mesh->mPendingGeometry.mIndexCount = static_cast<std::uint32_t>(indexBufferData.size());
+}
 
-	// linking up the attributes in our VAO
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(
-		1,
-		3, //r,g,b
-		GL_FLOAT,
-		false,
-		sizeof(GLfloat) * 6,
-		(GLvoid*)(sizeof(GLfloat) * 3)
-	);
+/// <summary>
+/// MeshCreate() for a skinned model: its vertices go up as they are, joints
+/// and weights included, for the SKINNED permutations. The bounding sphere
+/// encloses every frame of its clips, since the CPU never sees the skinned
+/// vertices, and there are no meshlets: their cones would only hold for
+/// the bind pose.
+/// </summary>
+void SkinnedMeshCreate(Mesh3D* mesh, const SkinnedModel& model)
+{
+	mesh->mTransform.mHandle = gApp.mTransforms.Create();
+
+	VertexFormat format;
+	format.mStride = sizeof(SkinnedVertex);
+	format.mAttributes = {
+		{ 0, 3, GL_FLOAT, GL_FALSE, offsetof(SkinnedVertex, mPosition) },
+		{ 1, 3, GL_FLOAT, GL_FALSE, offsetof(SkinnedVertex, mColor) },
+		{ JointsLocation, 4, GL_UNSIGNED_BYTE, GL_FALSE, offsetof(SkinnedVertex, mJoints) },
+		{ WeightsLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(SkinnedVertex, mWeights) },
+	};
+	mesh->mBoundingSphere = model.ComputeBoundingSphere();
+
+	// Simplifying only ever moves a vertex onto another, so the levels keep
+	// using the same vertices and their joints.
+	std::vector<GLuint> indexBufferData = model.mIndices;
+	const std::vector<float> positionsAndColors = model.GetPositionsAndColors();
+	mesh->mLods = MeshLod::BuildChain(positionsAndColors.data(), static_cast<std::uint32_t>(model.mVertices.size()), 6, &indexBufferData);
+
+	const std::size_t vertexBytes = model.mVertices.size() * sizeof(SkinnedVertex);
+	std::vector<char> geometry(vertexBytes + indexBufferData.size() * sizeof(GLuint));
+	memcpy(geometry.data(), model.mVertices.data(), vertexBytes);
+	memcpy(geometry.data() + vertexBytes, indexBufferData.data(), indexBufferData.size() * sizeof(GLuint));
+
+	mesh->mPendingGeometry.mUpload = gApp.mResources.CreateBuffer(geometry.data(), static_cast<GLsizeiptr>(geometry.size()));
+	mesh->mPendingGeometry.mFormat = format;
+	mesh->mPendingGeometry.mVertexCount = static_cast<std::uint32_t>(model.mVertices.size());
+	mesh->mPendingGeometry.mIndexCount = static_cast<std::uint32_t>(indexBufferData.size());
+}
 
-	glBindVertexArray(0);
-	glDisableVertexAttribArray(0);
-	glDisableVertexAttribArray(1);
+/// <summary>
+/// Moves the geometry MeshCreate() uploaded into App::mMeshBuffers. This is
+/// the part that has to happen on the main thread: the arena's VAO only
+/// exists in the main context.
+/// </summary>
+void MeshFinishCreate(Mesh3D* mesh)
+{
+	Mesh3D::PendingGeometry& pending = mesh->mPendingGeometry;
+	GLuint upload = gApp.mResources.Take(pending.mUpload);
+	mesh->mGeometry = gApp.mMeshBuffers.CreateFromBuffer(pending.mFormat, upload, pending.mVertexCount, pending.mIndexCount);
+	glDeleteBuffers(1, &upload);
+	if (mesh->mGeometry == MeshBufferPool::InvalidHandle)
+	{
+		printf("Mesh buffers could not grow to fit %u vertices and %u indices.\n", pending.mVertexCount, pending.mIndexCount);
+		exit(1);
+	}
+	pending = Mesh3D::PendingGeometry();
 }
 
 void MeshDelete(Mesh3D* mesh)
 {
-	glDeleteBuffers(1, &mesh->mVertexBufferObject);
-	glDeleteVertexArrays(1, &mesh->mVertexArrayObject);
+	if (!mesh->mSharedGeometry)
+	{
+		gApp.mMeshBuffers.Destroy(mesh->mGeometry);
+	}
+	mesh->mGeometry = MeshBufferPool::InvalidHandle;
 }
 
 /// <summary>
-/// MeshSetPipeline
-/// Needs to set the graphic pipeline before we draw. 
+/// The level of detail to draw the mesh at this frame, picked by how big
+/// its error would look from the camera.
 /// </summary>
-/// <param name="pipeline"></param>
-/// <param name=""></param>
-void MeshSetPipeline(Mesh3D* mesh, GLuint pipeline)
+MeshBufferPool::DrawRange MeshGetLodRange(Mesh3D* mesh)
 {
-	mesh->mPipeline = pipeline;
+	const std::size_t level = MeshLod::Select(
+		mesh->mLods,
+		gApp.mModelViewProjections[mesh->mTransform.mHandle],
+		mesh->mBoundingSphere,
+		static_cast<float>(gApp.mScreenHeight),
+		gApp.mLodPixelThreshold
+	);
+	MeshBufferPool::DrawRange range = gApp.mMeshBuffers.GetDrawRange(mesh->mGeometry);
+	range.mFirstIndex += mesh->mLods[level].mFirstIndex;
+	range.mIndexCount = static_cast<GLsizei>(mesh->mLods[level].mIndexCount);
+	return range;
 }
 
 /// <summary>
-/// Draw Mesh
-/// 
-/// Note: We per mesh, choose the graphics pipleine that we want to use.
-/// Generally, this is not very efficient, to 'change state' (pipelines)
-/// very frequently. (But, for learning purposes or flexibility, this is useful)
+/// What to draw of the mesh this frame: its level of detail, or when that's
+/// the full mesh, only the meshlets that can be seen. Points into
+/// App::mVisibleMeshlets, so it's only good until the next call.
 /// </summary>
-void DrawMesh(Mesh3D* mesh)
+const std::vector<MeshBufferPool::DrawRange>& MeshGetDrawRanges(Mesh3D* mesh)
 {
-	if (mesh == nullptr)
+	std::vector<MeshBufferPool::DrawRange>& ranges = gApp.mVisibleMeshlets;
+	ranges.clear();
+	const MeshBufferPool::DrawRange lod = MeshGetLodRange(mesh);
+	const MeshBufferPool::DrawRange full = gApp.mMeshBuffers.GetDrawRange(mesh->mGeometry);
+	if (!gApp.mUseMeshletCulling || mesh->mMeshlets.size() < 2 || lod.mFirstIndex != full.mFirstIndex)
 	{
-		return;
+		ranges.push_back(lod);
+		return ranges;
 	}
 
-	// Setup which graphics pipeline we are going to use
-	glUseProgram(mesh->mPipeline);
-
-	glUniformMatrix4fv(
-		FindUniformLocation(gApp.mGraphicsPipelineShaderProgram, "u_ModelMatrix"),
-		1,
-		false,
-		&mesh->mTransform.mModelMatrix[0][0]
-	);
-
-	//NOTE: Often times we combine the model and the view matrix together to just send in 1 uniform.
-	//Updating our view matrix
+	std::vector<Meshlets::Range>& visible = gApp.mVisibleMeshletRanges;
+	Meshlets::Cull(mesh->mMeshlets, gApp.mModelViewProjections[mesh->mTransform.mHandle], mesh->mBackFaceCulled, &visible);
+	for (const Meshlets::Range& meshletRange : visible)
 	{
-		glm::mat4 view = gApp.mCamera.GetViewMatrix();
-		glUniformMatrix4fv(
-			FindUniformLocation(gApp.mGraphicsPipelineShaderProgram, "u_ViewMatrix"),
-			1,
-			false,
-			&view[0][0]
-		);
+		MeshBufferPool::DrawRange range = full;
+		range.mFirstIndex += meshletRange.mFirstIndex;
+		range.mIndexCount = static_cast<GLsizei>(meshletRange.mIndexCount);
+		ranges.push_back(range);
 	}
+	return ranges;
+}
 
-	//Updating our projection matrix (in perspective)
+/// <summary>
+/// Asks for as much of the scene texture as the mesh shows: about one
+/// texel per pixel across its bounding sphere.
+/// </summary>
+void MeshRequestTextureDetail(Mesh3D* mesh)
+{
+	if (gApp.mSceneTexture == TextureManager::InvalidHandle)
 	{
-		glm::mat4 perspective = gApp.mCamera.GetProjectionMatrix();
-
-		// Retrieve our location of our perspective matrix uniform
-		glUniformMatrix4fv(
-			FindUniformLocation(gApp.mGraphicsPipelineShaderProgram, "u_Projection"),
-			1,
-			false,
-			&perspective[0][0]
-		);
+		return;
 	}
-
-	glBindVertexArray(mesh->mVertexArrayObject);
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->mVertexBufferObject);
-	//glDrawArrays(GL_TRIANGLES, 0, 6);
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-	// stop using our current graphics pipeline
-	// Note: this is not necessary if we only have one graphics pipeline.
-	glUseProgram(0);
+	const glm::mat4& modelViewProjection = gApp.mModelViewProjections[mesh->mTransform.mHandle];
+	const glm::vec4 center = modelViewProjection * glm::vec4(glm::vec3(mesh->mBoundingSphere), 1.0f);
+	// The y row carries the projection's focal length and the model's scale.
+	const float scale = glm::length(glm::vec3(modelViewProjection[0][1], modelViewProjection[1][1], modelViewProjection[2][1]));
+	const float diameter = 2.0f * mesh->mBoundingSphere.w;
+	const float pixels = (center.w > mesh->mBoundingSphere.w)
+		? diameter * scale / center.w * 0.5f * static_cast<float>(gApp.mScreenHeight)
+		: static_cast<float>(gApp.mScreenHeight);
+	gApp.mTextures.RequestLevel(gApp.mSceneTexture, TextureManager::GetDesiredLevel(
+		gApp.mTextures.GetWidth(gApp.mSceneTexture), gApp.mTextures.GetHeight(gApp.mSceneTexture), pixels));
 }
 
 /// <summary>
-/// Translates a mesh -- updating the model matrix.
+/// The scene texture, or the white one while it isn't loaded (or failed to).
 /// </summary>
-/// <param name="mesh"></param>
-/// <param name="x"></param>
-/// <param name="y"></param>
-/// <param name="z"></param>
-void MeshTranslate(Mesh3D* mesh, float x, float y, float z)
+GLuint GetSceneTexture()
 {
-	mesh->mURotate -= 0.01f;
-	std::cout << "gURotate: " << mesh->mURotate << std::endl;
-	mesh->mTransform.mModelMatrix = glm::translate(mesh->mTransform.mModelMatrix,glm::vec3(x,y,z));
-	// Retrive our location of our Model Matrix
+	if (gApp.mSceneTexture != TextureManager::InvalidHandle && gApp.mTextures.GetTexture(gApp.mSceneTexture) != 0)
+	{
+		return gApp.mTextures.GetTexture(gApp.mSceneTexture);
+	}
+	return gApp.mTextures.GetTexture(gApp.mWhiteTexture);
 }
 
 /// <summary>
-/// Rotates a mesh about an arbitrary axis.
+/// Binds what the shaders sample to unit 0: the atlas with --atlas, else
+/// GetSceneTexture().
 /// </summary>
-/// <param name="mesh"></param>
-/// <param name="angle"></param>
-/// <param name="axis"></param>
-void MeshRotate(Mesh3D* mesh, float angle, glm::vec3 axis)
+void BindSceneTexture()
 {
-	//Model transformation by translating our object into world space.
-	mesh->mTransform.mModelMatrix = glm::rotate(mesh->mTransform.mModelMatrix, glm::radians(angle), axis);
+	if (gApp.mUseAtlas)
+	{
+		glBindTexture(GL_TEXTURE_2D_ARRAY, gApp.mAtlas.GetTexture());
+	}
+	else
+	{
+		glBindTexture(GL_TEXTURE_2D, GetSceneTexture());
+	}
 }
 
 /// <summary>
-/// Scales a mesh by a given scale factor.
+/// Gives the mesh 'image' as its texture in the atlas.
 /// </summary>
-/// <param name="mesh"></param>
-/// <param name="scale"></param>
-void MeshScale(Mesh3D* mesh, glm::vec3 scale)
+bool MeshSetAtlasTexture(Mesh3D* mesh, const ImageLoader::Level& image)
 {
-	mesh->mTransform.mModelMatrix = glm::scale(mesh->mTransform.mModelMatrix, scale);
+	TextureArrayAtlas::Entry entry;
+	if (!gApp.mAtlas.Add(image, &entry))
+	{
+		return false;
+	}
+	const TransformHierarchy::Handle handle = mesh->mTransform.mHandle;
+	if (gApp.mAtlasEntries.size() <= handle)
+	{
+		gApp.mAtlasEntries.resize(handle + 1);
+	}
+	gApp.mAtlasEntries[handle] = entry;
+	return true;
 }
 
-int main(int argc, char* args[])
+/// <summary>
+/// MeshSetMaterial
+/// Needs to set the material, and so the graphic pipeline, before we draw.
+/// </summary>
+/// <param name="mesh"></param>
+/// <param name="material"></param>
+void MeshSetMaterial(Mesh3D* mesh, MaterialSystem::Handle material)
+{
+	mesh->mMaterial = material;
+	const TransformHierarchy::Handle handle = mesh->mTransform.mHandle;
+	if (gApp.mObjectMaterials.size() <= handle)
+	{
+		gApp.mObjectMaterials.resize(handle + 1, 0);
+	}
+	gApp.mObjectMaterials[handle] = material;
+}
+
+/// <summary>
+/// Whether the materials are shaded by lights: the point lights of
+/// --lights, or the sun of --shadows.
+/// </summary>
+bool IsSceneLit()
+{
+	return !gApp.mLights.empty() || gApp.mUseShadows;
+}
+
+/// <summary>
+/// What a draw path adds to every material's features: Instanced on the
+/// indirect paths, GBuffer when shading deferred.
+/// </summary>
+std::uint32_t GetPathFeatures(bool instanced, bool deferred)
+{
+	return (instanced ? static_cast<std::uint32_t>(MaterialSystem::Instanced) : 0u)
+		| (deferred ? static_cast<std::uint32_t>(MaterialSystem::GBuffer) : 0u);
+}
+
+/// <summary>
+/// Draw Mesh
+/// 
+/// Note: We per mesh, choose the graphics pipleine that we want to use.
+/// Generally, this is not very efficient, to 'change state' (pipelines)
+/// very frequently. (But, for learning purposes or flexibility, this is useful)
+/// </summary>
+void DrawMesh(Mesh3D* mesh)
+{
+	if (mesh == nullptr)
+	{
+		return;
+	}
+
+	// Setup which graphics pipeline we are going to use: our material's permutation.
+	glUseProgram(gApp.mMaterials.GetProgram(mesh->mMaterial, GetPathFeatures(false, gApp.mUseDeferred)));
+	BindSceneTexture();
+
+	// The model, view and projection matrices were already combined for
+	// every mesh at once and written to this frame's ring buffer region
+	// (see the main loop), so we only point the uniform block at ours.
+	glBindBufferRange(
+		GL_UNIFORM_BUFFER,
+		PerObjectBinding,
+		gApp.mFrameData.GetBuffer(),
+		gApp.mPerObjectOffset + mesh->mTransform.mHandle * gApp.mPerObjectStride,
+		sizeof(PerObjectData)
+	);
+
+	// Binds the shared VAO and draws our ranges of it with glDrawElementsBaseVertex.
+	for (const MeshBufferPool::DrawRange& range : MeshGetDrawRanges(mesh))
+	{
+		MeshBufferPool::Draw(range);
+	}
+
+	// stop using our current graphics pipeline
+	// Note: this is not necessary if we only have one graphics pipeline.
+	glUseProgram(0);
+}
+
+/// <summary>
+/// Queues a mesh for DrawOpaquePassIndirect(), instead of calling DrawMesh(),
+/// for forward or for deferred shading. Must happen before this frame's
+/// streaming buffer is committed.
+/// </summary>
+void MeshQueueIndirect(Mesh3D* mesh, bool deferred)
+{
+	// baseInstance is our transform, which is also where our matrix is in this frame's per-object data.
+	const GLuint program = gApp.mMaterials.GetProgram(mesh->mMaterial, GetPathFeatures(true, deferred));
+	IndirectDrawList& draws = deferred ? gApp.mGBufferDraws : gApp.mOpaqueDraws;
+	for (const MeshBufferPool::DrawRange& range : MeshGetDrawRanges(mesh))
+	{
+		draws.Add(range, mesh->mTransform.mHandle, program);
+	}
+}
+
+/// <summary>
+/// Draws every queued mesh with a single glMultiDrawElementsIndirect per
+/// vertex array and permutation, so thousands of meshes cost a handful of
+/// API calls.
+/// </summary>
+void DrawOpaquePassIndirect()
+{
+	BindSceneTexture();
+
+	// The per-object blocks double as instanced vertex data here.
+	IndirectDrawList& draws = gApp.mUseDeferred ? gApp.mGBufferDraws : gApp.mOpaqueDraws;
+	draws.SetInstanceMatrices(
+		InstanceMatrixLocation,
+		InstanceVectorCount,
+		gApp.mFrameData.GetBuffer(),
+		gApp.mPerObjectOffset,
+		static_cast<GLsizei>(gApp.mPerObjectStride)
+	);
+	draws.Submit();
+
+	glUseProgram(0);
+}
+
+/// <summary>
+/// Registers a mesh with the GPU culling pass. Unlike MeshQueueIndirect()
+/// this only has to happen again when the mesh's geometry moves. The
+/// compute shader culls whole meshes, not their meshlets.
+/// </summary>
+void MeshRegisterGpuCulling(Mesh3D* mesh)
+{
+	gApp.mGpuCulling.Add(gApp.mMeshBuffers.GetDrawRange(mesh->mGeometry), mesh->mBoundingSphere, mesh->mTransform.mHandle, mesh->mLods,
+		gApp.mMaterials.GetProgram(mesh->mMaterial, GetPathFeatures(true, gApp.mUseDeferred)));
+}
+
+/// <summary>
+/// Registers every mesh with the GPU culling pass again, once they moved
+/// or the permutations they draw with changed.
+/// </summary>
+void RegisterGpuCullingDraws()
+{
+	gApp.mGpuCulling.Clear();
+	for (Mesh3D* mesh : gSceneMeshes)
+	{
+		MeshRegisterGpuCulling(mesh);
+	}
+}
+
+/// <summary>
+/// Culls every registered mesh on the GPU and draws the survivors, without
+/// the CPU ever seeing which ones they were.
+/// </summary>
+void DrawOpaquePassGpuCulled()
+{
+	gApp.mGpuCulling.Cull(
+		gApp.mFrameData.GetBuffer(),
+		gApp.mPerObjectOffset,
+		gApp.mPerObjectStride,
+		static_cast<GLsizeiptr>(gApp.mModelViewProjections.size())
+	);
+	if (gApp.mValidateCulling)
+	{
+		gApp.mGpuCulling.Validate(gApp.mModelViewProjections, &gApp.mCullingValidation);
+	}
+
+	// Culling uses texture unit 0 for the depth pyramid, so bind ours after.
+	BindSceneTexture();
+	gApp.mGpuCulling.Submit(InstanceMatrixLocation, InstanceVectorCount);
+	glUseProgram(0);
+}
+
+/// <summary>
+/// Prints which of the paths above draws the opaque pass.
+/// </summary>
+void PrintOpaquePassMode()
+{
+	if (gApp.mUseGpuCulling)
+	{
+		printf("Opaque pass: GPU culling + %s\n", GLAD_GL_ARB_indirect_parameters ? "glMultiDrawElementsIndirectCountARB" : "glMultiDrawElementsIndirect");
+	}
+	else
+	{
+		printf("Opaque pass: %s\n", gApp.mUseIndirectDraws ? "glMultiDrawElementsIndirect" : "one draw per mesh");
+	}
+}
+
+/// <summary>
+/// Prints how the GPU culling agreed with the CPU's, with --validate-culling.
+/// </summary>
+void PrintCullingValidation()
+{
+	const GpuCulling::Validation& validation = gApp.mCullingValidation;
+	if (!gApp.mValidateCulling || validation.mCulls == 0)
+	{
+		return;
+	}
+	const bool passed = validation.mMismatches == 0;
+	printf("Culling validation: %llu culls of %llu draws, %llu visible on the GPU, %llu on the CPU (%llu occluded), %llu borderline, %llu mismatched: %s\n",
+		static_cast<unsigned long long>(validation.mCulls),
+		static_cast<unsigned long long>(validation.mDraws),
+		static_cast<unsigned long long>(validation.mVisible),
+		static_cast<unsigned long long>(validation.mReferenceVisible),
+		static_cast<unsigned long long>(validation.mOccluded),
+		static_cast<unsigned long long>(validation.mBorderline),
+		static_cast<unsigned long long>(validation.mMismatches),
+		passed ? "passed" : "FAILED");
+}
+
+/// <summary>
+/// Switches between forward and deferred shading. The GPU culling pass has
+/// the programs in its records, so those are made again, and its depth
+/// pyramid is of the other path's last frame, if any, so it's dropped.
+/// </summary>
+void SetDeferredShading(bool deferred)
+{
+	if (!gApp.mDeferred.IsCreated() || deferred == gApp.mUseDeferred)
+	{
+		return;
+	}
+	gApp.mUseDeferred = deferred;
+	if (GpuCulling::IsSupported())
+	{
+		RegisterGpuCullingDraws();
+		gApp.mGpuCulling.SetOcclusionEnabled(false);
+	}
+}
+
+/// <summary>
+/// Prints which of forward and deferred shading is in use.
+/// </summary>
+void PrintShadingMode()
+{
+	if (gApp.mUseDeferred)
+	{
+		printf("Shading: deferred, %.2f MiB G-buffer\n", gApp.mDeferred.GetMemoryBytes() / (1024.0 * 1024.0));
+	}
+	else
+	{
+		printf("Shading: forward\n");
+	}
+}
+
+/// <summary>
+/// Clears the screen to our background.
+/// </summary>
+void ClearScreen()
+{
+	// Disable depth test and face culling.
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_CULL_FACE);
+
+	// Initialize clear color
+	// This is the background of the screen.
+	glViewport(0, 0, gApp.mScreenWidth, gApp.mScreenHeight);
+	glClearColor(1.f, 1.f, 0.1f, 1.f);
+
+	// Clear the color and depth buffers.
+	glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+}
+
+/// <summary>
+/// Draws the opaque meshes with whichever path is enabled, and with
+/// deferred shading, lights what they left in the G-buffer. Its depth is
+/// what the GPU culling tests the next frame against; the forward path's
+/// is the window's, which compute shaders can't read.
+/// </summary>
+void DrawScene()
+{
+	if (gApp.mUseDeferred)
+	{
+		gApp.mDeferred.BeginGeometryPass();
+	}
+
+	if (gApp.mUseGpuCulling)
+	{
+		DrawOpaquePassGpuCulled();
+	}
+	else if (gApp.mUseIndirectDraws)
+	{
+		DrawOpaquePassIndirect();
+	}
+	else
+	{
+		for (Mesh3D* mesh : gSceneMeshes)
+		{
+			DrawMesh(mesh);
+		}
+	}
+
+	if (gApp.mUseDeferred)
+	{
+		gApp.mDeferred.Shade(0);
+		if (gApp.mUseGpuCulling)
+		{
+			gApp.mGpuCulling.BuildDepthPyramid(gApp.mDeferred.GetTexture(DeferredShading::DepthTarget), gApp.mDeferred.GetWidth(), gApp.mDeferred.GetHeight());
+			gApp.mGpuCulling.SetOcclusionEnabled(true);
+		}
+	}
+}
+
+/// <summary>
+/// DrawScene() twice, the other shading first so the one in use ends up
+/// on screen. Each is timed with a GL_TIME_ELAPSED query, and on the CPU
+/// from the first call to glFinish() returning (software rasterizers only
+/// draw once flushed, which the query can miss), then read back, and the
+/// two pictures compared. Everything waits for the GPU; this is for
+/// measuring, not for playing.
+/// </summary>
+void DrawSceneCompared()
+{
+	using Clock = std::chrono::steady_clock;
+	const bool selected = gApp.mUseDeferred;
+	if (gApp.mRenderPathQueries[0] == 0)
+	{
+		glGenQueries(2, gApp.mRenderPathQueries);
+	}
+
+	std::vector<std::uint8_t> pictures[2];
+	for (const bool deferred : { !selected, selected })
+	{
+		SetDeferredShading(deferred);
+		ClearScreen();
+
+		const int path = deferred ? 1 : 0;
+		glFinish();
+		const Clock::time_point start = Clock::now();
+		glBeginQuery(GL_TIME_ELAPSED, gApp.mRenderPathQueries[path]);
+		DrawScene();
+		glEndQuery(GL_TIME_ELAPSED);
+		glFinish();
+		gApp.mRenderPathFinishMilliseconds[path] += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		pictures[path].resize(static_cast<std::size_t>(gApp.mScreenWidth) * gApp.mScreenHeight * 4);
+		glReadPixels(0, 0, gApp.mScreenWidth, gApp.mScreenHeight, GL_RGBA, GL_UNSIGNED_BYTE, pictures[path].data());
+
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(gApp.mRenderPathQueries[path], GL_QUERY_RESULT, &nanoseconds);
+		gApp.mRenderPathGpuMilliseconds[path] += nanoseconds / 1000000.0;
+	}
+
+	for (std::size_t pixel = 0; pixel < pictures[0].size(); pixel += 4)
+	{
+		int difference = 0;
+		for (std::size_t channel = pixel; channel < pixel + 3; ++channel)
+		{
+			difference = std::max(difference, std::abs(pictures[0][channel] - pictures[1][channel]));
+		}
+		gApp.mMaxPixelDifference = std::max(gApp.mMaxPixelDifference, difference);
+		// Off by more than rounding.
+		gApp.mDifferentPixels += (difference > 2) ? 1 : 0;
+	}
+	++gApp.mComparedFrames;
+}
+
+/// <summary>
+/// What --compare-render-paths found, per frame on average.
+/// </summary>
+void PrintRenderPathComparison()
+{
+	if (gApp.mComparedFrames == 0)
+	{
+		return;
+	}
+	const char* const names[2] = { "forward", "deferred" };
+	for (int path = 0; path < 2; ++path)
+	{
+		printf("%-8s shading: %.3f ms GPU query, %.3f ms until finished, per frame\n", names[path],
+			gApp.mRenderPathGpuMilliseconds[path] / gApp.mComparedFrames,
+			gApp.mRenderPathFinishMilliseconds[path] / gApp.mComparedFrames);
+	}
+	printf("Pictures over %d frames: at most %d apart in a channel, %.3f%% of pixels more than 2 apart\n",
+		gApp.mComparedFrames, gApp.mMaxPixelDifference,
+		100.0 * gApp.mDifferentPixels / (static_cast<double>(gApp.mComparedFrames) * gApp.mScreenWidth * gApp.mScreenHeight));
+}
+
+/// <summary>
+/// Fits the shadow cascades to this frame's view and hands them to the
+/// shaders. Every scene mesh casts, with its bounding sphere in world space.
+/// </summary>
+void UpdateShadows(const Camera& camera)
+{
+	const glm::vec3 sunDirection(-0.4f, -1.0f, -0.3f);
+	const glm::vec3 sunColor(0.9f, 0.85f, 0.75f);
+
+	const glm::mat4* world = gApp.mTransforms.GetWorldMatrices();
+	gApp.mShadowCasters.resize(gSceneMeshes.size());
+	for (std::size_t i = 0; i < gSceneMeshes.size(); ++i)
+	{
+		const Mesh3D* mesh = gSceneMeshes[i];
+		const glm::mat4& matrix = world[mesh->mTransform.mHandle];
+		const float scale = std::max(glm::length(glm::vec3(matrix[0])), std::max(glm::length(glm::vec3(matrix[1])), glm::length(glm::vec3(matrix[2]))));
+		gApp.mShadowCasters[i].mBoundingSphere = glm::vec4(glm::vec3(matrix * glm::vec4(glm::vec3(mesh->mBoundingSphere), 1.0f)), mesh->mBoundingSphere.w * scale);
+		gApp.mShadowCasters[i].mStatic = mesh->mStatic;
+	}
+
+	gApp.mShadows.Update(camera.GetViewMatrix(), camera.GetProjectionMatrix(), sunDirection, gApp.mShadowCasters);
+	gApp.mShadows.Upload(camera.GetViewMatrix(), sunColor);
+	gApp.mShadows.Bind(ShadowsBinding, ShadowMapUnit);
+}
+
+/// <summary>
+/// Writes a per-object block for every caster of every cascade drawn this
+/// frame, in RenderShadowCascades()' order, after the scene's own blocks.
+/// </summary>
+void WriteShadowObjectData()
+{
+	std::size_t count = 0;
+	for (std::uint32_t cascade = 0; cascade < gApp.mShadows.GetCascadeCount(); ++cascade)
+	{
+		count += gApp.mShadows.NeedsRender(cascade) ? gApp.mShadows.GetCasters(cascade).size() : 0;
+	}
+	if (count == 0)
+	{
+		return;
+	}
+
+	char* shadowObjects = static_cast<char*>(gApp.mFrameData.Allocate(
+		gApp.mPerObjectStride * count,
+		StreamingBuffer::GetUniformAlignment(),
+		&gApp.mShadowObjectOffset
+	));
+	if (shadowObjects == nullptr)
+	{
+		printf("Streaming buffer is too small for %d shadow casters.\n", static_cast<int>(count));
+		exit(1);
+	}
+	const glm::mat4* world = gApp.mTransforms.GetWorldMatrices();
+	for (std::uint32_t cascade = 0; cascade < gApp.mShadows.GetCascadeCount(); ++cascade)
+	{
+		if (!gApp.mShadows.NeedsRender(cascade))
+		{
+			continue;
+		}
+		for (const std::uint32_t caster : gApp.mShadows.GetCasters(cascade))
+		{
+			const TransformHierarchy::Handle handle = gSceneMeshes[caster]->mTransform.mHandle;
+			const std::uint32_t firstJoint = (handle < gApp.mObjectFirstJoints.size()) ? gApp.mObjectFirstJoints[handle] : 0;
+			PerObjectData data;
+			data.mModelViewProjection = gApp.mShadows.GetViewProjection(cascade) * world[handle];
+			data.mAtlasRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+			data.mObjectIndices = glm::vec4(0.0f, static_cast<float>(gSceneMeshes[caster]->mMaterial), static_cast<float>(firstJoint), 0.0f);
+			memcpy(shadowObjects, &data, sizeof(data));
+			shadowObjects += gApp.mPerObjectStride;
+		}
+	}
+}
+
+/// <summary>
+/// Draws the casters' depth into every cascade that needs it this frame,
+/// one draw per caster at the level of detail the camera sees it at.
+/// Skinned casters are posed by the skinned depth permutation.
+/// </summary>
+void RenderShadowCascades()
+{
+	GLintptr offset = gApp.mShadowObjectOffset;
+	for (std::uint32_t cascade = 0; cascade < gApp.mShadows.GetCascadeCount(); ++cascade)
+	{
+		if (!gApp.mShadows.NeedsRender(cascade))
+		{
+			continue;
+		}
+		gApp.mShadows.BeginCascade(cascade);
+		GLuint current = 0;
+		for (const std::uint32_t caster : gApp.mShadows.GetCasters(cascade))
+		{
+			Mesh3D* mesh = gSceneMeshes[caster];
+			const GLuint program = gApp.mMaterials.GetPermutation(MaterialSystem::DepthOnly
+				| (gApp.mMaterials.GetFeatures(mesh->mMaterial) & MaterialSystem::Skinned));
+			if (program != current)
+			{
+				glUseProgram(program);
+				current = program;
+			}
+			glBindBufferRange(GL_UNIFORM_BUFFER, PerObjectBinding, gApp.mFrameData.GetBuffer(), offset, sizeof(PerObjectData));
+			offset += gApp.mPerObjectStride;
+			MeshBufferPool::Draw(MeshGetLodRange(mesh));
+		}
+		glUseProgram(0);
+		gApp.mShadows.EndCascade(0);
+	}
+	glViewport(0, 0, gApp.mScreenWidth, gApp.mScreenHeight);
+}
+
+/// <summary>
+/// How often each cascade was drawn with --shadows, and what it cost.
+/// </summary>
+void PrintShadowStats()
+{
+	if (!gApp.mShadows.IsCreated())
+	{
+		return;
+	}
+	for (std::uint32_t cascade = 0; cascade < gApp.mShadows.GetCascadeCount(); ++cascade)
+	{
+		const CascadedShadowMaps::CascadeStats stats = gApp.mShadows.GetStats(cascade);
+		printf("Shadow cascade %u: to %.2f, drawn in %llu of %llu frames, %.3f ms GPU and %.1f casters per draw\n",
+			cascade, stats.mEnd,
+			static_cast<unsigned long long>(stats.mRenderCount),
+			static_cast<unsigned long long>(gApp.mShadows.GetFrameCount()),
+			stats.mAverageMilliseconds, stats.mAverageCasters);
+	}
+}
+
+/// <summary>
+/// Two fountains either side of the meshes, half of --particles each: the
+/// rate is as high as their slots allow. The reference gets the same ones.
+/// </summary>
+void SetUpParticles()
+{
+	ParticleSimulation& simulation = gApp.mParticles.GetSimulation();
+	const std::uint32_t slots = gApp.mParticleBudget / 2;
+	for (const float x : { -0.8f, 0.8f })
+	{
+		ParticleSimulation::Emitter emitter;
+		emitter.mPosition = glm::vec3(x, -1.0f, -3.0f);
+		emitter.mVelocity = glm::vec3(-0.3f * x, 2.2f, 0.0f);
+		emitter.mSpread = 0.4f;
+		emitter.mLifetime = 2.0f;
+		emitter.mSize = 0.01f;
+		emitter.mColor = (x < 0.0f) ? glm::vec4(1.0f, 0.5f, 0.15f, 0.3f) : glm::vec4(0.2f, 0.6f, 1.0f, 0.3f);
+		// AddEmitter() keeps one slot spare, and rounds up.
+		emitter.mRate = std::max(0.0f, (static_cast<float>(slots) - 2.0f) / (emitter.mLifetime * (1.0f + ParticleSimulation::LifetimeVariation)));
+		if (simulation.AddEmitter(emitter) == ParticleSimulation::InvalidHandle)
+		{
+			printf("No room for a particle emitter.\n");
+			exit(1);
+		}
+	}
+	printf("Particles: %u slots in %u emitters\n", simulation.GetUsedSlots(), simulation.GetEmitterCount());
+	if (gApp.mValidateParticles)
+	{
+		gApp.mParticleReference = simulation;
+	}
+}
+
+/// <summary>
+/// One tick of the particles on the GPU, and of the reference on the CPU
+/// with --validate-particles.
+/// </summary>
+void StepParticles(float seconds)
+{
+	gApp.mParticles.Step(seconds);
+	if (gApp.mValidateParticles)
+	{
+		using Clock = std::chrono::steady_clock;
+		const Clock::time_point start = Clock::now();
+		gApp.mParticleReference.Step(seconds, &gApp.mReferenceParticles);
+		gApp.mReferenceMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+}
+
+/// <summary>
+/// What a step cost on the GPU, and with --validate-particles on the CPU,
+/// and how far the GPU's particles ended up from the reference's. Reads
+/// the GPU's back, so only at exit.
+/// </summary>
+void PrintParticleStats()
+{
+	if (!gApp.mParticles.IsCreated() || gApp.mParticles.GetStepCount() == 0)
+	{
+		return;
+	}
+	const std::uint64_t steps = gApp.mParticles.GetStepCount();
+	printf("Particles: %u slots, %llu steps, %.3f ms GPU per step\n",
+		gApp.mParticles.GetSimulation().GetUsedSlots(),
+		static_cast<unsigned long long>(steps),
+		gApp.mParticles.GetAverageStepMilliseconds());
+	if (!gApp.mValidateParticles)
+	{
+		return;
+	}
+
+	std::vector<ParticleSimulation::Particle> gpu;
+	gApp.mParticles.ReadBack(&gpu);
+	const std::vector<ParticleSimulation::Particle>& cpu = gApp.mReferenceParticles;
+	float maxDistance = 0.0f;
+	std::size_t alive = 0;
+	std::size_t mismatched = 0;
+	for (std::size_t i = 0; i < gpu.size() && i < cpu.size(); ++i)
+	{
+		const bool gpuAlive = gpu[i].mPositionAge.w < gpu[i].mVelocityLifetime.w;
+		const bool cpuAlive = cpu[i].mPositionAge.w < cpu[i].mVelocityLifetime.w;
+		alive += cpuAlive ? 1 : 0;
+		if (gpuAlive != cpuAlive)
+		{
+			++mismatched;
+		}
+		else if (cpuAlive)
+		{
+			maxDistance = std::max(maxDistance, glm::length(glm::vec3(gpu[i].mPositionAge) - glm::vec3(cpu[i].mPositionAge)));
+		}
+	}
+	const bool passed = gpu.size() == cpu.size() && mismatched == 0 && maxDistance < 1e-3f;
+	printf("Particle validation: %zu alive, %zu alive on one side only, %.2e apart at most: %s\n",
+		alive, mismatched, maxDistance, passed ? "passed" : "FAILED");
+	printf("Particle step: %.3f ms GPU, %.3f ms CPU reference (%u threads)\n",
+		gApp.mParticles.GetAverageStepMilliseconds(),
+		gApp.mReferenceMilliseconds / steps,
+		std::max(1u, std::thread::hardware_concurrency()));
+}
+
+/// <summary>
+/// Translates a mesh -- updating the model matrix.
+/// </summary>
+/// <param name="mesh"></param>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+void MeshTranslate(Mesh3D* mesh, float x, float y, float z)
+{
+	mesh->mURotate -= 0.01f;
+	std::cout << "gURotate: " << mesh->mURotate << std::endl;
+	gApp.mTransforms.Translate(mesh->mTransform.mHandle, glm::vec3(x,y,z));
+	// Retrive our location of our Model Matrix
+}
+
+/// <summary>
+/// Rotates a mesh about an arbitrary axis.
+/// </summary>
+/// <param name="mesh"></param>
+/// <param name="angle"></param>
+/// <param name="axis"></param>
+void MeshRotate(Mesh3D* mesh, float angle, glm::vec3 axis)
+{
+	//Model transformation by translating our object into world space.
+	gApp.mTransforms.Rotate(mesh->mTransform.mHandle, glm::radians(angle), axis);
+}
+
+/// <summary>
+/// Scales a mesh by a given scale factor.
+/// </summary>
+/// <param name="mesh"></param>
+/// <param name="scale"></param>
+void MeshScale(Mesh3D* mesh, glm::vec3 scale)
+{
+	gApp.mTransforms.Scale(mesh->mTransform.mHandle, scale);
+}
+
+/// <summary>
+/// --characters: the model they all are, 'path's glTF file or else the
+/// test character, and its clips compressed.
+/// </summary>
+void LoadCharacterModel(const char* path)
+{
+	if (path == nullptr)
+	{
+		gApp.mCharacterModel = SkinnedModel::MakeTestCharacter(16);
+	}
+	else
+	{
+		std::string error;
+		if (!GltfLoader::Load(path, &gApp.mCharacterModel, &error))
+		{
+			printf("%s: %s\n", path, error.c_str());
+			exit(1);
+		}
+		if (gApp.mCharacterModel.mClips.empty())
+		{
+			printf("%s has no animations to play.\n", path);
+			exit(1);
+		}
+	}
+	for (const RawClip& clip : gApp.mCharacterModel.mClips)
+	{
+		gApp.mCharacterClips.push_back(AnimationClip::Compress(clip, AnimationClip::Tolerances()));
+	}
+	printf("Character: %d vertices, %u joints, %d clip(s)\n",
+		static_cast<int>(gApp.mCharacterModel.mVertices.size()),
+		gApp.mCharacterModel.mSkeleton.GetJointCount(),
+		static_cast<int>(gApp.mCharacterClips.size()));
+}
+
+/// <summary>
+/// A grid of gApp.mCharacterCount characters on the ground, behind and
+/// between the meshes, furthest first, each turned its own way. Only the
+/// first uploads geometry; SetUpCharacters() shares it with the rest.
+/// </summary>
+void CreateCharacters()
+{
+	const std::uint32_t count = gApp.mCharacterCount;
+	const std::uint32_t side = static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<float>(count))));
+	const float spacing = 5.0f / side;
+
+	// About a unit tall standing up, less when they're packed tighter.
+	float lowest = INFINITY;
+	float highest = -INFINITY;
+	for (const SkinnedVertex& vertex : gApp.mCharacterModel.mVertices)
+	{
+		lowest = std::min(lowest, vertex.mPosition.y);
+		highest = std::max(highest, vertex.mPosition.y);
+	}
+	const float scale = std::min(1.0f, 3.0f * spacing) / std::max(highest - lowest, 1e-6f);
+
+	std::uint32_t random = 5;
+	gCharacters.resize(count);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		Mesh3D& character = gCharacters[i];
+		if (i == 0)
+		{
+			SkinnedMeshCreate(&character, gApp.mCharacterModel);
+		}
+		else
+		{
+			character.mTransform.mHandle = gApp.mTransforms.Create();
+			character.mSharedGeometry = true;
+		}
+		const TransformHierarchy::Handle handle = character.mTransform.mHandle;
+		const glm::vec3 position(-2.5f + (i % side + 0.5f) * spacing, -1.2f - lowest * scale, -7.0f + (i / side + 0.5f) * spacing);
+		gApp.mTransforms.Translate(handle, position);
+		gApp.mTransforms.Rotate(handle, 6.2831853f * NextRandom(random), glm::vec3(0.0f, 1.0f, 0.0f));
+		gApp.mTransforms.Scale(handle, glm::vec3(scale));
+		gSceneMeshes.push_back(&character);
+	}
+}
+
+/// <summary>
+/// Once the first character's geometry is in App::mMeshBuffers: shares it
+/// with the rest, gives them all a skinned material lit like the scene,
+/// and starts each playing a clip, from its own point and at its own speed.
+/// </summary>
+void SetUpCharacters(std::uint32_t sceneFeatures)
+{
+	if (!gApp.mAnimation.Create(AnimationSystem::Settings()))
+	{
+		printf("Skin palette could not be created.\n");
+		exit(1);
+	}
+	// The model's own colors, no texture.
+	const std::uint32_t features = MaterialSystem::VertexColors | MaterialSystem::Skinned
+		| (sceneFeatures & (MaterialSystem::Lit | MaterialSystem::Shadowed));
+	const MaterialSystem::Handle material = gApp.mMaterials.Add(features, MaterialSystem::Parameters());
+
+	std::uint32_t random = 9;
+	for (std::uint32_t i = 0; i < gCharacters.size(); ++i)
+	{
+		Mesh3D& character = gCharacters[i];
+		if (character.mSharedGeometry)
+		{
+			character.mGeometry = gCharacters[0].mGeometry;
+			character.mLods = gCharacters[0].mLods;
+			character.mBoundingSphere = gCharacters[0].mBoundingSphere;
+		}
+		MeshSetMaterial(&character, material);
+
+		const AnimationClip& clip = gApp.mCharacterClips[i % gApp.mCharacterClips.size()];
+		const AnimationSystem::Handle instance = gApp.mAnimation.AddInstance(&gApp.mCharacterModel.mSkeleton, &clip,
+			clip.GetDuration() * NextRandom(random), 0.8f + 0.4f * NextRandom(random));
+		if (instance == AnimationSystem::InvalidHandle)
+		{
+			printf("Clip %s doesn't animate the character's joints.\n", clip.GetName().c_str());
+			exit(1);
+		}
+		const TransformHierarchy::Handle handle = character.mTransform.mHandle;
+		if (gApp.mObjectFirstJoints.size() <= handle)
+		{
+			gApp.mObjectFirstJoints.resize(handle + 1, 0);
+		}
+		gApp.mObjectFirstJoints[handle] = gApp.mAnimation.GetFirstJoint(instance);
+	}
+}
+
+/// <summary>
+/// What posing the characters cost, and how small their clips got.
+/// </summary>
+void PrintAnimationStats()
+{
+	if (!gApp.mAnimation.IsCreated() || gApp.mAnimationUpdateCount == 0)
+	{
+		return;
+	}
+	printf("Characters: %u with %u joints in all, %.3f ms average to pose (%s, %u threads), %.2f MiB of palettes uploaded\n",
+		gApp.mAnimation.GetInstanceCount(),
+		gApp.mAnimation.GetJointCount(),
+		gApp.mAnimationMilliseconds / gApp.mAnimationUpdateCount,
+		AnimationSystem::GetActivePathName(),
+		std::max(1u, std::thread::hardware_concurrency()),
+		gApp.mAnimation.GetUploadedBytes() / (1024.0 * 1024.0));
+	std::size_t keys = 0;
+	std::size_t compressedBytes = 0;
+	std::size_t rawBytes = 0;
+	for (std::size_t i = 0; i < gApp.mCharacterClips.size(); ++i)
+	{
+		keys += gApp.mCharacterClips[i].GetKeyCount();
+		compressedBytes += gApp.mCharacterClips[i].GetByteSize();
+		rawBytes += gApp.mCharacterModel.mClips[i].GetByteSize();
+	}
+	printf("Animation clips: %d, %d keys, %.1f KiB compressed from %.1f KiB (%.1fx)\n",
+		static_cast<int>(gApp.mCharacterClips.size()), static_cast<int>(keys),
+		compressedBytes / 1024.0, rawBytes / 1024.0,
+		static_cast<double>(rawBytes) / std::max<std::size_t>(compressedBytes, 1));
+}
+
+/// <summary>
+/// Reads this frame's input from gApp.mInput and handles the keys that act
+/// right away. Called once per frame, and again for late latching.
+/// </summary>
+void ProcessInput()
+{
+	const InputState previous = gApp.mInput.GetState();
+	const InputState& input = gApp.mInput.Poll();
+
+	if (input.WasPressed(InputAction::Quit) || input.IsHeld(InputAction::Quit))
+	{
+		printf("Goodbye!\n");
+		gApp.mQuit = true;
+	}
+	if (input.mMouseX != previous.mMouseX || input.mMouseY != previous.mMouseY)
+	{
+		// Both ends of the interpolation turn, so the mouse isn't a tick late.
+		gApp.mCamera.MouseLook(input.mMouseX, input.mMouseY);
+		gApp.mPreviousCamera.MouseLook(input.mMouseX, input.mMouseY);
+	}
+	if (input.WasPressed(InputAction::Defragment))
+	{
+		// Compact the mesh buffers, and show what that did.
+		gApp.mMeshBuffers.PrintStats();
+		gApp.mMeshBuffers.Defragment();
+		gApp.mMeshBuffers.PrintStats();
+
+		// The meshes moved, so their culling records are out of date.
+		if (GpuCulling::IsSupported())
+		{
+			RegisterGpuCullingDraws();
+		}
+	}
+	if (input.WasPressed(InputAction::ToggleIndirectDraws) && IndirectDrawList::IsSupported())
+	{
+		gApp.mUseIndirectDraws = !gApp.mUseIndirectDraws;
+		// GPU culling draws indirectly too, so it goes with them.
+		gApp.mUseGpuCulling = gApp.mUseGpuCulling && gApp.mUseIndirectDraws;
+		PrintOpaquePassMode();
+	}
+	// As at startup, only on top of the indirect draws.
+	if (input.WasPressed(InputAction::ToggleGpuCulling) && gApp.mUseIndirectDraws && gApp.mGpuCulling.IsCreated())
+	{
+		gApp.mUseGpuCulling = !gApp.mUseGpuCulling;
+		// The depth pyramid is as old as the last frame it culled.
+		gApp.mGpuCulling.SetOcclusionEnabled(false);
+		PrintOpaquePassMode();
+	}
+	if (input.WasPressed(InputAction::ToggleDeferredShading) && gApp.mDeferred.IsCreated())
+	{
+		SetDeferredShading(!gApp.mUseDeferred);
+		PrintShadingMode();
+	}
+	if (input.WasPressed(InputAction::PrintFramePacing))
+	{
+		gApp.mPacer.PrintStats();
+	}
+	if (input.WasPressed(InputAction::PrintGLStats) && GLStats::IsInstalled())
+	{
+		GLStats::PrintReport();
+	}
+}
+
+/// <summary>
+/// A width x height test pattern for the atlas: 'cells' checker squares a
+/// side, in 'color' and white.
+/// </summary>
+ImageLoader::Level MakeCheckerImage(std::uint32_t width, std::uint32_t height, std::uint32_t cells, glm::u8vec3 color)
+{
+	ImageLoader::Level level;
+	level.mWidth = width;
+	level.mHeight = height;
+	level.mPixels.resize(static_cast<std::size_t>(width) * height * 4);
+	for (std::uint32_t y = 0; y < height; ++y)
+	{
+		for (std::uint32_t x = 0; x < width; ++x)
+		{
+			const bool odd = ((x * cells / width) + (y * cells / height)) % 2 != 0;
+			std::uint8_t* pixel = &level.mPixels[(static_cast<std::size_t>(y) * width + x) * 4];
+			pixel[0] = odd ? color.r : 255;
+			pixel[1] = odd ? color.g : 255;
+			pixel[2] = odd ? color.b : 255;
+			pixel[3] = 255;
+		}
+	}
+	return level;
+}
+
+/// <summary>
+/// --atlas: packs a texture for each mesh into gApp.mAtlas, --texture's
+/// image for the first if there is one. It's loaded here rather than by
+/// the texture manager, since the atlas needs its pixels.
+/// </summary>
+void SetUpAtlas(const char* texturePath)
+{
+	if (!gApp.mAtlas.Create(TextureArrayAtlas::Settings()))
+	{
+		printf("Texture array atlas could not be created.\n");
+		exit(1);
+	}
+	ImageLoader::Image image;
+	std::string error;
+	if (texturePath == nullptr || !ImageLoader::Load(texturePath, &image, &error))
+	{
+		if (texturePath != nullptr)
+		{
+			printf("%s: %s\n", texturePath, error.c_str());
+		}
+		image.mLevels.assign(1, MakeCheckerImage(256, 256, 8, glm::u8vec3(200, 60, 40)));
+	}
+	if (!MeshSetAtlasTexture(&gMesh1, image.mLevels[0])
+		|| !MeshSetAtlasTexture(&gMesh2, MakeCheckerImage(128, 192, 4, glm::u8vec3(40, 90, 200)))
+		|| (gApp.mUseShadows && !MeshSetAtlasTexture(&gGround, MakeCheckerImage(64, 64, 8, glm::u8vec3(160, 160, 160)))))
+	{
+		printf("Texture array atlas is full.\n");
+		exit(1);
+	}
+	printf("Texture array atlas: %u layer(s), %.1f%% occupied\n",
+		gApp.mAtlas.GetUsedLayers(), gApp.mAtlas.GetOccupancy() * 100.0f);
+}
+
+/// <summary>
+/// --lights: 'count' small point lights of random colors, scattered around
+/// the meshes. The more there are, the dimmer each.
+/// </summary>
+void MakeSceneLights(std::size_t count)
+{
+	std::uint32_t random = 1;
+	gApp.mLights.resize(count);
+	for (ClusteredLighting::PointLight& light : gApp.mLights)
+	{
+		light.mPosition = glm::vec3(-3.0f + 6.0f * NextRandom(random), -2.0f + 4.0f * NextRandom(random), -7.0f + 6.0f * NextRandom(random));
+		light.mRadius = 0.3f + 0.7f * NextRandom(random);
+		light.mColor = glm::vec3(NextRandom(random), NextRandom(random), NextRandom(random));
+		light.mIntensity = 2.0f * std::min(1.0f, 64.0f / static_cast<float>(count));
+	}
+}
+
+/// <summary>
+/// Summary of the frame times of a scripted run, in milliseconds.
+/// </summary>
+void PrintFrameTimes(std::vector<double> times)
 {
+	if (times.empty())
+	{
+		return;
+	}
+	std::sort(times.begin(), times.end());
+	double sum = 0.0;
+	for (double time : times)
+	{
+		sum += time;
+	}
+	printf("Frame times over %d frames: %.3f ms average, %.3f median, %.3f 95th percentile, %.3f max\n",
+		static_cast<int>(times.size()),
+		sum / times.size(),
+		times[times.size() / 2],
+		times[std::min(times.size() - 1, times.size() * 95 / 100)],
+		times.back()
+	);
+}
+
+int main(int argc, char* args[])
+{
+	// Benchmarks don't need a window, so run them before touching SDL.
+	if (argc > 1 && std::string(args[1]) == "--bench-matrix")
+	{
+		return RunMatrixKernelBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-lod")
+	{
+		return RunMeshLodBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-meshlets")
+	{
+		return RunMeshletBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-textures")
+	{
+		return RunTextureBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-bcn")
+	{
+		return RunBlockCompressionBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-atlas")
+	{
+		return RunAtlasBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-lights")
+	{
+		return RunClusteredLightingBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-particles")
+	{
+		return RunParticleBenchmark();
+	}
+	if (argc > 1 && std::string(args[1]) == "--bench-animation")
+	{
+		return RunAnimationBenchmark();
+	}
+
+	// --max-fps <n> caps the frame rate, the simulation runs at its own rate anyway.
+	// --frames-in-flight <n> is how far the GPU may lag behind, --late-latch
+	// reads the mouse again just before the view is built.
+	// --capture <file> records every GL call into a trace, --replay <file>
+	// plays one back instead of running the app (--replay-csv <file> for
+	// the per-frame timings).
+	// --record-input <file> saves the input of every frame, --play-input
+	// <file> runs those frames again instead of reading SDL, and
+	// --camera-path <file> flies along a scripted path; the last two print
+	// frame times at the end.
+	// --gl-stats counts GL calls per frame and shows them in the title bar,
+	// --gl-stats-timing also times them, --gl-stats-csv <file> writes them
+	// out per frame.
+	// --lod-threshold <pixels> is how far off a mesh's level of detail may
+	// look, 0 always draws full detail. --no-meshlets draws full detail
+	// meshes whole instead of culling their meshlets.
+	// --eager-gl resolves every GL function at startup, as glad normally does,
+	// rather than each one on its first call.
+	// --texture <file> textures the meshes with a PNG, TGA or KTX2 image,
+	// --texture-budget <MiB> is how much video memory textures may take,
+	// --texture-filter <box|kaiser> how their mips are made.
+	// --atlas gives each mesh a texture of its own, packed into one texture
+	// array (the first is --texture's image, if there is one).
+	// --texture-compression <bc1|bc3|bc5|bc7> block compresses them as they
+	// load, at --texture-quality <fast|normal|high>, and keeps the result
+	// in a cache file next to the image unless --no-texture-cache.
+	// --pulse-material fades the second mesh in and out through its material.
+	// --lights <n> lights the scene with n point lights, clustered forward.
+	// --validate-culling checks every GPU cull against the same tests on
+	// the CPU, and reports how they agreed at exit.
+	// --deferred shades through a G-buffer instead (F6 switches), whose
+	// depth the GPU culling also culls against the next frame, and
+	// --compare-render-paths draws every frame both ways and reports the
+	// GPU time of each and how far apart the pictures are; with
+	// --play-input or --camera-path both see the same scene.
+	// --shadows puts a ground under the meshes and a sun over them, with
+	// cascaded shadow maps, and reports each cascade's cost at exit.
+	// --particles <n> adds two fountains of n particles in all, simulated on
+	// the GPU; --validate-particles runs the CPU reference alongside and
+	// compares the two at exit.
+	// --characters <n> stands n skinned characters on the ground, posed on
+	// the CPU from compressed clips and skinned in the vertex shader, and
+	// reports what posing them cost at exit; --character <file> makes them
+	// the first skinned mesh of a glTF file (.gltf or .glb) instead of the
+	// test character.
+	const char* texturePath = nullptr;
+	const char* characterPath = nullptr;
+	const char* capturePath = nullptr;
+	const char* recordInputPath = nullptr;
+	const char* playInputPath = nullptr;
+	const char* cameraPath = nullptr;
+	bool glStats = false;
+	bool glStatsTiming = false;
+	const char* glStatsCsvPath = nullptr;
+	const char* replayPath = nullptr;
+	const char* replayCsvPath = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = args[i];
+		if (arg == "--capture" && i + 1 < argc)
+		{
+			capturePath = args[++i];
+		}
+		else if (arg == "--replay" && i + 1 < argc)
+		{
+			replayPath = args[++i];
+		}
+		else if (arg == "--replay-csv" && i + 1 < argc)
+		{
+			replayCsvPath = args[++i];
+		}
+		else if (arg == "--record-input" && i + 1 < argc)
+		{
+			recordInputPath = args[++i];
+		}
+		else if (arg == "--play-input" && i + 1 < argc)
+		{
+			playInputPath = args[++i];
+		}
+		else if (arg == "--camera-path" && i + 1 < argc)
+		{
+			cameraPath = args[++i];
+		}
+		else if (arg == "--gl-stats")
+		{
+			glStats = true;
+		}
+		else if (arg == "--gl-stats-timing")
+		{
+			glStats = glStatsTiming = true;
+		}
+		else if (arg == "--gl-stats-csv" && i + 1 < argc)
+		{
+			glStats = true;
+			glStatsCsvPath = args[++i];
+		}
+		else if (arg == "--max-fps" && i + 1 < argc)
+		{
+			gApp.mScheduler.SetFrameLimit(atof(args[++i]));
+		}
+		else if (arg == "--frames-in-flight" && i + 1 < argc)
+		{
+			gApp.mPacer.SetFramesInFlight(atoi(args[++i]));
+		}
+		else if (arg == "--late-latch")
+		{
+			gApp.mPacer.SetLateLatching(true);
+		}
+		else if (arg == "--lod-threshold" && i + 1 < argc)
+		{
+			gApp.mLodPixelThreshold = static_cast<float>(atof(args[++i]));
+		}
+		else if (arg == "--no-meshlets")
+		{
+			gApp.mUseMeshletCulling = false;
+		}
+		else if (arg == "--texture" && i + 1 < argc)
+		{
+			texturePath = args[++i];
+		}
+		else if (arg == "--texture-budget" && i + 1 < argc)
+		{
+			gApp.mTextureSettings.mBudgetBytes = static_cast<std::size_t>(atof(args[++i]) * 1024.0 * 1024.0);
+		}
+		else if (arg == "--texture-filter" && i + 1 < argc)
+		{
+			const std::string filter = args[++i];
+			gApp.mTextureSettings.mFilter = (filter == "box") ? MipGenerator::Filter::Box : MipGenerator::Filter::Kaiser;
+		}
+		else if (arg == "--texture-compression" && i + 1 < argc)
+		{
+			if (!BlockCompressor::Parse(args[++i], &gApp.mTextureSettings.mFormat))
+			{
+				printf("Unknown texture compression %s, expected bc1, bc3, bc5 or bc7.\n", args[i]);
+				exit(1);
+			}
+			gApp.mTextureSettings.mCompress = true;
+		}
+		else if (arg == "--texture-quality" && i + 1 < argc)
+		{
+			if (!BlockCompressor::Parse(args[++i], &gApp.mTextureSettings.mQuality))
+			{
+				printf("Unknown texture quality %s, expected fast, normal or high.\n", args[i]);
+				exit(1);
+			}
+		}
+		else if (arg == "--lights" && i + 1 < argc)
+		{
+			MakeSceneLights(static_cast<std::size_t>(std::max(0, atoi(args[++i]))));
+		}
+		else if (arg == "--deferred")
+		{
+			gApp.mUseDeferred = true;
+		}
+		else if (arg == "--shadows")
+		{
+			gApp.mUseShadows = true;
+		}
+		else if (arg == "--particles" && i + 1 < argc)
+		{
+			gApp.mParticleBudget = static_cast<std::uint32_t>(std::max(0, atoi(args[++i])));
+		}
+		else if (arg == "--validate-culling")
+		{
+			gApp.mValidateCulling = true;
+		}
+		else if (arg == "--validate-particles")
+		{
+			gApp.mValidateParticles = true;
+		}
+		else if (arg == "--characters" && i + 1 < argc)
+		{
+			gApp.mCharacterCount = static_cast<std::uint32_t>(std::max(0, atoi(args[++i])));
+		}
+		else if (arg == "--character" && i + 1 < argc)
+		{
+			characterPath = args[++i];
+		}
+		else if (arg == "--compare-render-paths")
+		{
+			gApp.mCompareRenderPaths = true;
+		}
+		else if (arg == "--pulse-material")
+		{
+			gApp.mPulseMaterial = true;
+		}
+		else if (arg == "--atlas")
+		{
+			gApp.mUseAtlas = true;
+		}
+		else if (arg == "--no-texture-cache")
+		{
+			gApp.mTextureSettings.mUseCacheFiles = false;
+		}
+		else if (arg == "--eager-gl")
+		{
+			gApp.mEagerGLLoading = true;
+		}
+	}
+
+	if (replayPath != nullptr)
+	{
+		return GLReplay::Run(replayPath, replayCsvPath);
+	}
+
+	// The mouse starts in the middle, recorded or not, so playback sees the same motion.
+	gApp.mInput.SetMousePosition(gApp.mScreenWidth/2, gApp.mScreenHeight/2);
+	if (recordInputPath != nullptr && !gApp.mInput.StartRecording(recordInputPath))
+	{
+		printf("Could not record input to %s\n", recordInputPath);
+		exit(1);
+	}
+	if (playInputPath != nullptr && !gApp.mInput.StartPlayback(playInputPath))
+	{
+		printf("%s is not an input recording we can play.\n", playInputPath);
+		exit(1);
+	}
+	if (cameraPath != nullptr && !gApp.mCameraPath.Load(cameraPath))
+	{
+		printf("%s is not a camera path we can read.\n", cameraPath);
+		exit(1);
+	}
+	const bool scriptedRun = playInputPath != nullptr || cameraPath != nullptr;
+
 	printf("Hello OpenGL!\n");
 	
 	InitializeProgram(&gApp);
 
+	// Before anything is created, so the trace has everything.
+	if (capturePath != nullptr && !GLCapture::Begin(capturePath, gApp.mScreenWidth, gApp.mScreenHeight))
+	{
+		printf("Could not start a GL capture to %s\n", capturePath);
+		exit(1);
+	}
+	if (glStats)
+	{
+		GLStats::Install(glStatsTiming);
+		if (glStatsCsvPath != nullptr && !GLStats::OpenCsv(glStatsCsvPath))
+		{
+			printf("Could not write GL stats to %s\n", glStatsCsvPath);
+			exit(1);
+		}
+	}
+
+	// Capture and stats expect every GL call on this thread.
+	if (capturePath == nullptr && !glStats)
+	{
+		gApp.mResources.Start(gApp.mGraphicsApplicationWindow);
+	}
+
 	//setup our camera
 	gApp.mCamera.SetProjectionMatrix(
 		glm::radians(45.0f), 
@@ -417,7 +2231,10 @@ int main(int argc, char* args[])
 		0.1f, 
 		100.0f
 	);
+	gApp.mPreviousCamera = gApp.mCamera;
 
+	// The meshes and the shaders are made on the resource worker; we only
+	// wait for them once we need them.
 	MeshCreate(&gMesh1);
 	MeshTranslate(&gMesh1, 0.0f, 0.0f, -2.0f);
 	MeshScale(&gMesh1, glm::vec3(1.0f, 1.0f, 1.0f));
@@ -427,124 +2244,544 @@ int main(int argc, char* args[])
 	MeshTranslate(&gMesh2, 0.0f, 0.0f, -4.0f);
 	MeshScale(&gMesh2, glm::vec3(1.0f, 2.0f, 1.0f));
 
+	// The ground goes first: the opaque pass has no depth test, later draws cover it.
+	if (gApp.mUseShadows)
+	{
+		// Big enough to get levels of detail and meshlets of its own.
+		MeshCreate(&gGround, 16);
+		MeshTranslate(&gGround, 0.0f, -1.2f, -3.0f);
+		MeshRotate(&gGround, -90.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+		MeshScale(&gGround, glm::vec3(12.0f, 12.0f, 1.0f));
+		gGround.mStatic = true;
+		// Only ever seen from above, its underside can go.
+		gGround.mBackFaceCulled = true;
+		gSceneMeshes.push_back(&gGround);
+	}
+	// Then the characters, for the same reason; the meshes stand in front of them.
+	if (gApp.mCharacterCount > 0)
+	{
+		LoadCharacterModel(characterPath);
+		CreateCharacters();
+	}
+	gSceneMeshes.push_back(&gMesh1);
+	gSceneMeshes.push_back(&gMesh2);
+
 	//create graphic pipeline
 	//	- At a minimum, this means the vertex and fragment shader
+	// Both materials use the same permutation and only differ in their
+	// parameters, so the indirect paths still draw them in one call. With
+	// the atlas, the textures are layers of an array.
+	const std::uint32_t sceneFeatures = MaterialSystem::VertexColors | (gApp.mUseAtlas ? MaterialSystem::TextureArray : MaterialSystem::Texture)
+		| (IsSceneLit() ? static_cast<std::uint32_t>(MaterialSystem::Lit) : 0u)
+		| (gApp.mUseShadows ? static_cast<std::uint32_t>(MaterialSystem::Shadowed) : 0u);
+	const ResourceWorker::Ticket graphicsPipeline = gApp.mResources.Submit([sceneFeatures]() {
+		return CreateMaterialPipeline(MaterialSystem::GetDefines(sceneFeatures));
+	});
+
+	// Deferred shading's lighting pass, lit when the materials are.
+	const ResourceWorker::Ticket deferredPipeline = gApp.mResources.Submit([sceneFeatures]() {
+		return CreateGraphicsPipeline(".\\shaders\\fullscreen_vert.glsl", ".\\shaders\\deferred_frag.glsl", MaterialSystem::GetDefines(sceneFeatures & (MaterialSystem::Lit | MaterialSystem::Shadowed)),
+			".\\shaders\\lighting.glsl");
+	});
+
+	// The casters' depth, for the shadow maps.
+	ResourceWorker::Ticket shadowPipeline = ResourceWorker::InvalidTicket;
+	if (gApp.mUseShadows)
 	{
-		//create shader program
-		{
-			const std::string vertexShaderSource = LoadShaderAsString(".\\shaders\\vert.glsl");
-			const std::string fragmentShaderSource = LoadShaderAsString(".\\shaders\\frag.glsl");
-
-			GLuint programObject = glCreateProgram();
+		shadowPipeline = gApp.mResources.Submit([]() {
+			return CreateMaterialPipeline(MaterialSystem::GetDefines(MaterialSystem::DepthOnly));
+		});
+	}
 
-			GLuint myVertexShader = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-			GLuint myFragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-			glAttachShader(programObject, myVertexShader);
-			glAttachShader(programObject, myFragmentShader);
-			glLinkProgram(programObject);
+	// Multi-draw indirect needs a vertex shader that finds its matrix without a uniform per draw.
+	gApp.mUseIndirectDraws = IndirectDrawList::IsSupported();
+	ResourceWorker::Ticket indirectPipeline = ResourceWorker::InvalidTicket;
+	if (gApp.mUseIndirectDraws)
+	{
+		indirectPipeline = gApp.mResources.Submit([sceneFeatures]() {
+			return CreateMaterialPipeline(MaterialSystem::GetDefines(sceneFeatures | MaterialSystem::Instanced));
+		});
+	}
 
-			// validate our program
-			glValidateProgram(programObject);
+	// GPU culling writes the indirect commands with a compute shader (GL 4.3).
+	gApp.mUseGpuCulling = gApp.mUseIndirectDraws && GpuCulling::IsSupported();
+	ResourceWorker::Ticket cullPipeline = ResourceWorker::InvalidTicket;
+	ResourceWorker::Ticket depthPyramidPipeline = ResourceWorker::InvalidTicket;
+	if (gApp.mUseGpuCulling)
+	{
+		cullPipeline = gApp.mResources.Submit([]() { return CreateComputePipeline(".\\shaders\\cull_comp.glsl"); });
+		depthPyramidPipeline = gApp.mResources.Submit([]() { return CreateComputePipeline(".\\shaders\\depth_pyramid_comp.glsl"); });
+	}
 
-			// delete the individual shaders once we are done
-			glDetachShader(programObject, myVertexShader);
-			glDetachShader(programObject, myFragmentShader);
+	// Transform feedback runs the particles' step, GL 4.1 has no compute shaders.
+	ResourceWorker::Ticket particleUpdatePipeline = ResourceWorker::InvalidTicket;
+	ResourceWorker::Ticket particleRenderPipeline = ResourceWorker::InvalidTicket;
+	if (gApp.mParticleBudget > 0)
+	{
+		particleUpdatePipeline = gApp.mResources.Submit([]() {
+			return CreateTransformFeedbackPipeline(".\\shaders\\particle_update_vert.glsl", ParticleSystem::FeedbackVaryings, ParticleSystem::FeedbackVaryingCount);
+		});
+		particleRenderPipeline = gApp.mResources.Submit([]() {
+			return CreateGraphicsPipeline(".\\shaders\\particle_vert.glsl", ".\\shaders\\particle_frag.glsl");
+		});
+	}
 
-			glDeleteShader(myVertexShader);
-			glDeleteShader(myFragmentShader);
+	for (Mesh3D* mesh : gSceneMeshes)
+	{
+		if (!mesh->mSharedGeometry)
+		{
+			MeshFinishCreate(mesh);
+		}
+	}
+	gApp.mMeshBuffers.PrintStats();
 
-			gApp.mGraphicsPipelineShaderProgram = programObject;
+	// Any other permutation would be built on the main thread when first drawn.
+	if (!gApp.mMaterials.Create(CreateMaterialPipeline))
+	{
+		printf("Material buffer could not be created.\n");
+		exit(1);
+	}
+	if (IsSceneLit() && !gApp.mLighting.Create(ClusteredLighting::Settings()))
+	{
+		printf("Clustered lighting could not be set up.\n");
+		exit(1);
+	}
+	if (gApp.mUseShadows)
+	{
+		if (!gApp.mShadows.Create(CascadedShadowMaps::Settings()))
+		{
+			printf("Shadow maps could not be created.\n");
+			exit(1);
+		}
+		gApp.mMaterials.AddPermutation(MaterialSystem::DepthOnly, gApp.mResources.Take(shadowPipeline));
+	}
+	if (!gApp.mDeferred.Create(gApp.mResources.Take(deferredPipeline), FirstGBufferUnit, gApp.mScreenWidth, gApp.mScreenHeight))
+	{
+		printf("The G-buffer could not be created, shading stays forward.\n");
+		gApp.mUseDeferred = false;
+		gApp.mCompareRenderPaths = false;
+	}
+	gApp.mMaterials.AddPermutation(sceneFeatures, gApp.mResources.Take(graphicsPipeline));
+	if (gApp.mUseIndirectDraws)
+	{
+		gApp.mMaterials.AddPermutation(sceneFeatures | MaterialSystem::Instanced, gApp.mResources.Take(indirectPipeline));
+	}
+	MeshSetMaterial(&gMesh1, gApp.mMaterials.Add(sceneFeatures, MaterialSystem::Parameters()));
+	MeshSetMaterial(&gMesh2, gApp.mMaterials.Add(sceneFeatures, MaterialSystem::Parameters()));
+	if (gApp.mUseShadows)
+	{
+		// Plain grey and rough, without the quads' vertex colors.
+		MaterialSystem::Parameters ground;
+		ground.mBaseColor = glm::vec4(0.8f, 0.8f, 0.8f, 1.0f);
+		ground.mSurface.x = 0.9f;
+		MeshSetMaterial(&gGround, gApp.mMaterials.Add(sceneFeatures & ~MaterialSystem::VertexColors, ground));
+	}
+	if (gApp.mCharacterCount > 0)
+	{
+		SetUpCharacters(sceneFeatures);
+	}
+	if (gApp.mUseGpuCulling)
+	{
+		const GLuint cullProgram = gApp.mResources.Take(cullPipeline);
+		const GLuint depthPyramidProgram = gApp.mResources.Take(depthPyramidPipeline);
+		if (cullProgram != 0 && depthPyramidProgram != 0)
+		{
+			gApp.mGpuCulling.Create(cullProgram, depthPyramidProgram);
+			gApp.mGpuCulling.SetLodSelection(static_cast<float>(gApp.mScreenHeight), gApp.mLodPixelThreshold);
+			RegisterGpuCullingDraws();
+		}
+		else
+		{
+			// The indirect path culls on the CPU instead.
+			printf("GPU culling: the compute shaders didn't build, culling on the CPU.\n");
+			glDeleteProgram(cullProgram);
+			glDeleteProgram(depthPyramidProgram);
+			gApp.mUseGpuCulling = false;
+		}
+	}
+	if (gApp.mParticleBudget > 0)
+	{
+		ParticleSimulation::Settings particleSettings;
+		particleSettings.mMaxParticles = gApp.mParticleBudget;
+		particleSettings.mThreads = 0;
+		const GLuint particleUpdateProgram = gApp.mResources.Take(particleUpdatePipeline);
+		if (!gApp.mParticles.Create(particleUpdateProgram, gApp.mResources.Take(particleRenderPipeline), ParticlesBinding, particleSettings))
+		{
+			printf("Particle buffers could not be created.\n");
+			exit(1);
 		}
+		SetUpParticles();
+	}
+	PrintOpaquePassMode();
+	PrintShadingMode();
+
+	// 1 MiB per frame is plenty for the meshes, Allocate() fails loudly when
+	// it isn't. Characters add a per-object block each, and one per cascade.
+	const GLsizeiptr perObjectAlignment = std::max(StreamingBuffer::GetUniformAlignment(), StreamingBuffer::GetStorageAlignment());
+	const GLsizeiptr characterBytes = static_cast<GLsizeiptr>(gApp.mCharacterCount)
+		* ((sizeof(PerObjectData) + perObjectAlignment - 1) / perObjectAlignment * perObjectAlignment)
+		* (1 + (gApp.mUseShadows ? gApp.mShadows.GetCascadeCount() : 0));
+	if (!gApp.mFrameData.Create(1024 * 1024 + characterBytes))
+	{
+		printf("Streaming buffer could not be created.\n");
+		exit(1);
 	}
+	gApp.mPacer.Create();
 
-	MeshSetPipeline(&gMesh1, gApp.mGraphicsPipelineShaderProgram);
-	MeshSetPipeline(&gMesh2, gApp.mGraphicsPipelineShaderProgram);
+	// The white texture has to be there for the first frame; the scene's
+	// own is decoded in the background and shows up once it's ready.
+	if (gApp.mTextureSettings.mCompress && !BlockCompressor::IsSupportedByContext(gApp.mTextureSettings.mFormat))
+	{
+		printf("This context can't sample %s, textures stay uncompressed.\n", BlockCompressor::GetName(gApp.mTextureSettings.mFormat));
+		gApp.mTextureSettings.mCompress = false;
+	}
+	gApp.mTextures.Create(TextureBackends::GetGL(), gApp.mTextureSettings);
+	const std::uint8_t white[4] = { 255, 255, 255, 255 };
+	gApp.mWhiteTexture = gApp.mTextures.CreateFromPixels(1, 1, white);
+	gApp.mTextures.WaitForLoads();
+	gApp.mTextures.Update();
+	if (gApp.mUseAtlas)
+	{
+		SetUpAtlas(texturePath);
+	}
+	else if (texturePath != nullptr)
+	{
+		gApp.mSceneTexture = gApp.mTextures.Load(texturePath);
+	}
 
 	//application main loop
 	{
 		SDL_WarpMouseInWindow(gApp.mGraphicsApplicationWindow, gApp.mScreenWidth/2, gApp.mScreenHeight/2);
 		SDL_SetRelativeMouseMode(SDL_TRUE);
+		int frameCount = 0;
 		while (!gApp.mQuit)
 		{
+			// Wait for the GPU first, so the input we read next is as fresh as
+			// possible when the frame reaches the screen.
+			gApp.mPacer.BeginFrame();
+
+			// How many fixed simulation ticks fit in the time since the last
+			// frame. When playing input back, however many the recording ran.
+			const int ticks = gApp.mInput.BeginFrame(gApp.mScheduler.BeginFrame(), gApp.mScheduler.GetInterpolation());
+
 			//input
+			ProcessInput();
+			gApp.mPacer.MarkInputSampled();
+
+			// Simulation: everything that moves, a fixed step at a time, so it
+			// runs the same at any frame rate.
+			for (int tick = 0; tick < ticks; ++tick)
 			{
-				SDL_Event e;
-				static int mouseX = gApp.mScreenWidth/2; 
-				static int mouseY = gApp.mScreenHeight/2;
-				while (SDL_PollEvent(&e) != 0)
-				{
-					if (e.type == SDL_QUIT)
-					{
-						printf("Goodbye!\n");
-						gApp.mQuit = true;
-					}
-					else if (e.type == SDL_MOUSEMOTION)
-					{
-						mouseX += e.motion.xrel;
-						mouseY += e.motion.yrel;
-						gApp.mCamera.MouseLook(mouseX, mouseY);
-					}
-				}
-				// TODO: use some other key to move our object
-				//gUOffset += 0.001f;
-				//std::cout << "gUOffset: " << gUOffset << std::endl;
-				const Uint8* state = SDL_GetKeyboardState(NULL);
+				gApp.mPreviousCamera = gApp.mCamera;
+				gApp.mTransforms.BeginTick();
+
+				const InputState& input = gApp.mInput.GetState();
+				// per tick, at 60 ticks a second
 				float speed = 0.005f;
-				if (state[SDL_SCANCODE_UP]) {
+				if (input.IsHeld(InputAction::MoveForward)) {
 					gApp.mCamera.MoveForward(speed);
 				}
-				if (state[SDL_SCANCODE_DOWN]) {
+				if (input.IsHeld(InputAction::MoveBackward)) {
 					gApp.mCamera.MoveBackward(speed);
 					//gUOffset -= 0.001f;
 					//std::cout << "gUOffset: " << gUOffset << std::endl;
 				}
-				if (state[SDL_SCANCODE_LEFT]) {
+				if (input.IsHeld(InputAction::MoveLeft)) {
 					gApp.mCamera.MoveLeft(speed);
 				}
-				if (state[SDL_SCANCODE_RIGHT]) {
+				if (input.IsHeld(InputAction::MoveRight)) {
 					gApp.mCamera.MoveRight(speed);
 				}
-				if (state[SDL_SCANCODE_ESCAPE])
+
+				// A scripted path overrides wherever the input took the camera.
+				if (!gApp.mCameraPath.IsEmpty())
+				{
+					gApp.mCameraPathSeconds += static_cast<float>(gApp.mScheduler.GetTickSeconds());
+					glm::vec3 eye;
+					glm::vec3 target;
+					gApp.mCameraPath.Evaluate(gApp.mCameraPathSeconds, &eye, &target);
+					gApp.mCamera.LookAt(eye, target);
+				}
+
+				static float rotate = 0.01f;
+				MeshRotate(&gMesh1, rotate, glm::vec3(0.0f, 0.1f, 0.0f));
+				MeshRotate(&gMesh2, -rotate, glm::vec3(0.0f, 0.1f, 0.0f));
+
+				// The lights circle the meshes, every other one the other way.
+				for (std::size_t i = 0; i < gApp.mLights.size(); ++i)
+				{
+					const glm::vec3 center(0.0f, 0.0f, -3.0f);
+					const float angle = (i % 2 == 0) ? 0.01f : -0.01f;
+					const glm::vec3 offset = gApp.mLights[i].mPosition - center;
+					gApp.mLights[i].mPosition = center + glm::vec3(
+						offset.x * std::cos(angle) - offset.z * std::sin(angle),
+						offset.y,
+						offset.x * std::sin(angle) + offset.z * std::cos(angle));
+				}
+
+				// Only this material's 32 bytes go to the GPU.
+				if (gApp.mPulseMaterial)
 				{
-					gApp.mQuit = true;
+					gApp.mPulseSeconds += static_cast<float>(gApp.mScheduler.GetTickSeconds());
+					MaterialSystem::Parameters parameters = gApp.mMaterials.GetParameters(gMesh2.mMaterial);
+					parameters.mBaseColor = glm::vec4(glm::vec3(0.6f + 0.4f * std::cos(3.0f * gApp.mPulseSeconds)), 1.0f);
+					gApp.mMaterials.SetParameters(gMesh2.mMaterial, parameters);
+				}
+
+				if (gApp.mParticles.IsCreated())
+				{
+					StepParticles(static_cast<float>(gApp.mScheduler.GetTickSeconds()));
+				}
+				if (gApp.mAnimation.IsCreated())
+				{
+					gApp.mAnimation.Advance(static_cast<float>(gApp.mScheduler.GetTickSeconds()));
 				}
 			}
 
 			// Clear up the screen
+			ClearScreen();
+
+			// Late latching: the simulation is done, read the mouse once more
+			// so the view we're about to build is as recent as it gets.
+			if (gApp.mPacer.IsLateLatching())
+			{
+				ProcessInput();
+				gApp.mPacer.MarkInputSampled();
+			}
+
+			// Render in between the last two ticks, so motion is smooth even
+			// when the frame rate isn't a multiple of the tick rate.
+			const float alpha = gApp.mInput.GetInterpolation();
+			const Camera camera = Camera::Interpolate(gApp.mPreviousCamera, gApp.mCamera, alpha);
+
+			// Resolve the world matrices of everything that moved this frame.
+			gApp.mTransforms.Update(alpha);
+
+			// Pose the characters in between the last two ticks as well, and
+			// hand their skinning matrices to the vertex shader.
+			if (gApp.mAnimation.IsCreated())
+			{
+				using Clock = std::chrono::steady_clock;
+				const Clock::time_point poseStart = Clock::now();
+				gApp.mAnimation.Update(-(1.0f - alpha) * static_cast<float>(gApp.mScheduler.GetTickSeconds()));
+				gApp.mAnimationMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - poseStart).count();
+				++gApp.mAnimationUpdateCount;
+				if (!gApp.mAnimation.Upload())
+				{
+					printf("The skin palette is too big for a texture buffer (%u joints).\n", gApp.mAnimation.GetJointCount());
+					exit(1);
+				}
+				gApp.mAnimation.Bind(SkinPaletteUnit);
+			}
+
+			// Combine projection * view with every world matrix in one batch.
+			{
+				const glm::mat4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+				gApp.mModelViewProjections.resize(gApp.mTransforms.Size());
+				MatrixKernels::MultiplyBatch(
+					viewProjection,
+					gApp.mTransforms.GetWorldMatrices(),
+					gApp.mModelViewProjections.data(),
+					gApp.mTransforms.Size()
+				);
+			}
+
+			// Sort the lights into the clusters of this frame's view.
+			if (IsSceneLit())
+			{
+				using Clock = std::chrono::steady_clock;
+				const Clock::time_point assignStart = Clock::now();
+				gApp.mLighting.SetProjection(camera.GetProjectionMatrix());
+				gApp.mLighting.Assign(gApp.mLights, camera.GetViewMatrix());
+				gApp.mLightAssignMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - assignStart).count();
+				++gApp.mLightAssignCount;
+				gApp.mLighting.Upload(gApp.mScreenWidth, gApp.mScreenHeight, glm::vec3(0.1f));
+				gApp.mLighting.Bind(LightingBinding, FirstLightingUnit);
+			}
+			if (gApp.mUseShadows)
+			{
+				UpdateShadows(camera);
+			}
+
+			// Copy the per-object blocks into this frame's region of the ring buffer.
+			gApp.mFrameData.BeginFrame();
 			{
-				// Disable depth test and face culling.
-				glDisable(GL_DEPTH_TEST);
-				glDisable(GL_CULL_FACE);
+				// The culling pass reads the same blocks as a storage buffer.
+				const GLsizeiptr alignment = std::max(StreamingBuffer::GetUniformAlignment(), StreamingBuffer::GetStorageAlignment());
+				const std::size_t count = gApp.mModelViewProjections.size();
+				gApp.mPerObjectStride = (sizeof(PerObjectData) + alignment - 1) / alignment * alignment;
+
+				char* perObject = static_cast<char*>(gApp.mFrameData.Allocate(
+					gApp.mPerObjectStride * count,
+					alignment,
+					&gApp.mPerObjectOffset
+				));
+				if (perObject == nullptr)
+				{
+					printf("Streaming buffer is too small for %d objects.\n", static_cast<int>(count));
+					exit(1);
+				}
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					PerObjectData data;
+					data.mModelViewProjection = gApp.mModelViewProjections[i];
+					const TextureArrayAtlas::Entry entry = (i < gApp.mAtlasEntries.size()) ? gApp.mAtlasEntries[i] : TextureArrayAtlas::Entry();
+					data.mAtlasRect = entry.mRect;
+					const MaterialSystem::Handle material = (i < gApp.mObjectMaterials.size()) ? gApp.mObjectMaterials[i] : 0;
+					const std::uint32_t firstJoint = (i < gApp.mObjectFirstJoints.size()) ? gApp.mObjectFirstJoints[i] : 0;
+					data.mObjectIndices = glm::vec4(static_cast<float>(entry.mLayer), static_cast<float>(material), static_cast<float>(firstJoint), 0.0f);
+					memcpy(perObject + i * gApp.mPerObjectStride, &data, sizeof(data));
+				}
+			}
+			if (gApp.mUseShadows)
+			{
+				WriteShadowObjectData();
+			}
+			// The indirect commands go in the same region, next to the data they
+			// index. Comparing forward and deferred shading needs both lists.
+			if (gApp.mUseIndirectDraws && !gApp.mUseGpuCulling)
+			{
+				for (const bool deferred : { false, true })
+				{
+					if (deferred != gApp.mUseDeferred && !gApp.mCompareRenderPaths)
+					{
+						continue;
+					}
+					IndirectDrawList& draws = deferred ? gApp.mGBufferDraws : gApp.mOpaqueDraws;
+					draws.Clear();
+					for (Mesh3D* mesh : gSceneMeshes)
+					{
+						MeshQueueIndirect(mesh, deferred);
+					}
+					if (!draws.Write(&gApp.mFrameData))
+					{
+						printf("Streaming buffer is too small for %d draws.\n", static_cast<int>(draws.GetDrawCount()));
+						exit(1);
+					}
+				}
+			}
+			gApp.mFrameData.Commit();
+			gApp.mMaterials.Flush(MaterialsBinding);
 
-				// Initialize clear color
-				// This is the background of the screen.
-				glViewport(0, 0, gApp.mScreenWidth, gApp.mScreenHeight);
-				glClearColor(1.f, 1.f, 0.1f, 1.f);
+			// Stream the scene texture's levels in or out for how big the meshes are.
+			for (Mesh3D* mesh : gSceneMeshes)
+			{
+				MeshRequestTextureDetail(mesh);
+			}
+			gApp.mTextures.Update();
 
-				// Clear the color and depth buffers.
-				glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+			if (gApp.mUseShadows)
+			{
+				RenderShadowCascades();
 			}
 
-			static float rotate = 0.01f;
-			MeshRotate(&gMesh1, rotate, glm::vec3(0.0f, 0.1f, 0.0f));
-			MeshRotate(&gMesh2, -rotate, glm::vec3(0.0f, 0.1f, 0.0f));
+			// The first frame includes all the loading, it isn't compared.
+			if (gApp.mCompareRenderPaths && frameCount > 0)
+			{
+				DrawSceneCompared();
+			}
+			else
+			{
+				DrawScene();
+			}
+			// Blended over whatever the scene left, in any order.
+			if (gApp.mParticles.IsCreated())
+			{
+				gApp.mParticles.Draw(camera.GetViewMatrix(), camera.GetProjectionMatrix());
+			}
 
-			DrawMesh(&gMesh1);
-			DrawMesh(&gMesh2);
+			// Fence this frame's region so we don't overwrite it while the GPU still reads it.
+			gApp.mFrameData.EndFrame();
 
 			//update the screen
 			SDL_GL_SwapWindow(gApp.mGraphicsApplicationWindow);
+			gApp.mPacer.EndFrame();
+			GLCapture::MarkFrame();
+			GLStats::EndFrame();
+
+			// Wait here if we're ahead of --max-fps.
+			gApp.mScheduler.EndFrame();
+
+			// Twice a second is often enough to read.
+			if (GLStats::IsInstalled() && frameCount % 30 == 0)
+			{
+				const std::string title = "OpenGL Window - " + GLStats::Describe(GLStats::GetLastFrame());
+				SDL_SetWindowTitle(gApp.mGraphicsApplicationWindow, title.c_str());
+			}
+
+			// The first frame includes all the loading, so it doesn't count.
+			if (scriptedRun && frameCount > 0)
+			{
+				gApp.mFrameTimes.push_back(gApp.mScheduler.GetFrameSeconds() * 1000.0);
+			}
+			++frameCount;
+			if (!gApp.mCameraPath.IsEmpty() && gApp.mCameraPathSeconds >= gApp.mCameraPath.GetDuration())
+			{
+				gApp.mQuit = true;
+			}
 		}
 	}
 
+	PrintFrameTimes(gApp.mFrameTimes);
+	gApp.mInput.Finish();
+	// These read back from the GPU, so before anything is torn down.
+	PrintCullingValidation();
+	PrintShadowStats();
+	PrintParticleStats();
+
 	//clean up: call the cleanup function when our program terminates
 	{
-		SDL_DestroyWindow(gApp.mGraphicsApplicationWindow);
-		gApp.mGraphicsApplicationWindow = nullptr;
+		// Its context is current on the window, so it has to stop first.
+		gApp.mResources.Stop();
 
-		MeshDelete(&gMesh1);
+		for (Mesh3D* mesh : gSceneMeshes)
+		{
+			MeshDelete(mesh);
+		}
+		gApp.mMeshBuffers.DestroyAll();
+		gApp.mGpuCulling.Destroy();
+		gApp.mTextures.Destroy();
+		gApp.mAtlas.Destroy();
+
+		gApp.mFrameData.Destroy();
+		gApp.mPacer.Destroy();
+		printf("Materials: %d in %d permutation(s), %llu bytes uploaded in %llu updates\n",
+			static_cast<int>(gApp.mMaterials.GetMaterialCount()),
+			static_cast<int>(gApp.mMaterials.GetPermutationCount()),
+			static_cast<unsigned long long>(gApp.mMaterials.GetUploadedBytes()),
+			static_cast<unsigned long long>(gApp.mMaterials.GetUploadCount()));
+		PrintRenderPathComparison();
+		if (gApp.mRenderPathQueries[0] != 0)
+		{
+			glDeleteQueries(2, gApp.mRenderPathQueries);
+		}
+		gApp.mDeferred.Destroy();
+		gApp.mShadows.Destroy();
+		gApp.mParticles.Destroy();
+		PrintAnimationStats();
+		gApp.mAnimation.Destroy();
+		gApp.mMaterials.Destroy();
+		if (gApp.mLightAssignCount > 0)
+		{
+			printf("Clustered lighting: %d lights, %.3f ms average to assign (%s), %d indices last frame\n",
+				static_cast<int>(gApp.mLights.size()),
+				gApp.mLightAssignMilliseconds / gApp.mLightAssignCount,
+				ClusteredLighting::GetActivePathName(),
+				static_cast<int>(gApp.mLighting.GetLightIndices().size()));
+		}
+		gApp.mLighting.Destroy();
+		if (GLStats::IsInstalled())
+		{
+			GLStats::PrintReport();
+			GLStats::Uninstall();
+		}
+		GLCapture::End();
 
-		glDeleteProgram(gApp.mGraphicsPipelineShaderProgram);
+		// Everything above still needs the context.
+		SDL_GL_DeleteContext(gApp.mOpenGLContext);
+		gApp.mOpenGLContext = nullptr;
+		SDL_DestroyWindow(gApp.mGraphicsApplicationWindow);
+		gApp.mGraphicsApplicationWindow = nullptr;
 
 		SDL_Quit();
 	}
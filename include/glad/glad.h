@@ -704,6 +704,13 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Like gladLoadGLLoader, but every GL 1.0-4.1 and GL_ARB_* function starts
+ * out as a trampoline that resolves it through 'load' on its first call, so
+ * only the functions actually used are ever looked up. Other extensions'
+ * flags are set but their functions are left NULL. 'load' has to stay valid
+ * for as long as GL is used. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;